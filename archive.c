@@ -37,6 +37,125 @@ Probability Disitribution Function Archive Manager
 #include "fakefloat_xtrn.h"
 #include "lmd2.h"
 
+u8
+archive_bucket(ULONG *archive_size_base, u32 **u32_list_base_base){
+/*
+Append to each PDF in an archive of sorted keys a table produced by fakefloat_u32_list_bucket(), so that Slice can use fakefloat_bucket_to_slice_idx() to skip most of each search, then add ARCHIVE_FLAG_BUCKET to its header flags.
+
+In:
+
+  *archive_size_base is undefined.
+
+  **u32_list_base_base is an archive, such as the output of archive_downsample() after passing through archive_key_encode(), with a valid header, ARCHIVE_FLAG_KEY, and no free slots. It must not have been rearranged by archive_eytzinger().
+
+Out:
+
+  Returns one if out of memory, in which case all outputs are unchanged, else zero.
+
+  *archive_size_base is the new size of the archive.
+
+  *u32_list_base_base has been reallocated and the archive updated as described in the summary. The number of table bits is the number of bits required to express the number of floats per PDF, clamped to [ARCHIVE_BUCKET_BITS_MIN, ARCHIVE_BUCKET_BITS_MAX].
+*/
+  ULONG archive_size;
+  u8 bucket_bits;
+  u8 flags;
+  header_t *header_base;
+  ULONG pdf_count;
+  ULONG pdf_float_count;
+  ULONG pdf_idx;
+  ULONG pdf_slot_count;
+  ULONG pdf_slot_count_old;
+  u8 status;
+  ULONG u32_count;
+  ULONG u32_idx_max;
+  ULONG u32_idx_min;
+  ULONG u32_idx_min_old;
+  u32 *u32_list_base;
+
+  header_base=archive_header_init();
+  status=!header_base;
+  do{
+    if(status){
+      break;
+    }
+    u32_list_base=*u32_list_base_base;
+    archive_header_import(header_base, u32_list_base);
+    flags=archive_header_flags_get(header_base);
+    pdf_count=(ULONG)(header_base->pdf_count);
+    pdf_float_count=(ULONG)(header_base->pdf_float_count);
+    pdf_slot_count_old=(ULONG)(header_base->pdf_slot_count);
+    bucket_bits=0;
+    u32_count=pdf_float_count;
+    while(u32_count){
+      bucket_bits++;
+      u32_count>>=1;
+    }
+    bucket_bits=(u8)(MAX(bucket_bits, ARCHIVE_BUCKET_BITS_MIN));
+    bucket_bits=(u8)(MIN(bucket_bits, ARCHIVE_BUCKET_BITS_MAX));
+    pdf_slot_count=pdf_float_count+((ULONG)(1)<<bucket_bits)+1;
+    status=(pdf_slot_count<pdf_float_count);
+    u32_count=pdf_count*pdf_slot_count;
+    status=(u8)(status|((u32_count/pdf_count)!=pdf_slot_count));
+    u32_idx_max=u32_count+ARCHIVE_HEADER_U32_COUNT-1;
+    status=(u8)(status|(u32_idx_max<u32_count));
+    if(status){
+      break;
+    }
+    status=fakefloat_u32_list_realloc(u32_idx_max, u32_list_base_base);
+    if(status){
+      break;
+    }
+    u32_list_base=*u32_list_base_base;
+/*
+Move the PDFs apart, last one first because the new stride is at least as large as the old one, then build each table in the gap that follows its PDF.
+*/
+    pdf_idx=pdf_count;
+    do{
+      pdf_idx--;
+      u32_idx_min=ARCHIVE_HEADER_U32_COUNT+(pdf_idx*pdf_slot_count);
+      u32_idx_min_old=ARCHIVE_HEADER_U32_COUNT+(pdf_idx*pdf_slot_count_old);
+      memmove(&u32_list_base[u32_idx_min], &u32_list_base[u32_idx_min_old], (size_t)(pdf_float_count<<U32_SIZE_LOG2));
+      u32_idx_max=u32_idx_min+pdf_float_count-1;
+      fakefloat_u32_list_bucket(bucket_bits, u32_idx_max, u32_idx_min, u32_list_base);
+    }while(pdf_idx);
+    archive_header_fill(1, header_base, pdf_float_count, pdf_float_count, pdf_count-1, pdf_slot_count-1, u32_list_base);
+    header_base->signature=ARCHIVE_SIGNATURE+(flags|ARCHIVE_FLAG_BUCKET);
+    archive_size=archive_header_export(header_base, u32_list_base);
+    *archive_size_base=archive_size;
+  }while(0);
+  archive_free(header_base);
+  return status;
+}
+
+u8
+archive_bucket_bits_get(header_t *header_base){
+/*
+Get the number of high key bits which index the tables appended to each PDF by archive_bucket().
+
+In:
+
+  *header_base is an archive header.
+
+Out:
+
+  Returns zero if *header_base lacks ARCHIVE_FLAG_BUCKET, or if the number of free slots per PDF isn't consistent with a table of a supported size. Otherwise, returns the number of bits on [ARCHIVE_BUCKET_BITS_MIN, ARCHIVE_BUCKET_BITS_MAX].
+*/
+  u8 bucket_bits;
+  u8 bucket_bits_local;
+  u64 pdf_free_count;
+
+  bucket_bits=0;
+  if(archive_header_flags_get(header_base)&ARCHIVE_FLAG_BUCKET){
+    pdf_free_count=header_base->pdf_slot_count-header_base->pdf_float_count;
+    for(bucket_bits_local=ARCHIVE_BUCKET_BITS_MIN; bucket_bits_local<=ARCHIVE_BUCKET_BITS_MAX; bucket_bits_local++){
+      if(pdf_free_count==((1ULL<<bucket_bits_local)+1)){
+        bucket_bits=bucket_bits_local;
+      }
+    }
+  }
+  return bucket_bits;
+}
+
 u8
 archive_downsample(ULONG slice_idx_max_idx_max, ULONG *slice_idx_max_list_base, u8 *sort_status_base, u32 *u32_list_base, u32 **u32_list_base_list_base){
 /*
@@ -71,10 +190,8 @@ Out:
   *sort_status_base is one if all of the downsampled archives have sorted PDFs (which could happen even if the same was not true of the source archive), else zero. This is important to know because unsorted PDFs cannot be consumed by Slice.
 */
   ULONG archive_size;
-  u8 exp;
   header_t *header_base;
   ULONG list_size;
-  u32 mantissa;
   ULONG pdf_count;
   ULONG pdf_float_count;
   ULONG pdf_idx;
@@ -84,7 +201,6 @@ Out:
   ULONG *quotient_list_base;
   ULONG remainder;
   ULONG *remainder_list_base;
-  u8 sign_status;
   ULONG slice_count;
   ULONG slice_idx_max;
   ULONG slice_idx_max_idx;
@@ -212,11 +328,8 @@ If we want to divide a PDF in N more-or-less equal slices, then we need only (N-
               u32_idx1++;
               u32_idx_list_base1[slice_idx_max_idx]=u32_idx1;
               if(sort_status){
-                exp=FLOAT_U32_EXP_GET(u32_1);
-                mantissa=FLOAT_U32_MANTISSA_GET(u32_1);
-                sign_status=FLOAT_U32_IS_SIGNED(u32_1);
+                sort_status=(FLOAT_U32_KEY_GET(u32_1)<=FLOAT_U32_KEY_GET(u32_0));
                 u32_1=u32_0;
-                FLOAT_U32_IS_LESS_EQUAL(exp, mantissa, sign_status, u32_0, sort_status);
               }
               remainder=remainder_list_base[slice_idx_max_idx];
               slice_idx_max=slice_idx_max_list_base[slice_idx_max_idx];
@@ -265,6 +378,70 @@ If we want to divide a PDF in N more-or-less equal slices, then we need only (N-
   return status;
 }
 
+u8
+archive_eytzinger(u32 *u32_list_base){
+/*
+Rearrange each PDF in a sorted archive into Eytzinger order so that Slice can use fakefloat_eytzinger_to_slice_idx() or fakefloat_eytzinger_key_to_slice_idx() instead of a binary search, then add ARCHIVE_FLAG_EYTZINGER to its header flags.
+
+In:
+
+  *u32_list_base is an archive, such as the output of archive_downsample(), with a valid header, sorted PDFs, and without ARCHIVE_FLAG_EYTZINGER. It may already have been converted by archive_key_encode().
+
+Out:
+
+  Returns one if out of memory, in which case *u32_list_base is unchanged, else zero.
+
+  *u32_list_base has been rearranged as described in the summary, and its header has been updated accordingly.
+*/
+  u8 flags;
+  header_t *header_base;
+  ULONG pdf_count;
+  ULONG pdf_float_count;
+  ULONG pdf_idx;
+  ULONG pdf_slot_count;
+  u8 status;
+  ULONG u32_idx_max;
+  ULONG u32_idx_min;
+  u32 *u32_list_base1;
+
+  u32_list_base1=NULL;
+  header_base=archive_header_init();
+  status=!header_base;
+  do{
+    if(status){
+      break;
+    }
+    archive_header_import(header_base, u32_list_base);
+    flags=archive_header_flags_get(header_base);
+    pdf_count=(ULONG)(header_base->pdf_count);
+    pdf_float_count=(ULONG)(header_base->pdf_float_count);
+    pdf_slot_count=(ULONG)(header_base->pdf_slot_count);
+    if(pdf_float_count){
+      u32_list_base1=fakefloat_u32_list_malloc(0, pdf_float_count-1);
+      status=!u32_list_base1;
+      if(status){
+        break;
+      }
+      pdf_idx=0;
+      u32_idx_min=ARCHIVE_HEADER_U32_COUNT;
+      do{
+        u32_idx_max=u32_idx_min+pdf_float_count-1;
+        fakefloat_u32_list_eytzinger(u32_idx_max, u32_idx_min, u32_list_base, u32_list_base1);
+        u32_idx_min+=pdf_slot_count;
+      }while((++pdf_idx)!=pdf_count);
+    }
+/*
+The partial LMD2 hashes depend on the order of the floats, so recompute them.
+*/
+    archive_header_fill(1, header_base, pdf_float_count, pdf_float_count, pdf_count-1, pdf_slot_count-1, u32_list_base);
+    header_base->signature=ARCHIVE_SIGNATURE+(flags|ARCHIVE_FLAG_EYTZINGER);
+    archive_header_export(header_base, u32_list_base);
+  }while(0);
+  fakefloat_free(u32_list_base1);
+  archive_free(header_base);
+  return status;
+}
+
 void *
 archive_free(void *base){
 /*
@@ -287,7 +464,7 @@ Out:
 u8
 archive_header_check(u64 archive_size, header_t *header_base, u64 *lmd2_iterand_base, u8 lmd2_iterand_check_status, u64 *lmd2_partial_sum_base, ULONG *pdf_count_base, ULONG *pdf_float_count_base, ULONG *pdf_slot_count_base){
 /*
-Verify the integrity of an archive header, optionally including its cached LMD2 hash iterator, then extract its contents to the output variables.
+Verify the integrity of an archive header, optionally including its cached LMD2 hash iterator, then extract its contents to the output variables. Headers of lookup indexes, whose signatures include ARCHIVE_FLAG_* values, are also accepted, so callers which require sorted floats must check archive_header_flags_get() themselves.
 
 In:
 
@@ -324,6 +501,7 @@ Out:
   u64 i;
   u64 lmd2;
   u32 lmd2_c;
+  u8 flags;
   u64 lmd2_iterand;
   u64 lmd2_iterand_cache;
   u32 lmd2_x;
@@ -336,9 +514,18 @@ Out:
 
   status=1;
   do{
-    if(header_base->signature!=ARCHIVE_SIGNATURE){
+    if(ARCHIVE_FLAG_MAX<(header_base->signature-ARCHIVE_SIGNATURE)){
       break;
     }
+    flags=archive_header_flags_get(header_base);
+    if(flags&ARCHIVE_FLAG_BUCKET){
+      if((flags&ARCHIVE_FLAG_EYTZINGER)||!(flags&ARCHIVE_FLAG_KEY)){
+        break;
+      }
+      if(!archive_bucket_bits_get(header_base)){
+        break;
+      }
+    }
     pdf_float_count=header_base->pdf_float_count;
     pdf_slot_count=header_base->pdf_slot_count;
     if(pdf_slot_count<pdf_float_count){
@@ -525,6 +712,25 @@ Out:
   return;
 }
 
+u8
+archive_header_flags_get(header_t *header_base){
+/*
+Extract the ARCHIVE_FLAG_* values from the signature of an archive header.
+
+In:
+
+  *header_base is an archive header which has passed archive_header_check().
+
+Out:
+
+  Returns the sum of ARCHIVE_FLAG_* values describing the encoding of its PDFs, which is zero for an ordinary archive of sorted or unsorted floats.
+*/
+  u8 flags;
+
+  flags=(u8)(header_base->signature-ARCHIVE_SIGNATURE);
+  return flags;
+}
+
 void
 archive_header_import(header_t *header_base, u32 *u32_list_base){
 /*
@@ -723,7 +929,57 @@ Out:
 
   status=(u8)(build_break_count!=ARCHIVE_BUILD_BREAK_COUNT);
   status=(u8)(status|(ARCHIVE_BUILD_FEATURE_COUNT<build_feature_count));
-  status=(u8)(status|fakefloat_init(FAKEFLOAT_BUILD_BREAK_COUNT_EXPECTED, 0));
+  status=(u8)(status|fakefloat_init(FAKEFLOAT_BUILD_BREAK_COUNT_EXPECTED, 3));
+  return status;
+}
+
+u8
+archive_key_encode(u32 *u32_list_base){
+/*
+Convert each PDF in a sorted archive to order-preserving keys via fakefloat_u32_list_key_encode() so that Slice can search it with unsigned comparisons, then add ARCHIVE_FLAG_KEY to its header flags.
+
+In:
+
+  *u32_list_base is an archive, such as the output of archive_downsample(), with a valid header, sorted PDFs, and without ARCHIVE_FLAG_KEY. It may already have been rearranged by archive_eytzinger().
+
+Out:
+
+  Returns one if out of memory, in which case *u32_list_base is unchanged, else zero.
+
+  *u32_list_base has been converted as described in the summary, and its header has been updated accordingly.
+*/
+  u8 flags;
+  header_t *header_base;
+  ULONG pdf_count;
+  ULONG pdf_float_count;
+  ULONG pdf_idx;
+  ULONG pdf_slot_count;
+  u8 status;
+  ULONG u32_idx_max;
+  ULONG u32_idx_min;
+
+  header_base=archive_header_init();
+  status=!header_base;
+  if(!status){
+    archive_header_import(header_base, u32_list_base);
+    flags=archive_header_flags_get(header_base);
+    pdf_count=(ULONG)(header_base->pdf_count);
+    pdf_float_count=(ULONG)(header_base->pdf_float_count);
+    pdf_slot_count=(ULONG)(header_base->pdf_slot_count);
+    if(pdf_float_count){
+      pdf_idx=0;
+      u32_idx_min=ARCHIVE_HEADER_U32_COUNT;
+      do{
+        u32_idx_max=u32_idx_min+pdf_float_count-1;
+        fakefloat_u32_list_key_encode(u32_idx_max, u32_idx_min, u32_list_base);
+        u32_idx_min+=pdf_slot_count;
+      }while((++pdf_idx)!=pdf_count);
+    }
+    archive_header_fill(1, header_base, pdf_float_count, pdf_float_count, pdf_count-1, pdf_slot_count-1, u32_list_base);
+    header_base->signature=ARCHIVE_SIGNATURE+(flags|ARCHIVE_FLAG_KEY);
+    archive_header_export(header_base, u32_list_base);
+  }
+  archive_free(header_base);
   return status;
 }
 
@@ -19,6 +19,18 @@ You should have received a copy of the GNU Limited General Public
 License version 3 along with the Widebandit Library (filename
 "COPYING"). If not, see http://www.gnu.org/licenses/ .
 */
+/*
+ARCHIVE_BUCKET_BITS_* bound the number of high key bits which index the table appended to each PDF by archive_bucket().
+*/
+#define ARCHIVE_BUCKET_BITS_MAX 16U
+#define ARCHIVE_BUCKET_BITS_MIN 12U
+/*
+An archive whose signature exceeds ARCHIVE_SIGNATURE by a nonzero sum of ARCHIVE_FLAG_* values is an index which is only suitable for lookup. Archives without flags remain readable by everything. See archive_header_flags_get(). ARCHIVE_FLAG_BUCKET requires ARCHIVE_FLAG_KEY and excludes ARCHIVE_FLAG_EYTZINGER.
+*/
+#define ARCHIVE_FLAG_BUCKET 4U
+#define ARCHIVE_FLAG_EYTZINGER 1U
+#define ARCHIVE_FLAG_KEY 2U
+#define ARCHIVE_FLAG_MAX 7U
 #define ARCHIVE_HEADER_SIZE 0x40U
 #define ARCHIVE_HEADER_U32_COUNT 0x10U
 #define ARCHIVE_SIGNATURE 0x9A4AF8F2A5D4295DULL
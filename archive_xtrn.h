@@ -19,15 +19,20 @@ You should have received a copy of the GNU Limited General Public
 License version 3 along with the Widebandit Library (filename
 "COPYING"). If not, see http://www.gnu.org/licenses/ .
 */
+extern u8 archive_bucket(ULONG *archive_size_base, u32 **u32_list_base_base);
+extern u8 archive_bucket_bits_get(header_t *header_base);
 extern u8 archive_downsample(ULONG slice_count_idx_max, ULONG *slice_count_list_base, u8 *sort_status_base, u32 *u32_list_base, u32 **u32_list_base_list_base);
+extern u8 archive_eytzinger(u32 *u32_list_base);
 extern void *archive_free(void *base);
 extern u8 archive_header_check(u64 archive_size, header_t *header_base, u64 *lmd2_iterand_base, u8 lmd2_iterand_check_status, u64 *lmd2_partial_sum_base, ULONG *pdf_count_base, ULONG *pdf_float_count_base, ULONG *pdf_slot_count_base);
 extern ULONG archive_header_export(header_t *header_base, u32 *u32_list_base);
 extern void archive_header_fill(u8 hash_reset_status, header_t *header_base, ULONG pdf_float_count, ULONG pdf_float_count_old, ULONG pdf_idx_max, ULONG pdf_slot_idx_max, u32 *u32_list_base);
+extern u8 archive_header_flags_get(header_t *header_base);
 extern header_t *archive_header_init(void);
 extern u64 archive_header_lmd2_get(header_t *header_base);
 extern void archive_header_import(header_t *header_base, u32 *u32_list_base);
 extern u8 archive_init(u32 build_break_count, u32 build_feature_count);
+extern u8 archive_key_encode(u32 *u32_list_base);
 extern u32 **archive_list_free(ULONG u32_count_idx_max, u32 **u32_list_base_list_base);
 extern u32 **archive_list_malloc(ULONG pdf_count, ULONG u32_count_idx_max, ULONG *u32_count_list_base);
 extern void archive_lmd2_u64_digest(u64 *lmd2, u32 *lmd2_c_base, u32 *lmd2_x_base, u64 *lmd2_iterand_base, u64 u64_0);
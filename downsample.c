@@ -94,6 +94,7 @@ main(int argc, char *argv[]){
   u32 *archive_u32_list_base;
   ULONG arg_idx;
   int descriptor;
+  u8 flags;
   u8 emit_mode;
   u8 filesys_status;
   header_t *header_base;
@@ -115,7 +116,7 @@ main(int argc, char *argv[]){
   u32 *u32_list_base;
   u32 **u32_list_base_list_base;
 
-  status=archive_init(ARCHIVE_BUILD_BREAK_COUNT_EXPECTED, 0);
+  status=archive_init(ARCHIVE_BUILD_BREAK_COUNT_EXPECTED, 3);
   status=(u8)(status|ascii_init(ASCII_BUILD_BREAK_COUNT_EXPECTED, 0));
   status=(u8)(status|filesys_init(FILESYS_BUILD_BREAK_COUNT_EXPECTED, 5));
   archive_u32_list_base=NULL;
@@ -130,12 +131,12 @@ main(int argc, char *argv[]){
       break;
     }
     status=1;
-    if((argc<5)||!(argc&1)){
+    if(argc<5){
       EMIT_WRITE("Downsample\nCopyright 2021 Russell Leidich\nhttps://github.com/egione/Widebandit");
-      EMIT_WRITE("Build 1");
+      EMIT_WRITE("Build 4");
       EMIT_WRITE("Samples probability distribution functions at roughly regular intervals.");
       EMIT_WRITE("Syntax:\n");
-      EMIT_WRITE("  downsample verbosity sfy_file index_file0 width0 [index_file1 width1]...\n");
+      EMIT_WRITE("  downsample verbosity sfy_file index_file0 width0 [index_file1 width1]... [layout]\n");
       EMIT_WRITE("where:\n");
       EMIT_WRITE("  (verbosity) is one of:\n");
       EMIT_WRITE("    0: Report only errors.\n");
@@ -147,6 +148,16 @@ main(int argc, char *argv[]){
       EMIT_WRITE("  (width0) is the downsample resolution, that is, the number of floats per new");
       EMIT_WRITE("  PDF. Note that N floats imply (N+1) regions (slices).\n");
       EMIT_WRITE("  ...and so on with [(index_file1) (width1)] etc.\n");
+      EMIT_WRITE("  (layout), if present, is the sum of any of the following, which make lookups");
+      EMIT_WRITE("  faster, but then only Slice can read the index files:\n");
+      EMIT_WRITE("    1: Store each PDF in Eytzinger (breadth-first binary tree) order, which");
+      EMIT_WRITE("       Slice can search with far fewer cache misses.\n");
+      EMIT_WRITE("    2: Store each float as an order-preserving integer key, so that Slice can");
+      EMIT_WRITE("       compare them as plain integers.\n");
+      EMIT_WRITE("    4: Append to each PDF a table which maps the high bits of a key to the few");
+      EMIT_WRITE("       slices it could fall into, so Slice rarely needs to search. Implies 2.");
+      EMIT_WRITE("       Can't be combined with 1. Adds up to 256KiB per PDF.\n");
+      EMIT_WRITE("  The default is zero, which stores sorted floats.\n");
       break;
     }
     arg_idx=0;
@@ -172,6 +183,28 @@ main(int argc, char *argv[]){
 Increment emit_mode because we provide 3 levels, whereas emit.h provides 4. The difference is that we don't have any need for priority zero (critical) messages.
 */
     emit_mode++;
+/*
+An even argument count implies a trailing (layout) parameter after the (index_file) and (width) pairs.
+*/
+    flags=0;
+    if(!(argc&1)){
+      argc--;
+      parameter_text_base=argv[argc];
+      status=ascii_decimal_to_u64_convert(parameter_text_base, &parameter, ARCHIVE_FLAG_MAX);
+      if(status){
+        downsample_parameter_error_print(emit_mode, "layout");
+        break;
+      }
+      status=1;
+      flags=(u8)(parameter);
+      if(flags&ARCHIVE_FLAG_BUCKET){
+        if(flags&ARCHIVE_FLAG_EYTZINGER){
+          downsample_parameter_error_print(emit_mode, "layout");
+          break;
+        }
+        flags|=ARCHIVE_FLAG_KEY;
+      }
+    }
     sfy_pathname_base=argv[2];
     filesys_status=filesys_file_mem_map(&descriptor, &archive_size_u64, sfy_pathname_base, (void **)(&archive_u32_list_base), 0);
     if(filesys_status){
@@ -194,6 +227,10 @@ Increment emit_mode because we provide 3 levels, whereas emit.h provides 4. The
       break;
     }
     status=1;
+    if(archive_header_flags_get(header_base)){
+      downsample_error_print(emit_mode, "(sfy_file) is a lookup index, which can't be downsampled");
+      break;
+    }
 /*
 Each width parameter is a count of (u32)s to appear in a corresponding downsampled archive. The maximum index of such widths is the number of them less one, which can be computed from the commandline argument count (argc) and saved into u32_count_idx_max.
 */
@@ -245,6 +282,57 @@ Each width parameter is a count of (u32)s to appear in a corresponding downsampl
     status=1;
     if(!sort_status){
       downsample_warning_print(emit_mode, "(sfy_file) is not optimized, so downsampled output file cannot be used for lookup");
+      if(flags){
+        downsample_warning_print(emit_mode, "Ignoring (layout) because it requires sorted PDFs");
+        flags=0;
+      }
+    }
+    if(flags&ARCHIVE_FLAG_EYTZINGER){
+      downsample_progress_print(emit_mode, "Rearranging PDFs into Eytzinger order...");
+      u32_count_idx=0;
+      do{
+        u32_list_base=u32_list_base_list_base[u32_count_idx];
+        status=archive_eytzinger(u32_list_base);
+        if(status){
+          break;
+        }
+      }while((u32_count_idx++)!=u32_count_idx_max);
+      if(status){
+        downsample_out_of_memory_print(emit_mode);
+        break;
+      }
+      status=1;
+    }
+    if(flags&ARCHIVE_FLAG_KEY){
+      downsample_progress_print(emit_mode, "Converting floats to keys...");
+      u32_count_idx=0;
+      do{
+        u32_list_base=u32_list_base_list_base[u32_count_idx];
+        status=archive_key_encode(u32_list_base);
+        if(status){
+          break;
+        }
+      }while((u32_count_idx++)!=u32_count_idx_max);
+      if(status){
+        downsample_out_of_memory_print(emit_mode);
+        break;
+      }
+      status=1;
+    }
+    if(flags&ARCHIVE_FLAG_BUCKET){
+      downsample_progress_print(emit_mode, "Building bucket tables...");
+      u32_count_idx=0;
+      do{
+        status=archive_bucket(&u32_count_list_base[u32_count_idx], &u32_list_base_list_base[u32_count_idx]);
+        if(status){
+          break;
+        }
+      }while((u32_count_idx++)!=u32_count_idx_max);
+      if(status){
+        downsample_out_of_memory_print(emit_mode);
+        break;
+      }
+      status=1;
     }
     filesys_status=filesys_file_mem_unmap(descriptor, archive_size_u64, archive_u32_list_base);
     if(filesys_status){
@@ -34,6 +34,192 @@ License version 3 along with the Widebandit Library (filename
 #include "fakefloat_xtrn.h"
 #include "lmd2.h"
 
+u32
+fakefloat_bucket_to_slice_idx(u8 bucket_bits, ULONG slice_idx_max, ULONG slice_idx_min, u32 u32_key0, u32 *u32_list_base){
+/*
+Equivalent to fakefloat_key_to_slice_idx(), but first narrows the search to the range of slice indexes that the high bits of the key can reach, using a table built by fakefloat_u32_list_bucket(). If that range is empty, then no search is required at all.
+
+In:
+
+  bucket_bits is the number of high key bits which index the table, as passed to fakefloat_u32_list_bucket().
+
+  slice_idx_max is the index of the last key in a particular PDF at *u32_list_base. (slice_idx_max-slice_idx_min) must not exceed (U32_MAX-1) because if it did then the return value could wrap 32 bits.
+
+  slice_idx_min is the index of the first key in the same PDF.
+
+  u32_key0 is FLOAT_U32_KEY_GET() of the fakefloat for which to return the slice index.
+
+  *u32_list_base is a sorted list of keys which are defined on the index range [slice_idx_min, slice_idx_max], followed immediately by the table.
+
+Out:
+
+  Returns the same value as fakefloat_key_to_slice_idx() would have returned.
+*/
+  ULONG bucket_idx;
+  u32 slice_idx;
+  u32 slice_idx_max_local;
+  u32 slice_idx_min_local;
+
+  bucket_idx=slice_idx_max+1+(u32_key0>>(U32_BITS-bucket_bits));
+  slice_idx_min_local=u32_list_base[bucket_idx];
+  slice_idx_max_local=u32_list_base[bucket_idx+1];
+  slice_idx=slice_idx_min_local;
+  if(slice_idx_min_local!=slice_idx_max_local){
+    slice_idx_max=slice_idx_min+slice_idx_max_local-1;
+    slice_idx_min+=slice_idx_min_local;
+    slice_idx+=fakefloat_key_to_slice_idx(slice_idx_max, slice_idx_min, u32_key0, u32_list_base);
+  }
+  return slice_idx;
+}
+
+u32
+fakefloat_eytzinger_idx_to_slice_idx(ULONG eytzinger_idx, u8 level, ULONG u32_count){
+/*
+Convert a node of an implicit tree produced by fakefloat_u32_list_eytzinger() back to its index prior to being rearranged.
+
+In:
+
+  eytzinger_idx is the one-based index of the node, or zero to indicate that no node was found.
+
+  level is the depth of the node, which is the index of the most significant one bit of eytzinger_idx. Ignored if eytzinger_idx is zero.
+
+  u32_count is the number of nodes in the tree.
+
+Out:
+
+  Returns u32_count if eytzinger_idx is zero, else the sorted index of the node, on [0, (u32_count-1)].
+*/
+  u8 level_max;
+  ULONG slice_count;
+  ULONG slice_idx;
+  ULONG slice_idx_half;
+
+  slice_idx=u32_count;
+  if(eytzinger_idx){
+/*
+If the tree had no holes on its last level (level_max), the in-order index of the node at position P on level L would be ((2P+1)*2^(level_max-L)-1). Subtract the number of missing last level nodes which would have preceded it.
+*/
+    level_max=0;
+    slice_count=u32_count;
+    while(slice_count>>=1){
+      level_max++;
+    }
+    slice_count=u32_count-((ULONG)(1)<<level_max)+1;
+    slice_idx=eytzinger_idx-((ULONG)(1)<<level);
+    slice_idx=(((slice_idx<<1)+1)<<(level_max-level))-1;
+    slice_idx_half=(slice_idx+1)>>1;
+    if(slice_count<slice_idx_half){
+      slice_idx-=slice_idx_half-slice_count;
+    }
+  }
+  return (u32)(slice_idx);
+}
+
+u32
+fakefloat_eytzinger_key_to_slice_idx(ULONG slice_idx_max, ULONG slice_idx_min, u32 u32_key0, u32 *u32_list_base){
+/*
+Equivalent to fakefloat_eytzinger_to_slice_idx(), but for a PDF which has also been converted by fakefloat_u32_list_key_encode(), so each probe is a plain unsigned comparison.
+
+In:
+
+  slice_idx_max is the index of the last key in a particular PDF at *u32_list_base. (slice_idx_max-slice_idx_min) must not exceed (U32_MAX-1) because if it did then the return value could wrap 32 bits.
+
+  slice_idx_min is the index of the first key in the same PDF.
+
+  u32_key0 is FLOAT_U32_KEY_GET() of the fakefloat for which to return the slice index.
+
+  *u32_list_base is a list of keys which are defined on the index range [slice_idx_min, slice_idx_max] and are in Eytzinger order.
+
+Out:
+
+  Returns the same value as fakefloat_key_to_slice_idx() would have returned prior to the PDF being rearranged.
+*/
+  ULONG eytzinger_idx;
+  ULONG eytzinger_idx_found;
+  u8 level;
+  u8 level_found;
+  ULONG mask;
+  u32 slice_idx;
+  ULONG u32_count;
+  ULONG u32_idx_base;
+  u32 u32_key1;
+
+  u32_count=slice_idx_max-slice_idx_min+1;
+  u32_idx_base=slice_idx_min-1;
+  eytzinger_idx=1;
+  eytzinger_idx_found=0;
+  level=0;
+  level_found=0;
+  do{
+    FLOAT_U32_PREFETCH(&u32_list_base[u32_idx_base+(eytzinger_idx<<4)]);
+    FLOAT_U32_PREFETCH(&u32_list_base[u32_idx_base+(eytzinger_idx<<4)+15]);
+    u32_key1=u32_list_base[u32_idx_base+eytzinger_idx];
+    mask=(ULONG)(u32_key1<u32_key0)-1;
+    eytzinger_idx_found=(eytzinger_idx_found&~mask)|(eytzinger_idx&mask);
+    level_found=(u8)((level_found&~mask)|(level&mask));
+    eytzinger_idx=(eytzinger_idx<<1)+(ULONG)(u32_key1<u32_key0);
+    level++;
+  }while(eytzinger_idx<=u32_count);
+  slice_idx=fakefloat_eytzinger_idx_to_slice_idx(eytzinger_idx_found, level_found, u32_count);
+  return slice_idx;
+}
+
+u32
+fakefloat_eytzinger_to_slice_idx(ULONG slice_idx_max, ULONG slice_idx_min, u32 u32_0, u32 *u32_list_base){
+/*
+Equivalent to fakefloat_to_slice_idx(), but for a PDF which has been rearranged by fakefloat_u32_list_eytzinger(). The search descends the implicit tree without branching on the comparison, and the top few levels share a handful of cache lines no matter how wide the PDF.
+
+In:
+
+  slice_idx_max is the index of the last fakefloat in a particular PDF at *u32_list_base. (slice_idx_max-slice_idx_min) must not exceed (U32_MAX-1) because if it did then the return value could wrap 32 bits.
+
+  slice_idx_min is the index of the first fakefloat in the same PDF.
+
+  u32_0 is the fakefloat for which to return the slice index.
+
+  *u32_list_base is a list of fakefloats which are defined on the index range [slice_idx_min, slice_idx_max] and are in Eytzinger order.
+
+Out:
+
+  Returns the same value as fakefloat_to_slice_idx() would have returned prior to the PDF being rearranged.
+*/
+  ULONG eytzinger_idx;
+  ULONG eytzinger_idx_found;
+  u8 level;
+  u8 level_found;
+  ULONG mask;
+  u32 slice_idx;
+  ULONG u32_count;
+  ULONG u32_idx_base;
+  u32 u32_key0;
+  u32 u32_key1;
+
+  u32_count=slice_idx_max-slice_idx_min+1;
+/*
+Node eytzinger_idx, which is one-based, lives at (u32_list_base[u32_idx_base+eytzinger_idx]). Each step goes right if the node is less than u32_0, else left, in which case the node becomes the best candidate so far. The candidate and its level are retained by masking rather than branching.
+
+Because the comparison doesn't predict the next load, request the 16 great-great-grandchildren of the current node, which are contiguous, in advance. They might straddle 2 cache lines, so touch both ends. Prefetches past the end of the PDF are harmless.
+*/
+  u32_idx_base=slice_idx_min-1;
+  u32_key0=FLOAT_U32_KEY_GET(u32_0);
+  eytzinger_idx=1;
+  eytzinger_idx_found=0;
+  level=0;
+  level_found=0;
+  do{
+    FLOAT_U32_PREFETCH(&u32_list_base[u32_idx_base+(eytzinger_idx<<4)]);
+    FLOAT_U32_PREFETCH(&u32_list_base[u32_idx_base+(eytzinger_idx<<4)+15]);
+    u32_key1=FLOAT_U32_KEY_GET(u32_list_base[u32_idx_base+eytzinger_idx]);
+    mask=(ULONG)(u32_key1<u32_key0)-1;
+    eytzinger_idx_found=(eytzinger_idx_found&~mask)|(eytzinger_idx&mask);
+    level_found=(u8)((level_found&~mask)|(level&mask));
+    eytzinger_idx=(eytzinger_idx<<1)+(ULONG)(u32_key1<u32_key0);
+    level++;
+  }while(eytzinger_idx<=u32_count);
+  slice_idx=fakefloat_eytzinger_idx_to_slice_idx(eytzinger_idx_found, level_found, u32_count);
+  return slice_idx;
+}
+
 void *
 fakefloat_free(void *base){
 /*
@@ -90,6 +276,45 @@ Out:
   return status;
 }
 
+u32
+fakefloat_key_to_slice_idx(ULONG slice_idx_max, ULONG slice_idx_min, u32 u32_key0, u32 *u32_list_base){
+/*
+Equivalent to fakefloat_to_slice_idx(), but for a PDF which has been converted by fakefloat_u32_list_key_encode(). The search halves the remaining range with a mask rather than a branch, so its running time doesn't depend on the outcome of any comparison. Because nothing is speculated, both candidates for the next probe are prefetched instead.
+
+In:
+
+  slice_idx_max is the index of the last key in a particular PDF at *u32_list_base. (slice_idx_max-slice_idx_min) must not exceed (U32_MAX-1) because if it did then the return value could wrap 32 bits.
+
+  slice_idx_min is the index of the first key in the same PDF.
+
+  u32_key0 is FLOAT_U32_KEY_GET() of the fakefloat for which to return the slice index.
+
+  *u32_list_base is a sorted list of keys which are defined on the index range [slice_idx_min, slice_idx_max].
+
+Out:
+
+  Returns the number of keys less than u32_key0, which is the same value that fakefloat_to_slice_idx() would have returned prior to the PDF being converted.
+*/
+  ULONG mask;
+  ULONG slice_count;
+  ULONG slice_count_half;
+  ULONG slice_idx;
+  u32 slice_idx_local;
+
+  slice_count=slice_idx_max-slice_idx_min+1;
+  slice_idx=slice_idx_min;
+  while(1<slice_count){
+    slice_count_half=slice_count>>1;
+    FLOAT_U32_PREFETCH(&u32_list_base[slice_idx+(slice_count_half>>1)]);
+    FLOAT_U32_PREFETCH(&u32_list_base[slice_idx+slice_count_half+(slice_count_half>>1)]);
+    mask=0-(ULONG)(u32_list_base[slice_idx+slice_count_half]<u32_key0);
+    slice_idx+=slice_count_half&mask;
+    slice_count-=slice_count_half;
+  }
+  slice_idx_local=(u32)(slice_idx-slice_idx_min)+(u32)(u32_list_base[slice_idx]<u32_key0);
+  return slice_idx_local;
+}
+
 u32
 fakefloat_to_slice_idx(ULONG slice_idx_max, ULONG slice_idx_min, u32 u32_0, u32 *u32_list_base){
 /*
@@ -109,27 +334,23 @@ Out:
 
   Returns the slice index of u32_0 according to the rules stated in the summary. On [0, (slice_idx_max+1)].
 */
-  u8 exp;
-  u32 mantissa;
-  u8 sign_status;
   ULONG slice_idx;
   u32 slice_idx_local;
-  u8 status;
-  u32 u32_1;
+  u32 u32_key0;
+  u32 u32_key1;
 
-  exp=FLOAT_U32_EXP_GET(u32_0);
-  mantissa=FLOAT_U32_MANTISSA_GET(u32_0);
-  sign_status=FLOAT_U32_IS_SIGNED(u32_0);
-  u32_1=u32_list_base[slice_idx_max];
-  FLOAT_U32_IS_LESS_EQUAL(exp, mantissa, sign_status, u32_1, status);
+/*
+Compare order-preserving keys rather than decoding the IEEE754 fields of each probe.
+*/
+  u32_key0=FLOAT_U32_KEY_GET(u32_0);
+  u32_key1=FLOAT_U32_KEY_GET(u32_list_base[slice_idx_max]);
   slice_idx_local=(u32)(slice_idx_min);
-  if(status){  
+  if(u32_key0<=u32_key1){
     slice_idx_local=(u32)(slice_idx_min);
     do{
       slice_idx=slice_idx_min+((slice_idx_max-slice_idx_min)>>1);
-      u32_1=u32_list_base[slice_idx];
-      FLOAT_U32_IS_LESS_EQUAL(exp, mantissa, sign_status, u32_1, status);
-      if(status){
+      u32_key1=FLOAT_U32_KEY_GET(u32_list_base[slice_idx]);
+      if(u32_key0<=u32_key1){
         slice_idx_max=slice_idx;
       }else{
         slice_idx_min=slice_idx+1;
@@ -142,6 +363,42 @@ Out:
   return slice_idx_local;
 }
 
+void
+fakefloat_u32_list_bucket(u8 bucket_bits, ULONG u32_idx_max, ULONG u32_idx_min, u32 *u32_list_base){
+/*
+Build a table which maps the high bits of a key to the range of indexes in a sorted list of keys that it could fall between, for use with fakefloat_bucket_to_slice_idx().
+
+In:
+
+  bucket_bits is the number of high key bits with which to index the table. On [1, (U32_BITS-1)].
+
+  u32_idx_max is the index of the last key at u32_list_base.
+
+  u32_idx_min is the index of the first key at u32_list_base.
+
+  *u32_list_base contains (u32_idx_max-u32_idx_min+1) keys sorted ascending, followed by ((2^bucket_bits)+1) undefined (u32)s to hold the table.
+
+Out:
+
+  Entry N of the table at (u32_list_base[u32_idx_max+1]) is the number of keys whose high bits are less than N. Thus keys with high bits equal to N can only occur on [entry N, (entry (N+1))-1], relative to u32_idx_min.
+*/
+  ULONG bucket_idx;
+  ULONG bucket_idx_max;
+  u8 bucket_shift;
+  ULONG u32_idx;
+
+  bucket_idx_max=(ULONG)(1)<<bucket_bits;
+  bucket_shift=(u8)(U32_BITS-bucket_bits);
+  u32_idx=u32_idx_min;
+  for(bucket_idx=0; bucket_idx<=bucket_idx_max; bucket_idx++){
+    while((u32_idx<=u32_idx_max)&&((u32_list_base[u32_idx]>>bucket_shift)<bucket_idx)){
+      u32_idx++;
+    }
+    u32_list_base[u32_idx_max+1+bucket_idx]=(u32)(u32_idx-u32_idx_min);
+  }
+  return;
+}
+
 u8
 fakefloat_u32_list_check(u32 *checksum_base, u64 *lmd2_iterand_base, u64 *lmd2_partial_base, u8 *sort_status_base, ULONG u32_idx_max, ULONG u32_idx_min, ULONG *u32_idx_min_infinity_base, ULONG *u32_idx_min_nan_base, ULONG *u32_idx_min_negative_base, ULONG *u32_idx_min_subnormal_base, ULONG *u32_idx_min_zero_minus_base, ULONG *u32_idx_min_zero_plus_base, u32 *u32_list_base){
 /*
@@ -324,6 +581,60 @@ Out:
   return u32_idx_min_nonzero;
 }
 
+void
+fakefloat_u32_list_eytzinger(ULONG u32_idx_max, ULONG u32_idx_min, u32 *u32_list_base0, u32 *u32_list_base1){
+/*
+Rearrange a sorted list of fakefloats into Eytzinger order, which is the breadth-first order of an implicit balanced binary search tree, for use with fakefloat_eytzinger_to_slice_idx().
+
+In:
+
+  u32_idx_max is the index of the last (u32) to rearrange at u32_list_base0.
+
+  u32_idx_min is the index of the first (u32) to rearrange at u32_list_base0.
+
+  *u32_list_base0 contains (u32_idx_max-u32_idx_min+1) fakefloats sorted consistent with fakefloat_u32_list_sort_check().
+
+  *u32_list_base1 is undefined and writable for (u32_idx_max-u32_idx_min+1) (u32)s.
+
+Out:
+
+  *u32_list_base0 is rearranged on [u32_idx_min, u32_idx_max] such that the node with one-based index N has children (2N) and (2N+1).
+
+  *u32_list_base1 is undefined.
+*/
+  ULONG eytzinger_idx;
+  ULONG u32_count;
+  ULONG u32_idx;
+  ULONG u32_idx_base;
+
+  u32_count=u32_idx_max-u32_idx_min+1;
+  memcpy(u32_list_base1, &u32_list_base0[u32_idx_min], (size_t)(u32_count<<U32_SIZE_LOG2));
+/*
+Visit the nodes in order, starting from the leftmost one, so that they consume the sorted fakefloats in order.
+*/
+  u32_idx_base=u32_idx_min-1;
+  eytzinger_idx=1;
+  while((eytzinger_idx<<1)<=u32_count){
+    eytzinger_idx<<=1;
+  }
+  u32_idx=0;
+  do{
+    u32_list_base0[u32_idx_base+eytzinger_idx]=u32_list_base1[u32_idx];
+    if(((eytzinger_idx<<1)+1)<=u32_count){
+      eytzinger_idx=(eytzinger_idx<<1)+1;
+      while((eytzinger_idx<<1)<=u32_count){
+        eytzinger_idx<<=1;
+      }
+    }else{
+      while(eytzinger_idx&1){
+        eytzinger_idx>>=1;
+      }
+      eytzinger_idx>>=1;
+    }
+  }while((++u32_idx)!=u32_count);
+  return;
+}
+
 u8
 fakefloat_u32_list_find(u32 u32_0, ULONG u32_idx_max, ULONG *u32_idx_min_base, u32 *u32_list_base){
 /*
@@ -582,6 +893,56 @@ Out:
   return;
 }
 
+void
+fakefloat_u32_list_key_decode(ULONG u32_idx_max, ULONG u32_idx_min, u32 *u32_list_base){
+/*
+Convert a list of keys produced by fakefloat_u32_list_key_encode() back to fakefloats.
+
+In:
+
+  u32_idx_max is the index of the last key to convert at u32_list_base.
+
+  u32_idx_min is the index of the first key to convert at u32_list_base.
+
+  *u32_list_base contains (u32_idx_max-u32_idx_min+1) keys.
+
+Out:
+
+  *u32_list_base contains the corresponding fakefloats on [u32_idx_min, u32_idx_max], except that negative zeroes have become positive zeroes.
+*/
+  ULONG u32_idx;
+
+  for(u32_idx=u32_idx_min; u32_idx<=u32_idx_max; u32_idx++){
+    u32_list_base[u32_idx]=FLOAT_U32_FROM_KEY(u32_list_base[u32_idx]);
+  }
+  return;
+}
+
+void
+fakefloat_u32_list_key_encode(ULONG u32_idx_max, ULONG u32_idx_min, u32 *u32_list_base){
+/*
+Convert a list of fakefloats to their order-preserving keys via FLOAT_U32_KEY_GET(), so that they can be compared as unsigned integers.
+
+In:
+
+  u32_idx_max is the index of the last fakefloat to convert at u32_list_base.
+
+  u32_idx_min is the index of the first fakefloat to convert at u32_list_base.
+
+  *u32_list_base contains (u32_idx_max-u32_idx_min+1) fakefloats.
+
+Out:
+
+  *u32_list_base contains the corresponding keys on [u32_idx_min, u32_idx_max].
+*/
+  ULONG u32_idx;
+
+  for(u32_idx=u32_idx_min; u32_idx<=u32_idx_max; u32_idx++){
+    u32_list_base[u32_idx]=FLOAT_U32_KEY_GET(u32_list_base[u32_idx]);
+  }
+  return;
+}
+
 u32 *
 fakefloat_u32_list_malloc(u8 empty_status, ULONG u32_idx_max){
 /*
@@ -769,24 +1130,21 @@ Out:
 
   Returns one if the values are consistent with a possible output of fake_float_u32_list_sort(), else zero.
 */
-  u8 exp;
-  u32 mantissa;
-  u8 sign_status;
   u8 status;
-  u32 u32_0;
-  u32 u32_1;
   ULONG u32_idx;
+  u32 u32_key0;
+  u32 u32_key1;
 
+/*
+FLOAT_U32_KEY_GET(U32_MAX) is zero, so the first comparison always succeeds.
+*/
   status=1;
-  u32_1=U32_MAX;
+  u32_key1=FLOAT_U32_KEY_GET(U32_MAX);
   u32_idx=u32_idx_min;
   do{
-    u32_0=u32_list_base[u32_idx];
-    exp=FLOAT_U32_EXP_GET(u32_1);
-    mantissa=FLOAT_U32_MANTISSA_GET(u32_1);
-    sign_status=FLOAT_U32_IS_SIGNED(u32_1);
-    u32_1=u32_0;
-    FLOAT_U32_IS_LESS_EQUAL(exp, mantissa, sign_status, u32_0, status);
+    u32_key0=FLOAT_U32_KEY_GET(u32_list_base[u32_idx]);
+    status=(u32_key1<=u32_key0);
+    u32_key1=u32_key0;
   }while(status&&((u32_idx++)!=u32_idx_max));
   return status;
 }
@@ -24,6 +24,8 @@ License version 3 along with the Widebandit Library (filename
 */
 #define FLOAT_U32_EXP_GET(_float) (u8)((_float)>>23)
 
+#define FLOAT_U32_FROM_KEY(_key) ((u32)(_key)^((0U-(((u32)(_key)>>31)^1U))|0x80000000U))
+
 #define FLOAT_U32_GET(_exp, _mantissa, _sign) (((u32)(_exp)<<23)|(_mantissa)|((u32)(_sign)<<31))
 
 #define FLOAT_U32_IS_GREATER(_exp, _mantissa, _sign, _target, _status) \
@@ -148,8 +150,19 @@ License version 3 along with the Widebandit Library (filename
 
 #define FLOAT_U32_IS_SUBNORMAL(_float) (u8)((!(u8)((_float)>>23))&&((_float)&0x7FFFFF))
 
+/*
+FLOAT_U32_KEY_GET() maps a fakefloat to its order-preserving key, whose unsigned order matches the order implied by FLOAT_U32_IS_LESS_EQUAL() and friends: the sign bit is flipped for positives, and all bits are flipped for negatives. Negative zero is first replaced by positive zero because they compare equal. FLOAT_U32_FROM_KEY() is the inverse, apart from negative zero.
+*/
+#define FLOAT_U32_KEY_GET(_float) (((u32)(_float)^((0U-((u32)(_float)>>31))|0x80000000U))+(u32)((u32)(_float)==0x80000000U))
+
 #define FLOAT_U32_MANTISSA_GET(_float) ((_float)&0x7FFFFF)
 
+#ifdef __GNUC__
+  #define FLOAT_U32_PREFETCH(_base) __builtin_prefetch(_base)
+#else
+  #define FLOAT_U32_PREFETCH(_base)
+#endif
+
 #define FLOAT_U32_UNSIGNED_GET(_exp, _mantissa) (((u32)(_exp)<<23)|(_mantissa))
 
 #define FLOAT_U32_UNSIGNED_IS_GREATER(_exp, _mantissa, _target, _status) \
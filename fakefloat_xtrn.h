@@ -19,17 +19,26 @@ You should have received a copy of the GNU Limited General Public
 License version 3 along with the Widebandit Library (filename
 "COPYING"). If not, see http://www.gnu.org/licenses/ .
 */
+extern u32 fakefloat_bucket_to_slice_idx(u8 bucket_bits, ULONG slice_idx_max, ULONG slice_idx_min, u32 u32_key0, u32 *u32_list_base);
+extern u32 fakefloat_eytzinger_idx_to_slice_idx(ULONG eytzinger_idx, u8 level, ULONG u32_count);
+extern u32 fakefloat_eytzinger_key_to_slice_idx(ULONG slice_idx_max, ULONG slice_idx_min, u32 u32_key0, u32 *u32_list_base);
+extern u32 fakefloat_eytzinger_to_slice_idx(ULONG slice_idx_max, ULONG slice_idx_min, u32 u32_0, u32 *u32_list_base);
 extern void *fakefloat_free(void *base);
 extern ULONG *fakefloat_freq_list_malloc(void);
 extern u8 fakefloat_init(u32 build_break_count, u32 build_feature_count);
+extern u32 fakefloat_key_to_slice_idx(ULONG slice_idx_max, ULONG slice_idx_min, u32 u32_key0, u32 *u32_list_base);
 extern u32 fakefloat_to_slice_idx(ULONG slice_idx_max, ULONG slice_idx_min, u32 u32_0, u32 *slice_list_base);
+extern void fakefloat_u32_list_bucket(u8 bucket_bits, ULONG u32_idx_max, ULONG u32_idx_min, u32 *u32_list_base);
 extern u8 fakefloat_u32_list_check(u32 *checksum_base, u64 *lmd2_iterand_base, u64 *lmd2_partial_base, u8 *sort_status_base, ULONG u32_idx_max, ULONG u32_idx_min, ULONG *u32_idx_min_infinity_base, ULONG *u32_idx_min_nan_base, ULONG *u32_idx_min_negative_base, ULONG *u32_idx_min_subnormal_base, ULONG *u32_idx_min_zero_minus_base, ULONG *u32_idx_min_zero_plus_base, u32 *u32_list_base);
 extern ULONG fakefloat_u32_list_empty_check(ULONG u32_idx_max, ULONG u32_idx_min, u32 *u32_list_base);
+extern void fakefloat_u32_list_eytzinger(ULONG u32_idx_max, ULONG u32_idx_min, u32 *u32_list_base0, u32 *u32_list_base1);
 extern u8 fakefloat_u32_list_find(u32 u32_0, ULONG u32_idx_max, ULONG *u32_idx_min_base, u32 *u32_list_base);
 extern u64 fakefloat_u32_list_hash(u64 *lmd2_iterand_base, ULONG u32_idx_max, ULONG u32_idx_min, u32 *u32_list_base);
 extern void fakefloat_u32_list_inject(ULONG block_idx_max, ULONG from_u32_idx_min, u32 *from_u32_list_base, ULONG inject_u32_count, ULONG to_block_u32_count, ULONG to_u32_idx_min, u32 *to_u32_list_base);
 extern void fakefloat_u32_list_interleave(ULONG block_idx_max, ULONG interleave_u32_count, ULONG to_block_u32_count, ULONG to_block_u32_count_new, ULONG to_u32_idx_min, u32 *to_u32_list_base);
 extern void fakefloat_u32_list_interleave_inject(ULONG block_idx_max, ULONG from_u32_idx_min, u32 *from_u32_list_base, ULONG inject_u32_count, ULONG interleave_u32_count, ULONG to_block_u32_count, ULONG to_block_u32_count_new, ULONG to_u32_idx_min, u32 *to_u32_list_base);
+extern void fakefloat_u32_list_key_decode(ULONG u32_idx_max, ULONG u32_idx_min, u32 *u32_list_base);
+extern void fakefloat_u32_list_key_encode(ULONG u32_idx_max, ULONG u32_idx_min, u32 *u32_list_base);
 extern u32 *fakefloat_u32_list_malloc(u8 empty_status, ULONG u32_idx_max);
 extern u8 fakefloat_u32_list_realloc(ULONG u32_idx_max, u32 **u32_list_base_base);
 extern void fakefloat_u32_list_sort(ULONG *freq_list_base, u8 sign_status, ULONG u32_idx_max, u32 *u32_list_base0, u32 *u32_list_base1);
@@ -29,8 +29,8 @@ This value is set to the sum of breakage events in the source code of this libra
 
 When calling the initialization code for this library, always use the corresponding constant ending in "_EXPECTED". This will force a runtime error, in addition to a build error below, if the programmer fails to notice subordinate build breakages which may affect the correctness of transactions with this library.
 */
-#define TRANSFORM_BUILD_BREAK_COUNT (0+FRU128_BUILD_BREAK_COUNT+FRU64_BUILD_BREAK_COUNT)
-#define TRANSFORM_BUILD_BREAK_COUNT_EXPECTED 6
+#define TRANSFORM_BUILD_BREAK_COUNT (3+FILESYS_BUILD_BREAK_COUNT+FRU128_BUILD_BREAK_COUNT+FRU64_BUILD_BREAK_COUNT+THREAD_BUILD_BREAK_COUNT)
+#define TRANSFORM_BUILD_BREAK_COUNT_EXPECTED 12
 #if TRANSFORM_BUILD_BREAK_COUNT!=TRANSFORM_BUILD_BREAK_COUNT_EXPECTED
   #error Transform is unaware of the latest non-backward-compatible changes to the libraries that it uses.
 #endif
@@ -41,8 +41,8 @@ This value is set to the number of features added to the source code of this lib
 
 This value should NOT be used by any library other than this one; doing so could require this library to support more features than the caller actually needs. Instead, source code should hardcode a constant parameter to the call to the initialization code (for this library) which conveys the minimum required value of this count.
 */
-#define TRANSFORM_BUILD_FEATURE_COUNT 0
+#define TRANSFORM_BUILD_FEATURE_COUNT 19
 /*
 BUILD_ID must increase with every code release, even if only a comment changes. It allows the user to discern one build from another, but is invisible to other libraries. If this library depends on other libraries, then it should be expressed as the sum of the local build ID plus the build IDs of those libraries, and in any event must increase monotonically even if some of the latter are removed.
 */
-#define TRANSFORM_BUILD_ID (0+FRU128_BUILD_ID+FRU64_BUILD_ID)
+#define TRANSFORM_BUILD_ID (19+FILESYS_BUILD_ID+FRU128_BUILD_ID+FRU64_BUILD_ID+THREAD_BUILD_ID)
@@ -89,6 +89,27 @@ TYPEDEF_START
   u128 b;
 TYPEDEF_END(fru128);
 
+#ifdef FRU128_LANES
+/*
+FRU128_LANES enables the FRU128_LANES_* macros, which operate on FRU128_LANE_COUNT fractervals at once using the vector extensions of GCC and Clang. Each u128 lane is split into vectors of its high and low halves, so lane (i) of a fru128_lanes (_a) is the fracterval whose lower limit has high half (_a.a.hi[i]) and low half (_a.a.lo[i]), and likewise for its upper limit in (_a.b). FRU128_LANE_COUNT is fixed at 4 because the lane shuffles are spelled out, fracterval lists are loaded as little-endian u64s, and memcpy() must be declared. Callers must provide scalar equivalents for builds without FRU128_LANES, which is the default, because without an instruction set with 64-bit unsigned comparisons (e.g. "-march=native" on an AVX2 machine), the compiler emulates them at some cost. See the makefile target skan_lanes.
+
+FRU128_LANES_SUBTRACT_FRU128_LIST_WRAP() sets each lane to the change which FRU128_ADD_FRU128_SUBTRACT_FRU128_WRAP_SELF() would make to a sum, given consecutive items of two fracterval lists, and FRU128_LANES_ACCUMULATE_WRAP_SELF() turns such changes into running sums starting from a given fracterval, so together they roll a window sum across FRU128_LANE_COUNT positions in modular arithmetic. The *_INDEX_SELF macros track lane-wise extremes and the indexes at which they occurred, updating only on strict inequality, so each lane retains the first of any tied values.
+*/
+  #define FRU128_LANE_COUNT 4U
+
+  typedef u64 fru128_lanes_u64 __attribute__((vector_size(FRU128_LANE_COUNT*U64_SIZE)));
+
+  TYPEDEF_START
+    fru128_lanes_u64 hi;
+    fru128_lanes_u64 lo;
+  TYPEDEF_END(fru128_lanes_u128);
+
+  TYPEDEF_START
+    fru128_lanes_u128 a;
+    fru128_lanes_u128 b;
+  TYPEDEF_END(fru128_lanes);
+#endif
+
 #define FRU128_BIT_MAX 255U
 #define FRU128_BITS 256U
 #define FRU128_BITS_LOG2 8U
@@ -1086,6 +1107,42 @@ TYPEDEF_END(fru128);
     } \
   }
 
+#define FRU128_ADD_FRU128_SUBTRACT_FRU128_SELF(_a, _p, _q, _z) \
+  do{ \
+    fru128 _d; \
+    u128 _r; \
+    u8 _s; \
+    \
+    U128_SUBTRACT_U128(_r, _p.a, _q.b); \
+    U128_DECREMENT_SELF(_r); \
+    U128_ADD_U128(_d.a, _a.a, _r); \
+    U128_SUBTRACT_U128(_r, _p.b, _q.a); \
+    U128_INCREMENT_SELF(_r); \
+    U128_ADD_U128(_d.b, _a.b, _r); \
+    U128_ADD_U128(_r, _d.b, _q.a); \
+    _s=(u8)(U128_IS_LESS_EQUAL(_r, _p.b)); \
+    U128_ADD_U128(_r, _a.a, _p.a); \
+    _s=(u8)(_s|U128_IS_LESS_EQUAL(_r, _d.a)); \
+    if(!_s){ \
+      _a=_d; \
+    }else{ \
+      FRU128_ADD_FRU128_SELF(_a, _p, _z); \
+      FRU128_SUBTRACT_FRU128_SELF(_a, _q, _z); \
+    } \
+  }while(0)
+
+#define FRU128_ADD_FRU128_SUBTRACT_FRU128_WRAP_SELF(_a, _p, _q) \
+  do{ \
+    u128 _r; \
+    \
+    U128_SUBTRACT_U128(_r, _p.a, _q.b); \
+    U128_DECREMENT_SELF(_r); \
+    U128_ADD_U128_SELF(_a.a, _r); \
+    U128_SUBTRACT_U128(_r, _p.b, _q.a); \
+    U128_INCREMENT_SELF(_r); \
+    U128_ADD_U128_SELF(_a.b, _r); \
+  }while(0)
+
 #define FRU128_ADD_FRU64_HI(_a, _p, _v, _z) \
   U128_ADD_U64_HI(_a.a, _p.a, _v.a); \
   U128_ADD_U64_HI(_a.b, _p.b, _v.b); \
@@ -1325,6 +1382,155 @@ TYPEDEF_END(fru128);
   _a.a=(_p); \
   _a.b=(_q)
 
+#ifdef FRU128_LANES
+  #define FRU128_LANES_ACCUMULATE_WRAP_SELF(_a, _p) \
+    do{ \
+      fru128_lanes_u128 _d; \
+      \
+      FRU128_LANES_U128_SHUFFLE(_d, _a.a, 4, 0, 1, 2); \
+      FRU128_LANES_U128_ADD_U128_SELF(_a.a, _d); \
+      FRU128_LANES_U128_SHUFFLE(_d, _a.a, 4, 4, 0, 1); \
+      FRU128_LANES_U128_ADD_U128_SELF(_a.a, _d); \
+      FRU128_LANES_U128_FROM_U128(_d, _p.a); \
+      FRU128_LANES_U128_ADD_U128_SELF(_a.a, _d); \
+      FRU128_LANES_U128_SHUFFLE(_d, _a.b, 4, 0, 1, 2); \
+      FRU128_LANES_U128_ADD_U128_SELF(_a.b, _d); \
+      FRU128_LANES_U128_SHUFFLE(_d, _a.b, 4, 4, 0, 1); \
+      FRU128_LANES_U128_ADD_U128_SELF(_a.b, _d); \
+      FRU128_LANES_U128_FROM_U128(_d, _p.b); \
+      FRU128_LANES_U128_ADD_U128_SELF(_a.b, _d); \
+    }while(0)
+
+  #define FRU128_LANES_FROM_FRU128_LIST(_a, _m) \
+    do{ \
+      fru128_lanes_u64 _t0; \
+      fru128_lanes_u64 _t1; \
+      fru128_lanes_u64 _t2; \
+      fru128_lanes_u64 _t3; \
+      fru128_lanes_u64 _u0; \
+      fru128_lanes_u64 _u1; \
+      fru128_lanes_u64 _u2; \
+      fru128_lanes_u64 _u3; \
+      \
+      memcpy(&_t0, &(_m)[0], sizeof(fru128_lanes_u64)); \
+      memcpy(&_t1, &(_m)[1], sizeof(fru128_lanes_u64)); \
+      memcpy(&_t2, &(_m)[2], sizeof(fru128_lanes_u64)); \
+      memcpy(&_t3, &(_m)[3], sizeof(fru128_lanes_u64)); \
+      _u0=FRU128_LANES_U64_SHUFFLE(_t0, _t1, 0, 4, 2, 6); \
+      _u1=FRU128_LANES_U64_SHUFFLE(_t0, _t1, 1, 5, 3, 7); \
+      _u2=FRU128_LANES_U64_SHUFFLE(_t2, _t3, 0, 4, 2, 6); \
+      _u3=FRU128_LANES_U64_SHUFFLE(_t2, _t3, 1, 5, 3, 7); \
+      _a.a.lo=FRU128_LANES_U64_SHUFFLE(_u0, _u2, 0, 1, 4, 5); \
+      _a.a.hi=FRU128_LANES_U64_SHUFFLE(_u1, _u3, 0, 1, 4, 5); \
+      _a.b.lo=FRU128_LANES_U64_SHUFFLE(_u0, _u2, 2, 3, 6, 7); \
+      _a.b.hi=FRU128_LANES_U64_SHUFFLE(_u1, _u3, 2, 3, 6, 7); \
+    }while(0)
+
+  #define FRU128_LANES_SUBTRACT_FRU128_LIST_WRAP(_a, _m0, _m1) \
+    do{ \
+      fru128_lanes _d; \
+      fru128_lanes_u64 _s; \
+      \
+      FRU128_LANES_FROM_FRU128_LIST(_a, _m0); \
+      FRU128_LANES_FROM_FRU128_LIST(_d, _m1); \
+      FRU128_LANES_U128_SUBTRACT_U128_SELF(_a.a, _d.b); \
+      _s=(fru128_lanes_u64)(_a.a.lo==0); \
+      _a.a.lo-=1; \
+      _a.a.hi+=_s; \
+      FRU128_LANES_U128_SUBTRACT_U128_SELF(_a.b, _d.a); \
+      _a.b.lo+=1; \
+      _s=(fru128_lanes_u64)(_a.b.lo==0); \
+      _a.b.hi-=_s; \
+    }while(0)
+
+  #define FRU128_LANES_TO_FRU128(_a, _i, _p) \
+    U128_FROM_U64_PAIR(_a.a, _p.a.lo[_i], _p.a.hi[_i]); \
+    U128_FROM_U64_PAIR(_a.b, _p.b.lo[_i], _p.b.hi[_i])
+
+  #define FRU128_LANES_U128_ADD_U128_SELF(_a, _p) \
+    do{ \
+      fru128_lanes_u64 _s; \
+      \
+      _a.lo+=_p.lo; \
+      _s=(fru128_lanes_u64)(_a.lo<_p.lo); \
+      _a.hi+=_p.hi-_s; \
+    }while(0)
+
+  #define FRU128_LANES_U128_FROM_U128(_a, _p) \
+    do{ \
+      u64 _t; \
+      u64 _u; \
+      \
+      U128_TO_U64_PAIR(_t, _u, _p); \
+      _a.hi=((fru128_lanes_u64){0})+_u; \
+      _a.lo=((fru128_lanes_u64){0})+_t; \
+    }while(0)
+
+  #define FRU128_LANES_U128_IS_LESS(_s, _p, _q) \
+    _s=(fru128_lanes_u64)((_p.hi<_q.hi)|((_p.hi==_q.hi)&(_p.lo<_q.lo)))
+
+  #define FRU128_LANES_U128_MAX_INDEX_SELF(_a, _n, _p, _q) \
+    do{ \
+      fru128_lanes_u64 _s; \
+      \
+      FRU128_LANES_U128_IS_LESS(_s, _a, _p); \
+      _a.hi=(_a.hi&~_s)|(_p.hi&_s); \
+      _a.lo=(_a.lo&~_s)|(_p.lo&_s); \
+      _n=(_n&~_s)|(_q&_s); \
+    }while(0)
+
+  #define FRU128_LANES_U128_MAX_SELF(_a, _p) \
+    do{ \
+      fru128_lanes_u64 _s; \
+      \
+      FRU128_LANES_U128_IS_LESS(_s, _a, _p); \
+      _a.hi=(_a.hi&~_s)|(_p.hi&_s); \
+      _a.lo=(_a.lo&~_s)|(_p.lo&_s); \
+    }while(0)
+
+  #define FRU128_LANES_U128_MIN_INDEX_SELF(_a, _n, _p, _q) \
+    do{ \
+      fru128_lanes_u64 _s; \
+      \
+      FRU128_LANES_U128_IS_LESS(_s, _p, _a); \
+      _a.hi=(_a.hi&~_s)|(_p.hi&_s); \
+      _a.lo=(_a.lo&~_s)|(_p.lo&_s); \
+      _n=(_n&~_s)|(_q&_s); \
+    }while(0)
+
+  #define FRU128_LANES_U128_SHUFFLE(_a, _p, _i0, _i1, _i2, _i3) \
+    do{ \
+      fru128_lanes_u64 _t; \
+      \
+      _t=(fru128_lanes_u64){0}; \
+      _a.hi=FRU128_LANES_U64_SHUFFLE(_p.hi, _t, _i0, _i1, _i2, _i3); \
+      _a.lo=FRU128_LANES_U64_SHUFFLE(_p.lo, _t, _i0, _i1, _i2, _i3); \
+    }while(0)
+
+  #define FRU128_LANES_U128_SUBTRACT_U128_SELF(_a, _p) \
+    do{ \
+      fru128_lanes_u64 _s; \
+      \
+      _s=(fru128_lanes_u64)(_a.lo<_p.lo); \
+      _a.lo-=_p.lo; \
+      _a.hi-=_p.hi-_s; \
+    }while(0)
+
+  #define FRU128_LANES_U64_FROM_U64(_a, _v) \
+    _a=((fru128_lanes_u64){0})+(u64)(_v)
+
+  #define FRU128_LANES_U64_FROM_U64_SEQUENCE(_a, _v) \
+    _a=((fru128_lanes_u64){0, 1, 2, 3})+(u64)(_v)
+
+  #ifdef __clang__
+    #define FRU128_LANES_U64_SHUFFLE(_p, _q, _i0, _i1, _i2, _i3) \
+      __builtin_shufflevector(_p, _q, _i0, _i1, _i2, _i3)
+  #else
+    #define FRU128_LANES_U64_SHUFFLE(_p, _q, _i0, _i1, _i2, _i3) \
+      __builtin_shuffle(_p, _q, (fru128_lanes_u64){_i0, _i1, _i2, _i3})
+  #endif
+#endif
+
 #define FRU128_LOG_DELTA_U64(_a, _v, _z) \
   _z=(u8)(_z|fracterval_u128_log_delta_u64(&_a, _v))
 
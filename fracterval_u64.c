@@ -1128,6 +1128,131 @@ Out:
   return status;
 }
 
+u8
+fracterval_u64_rank_list_insert_ascending(fru64 p, ULONG *rank_count_base, ULONG *rank_idx_base, ULONG rank_idx_max_max, fru64 *rank_list_base, u64 *threshold_base){
+/*
+This is the 64-bit fracterval equivalent of fracterval_u128_rank_list_insert_ascending(). Replace all occurrences of "128" with "64" in its definition.
+*/
+  u64 p_mean;
+  u64 q_mean;
+  fru64 q;
+  ULONG rank_count;
+  ULONG rank_idx0;
+  ULONG rank_idx1;
+  u8 status;
+  u64 threshold;
+
+  rank_count=*rank_count_base;
+  FRU64_MEAN_TO_FTD64(p_mean, p);
+  rank_idx0=rank_count;
+  status=1;
+  if(rank_count){
+    status=0;
+    do{
+      rank_idx1=rank_idx0-1;
+      q=rank_list_base[rank_idx1];
+      FRU64_MEAN_TO_FTD64(q_mean, q);
+      if(q_mean<=p_mean){
+        status=(rank_idx0==rank_count);
+        break;
+      }
+      rank_list_base[rank_idx0]=q;
+      rank_idx0=rank_idx1;
+    }while(rank_idx1);
+  }
+  if(rank_count<=rank_idx_max_max){
+    rank_count++;
+    status=0;
+    *rank_count_base=rank_count;
+  }
+  if(!status){
+    rank_list_base[rank_idx0]=p;
+    *rank_idx_base=rank_idx0;
+    if(rank_idx0==rank_idx_max_max){
+      threshold=p_mean;
+      if(threshold!=0){
+        threshold--;
+      }
+      *threshold_base=threshold;
+    }
+  }
+  return status;
+}
+
+u8
+fracterval_u64_rank_list_insert_descending(fru64 p, ULONG *rank_count_base, ULONG *rank_idx_base, ULONG rank_idx_max_max, fru64 *rank_list_base, u64 *threshold_base){
+/*
+This is the 64-bit fracterval equivalent of fracterval_u128_rank_list_insert_descending(). Replace all occurrences of "128" with "64" in its definition.
+*/
+  u64 p_mean;
+  u64 q_mean;
+  fru64 q;
+  ULONG rank_count;
+  ULONG rank_idx0;
+  ULONG rank_idx1;
+  u8 status;
+  u64 threshold;
+
+  rank_count=*rank_count_base;
+  FRU64_MEAN_TO_FTD64(p_mean, p);
+  rank_idx0=rank_count;
+  status=1;
+  if(rank_count){
+    status=0;
+    do{
+      rank_idx1=rank_idx0-1;
+      q=rank_list_base[rank_idx1];
+      FRU64_MEAN_TO_FTD64(q_mean, q);
+      if(p_mean<=q_mean){
+        status=(rank_idx0==rank_count);
+        break;
+      }
+      rank_list_base[rank_idx0]=q;
+      rank_idx0=rank_idx1;
+    }while(rank_idx1);
+  }
+  if(rank_count<=rank_idx_max_max){
+    rank_count++;
+    status=0;
+    *rank_count_base=rank_count;
+  }
+  if(!status){
+    rank_list_base[rank_idx0]=p;
+    *rank_idx_base=rank_idx0;
+    if(rank_idx0==rank_idx_max_max){
+      threshold=p_mean;
+      if(threshold!=U64_MAX){
+        threshold++;
+      }
+      *threshold_base=threshold;
+    }
+  }
+  return status;
+}
+
+fru64 *
+fracterval_u64_rank_list_malloc(ULONG rank_idx_max_max){
+/*
+This is the 64-bit fracterval equivalent of fracterval_u128_rank_list_malloc(). Replace all occurrences of "128" with "64" in its definition.
+*/
+  fru64 *list_base;
+  u64 list_bit_count;
+  ULONG list_size;
+
+  list_base=NULL;
+  list_size=(rank_idx_max_max+2)<<(U64_SIZE_LOG2+1);
+  if(rank_idx_max_max==((list_size>>(U64_SIZE_LOG2+1))-2)){
+/*
+Ensure that the allocated size in bits can be described in 64 bits.
+*/
+    list_bit_count=(u64)(list_size)<<U8_BITS_LOG2;
+    if((list_bit_count>>U8_BITS_LOG2)==list_size){
+      list_base=DEBUG_MALLOC_PARANOID(list_size);
+    }
+  }
+  return list_base;
+}
+
 u8
 fracterval_u64_shift_left(fru64 *a_base, u8 b, fru64 p){
 /*
@@ -85,6 +85,22 @@ TYPEDEF_START
   u64 b;
 TYPEDEF_END(fru64);
 
+#ifdef FRU64_LANES
+/*
+FRU64_LANES enables the FRU64_LANES_* macros, which operate on FRU64_LANE_COUNT fractervals at once using the vector extensions of GCC and Clang. Lane (i) of a fru64_lanes (_a) is the fracterval {(_a.a[i]), (_a.b[i])}. FRU64_LANE_COUNT is fixed at 4 because the lane shuffles are spelled out, and memcpy() must be declared. Callers must provide scalar equivalents for builds without FRU64_LANES, which is the default, because without an instruction set with 64-bit unsigned comparisons (e.g. "-march=native" on an AVX2 machine), the compiler emulates them at some cost. The makefile target skan_lanes builds skan with both FRU64_LANES and FRU128_LANES, and "-march=native".
+
+FRU64_LANES_SUBTRACT_FRU64_LIST_WRAP() sets each lane to the change which FRU64_ADD_FRU64_SUBTRACT_FRU64_WRAP_SELF() would make to a sum, given consecutive items of two fracterval lists, and FRU64_LANES_ACCUMULATE_WRAP_SELF() turns such changes into running sums starting from a given fracterval, so together they roll a window sum across FRU64_LANE_COUNT positions in modular arithmetic. The *_INDEX_SELF macros track lane-wise extremes and the indexes at which they occurred, updating only on strict inequality, so each lane retains the first of any tied values.
+*/
+  #define FRU64_LANE_COUNT 4U
+
+  typedef u64 fru64_lanes_u64 __attribute__((vector_size(FRU64_LANE_COUNT*U64_SIZE)));
+
+  TYPEDEF_START
+    fru64_lanes_u64 a;
+    fru64_lanes_u64 b;
+  TYPEDEF_END(fru64_lanes);
+#endif
+
 #define FRU64_BIT_MAX 127U
 #define FRU64_BITS 128U
 #define FRU64_BITS_LOG2 7U
@@ -115,6 +131,27 @@ TYPEDEF_END(fru64);
     } \
   }
 
+#define FRU64_ADD_FRU64_SUBTRACT_FRU64_SELF(_a, _p, _q, _z) \
+  do{ \
+    fru64 _d; \
+    u8 _s; \
+    \
+    _d.a=_a.a+(_p.a-_q.b-1); \
+    _d.b=_a.b+(_p.b-_q.a+1); \
+    _s=(u8)((_d.b+_q.a)<=_p.b); \
+    _s=(u8)(_s|((_a.a+_p.a)<=_d.a)); \
+    if(!_s){ \
+      _a=_d; \
+    }else{ \
+      FRU64_ADD_FRU64_SELF(_a, _p, _z); \
+      FRU64_SUBTRACT_FRU64_SELF(_a, _q, _z); \
+    } \
+  }while(0)
+
+#define FRU64_ADD_FRU64_SUBTRACT_FRU64_WRAP_SELF(_a, _p, _q) \
+  _a.a+=_p.a-_q.b-1; \
+  _a.b+=_p.b-_q.a+1
+
 #define FRU64_ADD_FTD64(_a, _p, _q, _z) \
   _a.a=_p.a+(_q); \
   _a.b=_p.b+(_q)+1; \
@@ -188,6 +225,86 @@ TYPEDEF_END(fru64);
   _a.a=(_v); \
   _a.b=(_w)
 
+#ifdef FRU64_LANES
+  #define FRU64_LANES_ACCUMULATE_WRAP_SELF(_a, _p) \
+    do{ \
+      fru64_lanes_u64 _d; \
+      \
+      _d=(fru64_lanes_u64){0}; \
+      _a.a+=FRU64_LANES_U64_SHUFFLE(_a.a, _d, 4, 0, 1, 2); \
+      _a.b+=FRU64_LANES_U64_SHUFFLE(_a.b, _d, 4, 0, 1, 2); \
+      _a.a+=FRU64_LANES_U64_SHUFFLE(_a.a, _d, 4, 4, 0, 1); \
+      _a.b+=FRU64_LANES_U64_SHUFFLE(_a.b, _d, 4, 4, 0, 1); \
+      _a.a+=_p.a; \
+      _a.b+=_p.b; \
+    }while(0)
+
+  #define FRU64_LANES_FROM_FRU64_LIST(_a, _m) \
+    do{ \
+      fru64_lanes_u64 _t; \
+      fru64_lanes_u64 _u; \
+      \
+      memcpy(&_t, &(_m)[0], sizeof(fru64_lanes_u64)); \
+      memcpy(&_u, &(_m)[FRU64_LANE_COUNT>>1], sizeof(fru64_lanes_u64)); \
+      _a.a=FRU64_LANES_U64_SHUFFLE(_t, _u, 0, 2, 4, 6); \
+      _a.b=FRU64_LANES_U64_SHUFFLE(_t, _u, 1, 3, 5, 7); \
+    }while(0)
+
+  #define FRU64_LANES_SUBTRACT_FRU64_LIST_WRAP(_a, _m0, _m1) \
+    do{ \
+      fru64_lanes _d; \
+      \
+      FRU64_LANES_FROM_FRU64_LIST(_a, _m0); \
+      FRU64_LANES_FROM_FRU64_LIST(_d, _m1); \
+      _a.a=_a.a-_d.b-1; \
+      _a.b=_a.b-_d.a+1; \
+    }while(0)
+
+  #define FRU64_LANES_TO_FRU64(_a, _i, _p) \
+    _a.a=_p.a[_i]; \
+    _a.b=_p.b[_i]
+
+  #define FRU64_LANES_U64_FROM_U64(_a, _v) \
+    _a=((fru64_lanes_u64){0})+(u64)(_v)
+
+  #define FRU64_LANES_U64_FROM_U64_SEQUENCE(_a, _v) \
+    _a=((fru64_lanes_u64){0, 1, 2, 3})+(u64)(_v)
+
+  #define FRU64_LANES_U64_MAX_INDEX_SELF(_a, _n, _p, _q) \
+    do{ \
+      fru64_lanes_u64 _s; \
+      \
+      _s=(fru64_lanes_u64)(_a<_p); \
+      _a=(_a&~_s)|(_p&_s); \
+      _n=(_n&~_s)|(_q&_s); \
+    }while(0)
+
+  #define FRU64_LANES_U64_MAX_SELF(_a, _p) \
+    do{ \
+      fru64_lanes_u64 _s; \
+      \
+      _s=(fru64_lanes_u64)(_a<_p); \
+      _a=(_a&~_s)|(_p&_s); \
+    }while(0)
+
+  #define FRU64_LANES_U64_MIN_INDEX_SELF(_a, _n, _p, _q) \
+    do{ \
+      fru64_lanes_u64 _s; \
+      \
+      _s=(fru64_lanes_u64)(_p<_a); \
+      _a=(_a&~_s)|(_p&_s); \
+      _n=(_n&~_s)|(_q&_s); \
+    }while(0)
+
+  #ifdef __clang__
+    #define FRU64_LANES_U64_SHUFFLE(_p, _q, _i0, _i1, _i2, _i3) \
+      __builtin_shufflevector(_p, _q, _i0, _i1, _i2, _i3)
+  #else
+    #define FRU64_LANES_U64_SHUFFLE(_p, _q, _i0, _i1, _i2, _i3) \
+      __builtin_shuffle(_p, _q, (fru64_lanes_u64){_i0, _i1, _i2, _i3})
+  #endif
+#endif
+
 #define FRU64_LOG_DELTA_U64(_a, _v, _z) \
   _z=(u8)(_z|fracterval_u64_log_delta_u64(&_a, _v))
 
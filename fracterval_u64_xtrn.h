@@ -38,6 +38,9 @@ extern void fracterval_u64_multiply_mantissa_u64(fru64 *a_base, fru64 p, u64 q);
 extern u8 fracterval_u64_multiply_u64(fru64 *a_base, fru64 p, u64 v);
 extern void fracterval_u64_nats_from_bits(fru64 *a_base, fru64 p);
 extern u8 fracterval_u64_nats_to_bits(fru64 *a_base, fru64 p);
+extern u8 fracterval_u64_rank_list_insert_ascending(fru64 p, ULONG *rank_count_base, ULONG *rank_idx_base, ULONG rank_idx_max_max, fru64 *rank_list_base, u64 *threshold_base);
+extern u8 fracterval_u64_rank_list_insert_descending(fru64 p, ULONG *rank_count_base, ULONG *rank_idx_base, ULONG rank_idx_max_max, fru64 *rank_list_base, u64 *threshold_base);
+extern fru64 *fracterval_u64_rank_list_malloc(ULONG rank_idx_max_max);
 extern u8 fracterval_u64_shift_left(fru64 *a_base, u8 b, fru64 p);
 extern u32 fracterval_u64_to_fakefloat(fru64 p, u8 units_bit_idx);
 extern u64 *fracterval_u64_u64_list_malloc(ULONG u64_idx_max);
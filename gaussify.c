@@ -210,6 +210,10 @@ Increment emit_mode because we provide 3 levels, whereas emit.h provides 4. The
       break;
     }
     status=1;
+    if(archive_header_flags_get(header_base)){
+      gaussify_error_print(emit_mode, "(sfy_file) is a lookup index, which is only suitable for Slice");
+      break;
+    }
     gic_base=gic_malloc(pdf_float_count, pdf_count);
     if(!gic_base){
       gaussify_out_of_memory_print(emit_mode);
@@ -27,8 +27,10 @@ Multispectral Entropy Transform Utility
 #include "flag_filesys.h"
 #include "flag_fracterval_u128.h"
 #include "flag_fracterval_u64.h"
+#include "flag_thread.h"
 #include "flag_transform.h"
 #include "flag_whole.h"
+#include <pthread.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
@@ -44,6 +46,8 @@ Multispectral Entropy Transform Utility
 #include "fracterval_u128_xtrn.h"
 #include "fracterval_u64.h"
 #include "fracterval_u64_xtrn.h"
+#include "thread.h"
+#include "thread_xtrn.h"
 #include "transform.h"
 #include "transform_xtrn.h"
 #include "whole_xtrn.h"
@@ -60,6 +64,57 @@ Multispectral Entropy Transform Utility
 #define SKAN_FLAGS_PRECISE_MASK 1U
 #define SKAN_FLAGS_ROUNDING_LSB 2U
 #define SKAN_FLAGS_ROUNDING_MASK 3U
+#define SKAN_FOLDER_STATUS_CHANGED 5U
+#define SKAN_FOLDER_STATUS_DONE 1U
+#define SKAN_FOLDER_STATUS_HEIGHT_FAIL 4U
+#define SKAN_FOLDER_STATUS_PENDING 0U
+#define SKAN_FOLDER_STATUS_READ_FAIL 2U
+#define SKAN_FOLDER_STATUS_SIZE_FAIL 3U
+#define SKAN_STREAM_SIZE_MIN (1UL<<22)
+#define SKAN_TRANSPOSE_TILE_WIDTH_DEFAULT 64U
+
+TYPEDEF_START
+  entropy_t *entropy_base;
+  entropy_t *entropy_list_base;
+  ULONG *filename_char_idx_list_base;
+  char *filename_list_base;
+  void *folder_list_base;
+  pthread_mutex_t *mutex_base;
+  u8 *status_list_base;
+  transform_t *transform_base;
+  u8 *whole_u8_list_base;
+  ULONG file_size_max;
+  ULONG filename_count;
+  ULONG filename_idx;
+  ULONG print_idx;
+  ULONG row_size;
+  ULONG whole_y_idx_max_max;
+  ULONG window_y_idx_post;
+  u32 whole_max_max;
+  u8 emit_mode;
+  u8 granularity;
+  u8 overflow_status;
+TYPEDEF_END(skan_folder_t)
+
+TYPEDEF_START
+  thread_barrier_t *barrier_base;
+  entropy_t *entropy_base;
+  u32 *fakefloat_list_base;
+  char *float_pathname_base;
+  void *stream_list_base;
+  transform_t *transform_base;
+  char *whole_pathname_base;
+  u8 *whole_u8_list_base;
+  ULONG buffer_size;
+  ULONG chunk_idx_max;
+  ULONG chunk_y_idx_post;
+  ULONG row_size;
+  ULONG thread_idx;
+  ULONG whole_y_idx_min;
+  u8 filesys_status;
+  u8 overflow_status;
+  u8 stream_status;
+TYPEDEF_END(skan_stream_t)
 
 void
 skan_comma_print(void){
@@ -77,6 +132,174 @@ skan_error_print(u8 emit_mode, char *text_base){
   return;
 }
 
+void
+skan_extremes_print(entropy_t *entropy_base){
+/*
+Print the CSV row which summarizes a scan.
+
+In:
+
+  entropy_base is transform_malloc():Out:*entropy_base_base after dispatch.
+
+Out:
+
+  A row of the form "nats_min,nats_max,x_span,y_span,min_x_min,min_y_min,max_x_min,max_y_min" has been printed.
+*/
+  if(!entropy_base->precise_status){
+    EMIT_F64("", entropy_base->min_min_u64);
+    skan_comma_print();
+    EMIT_F64("", entropy_base->max_max_u64);
+  }else{
+    EMIT_F128("", entropy_base->min_min_u128);
+    skan_comma_print();
+    EMIT_F128("", entropy_base->max_max_u128);
+  }
+  skan_comma_print();
+  EMIT_U64_DECIMAL("", entropy_base->window_x_idx_post);
+  skan_comma_print();
+  EMIT_U64_DECIMAL("", entropy_base->window_y_idx_post);
+  skan_comma_print();
+  EMIT_U64_DECIMAL("", entropy_base->min_min_x_idx);
+  skan_comma_print();
+  EMIT_U64_DECIMAL("", entropy_base->min_min_y_idx);
+  skan_comma_print();
+  EMIT_U64_DECIMAL("", entropy_base->max_max_x_idx);
+  skan_comma_print();
+  EMIT_U64_DECIMAL("", entropy_base->max_max_y_idx);
+  EMIT_WRITE("");
+  return;
+}
+
+void
+skan_header_print(u8 discount_status){
+/*
+Print the CSV header which precedes skan_extremes_print().
+
+In:
+
+  discount_status is one if entropies are expressed in discount nats, else zero.
+
+Out:
+
+  The header has been printed.
+*/
+  if(discount_status){
+    EMIT_PRINT("DISCOUNT_NATS_MIN,DISCOUNT_");
+  }else{
+    EMIT_PRINT("NATS_MIN,");
+  }
+  EMIT_WRITE("NATS_MAX,X_SPAN,Y_SPAN,MIN_X_MIN,MIN_Y_MIN,MAX_X_MIN,MAX_Y_MIN");
+  return;
+}
+
+ULONG *
+skan_list_parse(ULONG *list_idx_max_base, char *text_base){
+/*
+Parse a comma-separated list of decimal values, such as the value of a --widths option.
+
+In:
+
+  *list_idx_max_base is undefined.
+
+  text_base is the base of the list text, which will be modified by replacing each comma with a null terminator.
+
+Out:
+
+  Returns NULL if any value was empty or not representable as a ULONG, or if allocation failed, else the base of a list of the values in order, which must be freed via transform_free().
+
+  *list_idx_max_base is the number of values, less one.
+*/
+  char *item_base;
+  ULONG list_idx;
+  ULONG *list_base;
+  ULONG list_idx_max;
+  u64 parameter;
+  u8 status;
+  ULONG text_idx;
+
+  list_idx_max=0;
+  text_idx=0;
+  while(text_base[text_idx]){
+    list_idx_max+=(text_base[text_idx]==',');
+    text_idx++;
+  }
+  list_base=DEBUG_MALLOC_PARANOID((list_idx_max+1)<<ULONG_SIZE_LOG2);
+  if(list_base){
+    item_base=text_base;
+    list_idx=0;
+    do{
+      text_idx=0;
+      while(item_base[text_idx]&&(item_base[text_idx]!=',')){
+        text_idx++;
+      }
+      item_base[text_idx]=0;
+      status=!text_idx;
+      status=(u8)(status|ascii_decimal_to_u64_convert(item_base, &parameter, ULONG_MAX));
+      if(status){
+        list_base=transform_free(list_base);
+        break;
+      }
+      list_base[list_idx]=(ULONG)(parameter);
+      item_base=&item_base[text_idx+1];
+    }while((list_idx++)!=list_idx_max);
+  }
+  *list_idx_max_base=list_idx_max;
+  return list_base;
+}
+
+char *
+skan_option_get(int *argc_base, char *argv[], char *name_base){
+/*
+Find an option of the form "--name=value" or "--name" in the parameter list and remove it, so that the remaining parameters are positional as before options existed.
+
+In:
+
+  *argc_base is main():In:argc.
+
+  argv is main():In:argv.
+
+  name_base is the name of the option without the leading "--".
+
+Out:
+
+  Returns NULL if the option wasn't found, else the base of its value, which is empty if there was no "=". If the option appears more than once, then the first instance is used.
+
+  *argc_base has been decremented and argv has been compacted if the option was found.
+*/
+  ULONG arg_idx;
+  ULONG arg_idx_post;
+  char *arg_base;
+  ULONG name_char_count;
+  char *value_base;
+
+  arg_idx=1;
+  arg_idx_post=(ULONG)(*argc_base);
+  name_char_count=(ULONG)(strlen(name_base));
+  value_base=NULL;
+  while(arg_idx<arg_idx_post){
+    arg_base=argv[arg_idx];
+    if((arg_base[0]=='-')&&(arg_base[1]=='-')&&!strncmp(&arg_base[2], name_base, (size_t)(name_char_count))){
+      value_base=&arg_base[name_char_count+2];
+      if(*value_base=='='){
+        value_base++;
+      }else if(*value_base){
+        value_base=NULL;
+      }
+      if(value_base){
+        arg_idx_post--;
+        while(arg_idx!=arg_idx_post){
+          argv[arg_idx]=argv[arg_idx+1];
+          arg_idx++;
+        }
+        *argc_base=(int)(arg_idx_post);
+        break;
+      }
+    }
+    arg_idx++;
+  }
+  return value_base;
+}
+
 void
 skan_out_of_memory_print(u8 emit_mode){
   skan_error_print(emit_mode, "Out of memory");
@@ -102,6 +325,501 @@ skan_progress_print(u8 emit_mode, char *text_base){
   return;
 }
 
+void
+skan_rank_list_print(entropy_t *entropy_base, u8 max_status){
+/*
+Print one CSV row per window in one of the rank lists populated by transform_dispatch*() after transform_rank_init().
+
+In:
+
+  entropy_base is transform_malloc():Out:*entropy_base_base.
+
+  max_status is one to print the list of greatest entropies, else zero for the list of least entropies.
+
+Out:
+
+  Rows of the form "(MIN|MAX),rank,nats_mean,x_min,y_min" have been printed, with rank zero being the most extreme.
+*/
+  fru128 entropy_fru128;
+  fru128 *entropy_fru128_list_base;
+  fru64 entropy_fru64;
+  fru64 *entropy_fru64_list_base;
+  u128 mean_u128;
+  u64 mean_u64;
+  ULONG rank_count;
+  ULONG rank_idx;
+  ULONG *xy_list_base;
+
+  rank_count=entropy_base->rank_min_count;
+  entropy_fru128_list_base=entropy_base->rank_min_fru128_list_base;
+  entropy_fru64_list_base=entropy_base->rank_min_fru64_list_base;
+  xy_list_base=entropy_base->rank_min_xy_list_base;
+  if(max_status){
+    rank_count=entropy_base->rank_max_count;
+    entropy_fru128_list_base=entropy_base->rank_max_fru128_list_base;
+    entropy_fru64_list_base=entropy_base->rank_max_fru64_list_base;
+    xy_list_base=entropy_base->rank_max_xy_list_base;
+  }
+  rank_idx=0;
+  while(rank_idx!=rank_count){
+    if(!max_status){
+      EMIT_PRINT("MIN,");
+    }else{
+      EMIT_PRINT("MAX,");
+    }
+    EMIT_U64_DECIMAL("", rank_idx);
+    skan_comma_print();
+    if(!entropy_base->precise_status){
+      entropy_fru64=entropy_fru64_list_base[rank_idx];
+      FRU64_MEAN_TO_FTD64(mean_u64, entropy_fru64);
+      EMIT_F64("", mean_u64);
+    }else{
+      entropy_fru128=entropy_fru128_list_base[rank_idx];
+      FRU128_MEAN_TO_FTD128(mean_u128, entropy_fru128);
+      EMIT_F128("", mean_u128);
+    }
+    skan_comma_print();
+    EMIT_U64_DECIMAL("", xy_list_base[rank_idx<<1]);
+    skan_comma_print();
+    EMIT_U64_DECIMAL("", xy_list_base[(rank_idx<<1)+1]);
+    EMIT_WRITE("");
+    rank_idx++;
+  }
+  return;
+}
+
+#ifdef TRANSFORM_STATS
+  u8
+  skan_stats_print(u8 emit_mode, char *stats_pathname_base){
+/*
+Report the instrumentation counters accumulated by Transform, which only exist if it was built with "-DTRANSFORM_STATS" (via "make skan_stats").
+
+In:
+
+  emit_mode is the verbosity, as used by skan_progress_print().
+
+  *stats_pathname_base is the name of the file to which to write the counters as a single JSON object, or NULL to skip that.
+
+Out:
+
+  Returns FILESYS_STATUS_* as returned by filesys_file_write_obnoxious(), or zero if stats_pathname_base is NULL.
+
+  The counters have been printed if emit_mode is at least EMIT3.
+*/
+    char decimal_list_base[24];
+    u8 decimal_idx;
+    u8 filesys_status;
+    char *name_base;
+    ULONG name_size;
+    char stats_list_base[(TRANSFORM_STATS_IDX_MAX+1)<<6];
+    u8 stats_idx;
+    ULONG text_idx;
+    u64 value;
+
+    filesys_status=0;
+    stats_idx=0;
+    stats_list_base[0]='{';
+    text_idx=1;
+    do{
+      value=transform_stats_get(&name_base, stats_idx);
+      if(EMIT3<=emit_mode){
+        EMIT_PRINT("stats.");
+        EMIT_U64_DECIMAL(name_base, value);
+      }
+      if(stats_idx){
+        stats_list_base[text_idx]=',';
+        text_idx++;
+      }
+      name_size=(ULONG)(strlen(name_base));
+      stats_list_base[text_idx]='"';
+      memcpy(&stats_list_base[text_idx+1], name_base, (size_t)(name_size));
+      text_idx+=name_size+1;
+      stats_list_base[text_idx]='"';
+      stats_list_base[text_idx+1]=':';
+      text_idx+=2;
+      decimal_idx=0;
+      do{
+        decimal_list_base[decimal_idx]=(char)('0'+(value%10));
+        decimal_idx++;
+        value/=10;
+      }while(value);
+      do{
+        decimal_idx--;
+        stats_list_base[text_idx]=decimal_list_base[decimal_idx];
+        text_idx++;
+      }while(decimal_idx);
+    }while((stats_idx++)!=TRANSFORM_STATS_IDX_MAX);
+    stats_list_base[text_idx]='}';
+    stats_list_base[text_idx+1]='\n';
+    text_idx+=2;
+    if(stats_pathname_base){
+      filesys_status=filesys_file_write_obnoxious(0, text_idx, stats_pathname_base, stats_list_base);
+    }
+    return filesys_status;
+  }
+#endif
+
+u8
+skan_stream_read(ULONG chunk_idx, skan_stream_t *stream_base){
+/*
+Fill the half of the stream buffer which belongs to a given chunk with the rows of wholes which transform_dispatch_stream() requires in order to process it.
+
+In:
+
+  chunk_idx is the index of the chunk. If nonzero, then the other half of the buffer must already have been filled for (chunk_idx-1), and may be in use by transform_dispatch_stream() because it's only read here.
+
+  stream_base is the base of the skan_stream_t prepared by main().
+
+Out:
+
+  Returns zero on success, else a FILESYS_STATUS code.
+
+  The half of (stream_base->whole_u8_list_base) at ((chunk_idx&1)*(stream_base->buffer_size)) contains rows as transform_dispatch_stream():In:whole_u8_list_base requires, with whole_y_idx_min equal to (chunk_idx*(stream_base->chunk_y_idx_post)+(stream_base->whole_y_idx_min)).
+*/
+  u8 *buffer_base;
+  u8 *buffer_peer_base;
+  ULONG buffer_y_idx;
+  ULONG chunk_y_idx_min;
+  ULONG chunk_y_idx_post;
+  entropy_t *entropy_base;
+  u8 filesys_status;
+  ULONG row_size;
+  ULONG row_y_idx_min;
+  ULONG row_y_idx_post;
+  ULONG window_y_idx_max;
+
+  chunk_y_idx_post=stream_base->chunk_y_idx_post;
+  entropy_base=stream_base->entropy_base;
+  row_size=stream_base->row_size;
+  window_y_idx_max=entropy_base->window_y_idx_max;
+  buffer_base=&stream_base->whole_u8_list_base[(chunk_idx&1)*stream_base->buffer_size];
+  chunk_y_idx_min=chunk_idx*chunk_y_idx_post+stream_base->whole_y_idx_min;
+  if(!chunk_idx){
+    buffer_y_idx=1;
+    row_y_idx_min=0;
+    if(chunk_y_idx_min){
+/*
+We're resuming from a checkpoint, so the row preceding the first window is required as well.
+*/
+      buffer_y_idx=0;
+      row_y_idx_min=chunk_y_idx_min-1;
+    }
+  }else{
+/*
+The first (window_y_idx_max+1) rows required by this chunk are the last rows of the previous one, so copy them instead of reading them again.
+*/
+    buffer_peer_base=&stream_base->whole_u8_list_base[((chunk_idx&1)^1)*stream_base->buffer_size];
+    buffer_y_idx=window_y_idx_max+1;
+    memcpy(buffer_base, &buffer_peer_base[chunk_y_idx_post*row_size], (size_t)(buffer_y_idx*row_size));
+    row_y_idx_min=chunk_y_idx_min+window_y_idx_max;
+  }
+  row_y_idx_post=chunk_y_idx_min+chunk_y_idx_post+window_y_idx_max;
+  row_y_idx_post=MIN(row_y_idx_post, entropy_base->whole_y_idx_post);
+  filesys_status=filesys_subfile_read(0, stream_base->whole_pathname_base, (row_y_idx_post-row_y_idx_min)*row_size, (u64)(row_y_idx_min)*row_size, &buffer_base[buffer_y_idx*row_size]);
+  return filesys_status;
+}
+
+void *
+skan_stream_thread(void *stream_base){
+/*
+Execute one thread's share of a chunked scan. Thread zero runs the transform on one chunk while thread one writes the fakefloats of the previous chunk and, if streaming, reads the wholes of the next, so that storage and compute overlap. If thread one could not be created, then thread zero does everything in turn. If transform_hit_init() was called, then thread zero appends the hits of each chunk to the float file itself as soon as the chunk is done, because they're usually too few to be worth overlapping.
+
+In:
+
+  stream_base is the base of a skan_stream_t prepared by main(). If (stream_base->stream_status) is one, then the chunk with index zero must already have been read.
+
+Out:
+
+  Returns NULL.
+
+  (stream_base->filesys_status) is zero on success, else the FILESYS_STATUS code of the read or write failure which stopped the scan.
+
+  If (stream_base->thread_idx) is zero, then (stream_base->overflow_status) is transform_dispatch_stream():Out summed over all chunks. The float file, if any, has been extended by each chunk of fakefloats or hits in turn.
+*/
+  thread_barrier_t *barrier_base;
+  ULONG buffer_y_idx_min;
+  ULONG chunk_idx;
+  ULONG chunk_idx_max;
+  ULONG chunk_y_idx_post;
+  entropy_t *entropy_base;
+  ULONG fakefloat_idx_delta;
+  u32 *fakefloat_list_base;
+  ULONG fakefloat_row_size;
+  u8 filesys_status;
+  u8 overflow_status;
+  skan_stream_t *stream_base_local;
+  skan_stream_t *stream_list_base;
+  ULONG thread_idx;
+  ULONG thread_idx_max;
+  u8 *whole_u8_list_base;
+  ULONG whole_y_idx_max;
+  ULONG whole_y_idx_min;
+
+  stream_base_local=(skan_stream_t *)(stream_base);
+  barrier_base=stream_base_local->barrier_base;
+  thread_barrier_wait(barrier_base);
+  thread_idx_max=barrier_base->thread_idx_max;
+  chunk_idx=0;
+  chunk_idx_max=stream_base_local->chunk_idx_max;
+  chunk_y_idx_post=stream_base_local->chunk_y_idx_post;
+  entropy_base=stream_base_local->entropy_base;
+/*
+Each half of the fakefloat list holds one chunk, plus the undefined first row which transform_dispatch_stream() leaves behind.
+*/
+  fakefloat_idx_delta=(entropy_base->fakefloat_x_idx_max+1)*(chunk_y_idx_post+1);
+  fakefloat_list_base=stream_base_local->fakefloat_list_base;
+  fakefloat_row_size=(entropy_base->fakefloat_x_idx_max+1)<<U32_SIZE_LOG2;
+  filesys_status=0;
+  overflow_status=0;
+  stream_list_base=(skan_stream_t *)(stream_base_local->stream_list_base);
+  thread_idx=stream_base_local->thread_idx;
+  do{
+    if(!thread_idx){
+      buffer_y_idx_min=1;
+      whole_u8_list_base=&stream_base_local->whole_u8_list_base[(chunk_idx&1)*stream_base_local->buffer_size];
+      whole_y_idx_min=chunk_idx*chunk_y_idx_post+stream_base_local->whole_y_idx_min;
+      whole_y_idx_max=MIN(whole_y_idx_min+chunk_y_idx_post-1, entropy_base->fakefloat_y_idx_max);
+      if(!stream_base_local->stream_status){
+        buffer_y_idx_min=whole_y_idx_min;
+        whole_u8_list_base=stream_base_local->whole_u8_list_base;
+      }
+      if(fakefloat_list_base){
+        entropy_base->fakefloat_list_base=&fakefloat_list_base[(chunk_idx&1)*fakefloat_idx_delta];
+      }
+      overflow_status=(u8)(overflow_status|transform_dispatch_stream(buffer_y_idx_min, entropy_base, stream_base_local->transform_base, whole_u8_list_base, whole_y_idx_max, whole_y_idx_min));
+      if(entropy_base->hit_count){
+        filesys_status=filesys_file_write_obnoxious(1, entropy_base->hit_count*(ULONG)(sizeof(transform_hit_t)), stream_base_local->float_pathname_base, entropy_base->hit_list_base);
+        entropy_base->hit_count=0;
+      }
+    }
+    if(thread_idx==thread_idx_max){
+/*
+The previous chunk was complete, so it had exactly (chunk_y_idx_post) rows.
+*/
+      if(chunk_idx&&fakefloat_list_base){
+        filesys_status=filesys_file_write_obnoxious(1, chunk_y_idx_post*fakefloat_row_size, stream_base_local->float_pathname_base, &fakefloat_list_base[((chunk_idx&1)^1)*fakefloat_idx_delta+entropy_base->fakefloat_x_idx_max+1]);
+      }
+      if(stream_base_local->stream_status&&(chunk_idx!=chunk_idx_max)&&!filesys_status){
+        filesys_status=skan_stream_read(chunk_idx+1, stream_base_local);
+      }
+    }
+    stream_base_local->filesys_status=filesys_status;
+    thread_barrier_wait(barrier_base);
+    if(stream_list_base[0].filesys_status||stream_list_base[thread_idx_max].filesys_status){
+      break;
+    }
+  }while((chunk_idx++)!=chunk_idx_max);
+  if((thread_idx==thread_idx_max)&&fakefloat_list_base&&!(stream_list_base[0].filesys_status||filesys_status)){
+    whole_y_idx_min=chunk_idx_max*chunk_y_idx_post+stream_base_local->whole_y_idx_min;
+    whole_y_idx_max=entropy_base->fakefloat_y_idx_max;
+    filesys_status=filesys_file_write_obnoxious(1, (whole_y_idx_max-whole_y_idx_min+1)*fakefloat_row_size, stream_base_local->float_pathname_base, &fakefloat_list_base[(chunk_idx_max&1)*fakefloat_idx_delta+entropy_base->fakefloat_x_idx_max+1]);
+    stream_base_local->filesys_status=filesys_status;
+  }
+  stream_base_local->overflow_status=overflow_status;
+  return NULL;
+}
+
+u8
+skan_stream_whole_max_get(u8 granularity, ULONG row_y_idx_min, skan_stream_t *stream_base, u32 *whole_max_base, ULONG whole_y_idx_post){
+/*
+Find the maximum whole in a whole file by reading it through the stream buffer, one buffer at a time, so that transform_malloc() can be called before streaming begins.
+
+In:
+
+  granularity is the number of bytes per whole, less one.
+
+  row_y_idx_min is the index of the first row to inspect, which is nonzero when resuming from a checkpoint because the preceding rows have already been accounted for. On [0, whole_y_idx_post-1].
+
+  stream_base is the base of the skan_stream_t prepared by main(), in which buffer_size, row_size, whole_pathname_base, and whole_u8_list_base are valid.
+
+  *whole_max_base is undefined.
+
+  whole_y_idx_post is the number of rows in the whole file.
+
+Out:
+
+  Returns zero on success, else a FILESYS_STATUS code.
+
+  *whole_max_base is the maximum whole on rows [row_y_idx_min, whole_y_idx_post-1].
+*/
+  u8 filesys_status;
+  ULONG row_size;
+  ULONG row_y_idx_post;
+  ULONG row_y_idx_span;
+  u32 whole_max;
+  u32 whole_max_local;
+  u8 whole_size;
+
+  filesys_status=0;
+  row_size=stream_base->row_size;
+  row_y_idx_span=(stream_base->buffer_size<<1)/row_size;
+  whole_max=0;
+  whole_size=(u8)(granularity+1);
+  do{
+    row_y_idx_post=MIN(row_y_idx_min+row_y_idx_span, whole_y_idx_post);
+    filesys_status=filesys_subfile_read(0, stream_base->whole_pathname_base, (row_y_idx_post-row_y_idx_min)*row_size, (u64)(row_y_idx_min)*row_size, stream_base->whole_u8_list_base);
+    if(filesys_status){
+      break;
+    }
+    whole_max_local=whole_max_get(granularity, (row_y_idx_post-row_y_idx_min)*row_size/whole_size-1, stream_base->whole_u8_list_base);
+    whole_max=MAX(whole_max, whole_max_local);
+    row_y_idx_min=row_y_idx_post;
+  }while(row_y_idx_min!=whole_y_idx_post);
+  *whole_max_base=whole_max;
+  return filesys_status;
+}
+
+u8
+skan_sweep(entropy_t *entropy_base, ULONG height_idx_max, ULONG *height_list_base, u8 *overflow_status_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG width_idx_max, ULONG *width_list_base){
+/*
+Scan a whole array at every combination of window width and height in the given lists, sharing lookup lists across all heights and column state across all widths of the same height, then print one CSV row per combination.
+
+In:
+
+  entropy_base is transform_malloc():Out:*entropy_base_base, for which the window size is the greatest width and height in the lists.
+
+  height_idx_max is the number of items in *height_list_base, less one.
+
+  height_list_base is the base of the list of window heights, in the order in which to report them. Each is on [2, (entropy_base->window_y_idx_post)].
+
+  *overflow_status_base is undefined.
+
+  transform_base is transform_malloc():Out:*transform_base_base.
+
+  whole_u8_list_base is transform_dispatch():In:whole_u8_list_base.
+
+  width_idx_max is the number of items in *width_list_base, less one.
+
+  width_list_base is the base of the list of window widths, in the order in which to report them for each height. Each is on [1, (entropy_base->window_x_idx_post)].
+
+Out:
+
+  Returns one if allocation failed, else zero.
+
+  *overflow_status_base is one if fracterval underflow or overflow occurred at any window size, else zero.
+
+  One CSV row per window size has been printed, in row-major order of (height, width), until allocation failed, if it did.
+*/
+  entropy_t *entropy_height_base;
+  entropy_t **entropy_list_base;
+  ULONG height_idx;
+  u8 overflow_status;
+  u8 status;
+  transform_t *transform_height_base;
+  ULONG width_idx;
+  ULONG window_y_idx_max;
+
+  overflow_status=0;
+  entropy_list_base=DEBUG_CALLOC_PARANOID((width_idx_max+1)*(ULONG)(sizeof(entropy_t *)));
+  status=!entropy_list_base;
+  if(!status){
+    height_idx=0;
+    do{
+      window_y_idx_max=height_list_base[height_idx]-1;
+      entropy_height_base=entropy_base;
+      transform_height_base=transform_base;
+      if(window_y_idx_max!=entropy_base->window_y_idx_max){
+        transform_clone_resize(entropy_base, &entropy_height_base, transform_base, &transform_height_base, window_y_idx_max);
+        status=!entropy_height_base;
+      }
+      if(!status){
+        width_idx=0;
+        do{
+          entropy_list_base[width_idx]=transform_entropy_clone(entropy_height_base, transform_height_base, width_list_base[width_idx]-1);
+          status=(u8)(status|!entropy_list_base[width_idx]);
+        }while((width_idx++)!=width_idx_max);
+        if(!status){
+          overflow_status=(u8)(overflow_status|transform_dispatch_sweep(entropy_list_base, width_idx_max, transform_height_base, whole_u8_list_base));
+          width_idx=0;
+          do{
+            skan_extremes_print(entropy_list_base[width_idx]);
+          }while((width_idx++)!=width_idx_max);
+        }
+        width_idx=0;
+        do{
+          entropy_list_base[width_idx]=transform_free(entropy_list_base[width_idx]);
+        }while((width_idx++)!=width_idx_max);
+        if(transform_height_base!=transform_base){
+          transform_free_all(&entropy_height_base, &transform_height_base);
+        }
+      }
+    }while((!status)&&((height_idx++)!=height_idx_max));
+    transform_free(entropy_list_base);
+  }
+  *overflow_status_base=overflow_status;
+  return status;
+}
+
+u8
+skan_threshold_parse(u8 precise_status, u128 *threshold_u128_base, u64 *threshold_u64_base, char *text_base){
+/*
+Parse a threshold given in the hex fixed-point format of the CSV output, such as the value of an --above option.
+
+In:
+
+  precise_status is one to parse a 64.64 value, else zero to parse a 32.32 value.
+
+  *threshold_u128_base is undefined.
+
+  *threshold_u64_base is undefined.
+
+  text_base is the base of the threshold text, of the form "I" or "I.F", where "I" and "F" are the integer and fractional parts, each of up to 16 hex digits if precise_status is one, else 8. "F" is left-justified, so "1.8" means one and a half. The period, if any, will be replaced by a null terminator.
+
+Out:
+
+  Returns one if the text was malformed or out of range, else zero.
+
+  *threshold_u128_base is the threshold if precise_status is one, else zero.
+
+  *threshold_u64_base is the threshold if precise_status is zero, else zero.
+*/
+  u64 fraction;
+  char *fraction_text_base;
+  u64 integer;
+  u8 part_digit_count_max;
+  u8 status;
+  ULONG text_idx;
+  u128 threshold_u128;
+  u64 threshold_u64;
+
+  part_digit_count_max=(u8)((U32_BITS>>2)<<precise_status);
+  fraction=0;
+  text_idx=0;
+  while(text_base[text_idx]&&(text_base[text_idx]!='.')){
+    text_idx++;
+  }
+  fraction_text_base=NULL;
+  if(text_base[text_idx]){
+    text_base[text_idx]=0;
+    fraction_text_base=&text_base[text_idx+1];
+  }
+  status=(u8)((!text_idx)|(part_digit_count_max<text_idx));
+  status=(u8)(status|ascii_hex_to_u64_convert(text_base, &integer, U64_MAX));
+  if(fraction_text_base){
+    text_idx=(ULONG)(strlen(fraction_text_base));
+    status=(u8)(status|(!text_idx)|(part_digit_count_max<text_idx));
+    status=(u8)(status|ascii_hex_to_u64_convert(fraction_text_base, &fraction, U64_MAX));
+    if(!status){
+/*
+Left-justify the fraction. There is at least one digit, so the shift is less than U64_BITS.
+*/
+      fraction<<=(part_digit_count_max-text_idx)<<2;
+    }
+  }
+  threshold_u64=0;
+  U128_SET_ZERO(threshold_u128);
+  if(!status){
+    if(!precise_status){
+      threshold_u64=(integer<<U32_BITS)|fraction;
+    }else{
+      U128_FROM_U64_PAIR(threshold_u128, fraction, integer);
+    }
+  }
+  *threshold_u128_base=threshold_u128;
+  *threshold_u64_base=threshold_u64;
+  return status;
+}
+
 void
 skan_too_big_print(u8 emit_mode, char *text_base){
   if(EMIT1<=emit_mode){
@@ -113,47 +831,419 @@ skan_too_big_print(u8 emit_mode, char *text_base){
     #endif
     EMIT_WRITE(".");
   }
-  return;
-}
-
-void
-skan_warning_print(u8 emit_mode, char *text_base){
-  if(EMIT2<=emit_mode){
-    EMIT_PRINT("WARNING: ");
-    EMIT_PRINT(text_base);
-    EMIT_WRITE(".");
+  return;
+}
+
+void
+skan_warning_print(u8 emit_mode, char *text_base){
+  if(EMIT2<=emit_mode){
+    EMIT_PRINT("WARNING: ");
+    EMIT_PRINT(text_base);
+    EMIT_WRITE(".");
+  }
+  return;
+}
+
+void
+skan_whole_folder_file_print(skan_folder_t *folder_base, ULONG filename_idx){
+/*
+Print the CSV row of one file in a folder or, if it couldn't be scanned, a warning in its place. Don't call here directly; use skan_whole_folder_file_scan() instead.
+
+In:
+
+  folder_base is skan_whole_folder_file_scan():In:folder_base.
+
+  filename_idx is the index of the file, the status of which must not be SKAN_FOLDER_STATUS_PENDING.
+
+Out:
+
+  The row or warning has been printed.
+*/
+  u8 emit_mode;
+  u8 file_status;
+  char *filename_base;
+
+  emit_mode=folder_base->emit_mode;
+  file_status=folder_base->status_list_base[filename_idx];
+  filename_base=&folder_base->filename_list_base[folder_base->filename_char_idx_list_base[filename_idx]];
+  if(file_status==SKAN_FOLDER_STATUS_DONE){
+    EMIT_PRINT(filename_base);
+    skan_comma_print();
+    skan_extremes_print(&folder_base->entropy_list_base[filename_idx]);
+  }else if(EMIT2<=emit_mode){
+    EMIT_PRINT("WARNING: Skipped ");
+    EMIT_PRINT(filename_base);
+    if(file_status==SKAN_FOLDER_STATUS_READ_FAIL){
+      EMIT_WRITE(" because it could not be read.");
+    }else if(file_status==SKAN_FOLDER_STATUS_SIZE_FAIL){
+      EMIT_WRITE(" because its size is not a nonzero multiple of ((wholes_per_row)*(whole_size)).");
+    }else if(file_status==SKAN_FOLDER_STATUS_HEIGHT_FAIL){
+      EMIT_WRITE(" because it has fewer than (window_height) rows.");
+    }else{
+      EMIT_WRITE(" because it changed during execution.");
+    }
+  }
+  return;
+}
+
+void *
+skan_whole_folder_file_scan(void *folder_base){
+/*
+Execute one thread's share of skan_whole_folder_scan(), taking one file at a time from the list until none remain. On the first pass, validate the size of each file and find its maximum whole. On the second, scan each file which passed, then print the CSV rows, or warnings, of all files which precede the first one not yet done, so that they appear in list order regardless of which thread finishes first.
+
+In:
+
+  folder_base is the base of a skan_folder_t prepared by skan_whole_folder_scan(). (entropy_base) is NULL on the first pass, else a clone to reuse for every file.
+
+Out:
+
+  Returns NULL.
+
+  On the first pass, the status of each file which can't be scanned has been set to one of SKAN_FOLDER_STATUS_*_FAIL, and (whole_max_max) and (whole_y_idx_max_max) of the first skan_folder_t have been raised to cover every file which can.
+
+  On the second pass, (overflow_status) is one if fracterval underflow or overflow occurred in any file scanned by this thread, else zero.
+*/
+  entropy_t *entropy_base;
+  ULONG file_size;
+  u8 file_status;
+  ULONG filename_char_idx;
+  ULONG filename_count;
+  ULONG filename_idx;
+  u8 filesys_status;
+  skan_folder_t *folder_base_local;
+  skan_folder_t *folder_list_base;
+  u8 overflow_status;
+  ULONG print_idx;
+  ULONG row_size;
+  u8 *status_list_base;
+  u8 *whole_u8_list_base;
+  u32 whole_max;
+  ULONG whole_y_idx_post;
+
+  folder_base_local=(skan_folder_t *)(folder_base);
+  folder_list_base=(skan_folder_t *)(folder_base_local->folder_list_base);
+  entropy_base=folder_base_local->entropy_base;
+  filename_count=folder_base_local->filename_count;
+  overflow_status=0;
+  row_size=folder_base_local->row_size;
+  status_list_base=folder_base_local->status_list_base;
+  whole_u8_list_base=folder_base_local->whole_u8_list_base;
+  do{
+    pthread_mutex_lock(folder_base_local->mutex_base);
+    filename_idx=folder_list_base[0].filename_idx;
+    if(filename_idx!=filename_count){
+      folder_list_base[0].filename_idx=filename_idx+1;
+    }
+    pthread_mutex_unlock(folder_base_local->mutex_base);
+    if(filename_idx==filename_count){
+      break;
+    }
+/*
+Only the thread which takes a file writes its status, which was last written on the first pass if at all, so it can be read without the mutex.
+*/
+    file_status=status_list_base[filename_idx];
+    whole_max=0;
+    whole_y_idx_post=0;
+    if(file_status==SKAN_FOLDER_STATUS_PENDING){
+      file_size=folder_base_local->file_size_max;
+      filename_char_idx=folder_base_local->filename_char_idx_list_base[filename_idx];
+      filesys_status=filesys_file_read_next(&file_size, &filename_char_idx, folder_base_local->filename_list_base, whole_u8_list_base);
+      file_status=SKAN_FOLDER_STATUS_READ_FAIL;
+      if(!filesys_status){
+        file_status=SKAN_FOLDER_STATUS_SIZE_FAIL;
+        if(file_size&&!(file_size%row_size)){
+          file_status=SKAN_FOLDER_STATUS_HEIGHT_FAIL;
+          whole_y_idx_post=file_size/row_size;
+          if(folder_base_local->window_y_idx_post<=whole_y_idx_post){
+            file_status=SKAN_FOLDER_STATUS_PENDING;
+            whole_max=whole_max_get(folder_base_local->granularity, file_size/(ULONG)(folder_base_local->granularity+1)-1, whole_u8_list_base);
+          }
+        }
+      }
+      if(entropy_base){
+/*
+The file passed the first pass, so any failure now means that it changed in the meantime. In particular, its wholes must not exceed those for which the lookup lists were computed.
+*/
+        if((file_status!=SKAN_FOLDER_STATUS_PENDING)||(entropy_base->whole_max_max<whole_max)||transform_clone_reset(entropy_base, folder_base_local->transform_base, whole_y_idx_post-1)){
+          file_status=SKAN_FOLDER_STATUS_CHANGED;
+        }else{
+          overflow_status=(u8)(overflow_status|transform_dispatch(entropy_base, folder_base_local->transform_base, whole_u8_list_base));
+          memcpy(&folder_base_local->entropy_list_base[filename_idx], entropy_base, sizeof(entropy_t));
+          file_status=SKAN_FOLDER_STATUS_DONE;
+        }
+      }
+    }
+    pthread_mutex_lock(folder_base_local->mutex_base);
+    status_list_base[filename_idx]=file_status;
+    if(!entropy_base){
+      if(file_status==SKAN_FOLDER_STATUS_PENDING){
+        folder_list_base[0].whole_max_max=MAX(folder_list_base[0].whole_max_max, whole_max);
+        folder_list_base[0].whole_y_idx_max_max=MAX(folder_list_base[0].whole_y_idx_max_max, whole_y_idx_post-1);
+      }
+    }else{
+      print_idx=folder_list_base[0].print_idx;
+      while((print_idx!=filename_count)&&(status_list_base[print_idx]!=SKAN_FOLDER_STATUS_PENDING)){
+        skan_whole_folder_file_print(folder_base_local, print_idx);
+        print_idx++;
+      }
+      folder_list_base[0].print_idx=print_idx;
+    }
+    pthread_mutex_unlock(folder_base_local->mutex_base);
+  }while(1);
+  folder_base_local->overflow_status=overflow_status;
+  return NULL;
+}
+
+u8
+skan_whole_folder_scan(u8 algo_status, u8 discount_status, u8 emit_mode, ULONG file_size_max, ULONG filename_count, char *filename_list_base, u8 granularity, u8 header_status, u8 optimize_status, u8 *overflow_status_base, u8 precise_status, u8 rounding_status, ULONG thread_idx_max, ULONG whole_x_idx_max, ULONG window_x_idx_max, ULONG window_y_idx_max){
+/*
+Scan every file in a folder of whole files separately, but with lookup lists computed only once, for the greatest whole in any of them, and print one CSV row per file, prefixed with its name, in the order given. The files are distributed among a pool of threads, each of which takes the next file as soon as it's done with the previous one. Every file is read twice, first to find its maximum whole.
+
+In:
+
+  algo_status is transform_malloc():In:algo_status.
+
+  discount_status is transform_malloc():In:discount_status.
+
+  emit_mode is the verbosity, as used by skan_error_print().
+
+  file_size_max is filesys_filename_list_get():Out:*file_size_max_base. Nonzero.
+
+  filename_count is the number of files at filename_list_base. Nonzero.
+
+  filename_list_base is filesys_filename_list_sort():Out:*filename_list_base.
+
+  granularity is transform_malloc():In:granularity.
+
+  header_status is one to print the CSV header first, else zero.
+
+  optimize_status is transform_malloc():In:optimize_status.
+
+  *overflow_status_base is undefined.
+
+  precise_status is transform_malloc():In:precise_status.
+
+  rounding_status is transform_malloc():In:rounding_status.
+
+  thread_idx_max is the number of threads in the pool, less one. Each thread requires its own buffer of file_size_max bytes.
+
+  whole_x_idx_max is transform_malloc():In:whole_x_idx_max, which must not overflow when multiplied by (granularity+1).
+
+  window_x_idx_max is transform_malloc():In:window_x_idx_max.
+
+  window_y_idx_max is transform_malloc():In:window_y_idx_max.
+
+Out:
+
+  Returns one if an error occurred, which has been printed, else zero. Files which can't be scanned because of their size, or which change between reads, are reported by warnings in place of their CSV rows, and aren't errors.
+
+  *overflow_status_base is one if fracterval underflow or overflow occurred in any file, else zero.
+
+  The CSV rows of all files have been printed, unless an error occurred.
+*/
+  entropy_t *entropy_base;
+  entropy_t *entropy_list_base;
+  ULONG entropy_list_size;
+  ULONG filename_char_idx;
+  ULONG *filename_char_idx_list_base;
+  ULONG filename_idx;
+  skan_folder_t *folder_list_base;
+  pthread_mutex_t mutex;
+  u8 overflow_status;
+  u8 status;
+  u8 *status_list_base;
+  ULONG thread_idx;
+  transform_t *transform_base;
+  ULONG whole_idx_max;
+
+  entropy_base=NULL;
+  overflow_status=0;
+  transform_base=NULL;
+  thread_idx_max=MIN(thread_idx_max, filename_count-1);
+  folder_list_base=DEBUG_CALLOC_PARANOID((thread_idx_max+1)*(ULONG)(sizeof(skan_folder_t)));
+  entropy_list_size=filename_count*(ULONG)(sizeof(entropy_t));
+  entropy_list_base=NULL;
+  if((entropy_list_size/(ULONG)(sizeof(entropy_t)))==filename_count){
+    entropy_list_base=DEBUG_MALLOC_PARANOID(entropy_list_size);
+  }
+  filename_char_idx_list_base=DEBUG_MALLOC_PARANOID(filename_count<<ULONG_SIZE_LOG2);
+  status_list_base=DEBUG_CALLOC_PARANOID(filename_count);
+  status=!(folder_list_base&&entropy_list_base&&filename_char_idx_list_base&&status_list_base);
+  if(!status){
+    filename_char_idx=0;
+    filename_idx=0;
+    do{
+      filename_char_idx_list_base[filename_idx]=filename_char_idx;
+      filename_char_idx+=(ULONG)(strlen(&filename_list_base[filename_char_idx]))+1;
+    }while((++filename_idx)!=filename_count);
+/*
+Make every allocation in this thread because DEBUG_MALLOC_PARANOID() isn't thread-safe in debug builds.
+*/
+    whole_idx_max=(file_size_max-1)/(ULONG)(granularity+1);
+    thread_idx=0;
+    do{
+      folder_list_base[thread_idx].whole_u8_list_base=whole_list_malloc(granularity, whole_idx_max);
+      status=(u8)(status|!folder_list_base[thread_idx].whole_u8_list_base);
+    }while((thread_idx++)!=thread_idx_max);
+  }
+  if(!status){
+    pthread_mutex_init(&mutex, NULL);
+    thread_idx=0;
+    do{
+      folder_list_base[thread_idx].entropy_list_base=entropy_list_base;
+      folder_list_base[thread_idx].filename_char_idx_list_base=filename_char_idx_list_base;
+      folder_list_base[thread_idx].filename_list_base=filename_list_base;
+      folder_list_base[thread_idx].folder_list_base=folder_list_base;
+      folder_list_base[thread_idx].mutex_base=&mutex;
+      folder_list_base[thread_idx].status_list_base=status_list_base;
+      folder_list_base[thread_idx].file_size_max=file_size_max;
+      folder_list_base[thread_idx].filename_count=filename_count;
+      folder_list_base[thread_idx].row_size=(whole_x_idx_max+1)*(ULONG)(granularity+1);
+      folder_list_base[thread_idx].window_y_idx_post=window_y_idx_max+1;
+      folder_list_base[thread_idx].emit_mode=emit_mode;
+      folder_list_base[thread_idx].granularity=granularity;
+    }while((thread_idx++)!=thread_idx_max);
+/*
+The first pass finds the maximum whole and row count among the files which can be scanned. (folder_list_base[0].entropy_base) is NULL, which tells the workers not to scan yet.
+*/
+    thread_list_run(NULL, skan_whole_folder_file_scan, folder_list_base, (ULONG)(sizeof(skan_folder_t)), thread_idx_max);
+    status=!folder_list_base[0].whole_y_idx_max_max;
+    if(status){
+      skan_error_print(emit_mode, "No file in (whole_file) has a size which is a nonzero multiple of ((wholes_per_row)*(whole_size)) and at least (window_height) rows");
+    }else{
+      transform_malloc(algo_status, discount_status, &entropy_base, NULL, granularity, optimize_status, precise_status, rounding_status, &transform_base, folder_list_base[0].whole_max_max, whole_x_idx_max, folder_list_base[0].whole_y_idx_max_max, window_x_idx_max, window_y_idx_max);
+      status=!entropy_base;
+      if(!status){
+        thread_idx=0;
+        do{
+          transform_clone(entropy_base, &folder_list_base[thread_idx].entropy_base, transform_base, &folder_list_base[thread_idx].transform_base);
+          status=(u8)(status|!folder_list_base[thread_idx].entropy_base);
+        }while((thread_idx++)!=thread_idx_max);
+      }
+      if(status){
+        skan_out_of_memory_print(emit_mode);
+      }
+    }
+    if(!status){
+      if(header_status){
+        EMIT_PRINT("WHOLE_FILE,");
+        skan_header_print(discount_status);
+      }
+      folder_list_base[0].filename_idx=0;
+      thread_list_run(NULL, skan_whole_folder_file_scan, folder_list_base, (ULONG)(sizeof(skan_folder_t)), thread_idx_max);
+      thread_idx=0;
+      do{
+        overflow_status=(u8)(overflow_status|folder_list_base[thread_idx].overflow_status);
+      }while((thread_idx++)!=thread_idx_max);
+    }
+    pthread_mutex_destroy(&mutex);
+  }else{
+    skan_out_of_memory_print(emit_mode);
+  }
+  if(folder_list_base){
+    thread_idx=0;
+    do{
+      transform_free_all(&folder_list_base[thread_idx].entropy_base, &folder_list_base[thread_idx].transform_base);
+      whole_free(folder_list_base[thread_idx].whole_u8_list_base);
+    }while((thread_idx++)!=thread_idx_max);
   }
-  return;
+  transform_free_all(&entropy_base, &transform_base);
+  transform_free(folder_list_base);
+  transform_free(entropy_list_base);
+  transform_free(filename_char_idx_list_base);
+  transform_free(status_list_base);
+  *overflow_status_base=overflow_status;
+  return status;
 }
 
 int
 main(int argc, char *argv[]){
+  char *above_text_base;
+  u128 above_threshold_u128;
+  u64 above_threshold_u64;
   u8 algo_status;
   ULONG arg_idx;
+  char *bands_text_base;
+  thread_barrier_t *barrier_base;
+  char *below_text_base;
+  u128 below_threshold_u128;
+  u64 below_threshold_u64;
+  ULONG buffer_y_idx_post;
+  char *cache_pathname_base;
+  char *checkpoint_pathname_base;
+  ULONG chunk_y_idx_post;
+  char *disjoint_text_base;
   u8 discount_status;
   u8 emit_mode;
   entropy_t *entropy_base;
+  ULONG entropy_y_idx_post;
   ULONG fakefloat_list_size;
   u32 *fakefloat_list_base;
+  ULONG fakefloat_row_size;
+  ULONG fakefloat_y_idx_post;
+  u8 fatal_status;
+  ULONG file_size_max;
+  ULONG file_size_sum;
+  u8 file_status;
+  ULONG filename_count;
+  char *filename_list_base;
+  ULONG filename_list_size;
+  ULONG filename_list_size_new;
   u8 filesys_status;
   u8 flags;
   u8 float_file_status;
+  ULONG float_file_size;
   char *float_pathname_base;
+  u8 folder_status;
   u8 granularity;
   u8 header_status;
+  ULONG height_idx;
+  ULONG height_idx_max;
+  ULONG *height_list_base;
+  char *heights_text_base;
+  u8 hit_status;
+  char *memo_pathname_base;
   u8 optimize_status;
   u8 overflow_status;
   u64 parameter;
   char *parameter_text_base;
+  ULONG precompute_idx;
+  ULONG precompute_idx_max;
+  ULONG *precompute_list_base;
+  char *precompute_text_base;
   u8 precise_status;
+  ULONG rank_idx_max_max;
+  char *resume_text_base;
+  u8 retry_status;
   u8 rounding_status;
+  ULONG row_y_idx_min;
+  char *screen_text_base;
+  ULONG state_size;
+  u8 *state_u8_list_base;
   u8 status;
+  skan_stream_t stream_list_base[2];
+#ifdef TRANSFORM_STATS
+  char *stats_pathname_base;
+#endif
+  u8 sink_status;
+  char *stream_text_base;
+  u8 sweep_status;
+  ULONG thread_idx_max;
+  char *threads_text_base;
+  char *transpose_text_base;
+  ULONG transpose_tile_idx_max;
+  char *top_text_base;
   transform_t *transform_base;
   ULONG whole_file_size;
   ULONG whole_idx_max;
   u32 whole_max;
+  u32 whole_max_new;
   char *whole_pathname_base;
   u8 whole_size;
+  ULONG width_idx;
+  ULONG width_idx_max;
+  ULONG *width_list_base;
+  char *widths_text_base;
   ULONG whole_u8_idx_post;
   u8 *whole_u8_list_base;
   ULONG whole_x_idx_max;
@@ -170,14 +1260,43 @@ main(int argc, char *argv[]){
 
   status=ascii_init(ASCII_BUILD_BREAK_COUNT_EXPECTED, 0);
   status=(u8)(status|filesys_init(FILESYS_BUILD_BREAK_COUNT_EXPECTED, 5));
-  status=(u8)(status|transform_init(TRANSFORM_BUILD_BREAK_COUNT_EXPECTED, 0));
+  status=(u8)(status|thread_init(THREAD_BUILD_BREAK_COUNT_EXPECTED, 0));
+  status=(u8)(status|transform_init(TRANSFORM_BUILD_BREAK_COUNT_EXPECTED, 19));
   status=(u8)(status|whole_init(WHOLE_BUILD_BREAK_COUNT_EXPECTED, 0));
   emit_mode=EMIT3;
+  barrier_base=NULL;
   entropy_base=NULL;
   overflow_status=0;
   fakefloat_list_base=NULL;
+  filename_list_base=NULL;
+  height_idx_max=0;
+  height_list_base=NULL;
+  precompute_idx_max=0;
+  precompute_list_base=NULL;
+  state_u8_list_base=NULL;
   transform_base=NULL;
   whole_u8_list_base=NULL;
+  width_idx_max=0;
+  width_list_base=NULL;
+  above_text_base=skan_option_get(&argc, argv, "above");
+  bands_text_base=skan_option_get(&argc, argv, "bands");
+  below_text_base=skan_option_get(&argc, argv, "below");
+  cache_pathname_base=skan_option_get(&argc, argv, "cache");
+  checkpoint_pathname_base=skan_option_get(&argc, argv, "checkpoint");
+  disjoint_text_base=skan_option_get(&argc, argv, "disjoint");
+  heights_text_base=skan_option_get(&argc, argv, "heights");
+  memo_pathname_base=skan_option_get(&argc, argv, "memo");
+  precompute_text_base=skan_option_get(&argc, argv, "precompute");
+  resume_text_base=skan_option_get(&argc, argv, "resume");
+  screen_text_base=skan_option_get(&argc, argv, "screen");
+#ifdef TRANSFORM_STATS
+  stats_pathname_base=skan_option_get(&argc, argv, "stats");
+#endif
+  stream_text_base=skan_option_get(&argc, argv, "stream");
+  threads_text_base=skan_option_get(&argc, argv, "threads");
+  top_text_base=skan_option_get(&argc, argv, "top");
+  transpose_text_base=skan_option_get(&argc, argv, "transpose");
+  widths_text_base=skan_option_get(&argc, argv, "widths");
   do{
     if(status){
       skan_error_print(emit_mode, "Outdated source code");
@@ -186,12 +1305,12 @@ main(int argc, char *argv[]){
     status=1;
     if((argc!=9)&&(argc!=11)){
       EMIT_WRITE("Skan\nCopyright 2021 Russell Leidich\nhttps://github.com/egione/Widebandit");
-      EMIT_WRITE("Build 1");
+      EMIT_WRITE("Build 19");
       EMIT_WRITE("Compute a 2D rolling window entropy transform of discretized power amplitudes");
       EMIT_WRITE("(whole numbers) across frequencies (columns) and spectra (rows).\n");
       EMIT_WRITE("Syntax:\n");
       EMIT_WRITE("  skan verbosity whole_size row_width whole_file float_file flags window_width");
-      EMIT_WRITE("  window_height [x_min y_min]\n");
+      EMIT_WRITE("  window_height [x_min y_min] [--option=value ...]\n");
       EMIT_WRITE("where all values are decimal unless otherwise stated and:\n");
       EMIT_WRITE("  (verbosity) is one of:\n");
       EMIT_WRITE("    0: Report only errors.\n");
@@ -200,7 +1319,15 @@ main(int argc, char *argv[]){
       EMIT_WRITE("  (whole_size) is the number of bytes per whole in (whole_file), up to 4.\n");
       EMIT_WRITE("  (row_width) is the number of wholes per spectrum.\n");
       EMIT_WRITE("  (whole_file) is the name of the file containing spectra of (row_width) wholes");
-      EMIT_WRITE("  of size (whole_size).\n");
+      EMIT_WRITE("  of size (whole_size). If it's a folder, then every file therein, in sorted");
+      EMIT_WRITE("  order, is scanned separately, printing one CSV row per file, prefixed with its");
+      EMIT_WRITE("  name. Files of unsuitable size are skipped with a warning. Lookup lists are");
+      EMIT_WRITE("  computed only once, for the greatest whole in any file, so entropies are");
+      EMIT_WRITE("  comparable across files, but may differ from those of separate scans of files");
+      EMIT_WRITE("  with lesser wholes. --threads is then the number of files to scan at once.");
+      EMIT_WRITE("  (float_file) must be \"-\". Not allowed with (x_min), --above, --below,");
+      EMIT_WRITE("  --bands, --checkpoint, --heights, --screen, --stream, --top, --transpose, or");
+      EMIT_WRITE("  --widths.\n");
       EMIT_WRITE("  (float_file) is the file to which to dump 32-bit floating-point entropy values");
       EMIT_WRITE("  encoded as discount nats below maximum window entropy. Enter \"-\" to save");
       EMIT_WRITE("  time by not writing this file.\n");
@@ -234,6 +1361,89 @@ main(int argc, char *argv[]){
       EMIT_WRITE("  (float_file) must be \"-\".\n");
       EMIT_WRITE("  (y_min) must be specified if and only if (x_min) is specified. It is the");
       EMIT_WRITE("  corresponding zero-based row number.\n");
+      EMIT_WRITE("Options may appear anywhere after \"skan\" and are:\n");
+      EMIT_WRITE("  --above=(threshold) writes to (float_file), instead of every fakefloat, one");
+      EMIT_WRITE("  24-byte record per window of mean entropy at least (threshold), in row-major");
+      EMIT_WRITE("  order and in the same units as the fakefloats would have been. Each record");
+      EMIT_WRITE("  is the window's (x_min) and (y_min) as 64-bit integers, then fakefloats");
+      EMIT_WRITE("  bounding its entropy from below and above, all host-endian. (threshold) is");
+      EMIT_WRITE("  hex fixed-point like the CSV output, with up to 8 hex digits on either side");
+      EMIT_WRITE("  of the period, or 16 if (flags.precise). Records are written while the scan");
+      EMIT_WRITE("  proceeds. Not allowed with (x_min) or --threads.\n");
+      EMIT_WRITE("  --bands divides the rows into contiguous bands, one per thread, instead of");
+      EMIT_WRITE("  dividing each row. Each band restarts the rolling computation at its first");
+      EMIT_WRITE("  row, so in (flags.optimize) mode the last bits of the result may differ from");
+      EMIT_WRITE("  an unbanded scan. Without (flags.optimize), bands are always used when");
+      EMIT_WRITE("  --threads exceeds 1, and results are identical regardless.\n");
+      EMIT_WRITE("  --below=(threshold) is like --above, but for windows of mean entropy at most");
+      EMIT_WRITE("  (threshold). If both are specified, then windows satisfying either are");
+      EMIT_WRITE("  written.\n");
+      EMIT_WRITE("  --cache=(cache_file) takes the logs underlying the lookup tables from");
+      EMIT_WRITE("  (cache_file) if it's valid and covers the required range, which makes startup");
+      EMIT_WRITE("  much faster for large (whole_size). Otherwise it computes them and creates or");
+      EMIT_WRITE("  extends (cache_file) for next time. The same file serves all (flags) and");
+      EMIT_WRITE("  whole sizes, but is host-specific.\n");
+      EMIT_WRITE("  --checkpoint=(checkpoint_file) implies --stream and saves the state of the");
+      EMIT_WRITE("  scan after the last row to (checkpoint_file), so that --resume can process");
+      EMIT_WRITE("  rows appended to (whole_file) later. The file is host-specific and may be");
+      EMIT_WRITE("  large because it contains frequency lists for every column.\n");
+      EMIT_WRITE("  --disjoint requires --top and excludes any window which overlaps a more");
+      EMIT_WRITE("  extreme window already in the same list.\n");
+      EMIT_WRITE("  --heights=(list) scans once per window height in the comma-separated (list)");
+      EMIT_WRITE("  instead of just (window_height), printing one CSV row per window size.");
+      EMIT_WRITE("  Lookup lists are computed only once, for the greatest height. (float_file)");
+      EMIT_WRITE("  must be \"-\". Not allowed with (x_min), --bands, --checkpoint, --stream,");
+      EMIT_WRITE("  --threads, or --top.\n");
+      EMIT_WRITE("  --memo=(memo_file) takes the maximum logfreedom for each window height and");
+      EMIT_WRITE("  maximum whole from (memo_file), if it has a record for them from this build,");
+      EMIT_WRITE("  instead of approximating it. Otherwise it appends the approximation for next");
+      EMIT_WRITE("  time. Only applies to (flags.algo) logfreedom. The file is host-specific.\n");
+      EMIT_WRITE("  --precompute=(list) requires --memo and (flags.algo) logfreedom, and fills");
+      EMIT_WRITE("  (memo_file) for every combination of (window_height), or each height in");
+      EMIT_WRITE("  --heights, and each maximum whole in the comma-separated (list), instead of");
+      EMIT_WRITE("  scanning. Not allowed with (x_min).\n");
+      EMIT_WRITE("  --resume requires --checkpoint and scans only the windows which end in rows");
+      EMIT_WRITE("  appended to (whole_file) since (checkpoint_file) was saved, appending their");
+      EMIT_WRITE("  entropies to (float_file) and then updating (checkpoint_file). All other");
+      EMIT_WRITE("  parameters must be the same as before, and the new rows must not contain");
+      EMIT_WRITE("  any whole greater than the maximum seen so far. Results are identical to");
+      EMIT_WRITE("  those of a full scan.\n");
+      EMIT_WRITE("  --screen first estimates the entropy of every window in double precision,");
+      EMIT_WRITE("  with a proven error bound, and then computes fractervals only for those rows");
+      EMIT_WRITE("  which could contain the window of least or greatest entropy, allowing for");
+      EMIT_WRITE("  the width of every fracterval. The reported extremes are identical");
+      EMIT_WRITE("  regardless. (float_file) must be \"-\". Not allowed with (x_min),");
+      EMIT_WRITE("  (flags.optimize), --above, --below, --checkpoint, --heights, --stream, --top,");
+      EMIT_WRITE("  or --widths.\n");
+#ifdef TRANSFORM_STATS
+      EMIT_WRITE("  --stats=(json_file) writes the instrumentation counters of this build, which");
+      EMIT_WRITE("  are also printed at verbosity 2, to (json_file) as a single JSON object.\n");
+#endif
+      EMIT_WRITE("  --stream[=(rows)] reads (whole_file) in chunks of (rows) window rows plus");
+      EMIT_WRITE("  (window_height), while the previous chunk is being scanned, instead of");
+      EMIT_WRITE("  loading it all at once. Memory usage is then independent of the number of");
+      EMIT_WRITE("  rows, and so is that of (float_file), which is written one chunk at a time.");
+      EMIT_WRITE("  (whole_file) is read twice, first to find its maximum whole. Results are");
+      EMIT_WRITE("  identical regardless. By default, (rows) is enough for a few megabytes. Not");
+      EMIT_WRITE("  allowed with (x_min), --bands, or --threads.\n");
+      EMIT_WRITE("  --threads=(count) divides each row among (count) threads, up to 256, and");
+      EMIT_WRITE("  likewise the computation of logs for the lookup tables. Without");
+      EMIT_WRITE("  (flags.optimize), rows are independent, so the threads instead take");
+      EMIT_WRITE("  contiguous bands of whole rows, as with --bands. Results are identical");
+      EMIT_WRITE("  regardless. Default 1.\n");
+      EMIT_WRITE("  --top=(count) additionally reports the (count) windows of least and greatest");
+      EMIT_WRITE("  mean entropy as CSV rows after the usual one, ranked from most extreme. Not");
+      EMIT_WRITE("  allowed with (x_min).\n");
+      EMIT_WRITE("  --transpose[=(tile_width)] keeps a column-major copy of (whole_file) in");
+      EMIT_WRITE("  memory, so that computing each column from scratch reads contiguous memory");
+      EMIT_WRITE("  instead of one whole per row. This doubles memory usage but is much faster");
+      EMIT_WRITE("  on wide files without (flags.optimize). The copy is made in square tiles of");
+      EMIT_WRITE("  (tile_width) wholes, default 64. Results are identical regardless. Not");
+      EMIT_WRITE("  allowed with --stream.\n");
+      EMIT_WRITE("  --widths=(list) is like --heights, but for (window_width). All widths of the");
+      EMIT_WRITE("  same height are derived from the same column state, so in (flags.optimize)");
+      EMIT_WRITE("  mode, each additional width costs much less than a separate scan. Results");
+      EMIT_WRITE("  are identical to those of separate scans.\n");
       break;
     }
     arg_idx=0;
@@ -243,6 +1453,11 @@ main(int argc, char *argv[]){
         skan_error_print(emit_mode, "One or more parameters is encoded using invalid UTF8");
         break;
       }
+      if(arg_idx&&(argv[arg_idx][0]=='-')&&(argv[arg_idx][1]=='-')){
+        status=1;
+        skan_parameter_error_print(emit_mode, argv[arg_idx]);
+        break;
+      }
     }while((++arg_idx)<(ULONG)(argc));
     if(status){
       break;
@@ -334,8 +1549,300 @@ Increment emit_mode because we provide 3 levels, whereas emit.h provides 4. The
       }
       whole_y_idx_min=(ULONG)(parameter);
     }
+    status=(u8)(bands_text_base&&*bands_text_base);
+    if(status){
+      skan_parameter_error_print(emit_mode, "bands");
+      break;
+    }
+    status=(u8)(disjoint_text_base&&(*disjoint_text_base||!top_text_base));
+    if(status){
+      skan_parameter_error_print(emit_mode, "disjoint");
+      break;
+    }
+    rank_idx_max_max=0;
+    if(top_text_base){
+      status=ascii_decimal_to_u64_convert(top_text_base, &parameter, ULONG_MAX);
+      status=(u8)(status|!parameter|window_status);
+      if(status){
+        skan_parameter_error_print(emit_mode, "top");
+        break;
+      }
+      rank_idx_max_max=(ULONG)(parameter-1);
+    }
+    thread_idx_max=0;
+    if(threads_text_base){
+      status=ascii_decimal_to_u64_convert(threads_text_base, &parameter, THREAD_IDX_MAX_MAX+1);
+      status=(u8)(status|!parameter);
+      if(status){
+        skan_parameter_error_print(emit_mode, "threads");
+        break;
+      }
+      thread_idx_max=(ULONG)(parameter-1);
+    }
+    transform_lookup_threads_set(thread_idx_max);
+    if(cache_pathname_base){
+      status=!*cache_pathname_base;
+      if(status){
+        skan_parameter_error_print(emit_mode, "cache");
+        break;
+      }
+      transform_lookup_cache_set(cache_pathname_base);
+    }
+    if(memo_pathname_base){
+      status=!*memo_pathname_base;
+      if(status){
+        skan_parameter_error_print(emit_mode, "memo");
+        break;
+      }
+      transform_logfreedom_memo_set(memo_pathname_base);
+    }
+    if(checkpoint_pathname_base){
+      status=!*checkpoint_pathname_base;
+      status=(u8)(status|window_status|!!bands_text_base|!!thread_idx_max);
+      if(status){
+        skan_parameter_error_print(emit_mode, "checkpoint");
+        break;
+      }
+      if(!stream_text_base){
+        stream_text_base=checkpoint_pathname_base+strlen(checkpoint_pathname_base);
+      }
+    }
+    status=(u8)(resume_text_base&&(*resume_text_base||!checkpoint_pathname_base));
+    if(status){
+      skan_parameter_error_print(emit_mode, "resume");
+      break;
+    }
+#ifdef TRANSFORM_STATS
+    status=(u8)(stats_pathname_base&&!*stats_pathname_base);
+    if(status){
+      skan_parameter_error_print(emit_mode, "stats");
+      break;
+    }
+#endif
+    sweep_status=(heights_text_base||widths_text_base);
+    if(sweep_status){
+      status=(u8)(window_status|!!bands_text_base|!!checkpoint_pathname_base|!!stream_text_base|!!thread_idx_max|!!top_text_base);
+      if(heights_text_base){
+        window_y_idx_post=0;
+        height_list_base=skan_list_parse(&height_idx_max, heights_text_base);
+        status=(u8)(status|!height_list_base);
+        if(!status){
+          height_idx=0;
+          do{
+            status=(u8)(status|(height_list_base[height_idx]<=1));
+            window_y_idx_post=MAX(window_y_idx_post, height_list_base[height_idx]);
+          }while((height_idx++)!=height_idx_max);
+        }
+        if(status){
+          skan_parameter_error_print(emit_mode, "heights");
+          break;
+        }
+      }
+      if(widths_text_base){
+        window_x_idx_post=0;
+        width_list_base=skan_list_parse(&width_idx_max, widths_text_base);
+        status=(u8)(status|!width_list_base);
+        if(!status){
+          width_idx=0;
+          do{
+            status=(u8)(status|!width_list_base[width_idx]);
+            window_x_idx_post=MAX(window_x_idx_post, width_list_base[width_idx]);
+          }while((width_idx++)!=width_idx_max);
+        }
+        if(status){
+          skan_parameter_error_print(emit_mode, "widths");
+          break;
+        }
+      }
+    }
+    if(precompute_text_base){
+      status=(u8)((!memo_pathname_base)|window_status|(algo_status!=TRANSFORM_ALGO_STATUS_LOGFREEDOM));
+      if(!status){
+        precompute_list_base=skan_list_parse(&precompute_idx_max, precompute_text_base);
+        status=!precompute_list_base;
+        if(!status){
+          precompute_idx=0;
+          do{
+            status=(u8)(status|(U32_MAX<precompute_list_base[precompute_idx]));
+          }while((precompute_idx++)!=precompute_idx_max);
+        }
+      }
+      if(status){
+        skan_parameter_error_print(emit_mode, "precompute");
+        break;
+      }
+/*
+Precomputation replaces the scan, so the list of heights, if any, can be converted to maximum whole indexes in place.
+*/
+      if(!height_list_base){
+        window_y_idx_max=window_y_idx_post-1;
+        status=transform_logfreedom_memo_fill(0, &window_y_idx_max, precompute_idx_max, precompute_list_base);
+      }else{
+        height_idx=0;
+        do{
+          height_list_base[height_idx]--;
+        }while((height_idx++)!=height_idx_max);
+        status=transform_logfreedom_memo_fill(height_idx_max, height_list_base, precompute_idx_max, precompute_list_base);
+      }
+      if(status){
+        skan_error_print(emit_mode, "Could not precompute (memo_file)");
+        break;
+      }
+      skan_progress_print(emit_mode, "Done");
+      break;
+    }
+    chunk_y_idx_post=0;
+    if(stream_text_base){
+      parameter=0;
+      if(*stream_text_base){
+        status=ascii_decimal_to_u64_convert(stream_text_base, &parameter, ULONG_MAX);
+        status=(u8)(status|!parameter);
+      }
+      status=(u8)(status|window_status|!!bands_text_base|!!thread_idx_max);
+      if(status){
+        skan_parameter_error_print(emit_mode, "stream");
+        break;
+      }
+      chunk_y_idx_post=(ULONG)(parameter);
+    }
+    transpose_tile_idx_max=0;
+    if(transpose_text_base){
+      parameter=SKAN_TRANSPOSE_TILE_WIDTH_DEFAULT;
+      if(*transpose_text_base){
+        status=ascii_decimal_to_u64_convert(transpose_text_base, &parameter, ULONG_MAX);
+        status=(u8)(status|!parameter);
+      }
+      status=(u8)(status|!!stream_text_base);
+      if(status){
+        skan_parameter_error_print(emit_mode, "transpose");
+        break;
+      }
+      transpose_tile_idx_max=(ULONG)(parameter-1);
+    }
+    above_threshold_u64=0;
+    U128_SET_ZERO(above_threshold_u128);
+    if(above_text_base){
+      status=skan_threshold_parse(precise_status, &above_threshold_u128, &above_threshold_u64, above_text_base);
+      status=(u8)(status|window_status|!!thread_idx_max);
+      if(status){
+        skan_parameter_error_print(emit_mode, "above");
+        break;
+      }
+    }
+    below_threshold_u64=0;
+    U128_SET_ZERO(below_threshold_u128);
+    if(below_text_base){
+      status=skan_threshold_parse(precise_status, &below_threshold_u128, &below_threshold_u64, below_text_base);
+      status=(u8)(status|window_status|!!thread_idx_max);
+      if(status){
+        skan_parameter_error_print(emit_mode, "below");
+        break;
+      }
+    }
+    hit_status=(above_text_base||below_text_base);
+    if(screen_text_base){
+      status=(u8)((!!*screen_text_base)|window_status|optimize_status|hit_status|sweep_status|!!checkpoint_pathname_base|!!stream_text_base|!!top_text_base);
+      if(status){
+        skan_parameter_error_print(emit_mode, "screen");
+        break;
+      }
+    }
     status=1;
     whole_pathname_base=argv[4];
+    fatal_status=0;
+    file_size_max=0;
+    filename_count=0;
+    filename_list_size=U16_MAX;
+    do{
+      filename_list_base=filesys_char_list_malloc(filename_list_size-1);
+      if(!filename_list_base){
+        break;
+      }
+      filename_list_size_new=filename_list_size;
+      retry_status=filesys_filename_list_get(&fatal_status, &file_size_max, &file_size_sum, &file_status, &filename_count, filename_list_base, &filename_list_size_new, whole_pathname_base);
+      if(fatal_status){
+        break;
+      }
+      if(retry_status){
+        filename_list_base=filesys_free(filename_list_base);
+        filename_list_size=filename_list_size_new;
+      }
+    }while(retry_status);
+    if(!filename_list_base){
+      skan_out_of_memory_print(emit_mode);
+      break;
+    }
+/*
+If listing failed, then treat (whole_file) as a file, so that the usual error is reported below.
+*/
+    folder_status=!(fatal_status||file_status);
+    if(folder_status){
+/*
+(whole_file) is a folder, so scan each file therein separately, sharing one set of lookup lists among all of them.
+*/
+      status=(u8)(window_status|hit_status|sweep_status|!!bands_text_base|!!checkpoint_pathname_base|!!screen_text_base|!!stream_text_base|!!top_text_base|!!transpose_text_base);
+      if(status){
+        skan_error_print(emit_mode, "(x_min), --above, --below, --bands, --checkpoint, --heights, --screen, --stream, --top, --transpose, and --widths are not allowed when (whole_file) is a folder");
+        break;
+      }
+      status=1;
+      float_pathname_base=argv[5];
+      if(float_pathname_base[0]&&((float_pathname_base[0]!='-')||float_pathname_base[1])){
+        skan_error_print(emit_mode, "(float_file) must be \"-\" when (whole_file) is a folder");
+        break;
+      }
+      if(!filename_count){
+        skan_error_print(emit_mode, "(whole_file) is an empty folder");
+        break;
+      }
+      if(!file_size_max){
+        skan_error_print(emit_mode, "All files in (whole_file) have zero size");
+        break;
+      }
+      whole_u8_idx_post=whole_x_idx_post*whole_size;
+      if((whole_u8_idx_post/whole_size)!=whole_x_idx_post){
+        skan_too_big_print(emit_mode, "row_width");
+        break;
+      }
+      if(whole_x_idx_post<window_x_idx_post){
+        skan_too_big_print(emit_mode, "window_width");
+        break;
+      }
+      status=filesys_filename_list_sort(filename_count, filename_list_base);
+      if(status){
+        skan_out_of_memory_print(emit_mode);
+        break;
+      }
+      if(EMIT3<=emit_mode){
+        EMIT_U64_DECIMAL("folder.files", filename_count);
+        EMIT_U64_DECIMAL("flags.algo", algo_status);
+        EMIT_U64_DECIMAL("flags.discount", discount_status);
+        EMIT_U64_DECIMAL("flags.header", header_status);
+        EMIT_U64_DECIMAL("flags.optimize", optimize_status);
+        EMIT_U64_DECIMAL("flags.precise", precise_status);
+        EMIT_U64_DECIMAL("row_width", whole_x_idx_post);
+        EMIT_U64_DECIMAL("threads", thread_idx_max+1);
+        EMIT_PRINT("whole_file=");
+        EMIT_WRITE(whole_pathname_base);
+        EMIT_U64_DECIMAL("whole_size", whole_size);
+        EMIT_U64_DECIMAL("window_height", window_y_idx_post);
+        EMIT_U64_DECIMAL("window_width", window_x_idx_post);
+      }
+      status=skan_whole_folder_scan(algo_status, discount_status, emit_mode, file_size_max, filename_count, filename_list_base, granularity, header_status, optimize_status, &overflow_status, precise_status, rounding_status, thread_idx_max, whole_x_idx_post-1, window_x_idx_post-1, window_y_idx_post-1);
+      if(status){
+        break;
+      }
+#ifdef TRANSFORM_STATS
+      filesys_status=skan_stats_print(emit_mode, stats_pathname_base);
+      if(filesys_status){
+        status=1;
+        skan_error_print(emit_mode, "Could not write (json_file)");
+        break;
+      }
+#endif
+      skan_progress_print(emit_mode, "Done");
+      break;
+    }
     filesys_status=filesys_file_size_ulong_get(&whole_file_size, whole_pathname_base);
     if(filesys_status){
       if(filesys_status==FILESYS_STATUS_TOO_BIG){
@@ -380,7 +1887,37 @@ Increment emit_mode because we provide 3 levels, whereas emit.h provides 4. The
     }
     float_pathname_base=argv[5];
     float_file_status=(float_pathname_base[0]&&((float_pathname_base[0]!='-')||float_pathname_base[1]));
+    if(float_file_status&&sweep_status){
+      skan_error_print(emit_mode, "(float_file) must be \"-\" when --heights or --widths is specified");
+      break;
+    }
+    if(hit_status&&!float_file_status){
+      skan_error_print(emit_mode, "(float_file) must not be \"-\" when --above or --below is specified");
+      break;
+    }
+    if(float_file_status&&screen_text_base){
+      skan_error_print(emit_mode, "(float_file) must be \"-\" when --screen is specified");
+      break;
+    }
     if(EMIT3<=emit_mode){
+      if(above_text_base){
+        if(!precise_status){
+          EMIT_F64("above", above_threshold_u64);
+        }else{
+          EMIT_F128("above", above_threshold_u128);
+        }
+      }
+      if(below_text_base){
+        if(!precise_status){
+          EMIT_F64("below", below_threshold_u64);
+        }else{
+          EMIT_F128("below", below_threshold_u128);
+        }
+      }
+      if(checkpoint_pathname_base){
+        EMIT_PRINT("checkpoint_file=");
+        EMIT_WRITE(checkpoint_pathname_base);
+      }
       EMIT_U64_DECIMAL("flags.algo", algo_status);
       EMIT_U64_DECIMAL("flags.discount", discount_status);
       EMIT_U64_DECIMAL("flags.header", header_status);
@@ -392,7 +1929,21 @@ Increment emit_mode because we provide 3 levels, whereas emit.h provides 4. The
         EMIT_WRITE(float_pathname_base);
       }
       EMIT_U64_DECIMAL("row_count", whole_y_idx_post);
+      EMIT_U64_DECIMAL("resume", !!resume_text_base);
       EMIT_U64_DECIMAL("row_width", whole_x_idx_post);
+      EMIT_U64_DECIMAL("stream", !!stream_text_base);
+      if(sweep_status){
+        EMIT_U64_DECIMAL("sweep.heights", height_idx_max+1);
+        EMIT_U64_DECIMAL("sweep.widths", width_idx_max+1);
+      }
+      EMIT_U64_DECIMAL("threads", thread_idx_max+1);
+      if(transpose_text_base){
+        EMIT_U64_DECIMAL("transpose.tile_width", transpose_tile_idx_max+1);
+      }
+      if(top_text_base){
+        EMIT_U64_DECIMAL("top", rank_idx_max_max+1);
+        EMIT_U64_DECIMAL("top.disjoint", !!disjoint_text_base);
+      }
       EMIT_PRINT("whole_file=");
       EMIT_WRITE(whole_pathname_base);
       EMIT_U64_DECIMAL("whole_size", whole_size);
@@ -403,34 +1954,152 @@ Increment emit_mode because we provide 3 levels, whereas emit.h provides 4. The
         EMIT_U64_DECIMAL("y_min", whole_y_idx_min);
       }
     }
+    entropy_y_idx_post=0;
+    fakefloat_row_size=(whole_x_idx_post-window_x_idx_post+1)<<U32_SIZE_LOG2;
+    fakefloat_y_idx_post=whole_y_idx_post-window_y_idx_post+1;
+    whole_max=0;
+    if(resume_text_base){
+      filesys_status=filesys_file_size_ulong_get(&state_size, checkpoint_pathname_base);
+      if(filesys_status){
+        skan_error_print(emit_mode, "(checkpoint_file) not found");
+        break;
+      }
+      state_u8_list_base=DEBUG_MALLOC_PARANOID(state_size);
+      if(!state_u8_list_base){
+        skan_out_of_memory_print(emit_mode);
+        break;
+      }
+      filesys_status=filesys_file_read_exact(state_size, checkpoint_pathname_base, state_u8_list_base);
+      if(filesys_status){
+        skan_error_print(emit_mode, "Could not read (checkpoint_file)");
+        break;
+      }
+      status=transform_state_check(&entropy_y_idx_post, state_size, state_u8_list_base, &whole_max);
+      if(status){
+        skan_error_print(emit_mode, "(checkpoint_file) is corrupt or was saved by a different build");
+        break;
+      }
+      status=transform_state_parameters_check(algo_status, discount_status, granularity, optimize_status, precise_status, rank_idx_max_max, !!disjoint_text_base, !!top_text_base, rounding_status, state_u8_list_base, whole_x_idx_post-1, window_x_idx_post-1, window_y_idx_post-1);
+      if(status){
+        skan_error_print(emit_mode, "(checkpoint_file) was saved with different parameters");
+        break;
+      }
+      status=1;
+      if(fakefloat_y_idx_post<entropy_y_idx_post){
+        skan_error_print(emit_mode, "(whole_file) has fewer rows than when (checkpoint_file) was saved");
+        break;
+      }
+      if(float_file_status){
+/*
+The number of hits is unknown, so in that case, just verify that the float file consists of whole records.
+*/
+        filesys_status=filesys_file_size_ulong_get(&float_file_size, float_pathname_base);
+        if(hit_status){
+          filesys_status=(u8)(filesys_status|!!(float_file_size%(ULONG)(sizeof(transform_hit_t))));
+        }else{
+          filesys_status=(u8)(filesys_status|(float_file_size!=(entropy_y_idx_post*fakefloat_row_size)));
+        }
+        if(filesys_status){
+          skan_error_print(emit_mode, "(float_file) does not match (checkpoint_file)");
+          break;
+        }
+      }
+      if(EMIT3<=emit_mode){
+        EMIT_U64_DECIMAL("resume.y_min", entropy_y_idx_post);
+      }
+    }
     whole_idx_max=whole_file_size/whole_size-1;
+    if(stream_text_base){
+/*
+Each half of the stream buffer holds the rows required by one chunk, plus one row of padding so that transform_dispatch_stream() can index every chunk alike.
+*/
+      if(!chunk_y_idx_post){
+        chunk_y_idx_post=MAX(window_y_idx_post, SKAN_STREAM_SIZE_MIN/whole_u8_idx_post);
+      }
+      chunk_y_idx_post=MIN(chunk_y_idx_post, MAX(fakefloat_y_idx_post-entropy_y_idx_post, 1));
+      buffer_y_idx_post=chunk_y_idx_post+window_y_idx_post;
+      stream_list_base[0].buffer_size=buffer_y_idx_post*whole_u8_idx_post;
+      if(((stream_list_base[0].buffer_size/whole_u8_idx_post)!=buffer_y_idx_post)||(stream_list_base[0].buffer_size>>ULONG_BIT_MAX)){
+        skan_too_big_print(emit_mode, "stream");
+        break;
+      }
+      if(EMIT3<=emit_mode){
+        EMIT_U64_DECIMAL("stream.rows", chunk_y_idx_post);
+      }
+      whole_idx_max=(stream_list_base[0].buffer_size<<1)/whole_size-1;
+    }
     whole_u8_list_base=whole_list_malloc(granularity, whole_idx_max);
     if(!whole_u8_list_base){
       skan_out_of_memory_print(emit_mode);
       break;
     }
+    sink_status=float_file_status&&!(stream_text_base||thread_idx_max||window_status);
+    if(sink_status){
+/*
+The wholes are all in memory, but the fakefloats needn't be, so write them a chunk of a few megabytes at a time, overlapping the scan of the next chunk.
+*/
+      chunk_y_idx_post=MAX(SKAN_STREAM_SIZE_MIN/fakefloat_row_size, 1);
+      chunk_y_idx_post=MIN(chunk_y_idx_post, fakefloat_y_idx_post);
+    }
     fakefloat_list_size=0;
     whole_x_idx_max=whole_x_idx_post-1;
     whole_y_idx_max=whole_y_idx_post-1;
     window_x_idx_max=window_x_idx_post-1;
     window_y_idx_max=window_y_idx_post-1;
+    stream_list_base[0].chunk_y_idx_post=chunk_y_idx_post;
+    stream_list_base[0].fakefloat_list_base=NULL;
+    stream_list_base[0].float_pathname_base=NULL;
+    stream_list_base[0].row_size=whole_u8_idx_post;
+    stream_list_base[0].stream_status=!!stream_text_base;
+    stream_list_base[0].whole_pathname_base=whole_pathname_base;
+    stream_list_base[0].whole_u8_list_base=whole_u8_list_base;
     if(float_file_status){
       if(window_status){
         skan_error_print(emit_mode, "(float_file) must be \"-\" when (x_min) is specified. (x_min) and (y_min) are mainly just intended for verification. Setting (flags.precise) is the best place to ensure that (float_file) is accurate");
         break;
       }
-      filesys_status=filesys_file_write_obnoxious(0, 0, float_pathname_base, float_pathname_base);
-      if(filesys_status){
-        skan_error_print(emit_mode, "Could not create (float_file), perhaps due to a bad path");
-        break;
+      if(!resume_text_base){
+        filesys_status=filesys_file_write_obnoxious(0, 0, float_pathname_base, float_pathname_base);
+        if(filesys_status){
+          skan_error_print(emit_mode, "Could not create (float_file), perhaps due to a bad path");
+          break;
+        }
+      }
+      if(hit_status){
+/*
+No fakefloats are written, so don't compute them either.
+*/
+        stream_list_base[0].float_pathname_base=float_pathname_base;
+      }else if(!(stream_text_base||sink_status)){
+        fakefloat_list_base=transform_fakefloat_list_malloc(&fakefloat_list_size, whole_x_idx_max, whole_y_idx_max, window_x_idx_max, window_y_idx_max);
+      }else{
+/*
+Allocate room for two chunks, so that one can be written while the next is computed, each with one more row than it requires because transform_dispatch_stream() leaves the first row undefined.
+*/
+        fakefloat_list_base=transform_fakefloat_list_malloc(&fakefloat_list_size, whole_x_idx_max, (chunk_y_idx_post<<1)+1+window_y_idx_max, window_x_idx_max, window_y_idx_max);
+        stream_list_base[0].fakefloat_list_base=fakefloat_list_base;
+        stream_list_base[0].float_pathname_base=float_pathname_base;
       }
-      fakefloat_list_base=transform_fakefloat_list_malloc(&fakefloat_list_size, whole_x_idx_max, whole_y_idx_max, window_x_idx_max, window_y_idx_max);
-      if(!fakefloat_list_base){
+      if(!(fakefloat_list_base||hit_status)){
         skan_out_of_memory_print(emit_mode);
         break;
       }
     }
-    filesys_status=filesys_file_read_exact(whole_file_size, whole_pathname_base, whole_u8_list_base);
+    if(!stream_text_base){
+      filesys_status=filesys_file_read_exact(whole_file_size, whole_pathname_base, whole_u8_list_base);
+    }else{
+/*
+When resuming, only the rows which follow those covered by the checkpoint need to be inspected.
+*/
+      row_y_idx_min=0;
+      if(resume_text_base){
+        row_y_idx_min=entropy_y_idx_post+window_y_idx_max;
+      }
+      whole_max_new=0;
+      if(row_y_idx_min!=whole_y_idx_post){
+        filesys_status=skan_stream_whole_max_get(granularity, row_y_idx_min, &stream_list_base[0], &whole_max_new, whole_y_idx_post);
+      }
+    }
     if((filesys_status==FILESYS_STATUS_SIZE_CHANGED)||(filesys_status==FILESYS_STATUS_TOO_BIG)){
       skan_error_print(emit_mode, "(whole_file) changed during execution");
       break;
@@ -438,7 +2107,14 @@ Increment emit_mode because we provide 3 levels, whereas emit.h provides 4. The
       skan_error_print(emit_mode, "Could not read (whole_file), perhaps due to a bad path");
       break;
     }
-    whole_max=whole_max_get(granularity, whole_idx_max, whole_u8_list_base);
+    if(!stream_text_base){
+      whole_max=whole_max_get(granularity, whole_idx_max, whole_u8_list_base);
+    }else if(!resume_text_base){
+      whole_max=whole_max_new;
+    }else if(whole_max<whole_max_new){
+      skan_error_print(emit_mode, "(whole_file) has new wholes greater than any seen when (checkpoint_file) was saved, so scan it without --resume");
+      break;
+    }
     if(window_status){
       optimize_status=0;
     }
@@ -447,8 +2123,133 @@ Increment emit_mode because we provide 3 levels, whereas emit.h provides 4. The
       skan_out_of_memory_print(emit_mode);
       break;
     }
-    if(!window_status){
-      overflow_status=transform_dispatch(entropy_base, transform_base, whole_u8_list_base);
+    if(top_text_base){
+      status=transform_rank_init(entropy_base, !!disjoint_text_base, rank_idx_max_max);
+      if(status){
+        skan_out_of_memory_print(emit_mode);
+        break;
+      }
+      status=1;
+    }
+    if(hit_status){
+      status=0;
+      if(above_text_base){
+        status=transform_hit_init(entropy_base, 1, above_threshold_u128, above_threshold_u64);
+      }
+      if(below_text_base){
+        status=(u8)(status|transform_hit_init(entropy_base, 0, below_threshold_u128, below_threshold_u64));
+      }
+      if(status){
+        skan_out_of_memory_print(emit_mode);
+        break;
+      }
+      status=1;
+    }
+    if(screen_text_base){
+      status=transform_screen_init(entropy_base, transform_base);
+      if(status){
+        skan_out_of_memory_print(emit_mode);
+        break;
+      }
+      status=1;
+    }
+    if(transpose_text_base){
+      status=transform_transpose_init(entropy_base, transpose_tile_idx_max, transform_base, whole_u8_list_base);
+      if(status){
+        skan_out_of_memory_print(emit_mode);
+        break;
+      }
+      status=1;
+    }
+    if(resume_text_base){
+      status=transform_state_import(entropy_base, &entropy_y_idx_post, state_size, state_u8_list_base, transform_base);
+      if(status){
+        skan_error_print(emit_mode, "(checkpoint_file) was saved with different parameters");
+        break;
+      }
+      status=1;
+    }
+    if(stream_text_base||sink_status){
+      if(entropy_y_idx_post!=fakefloat_y_idx_post){
+        stream_list_base[0].chunk_idx_max=(entropy_base->fakefloat_y_idx_max-entropy_y_idx_post)/chunk_y_idx_post;
+        stream_list_base[0].entropy_base=entropy_base;
+        stream_list_base[0].filesys_status=0;
+        stream_list_base[0].overflow_status=0;
+        stream_list_base[0].stream_list_base=stream_list_base;
+        stream_list_base[0].transform_base=transform_base;
+        stream_list_base[0].thread_idx=0;
+        stream_list_base[0].whole_y_idx_min=entropy_y_idx_post;
+        if(stream_text_base){
+          filesys_status=skan_stream_read(0, &stream_list_base[0]);
+          if(filesys_status){
+            skan_error_print(emit_mode, "Could not read (whole_file), perhaps due to a bad path");
+            break;
+          }
+        }
+        barrier_base=thread_barrier_malloc(1);
+        if(!barrier_base){
+          skan_out_of_memory_print(emit_mode);
+          break;
+        }
+        stream_list_base[0].barrier_base=barrier_base;
+        stream_list_base[1]=stream_list_base[0];
+        stream_list_base[1].thread_idx=1;
+        thread_list_run(barrier_base, skan_stream_thread, stream_list_base, (ULONG)(sizeof(skan_stream_t)), 1);
+        entropy_base->fakefloat_list_base=fakefloat_list_base;
+        overflow_status=stream_list_base[0].overflow_status;
+        filesys_status=stream_list_base[0].filesys_status;
+        if(!filesys_status){
+          filesys_status=stream_list_base[1].filesys_status;
+        }
+        if(filesys_status==FILESYS_STATUS_WRITE_FAIL){
+          skan_error_print(emit_mode, "Could not write (float_file)");
+          break;
+        }else if(filesys_status){
+          skan_error_print(emit_mode, "(whole_file) changed during execution");
+          break;
+        }
+        if(entropy_base->hit_fail_status){
+          skan_out_of_memory_print(emit_mode);
+          break;
+        }
+      }
+      if(checkpoint_pathname_base){
+/*
+Save the checkpoint before discount conversion, which transform_state_export() requires.
+*/
+        state_u8_list_base=transform_free(state_u8_list_base);
+        state_size=transform_state_size_get(entropy_base, transform_base);
+        state_u8_list_base=DEBUG_MALLOC_PARANOID(state_size);
+        if(!state_u8_list_base){
+          skan_out_of_memory_print(emit_mode);
+          break;
+        }
+        transform_state_export(entropy_base, fakefloat_y_idx_post, state_size, state_u8_list_base, transform_base);
+        filesys_status=filesys_file_write_obnoxious(0, state_size, checkpoint_pathname_base, state_u8_list_base);
+        if(filesys_status){
+          skan_error_print(emit_mode, "Could not write (checkpoint_file)");
+          break;
+        }
+      }
+      if(discount_status){
+        overflow_status=(u8)(overflow_status|transform_entropy_to_discount(entropy_base));
+      }
+    }else if(sweep_status){
+      if(header_status){
+        skan_header_print(discount_status);
+      }
+      status=skan_sweep(entropy_base, height_idx_max, (height_list_base?height_list_base:&window_y_idx_post), &overflow_status, transform_base, whole_u8_list_base, width_idx_max, (width_list_base?width_list_base:&window_x_idx_post));
+      if(status){
+        skan_out_of_memory_print(emit_mode);
+        break;
+      }
+      status=1;
+    }else if(!window_status){
+      if(!bands_text_base){
+        overflow_status=transform_dispatch_threaded(entropy_base, thread_idx_max, transform_base, whole_u8_list_base);
+      }else{
+        overflow_status=transform_dispatch_banded(entropy_base, thread_idx_max, transform_base, whole_u8_list_base);
+      }
     }else{
       if(!precise_status){
         overflow_status=transform_whole_list_window_entropy_get_fru64(entropy_base, transform_base, whole_u8_list_base, whole_x_idx_min, whole_y_idx_min);
@@ -456,43 +2257,37 @@ Increment emit_mode because we provide 3 levels, whereas emit.h provides 4. The
         overflow_status=transform_whole_list_window_entropy_get_fru128(entropy_base, transform_base, whole_u8_list_base, whole_x_idx_min, whole_y_idx_min);
       }
     }
-    if(float_file_status){
+    if(float_file_status&&!(stream_text_base||sink_status)){
       filesys_status=filesys_file_write_obnoxious(0, fakefloat_list_size, float_pathname_base, fakefloat_list_base);
       if(filesys_status){
         skan_error_print(emit_mode, "Could not write (float_file)");
         break;
       }
     }
-    if(header_status){
-      if(discount_status){
-        EMIT_PRINT("DISCOUNT_NATS_MIN,DISCOUNT_");
-      }else{
-        EMIT_PRINT("NATS_MIN,");
+    if(header_status&&!sweep_status){
+      skan_header_print(discount_status);
+    }
+    if(!sweep_status){
+      skan_extremes_print(entropy_base);
+    }
+    if(top_text_base){
+      if(header_status){
+        if(discount_status){
+          EMIT_WRITE("EXTREME,RANK,DISCOUNT_NATS_MEAN,X_MIN,Y_MIN");
+        }else{
+          EMIT_WRITE("EXTREME,RANK,NATS_MEAN,X_MIN,Y_MIN");
+        }
       }
-      EMIT_WRITE("NATS_MAX,X_SPAN,Y_SPAN,MIN_X_MIN,MIN_Y_MIN,MAX_X_MIN,MAX_Y_MIN");
+      skan_rank_list_print(entropy_base, 0);
+      skan_rank_list_print(entropy_base, 1);
     }
-    if(!precise_status){
-      EMIT_F64("", entropy_base->min_min_u64);
-      skan_comma_print();
-      EMIT_F64("", entropy_base->max_max_u64);
-    }else{
-      EMIT_F128("", entropy_base->min_min_u128);
-      skan_comma_print();
-      EMIT_F128("", entropy_base->max_max_u128);
+#ifdef TRANSFORM_STATS
+    filesys_status=skan_stats_print(emit_mode, stats_pathname_base);
+    if(filesys_status){
+      skan_error_print(emit_mode, "Could not write (json_file)");
+      break;
     }
-    skan_comma_print();
-    EMIT_U64_DECIMAL("", window_x_idx_post);
-    skan_comma_print();
-    EMIT_U64_DECIMAL("", window_y_idx_post);
-    skan_comma_print();
-    EMIT_U64_DECIMAL("", entropy_base->min_min_x_idx);
-    skan_comma_print();
-    EMIT_U64_DECIMAL("", entropy_base->min_min_y_idx);
-    skan_comma_print();
-    EMIT_U64_DECIMAL("", entropy_base->max_max_x_idx);
-    skan_comma_print();
-    EMIT_U64_DECIMAL("", entropy_base->max_max_y_idx);
-    EMIT_WRITE("");
+#endif
     skan_progress_print(emit_mode, "Done");
     status=0;
   }while(0);
@@ -503,8 +2298,14 @@ Increment emit_mode because we provide 3 levels, whereas emit.h provides 4. The
       skan_warning_print(emit_mode, "Fracterval saturation occurred, which is probably inconsequential");
     }
   }
+  thread_barrier_free(barrier_base);
   transform_free_all(&entropy_base, &transform_base);
   transform_free(fakefloat_list_base);
+  filesys_free(filename_list_base);
+  transform_free(height_list_base);
+  transform_free(precompute_list_base);
+  transform_free(state_u8_list_base);
+  transform_free(width_list_base);
   whole_free(whole_u8_list_base);
   DEBUG_ALLOCATION_CHECK();
   return status;
@@ -0,0 +1,621 @@
+/*
+Widebandit
+Copyright 2021 Russell Leidich
+
+This collection of files constitutes the Widebandit Library. (This is a
+library in the abstact sense; it's not intended to compile to a ".lib"
+file.)
+
+The Widebandit Library is free software: you can redistribute it and/or
+modify it under the terms of the GNU Limited General Public License as
+published by the Free Software Foundation, version 3.
+
+The Widebandit Library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Limited General Public License version 3 for more details.
+
+You should have received a copy of the GNU Limited General Public
+License version 3 along with the Widebandit Library (filename
+"COPYING"). If not, see http://www.gnu.org/licenses/ .
+*/
+/*
+Multispectral Entropy Transform Benchmark
+*/
+#include "flag.h"
+#include "flag_ascii.h"
+#include "flag_filesys.h"
+#include "flag_fracterval_u128.h"
+#include "flag_fracterval_u64.h"
+#include "flag_thread.h"
+#include "flag_transform.h"
+#include "flag_whole.h"
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#ifndef _WIN32
+  #include <sys/resource.h>
+#endif
+#include "constant.h"
+#include "debug.h"
+#include "debug_xtrn.h"
+#include "emit.h"
+#include "emit_xtrn.h"
+#include "ascii_xtrn.h"
+#include "fracterval_u128.h"
+#include "fracterval_u128_xtrn.h"
+#include "fracterval_u64.h"
+#include "fracterval_u64_xtrn.h"
+#include "lmd2.h"
+#include "thread.h"
+#include "thread_xtrn.h"
+#include "transform.h"
+#include "transform_xtrn.h"
+#include "whole_xtrn.h"
+
+#define SKANBENCH_DISTRIBUTION_MAX 2U
+#define SKANBENCH_DISTRIBUTION_PATCHES 2U
+#define SKANBENCH_DISTRIBUTION_POISSON 1U
+#define SKANBENCH_DISTRIBUTION_UNIFORM 0U
+#define SKANBENCH_PATCH_WHOLE_MASK 3U
+#define SKANBENCH_PATCH_WINDOW_RATIO_LOG2 4U
+
+void skanbench_whole_set(u8 granularity, u32 whole, u8 *whole_u8_base);
+
+void
+skanbench_comma_print(void){
+  EMIT_PRINT(",");
+  return;
+}
+
+void
+skanbench_error_print(u8 emit_mode, char *text_base){
+  if(EMIT1<=emit_mode){
+    EMIT_PRINT("ERROR: ");
+    EMIT_PRINT(text_base);
+    EMIT_WRITE(".");
+  }
+  return;
+}
+
+void
+skanbench_out_of_memory_print(u8 emit_mode){
+  skanbench_error_print(emit_mode, "Out of memory");
+  return;
+}
+
+void
+skanbench_parameter_error_print(u8 emit_mode, char *text_base){
+  if(EMIT1<=emit_mode){
+    EMIT_PRINT("Invalid parameter: (");
+    EMIT_PRINT(text_base);
+    EMIT_WRITE("). For help, run without parameters.");
+  }
+  return;
+}
+
+u32 *
+skanbench_poisson_list_malloc(u32 whole_max_max){
+/*
+Allocate and fill a cumulative distribution table for a Poisson distribution of mean ((whole_max_max+1)>>1), truncated to [0, whole_max_max], so that uniform pseudorandom (u32)s can be converted to Poisson wholes by binary search. This models the shot noise of a spectrometer which counts photons.
+
+In:
+
+  whole_max_max is the maximum whole to generate.
+
+Out:
+
+  Returns NULL on failure, else the base of (whole_max_max+1) (u32)s, the whole-th of which is the least u32 which maps to a whole greater than whole, except that the last is U32_MAX. It must be freed via transform_free().
+*/
+  double cdf;
+  double mean;
+  double weight;
+  double weight_sum;
+  double *weight_list_base;
+  u32 *poisson_list_base;
+  ULONG whole;
+  ULONG whole_count;
+  ULONG whole_mode;
+
+  whole_count=(ULONG)(whole_max_max)+1;
+  poisson_list_base=NULL;
+  weight_list_base=NULL;
+  if(whole_count&&(((whole_count*(ULONG)(sizeof(double)))/(ULONG)(sizeof(double)))==whole_count)){
+    poisson_list_base=DEBUG_MALLOC_PARANOID(whole_count<<U32_SIZE_LOG2);
+    weight_list_base=DEBUG_MALLOC_PARANOID(whole_count*(ULONG)(sizeof(double)));
+  }
+  if(poisson_list_base&&weight_list_base){
+/*
+Compute unnormalized weights by walking outward from the mode, where the weight is one, so that neither an exponential nor a factorial is required, and so that weights far from the mode merely underflow to zero.
+*/
+    whole_mode=whole_count>>1;
+    mean=(double)(whole_mode);
+    weight=1.0;
+    weight_list_base[whole_mode]=weight;
+    whole=whole_mode;
+    while(whole){
+      weight*=(double)(whole)/mean;
+      whole--;
+      weight_list_base[whole]=weight;
+    }
+    weight=1.0;
+    whole=whole_mode;
+    while(whole!=whole_max_max){
+      whole++;
+      weight*=mean/(double)(whole);
+      weight_list_base[whole]=weight;
+    }
+    weight_sum=0.0;
+    whole=0;
+    do{
+      weight_sum+=weight_list_base[whole];
+    }while((whole++)!=whole_max_max);
+    cdf=0.0;
+    whole=0;
+    do{
+      cdf+=weight_list_base[whole]/weight_sum;
+      poisson_list_base[whole]=U32_MAX;
+      if(cdf<1.0){
+        poisson_list_base[whole]=(u32)(cdf*4294967296.0);
+      }
+    }while((whole++)!=whole_max_max);
+    poisson_list_base[whole_max_max]=U32_MAX;
+  }else{
+    poisson_list_base=transform_free(poisson_list_base);
+  }
+  transform_free(weight_list_base);
+  return poisson_list_base;
+}
+
+void
+skanbench_progress_print(u8 emit_mode, char *text_base){
+  if(EMIT3<=emit_mode){
+    EMIT_PRINT(text_base);
+    EMIT_WRITE(".");
+  }
+  return;
+}
+
+u64
+skanbench_rss_peak_get(void){
+/*
+Get the peak resident set size of this process so far.
+
+Out:
+
+  Returns the peak resident set size in KiB, or zero if the platform doesn't provide it.
+*/
+  u64 rss_peak;
+  #ifndef _WIN32
+    struct rusage usage;
+  #endif
+
+  rss_peak=0;
+  #ifndef _WIN32
+    if(!getrusage(RUSAGE_SELF, &usage)){
+      rss_peak=(u64)(usage.ru_maxrss);
+      #ifdef __APPLE__
+/*
+MacOS reports bytes instead of KiB.
+*/
+        rss_peak>>=10;
+      #endif
+    }
+  #endif
+  return rss_peak;
+}
+
+u64
+skanbench_time_get(void){
+/*
+Get the time on a monotonic clock.
+
+Out:
+
+  Returns the time in nanoseconds since an arbitrary epoch.
+*/
+  struct timespec time;
+  u64 time_ns;
+
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  time_ns=(u64)(time.tv_sec)*1000000000ULL+(u64)(time.tv_nsec);
+  return time_ns;
+}
+
+void
+skanbench_whole_list_fill(u8 distribution, u8 granularity, u32 *poisson_list_base, u32 whole_max_max, u8 *whole_u8_list_base, ULONG whole_x_idx_post, ULONG whole_y_idx_post, ULONG window_x_idx_post, ULONG window_y_idx_post){
+/*
+Fill a whole array with reproducible pseudorandom wholes from LMD2.
+
+In:
+
+  distribution is SKANBENCH_DISTRIBUTION_* and tells how the wholes are distributed.
+
+  granularity is the number of bytes per whole, less one.
+
+  poisson_list_base is skanbench_poisson_list_malloc():Out if distribution is SKANBENCH_DISTRIBUTION_POISSON, else ignored.
+
+  whole_max_max is the maximum whole to generate.
+
+  whole_u8_list_base is the base of (whole_x_idx_post*whole_y_idx_post) undefined wholes of size (granularity+1).
+
+  whole_x_idx_post is the number of wholes per row.
+
+  whole_y_idx_post is the number of rows.
+
+  window_x_idx_post is the window width, which is the width of each patch.
+
+  window_y_idx_post is the window height, which is the height of each patch.
+
+Out:
+
+  *whole_u8_list_base contains wholes on [0, whole_max_max], independently and uniformly distributed unless distribution is SKANBENCH_DISTRIBUTION_POISSON, in which case they follow skanbench_poisson_list_malloc():Out. If distribution is SKANBENCH_DISTRIBUTION_PATCHES, then one window-sized patch of wholes on [0, MIN(SKANBENCH_PATCH_WHOLE_MASK, whole_max_max)] has been pasted over the uniform background per (1<<SKANBENCH_PATCH_WINDOW_RATIO_LOG2) windows' worth of area, at pseudorandom positions, so that there are low-entropy regions to find.
+*/
+  u32 lmd2_c;
+  u64 lmd2_iterand;
+  u32 lmd2_x;
+  ULONG patch_count;
+  ULONG patch_idx;
+  u32 patch_whole_mask;
+  ULONG patch_x_idx;
+  ULONG patch_y_idx;
+  u32 whole;
+  ULONG whole_idx;
+  ULONG whole_idx_post;
+  u32 whole_lower;
+  u32 whole_mid;
+  u8 whole_size;
+  u64 whole_span;
+  u32 whole_upper;
+  ULONG whole_x_idx;
+  ULONG whole_y_idx;
+
+  LMD_SEED_INIT(LMD2_C0, lmd2_c, LMD2_X0, lmd2_x)
+  whole_idx=0;
+  whole_idx_post=whole_x_idx_post*whole_y_idx_post;
+  whole_size=(u8)(granularity+1);
+  whole_span=(u64)(whole_max_max)+1;
+  do{
+    LMD_ITERATE_NO_ZERO_CHECK(LMD2_A, lmd2_c, lmd2_x, lmd2_iterand)
+    if(distribution!=SKANBENCH_DISTRIBUTION_POISSON){
+      whole=(u32)(((u64)(lmd2_x)*whole_span)>>U32_BITS);
+    }else{
+/*
+Find the least whole whose cumulative probability exceeds lmd2_x.
+*/
+      whole_lower=0;
+      whole_upper=whole_max_max;
+      while(whole_lower!=whole_upper){
+        whole_mid=whole_lower+((whole_upper-whole_lower)>>1);
+        if(lmd2_x<poisson_list_base[whole_mid]){
+          whole_upper=whole_mid;
+        }else{
+          whole_lower=whole_mid+1;
+        }
+      }
+      whole=whole_lower;
+    }
+    skanbench_whole_set(granularity, whole, &whole_u8_list_base[whole_idx*whole_size]);
+  }while((++whole_idx)!=whole_idx_post);
+  if(distribution==SKANBENCH_DISTRIBUTION_PATCHES){
+    patch_count=whole_idx_post/(window_x_idx_post*window_y_idx_post);
+    patch_count>>=SKANBENCH_PATCH_WINDOW_RATIO_LOG2;
+    patch_count=MAX(patch_count, 1);
+    patch_whole_mask=MIN(SKANBENCH_PATCH_WHOLE_MASK, whole_max_max);
+    patch_idx=0;
+    do{
+      LMD_ITERATE_NO_ZERO_CHECK(LMD2_A, lmd2_c, lmd2_x, lmd2_iterand)
+      patch_x_idx=(ULONG)(((u64)(lmd2_x)*(whole_x_idx_post-window_x_idx_post+1))>>U32_BITS);
+      LMD_ITERATE_NO_ZERO_CHECK(LMD2_A, lmd2_c, lmd2_x, lmd2_iterand)
+      patch_y_idx=(ULONG)(((u64)(lmd2_x)*(whole_y_idx_post-window_y_idx_post+1))>>U32_BITS);
+      whole_y_idx=patch_y_idx;
+      do{
+        whole_x_idx=patch_x_idx;
+        do{
+          LMD_ITERATE_NO_ZERO_CHECK(LMD2_A, lmd2_c, lmd2_x, lmd2_iterand)
+          whole=lmd2_x&patch_whole_mask;
+          skanbench_whole_set(granularity, whole, &whole_u8_list_base[(whole_y_idx*whole_x_idx_post+whole_x_idx)*whole_size]);
+        }while((++whole_x_idx)!=(patch_x_idx+window_x_idx_post));
+      }while((++whole_y_idx)!=(patch_y_idx+window_y_idx_post));
+    }while((++patch_idx)!=patch_count);
+  }
+  return;
+}
+
+void
+skanbench_whole_set(u8 granularity, u32 whole, u8 *whole_u8_base){
+/*
+Store a whole in the little-endian format which Whole:whole_max_get() and the transform expect, regardless of host endianness.
+
+In:
+
+  granularity is the number of bytes per whole, less one.
+
+  whole is the whole to store, which must fit in (granularity+1) bytes.
+
+  whole_u8_base is the base of (granularity+1) undefined bytes.
+
+Out:
+
+  *whole_u8_base contains whole.
+*/
+  u8 whole_u8_idx;
+
+  whole_u8_idx=0;
+  do{
+    whole_u8_base[whole_u8_idx]=(u8)(whole);
+    whole>>=U8_BITS;
+  }while((whole_u8_idx++)!=granularity);
+  return;
+}
+
+int
+main(int argc, char *argv[]){
+  u8 algo_status;
+  ULONG arg_idx;
+  u8 distribution;
+  u8 emit_mode;
+  entropy_t *entropy_base;
+  u8 granularity;
+  u8 header_status;
+  u8 optimize_status;
+  u64 parameter;
+  char *parameter_text_base;
+  u32 *poisson_list_base;
+  u8 precise_status;
+  u64 rss_peak;
+  u8 status;
+  u64 time_dispatch_ns;
+  u64 time_ns;
+  u64 time_setup_ns;
+  transform_t *transform_base;
+  u64 whole_update_count;
+  u64 window_count;
+  u64 window_rate;
+  ULONG whole_idx_max;
+  u32 whole_max;
+  u32 whole_max_max;
+  u8 *whole_u8_list_base;
+  u64 whole_update_ps;
+  ULONG whole_x_idx_post;
+  ULONG whole_y_idx_post;
+  ULONG window_x_idx_post;
+  ULONG window_y_idx_post;
+
+  status=ascii_init(ASCII_BUILD_BREAK_COUNT_EXPECTED, 0);
+  status=(u8)(status|thread_init(THREAD_BUILD_BREAK_COUNT_EXPECTED, 0));
+  status=(u8)(status|transform_init(TRANSFORM_BUILD_BREAK_COUNT_EXPECTED, 0));
+  status=(u8)(status|whole_init(WHOLE_BUILD_BREAK_COUNT_EXPECTED, 0));
+  emit_mode=EMIT3;
+  entropy_base=NULL;
+  poisson_list_base=NULL;
+  transform_base=NULL;
+  whole_u8_list_base=NULL;
+  do{
+    if(status){
+      skanbench_error_print(emit_mode, "Outdated source code");
+      break;
+    }
+    status=1;
+    if(argc!=9){
+      EMIT_WRITE("Skanbench\nCopyright 2021 Russell Leidich\nhttps://github.com/egione/Widebandit");
+      EMIT_WRITE("Build 1");
+      EMIT_WRITE("Measure the throughput of the entropy transform used by Skan on synthetic whole");
+      EMIT_WRITE("arrays generated in memory, for every combination of (flags.algo),");
+      EMIT_WRITE("(flags.optimize), and (flags.precise).\n");
+      EMIT_WRITE("Syntax:\n");
+      EMIT_WRITE("  skanbench verbosity header whole_max_max row_width row_count distribution");
+      EMIT_WRITE("  window_width window_height\n");
+      EMIT_WRITE("where all values are decimal and:\n");
+      EMIT_WRITE("  (verbosity) is one of:\n");
+      EMIT_WRITE("    0: Report only errors.\n");
+      EMIT_WRITE("    1: Report errors and warnings.\n");
+      EMIT_WRITE("    2: Report errors, warnings, and progress information.\n");
+      EMIT_WRITE("  (header) is 1 to print CSV column headers, else 0 to print only rows to");
+      EMIT_WRITE("  append to an existing CSV.\n");
+      EMIT_WRITE("  (whole_max_max) is the maximum whole to generate, up to 4294967295.\n");
+      EMIT_WRITE("  (row_width) is the number of wholes per spectrum.\n");
+      EMIT_WRITE("  (row_count) is the number of spectra.\n");
+      EMIT_WRITE("  (distribution) is one of:\n");
+      EMIT_WRITE("    0: Uniform on [0, (whole_max_max)].\n");
+      EMIT_WRITE("    1: Poisson with mean ((whole_max_max)+1)/2, truncated.\n");
+      EMIT_WRITE("    2: Uniform with window-sized patches of wholes on [0, 3] covering about");
+      EMIT_WRITE("    1/16 of the area.\n");
+      EMIT_WRITE("  (window_width) is the number of columns in the rolling window.\n");
+      EMIT_WRITE("  (window_height) is the number of rows in the rolling window.\n");
+      EMIT_WRITE("The wholes are the same on every run with the same parameters. Each CSV row");
+      EMIT_WRITE("reports one combination, all in decimal:\n");
+      EMIT_WRITE("  BUILD is the transform build ID.\n");
+      EMIT_WRITE("  ALGO, OPTIMIZE, and PRECISE are the values of the corresponding Skan flags.\n");
+      EMIT_WRITE("  SETUP_NS is the time spent in transform_malloc(), which mainly computes");
+      EMIT_WRITE("  lookup lists.\n");
+      EMIT_WRITE("  DISPATCH_NS is the time spent in transform_dispatch(), without fakefloat");
+      EMIT_WRITE("  conversion.\n");
+      EMIT_WRITE("  WINDOWS_PER_SECOND is the number of windows divided by DISPATCH_NS.\n");
+      EMIT_WRITE("  PS_PER_WHOLE_UPDATE is DISPATCH_NS in picoseconds divided by the number of");
+      EMIT_WRITE("  whole updates, which is (window_height) times the number of wholes in all");
+      EMIT_WRITE("  rows at which a window may start. This is the work which a naive transform");
+      EMIT_WRITE("  would do, so the effect of (flags.optimize) shows directly.\n");
+      EMIT_WRITE("  PEAK_RSS_KIB is the peak resident set size of the process so far, or 0 if");
+      EMIT_WRITE("  unavailable. Combinations run in ascending order of expected memory usage,");
+      EMIT_WRITE("  so it's usually that of the current one.\n");
+      break;
+    }
+    arg_idx=0;
+    do{
+      status=ascii_utf8_string_verify(argv[arg_idx]);
+      if(status){
+        skanbench_error_print(emit_mode, "One or more parameters is encoded using invalid UTF8");
+        break;
+      }
+    }while((++arg_idx)<(ULONG)(argc));
+    if(status){
+      break;
+    }
+    parameter_text_base=argv[1];
+    status=ascii_decimal_to_u64_convert(parameter_text_base, &parameter, EMIT2);
+    if(status){
+      skanbench_parameter_error_print(emit_mode, "verbosity");
+      break;
+    }
+    emit_mode=(u8)(parameter);
+/*
+Increment emit_mode because we provide 3 levels, whereas emit.h provides 4. The difference is that we don't have any need for priority zero (critical) messages.
+*/
+    emit_mode++;
+    parameter_text_base=argv[2];
+    status=ascii_decimal_to_u64_convert(parameter_text_base, &parameter, 1);
+    if(status){
+      skanbench_parameter_error_print(emit_mode, "header");
+      break;
+    }
+    header_status=(u8)(parameter);
+    parameter_text_base=argv[3];
+    status=ascii_decimal_to_u64_convert(parameter_text_base, &parameter, U32_MAX);
+    status=(u8)(status|!parameter);
+    if(status){
+      skanbench_parameter_error_print(emit_mode, "whole_max_max");
+      break;
+    }
+    whole_max_max=(u32)(parameter);
+    parameter_text_base=argv[4];
+    status=ascii_decimal_to_u64_convert(parameter_text_base, &parameter, ULONG_MAX);
+    status=(u8)(status|!parameter);
+    if(status){
+      skanbench_parameter_error_print(emit_mode, "row_width");
+      break;
+    }
+    whole_x_idx_post=(ULONG)(parameter);
+    parameter_text_base=argv[5];
+    status=ascii_decimal_to_u64_convert(parameter_text_base, &parameter, ULONG_MAX);
+    status=(u8)(status|(parameter<=1));
+    if(status){
+      skanbench_parameter_error_print(emit_mode, "row_count");
+      break;
+    }
+    whole_y_idx_post=(ULONG)(parameter);
+    parameter_text_base=argv[6];
+    status=ascii_decimal_to_u64_convert(parameter_text_base, &parameter, SKANBENCH_DISTRIBUTION_MAX);
+    if(status){
+      skanbench_parameter_error_print(emit_mode, "distribution");
+      break;
+    }
+    distribution=(u8)(parameter);
+    parameter_text_base=argv[7];
+    status=ascii_decimal_to_u64_convert(parameter_text_base, &parameter, whole_x_idx_post);
+    status=(u8)(status|!parameter);
+    if(status){
+      skanbench_parameter_error_print(emit_mode, "window_width");
+      break;
+    }
+    window_x_idx_post=(ULONG)(parameter);
+    parameter_text_base=argv[8];
+    status=ascii_decimal_to_u64_convert(parameter_text_base, &parameter, whole_y_idx_post);
+    status=(u8)(status|(parameter<=1));
+    if(status){
+      skanbench_parameter_error_print(emit_mode, "window_height");
+      break;
+    }
+    window_y_idx_post=(ULONG)(parameter);
+    status=1;
+    granularity=0;
+    if(U8_MAX<whole_max_max){
+      granularity=U16_BYTE_MAX;
+      if(U16_MAX<whole_max_max){
+        granularity=U32_BYTE_MAX;
+      }
+    }
+    whole_idx_max=whole_x_idx_post*whole_y_idx_post-1;
+    if((whole_idx_max/whole_y_idx_post)!=(whole_x_idx_post-1)){
+      skanbench_error_print(emit_mode, "(row_width)*(row_count) is too big");
+      break;
+    }
+    whole_u8_list_base=whole_list_malloc(granularity, whole_idx_max);
+    if(distribution==SKANBENCH_DISTRIBUTION_POISSON){
+      poisson_list_base=skanbench_poisson_list_malloc(whole_max_max);
+    }
+    if(!whole_u8_list_base||((distribution==SKANBENCH_DISTRIBUTION_POISSON)&&!poisson_list_base)){
+      skanbench_out_of_memory_print(emit_mode);
+      break;
+    }
+    skanbench_progress_print(emit_mode, "Generating wholes");
+    status=0;
+    skanbench_whole_list_fill(distribution, granularity, poisson_list_base, whole_max_max, whole_u8_list_base, whole_x_idx_post, whole_y_idx_post, window_x_idx_post, window_y_idx_post);
+    whole_max=whole_max_get(granularity, whole_idx_max, whole_u8_list_base);
+    window_count=(u64)(whole_x_idx_post-window_x_idx_post+1)*(whole_y_idx_post-window_y_idx_post+1);
+    whole_update_count=(u64)(whole_x_idx_post)*(whole_y_idx_post-window_y_idx_post+1)*window_y_idx_post;
+    if(header_status){
+      EMIT_WRITE("BUILD,DISTRIBUTION,WHOLE_MAX_MAX,ROW_WIDTH,ROW_COUNT,WINDOW_WIDTH,WINDOW_HEIGHT,ALGO,OPTIMIZE,PRECISE,SETUP_NS,DISPATCH_NS,WINDOWS_PER_SECOND,PS_PER_WHOLE_UPDATE,PEAK_RSS_KIB");
+    }
+/*
+Frequency lists for every column make (flags.optimize) the most memory-hungry, and 128-bit fractervals double the size of everything else, so iterate over those outermost in order to keep PEAK_RSS_KIB meaningful.
+*/
+    optimize_status=0;
+    do{
+      precise_status=0;
+      do{
+        algo_status=0;
+        do{
+          time_ns=skanbench_time_get();
+          transform_malloc(algo_status, 0, &entropy_base, NULL, granularity, optimize_status, precise_status, TRANSFORM_ROUNDING_STATUS_NEAREST_EVEN, &transform_base, whole_max, whole_x_idx_post-1, whole_y_idx_post-1, window_x_idx_post-1, window_y_idx_post-1);
+          time_setup_ns=skanbench_time_get()-time_ns;
+          status=!entropy_base;
+          if(status){
+            break;
+          }
+          time_ns=skanbench_time_get();
+          transform_dispatch(entropy_base, transform_base, whole_u8_list_base);
+          time_dispatch_ns=skanbench_time_get()-time_ns;
+          rss_peak=skanbench_rss_peak_get();
+          transform_free_all(&entropy_base, &transform_base);
+          time_dispatch_ns=MAX(time_dispatch_ns, 1);
+          window_rate=(u64)((double)(window_count)*1000000000.0/(double)(time_dispatch_ns));
+          whole_update_ps=(u64)((double)(time_dispatch_ns)*1000.0/(double)(whole_update_count));
+          EMIT_U64_DECIMAL("", TRANSFORM_BUILD_ID);
+          skanbench_comma_print();
+          EMIT_U64_DECIMAL("", distribution);
+          skanbench_comma_print();
+          EMIT_U64_DECIMAL("", whole_max_max);
+          skanbench_comma_print();
+          EMIT_U64_DECIMAL("", whole_x_idx_post);
+          skanbench_comma_print();
+          EMIT_U64_DECIMAL("", whole_y_idx_post);
+          skanbench_comma_print();
+          EMIT_U64_DECIMAL("", window_x_idx_post);
+          skanbench_comma_print();
+          EMIT_U64_DECIMAL("", window_y_idx_post);
+          skanbench_comma_print();
+          EMIT_U64_DECIMAL("", algo_status);
+          skanbench_comma_print();
+          EMIT_U64_DECIMAL("", optimize_status);
+          skanbench_comma_print();
+          EMIT_U64_DECIMAL("", precise_status);
+          skanbench_comma_print();
+          EMIT_U64_DECIMAL("", time_setup_ns);
+          skanbench_comma_print();
+          EMIT_U64_DECIMAL("", time_dispatch_ns);
+          skanbench_comma_print();
+          EMIT_U64_DECIMAL("", window_rate);
+          skanbench_comma_print();
+          EMIT_U64_DECIMAL("", whole_update_ps);
+          skanbench_comma_print();
+          EMIT_U64_DECIMAL("", rss_peak);
+          EMIT_WRITE("");
+        }while((algo_status++)!=TRANSFORM_ALGO_STATUS_MAX);
+      }while((!status)&&((precise_status++)!=1));
+    }while((!status)&&((optimize_status++)!=1));
+    if(status){
+      skanbench_out_of_memory_print(emit_mode);
+      break;
+    }
+    skanbench_progress_print(emit_mode, "Done");
+    status=0;
+  }while(0);
+  transform_free_all(&entropy_base, &transform_base);
+  transform_free(poisson_list_base);
+  whole_free(whole_u8_list_base);
+  DEBUG_ALLOCATION_CHECK();
+  return status;
+}
@@ -27,7 +27,9 @@ Spectrum Discretizer
 #include "flag_ascii.h"
 #include "flag_fakefloat.h"
 #include "flag_filesys.h"
+#include "flag_thread.h"
 #include "flag_whole.h"
+#include <pthread.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
@@ -43,8 +45,45 @@ Spectrum Discretizer
 #include "archive_xtrn.h"
 #include "fakefloat.h"
 #include "fakefloat_xtrn.h"
+#include "thread.h"
+#include "thread_xtrn.h"
 #include "whole_xtrn.h"
 
+#define SLICE_STREAM_SIZE_MIN (1UL<<20)
+
+TYPEDEF_START
+  u32 *archive_u32_list_base;
+  u32 *float_list_base;
+  u8 *whole_u8_list_base;
+  ULONG float_idx_max;
+  ULONG float_idx_min;
+  ULONG pdf_count;
+  ULONG pdf_float_count;
+  ULONG pdf_slot_count;
+  u8 bucket_bits;
+  u8 flags;
+  u8 granularity;
+TYPEDEF_END(slice_thread_t)
+
+TYPEDEF_START
+  thread_barrier_t *barrier_base;
+  u32 *float_list_base;
+  char *float_pathname_base;
+  slice_thread_t *slice_thread_list_base;
+  void *stream_list_base;
+  char *whole_pathname_base;
+  u8 *whole_u8_list_base;
+  ULONG chunk_float_count;
+  ULONG chunk_idx_max;
+  ULONG float_count;
+  ULONG row_u8_idx;
+  ULONG thread_idx;
+  ULONG thread_idx_max;
+  u8 append_status;
+  u8 filesys_status;
+  u8 whole_size;
+TYPEDEF_END(slice_stream_t)
+
 void
 slice_error_print(u8 emit_mode, char *text_base){
   if(EMIT1<=emit_mode){
@@ -55,6 +94,196 @@ slice_error_print(u8 emit_mode, char *text_base){
   return;
 }
 
+void *
+slice_float_list_convert(void *thread_base){
+/*
+Convert a contiguous span of floats into wholes, which are their slice indexes within the PDFs to which they correspond. Suitable for use with thread_list_run().
+
+In:
+
+  thread_base is the base of a slice_thread_t:In. The floats at *float_list_base are taken to be rows of pdf_count floats, the Nth of which corresponds to the Nth PDF at *archive_u32_list_base. If flags includes ARCHIVE_FLAG_KEY, then they must already have been converted by fakefloat_u32_list_key_encode().
+
+Out:
+
+  Returns NULL.
+
+  The whole corresponding to each float on [float_idx_min, float_idx_max] has been written to *whole_u8_list_base as (granularity+1) bytes in little endian order. Other wholes have not been touched, so threads may share the same list.
+*/
+  ULONG archive_u32_idx_max;
+  ULONG archive_u32_idx_min;
+  u32 *archive_u32_list_base;
+  u8 bucket_bits;
+  u8 flags;
+  u32 float_0;
+  ULONG float_idx;
+  ULONG float_idx_max;
+  u32 *float_list_base;
+  u8 granularity;
+  ULONG pdf_count;
+  ULONG pdf_float_count;
+  ULONG pdf_idx;
+  ULONG pdf_slot_count;
+  u32 slice_idx;
+  slice_thread_t *slice_thread_base;
+  ULONG whole_u8_idx;
+  u8 *whole_u8_list_base;
+
+  slice_thread_base=(slice_thread_t *)(thread_base);
+  archive_u32_list_base=slice_thread_base->archive_u32_list_base;
+  bucket_bits=slice_thread_base->bucket_bits;
+  flags=slice_thread_base->flags;
+  float_idx=slice_thread_base->float_idx_min;
+  float_idx_max=slice_thread_base->float_idx_max;
+  float_list_base=slice_thread_base->float_list_base;
+  granularity=slice_thread_base->granularity;
+  pdf_count=slice_thread_base->pdf_count;
+  pdf_float_count=slice_thread_base->pdf_float_count;
+  pdf_slot_count=slice_thread_base->pdf_slot_count;
+  whole_u8_list_base=slice_thread_base->whole_u8_list_base;
+  pdf_idx=float_idx%pdf_count;
+  archive_u32_idx_min=(pdf_idx*pdf_slot_count)+ARCHIVE_HEADER_U32_COUNT;
+  archive_u32_idx_max=archive_u32_idx_min+pdf_float_count-1;
+  whole_u8_idx=float_idx*((ULONG)(granularity)+1);
+  do{
+    float_0=float_list_base[float_idx];
+    switch(flags){
+    case 0:
+      slice_idx=fakefloat_to_slice_idx(archive_u32_idx_max, archive_u32_idx_min, float_0, archive_u32_list_base);
+      break;
+    case ARCHIVE_FLAG_EYTZINGER:
+      slice_idx=fakefloat_eytzinger_to_slice_idx(archive_u32_idx_max, archive_u32_idx_min, float_0, archive_u32_list_base);
+      break;
+    case ARCHIVE_FLAG_KEY:
+      slice_idx=fakefloat_key_to_slice_idx(archive_u32_idx_max, archive_u32_idx_min, float_0, archive_u32_list_base);
+      break;
+    case ARCHIVE_FLAG_EYTZINGER|ARCHIVE_FLAG_KEY:
+      slice_idx=fakefloat_eytzinger_key_to_slice_idx(archive_u32_idx_max, archive_u32_idx_min, float_0, archive_u32_list_base);
+      break;
+    default:
+      slice_idx=fakefloat_bucket_to_slice_idx(bucket_bits, archive_u32_idx_max, archive_u32_idx_min, float_0, archive_u32_list_base);
+    }
+    whole_u8_list_base[whole_u8_idx]=(u8)(slice_idx);
+    whole_u8_idx++;
+    if(granularity){
+      whole_u8_list_base[whole_u8_idx]=(u8)(slice_idx>>U8_BITS);
+      whole_u8_idx++;
+      if(U16_BYTE_MAX<granularity){
+        whole_u8_list_base[whole_u8_idx]=(u8)(slice_idx>>U16_BITS);
+        whole_u8_idx++;
+        if(U24_BYTE_MAX<granularity){
+          whole_u8_list_base[whole_u8_idx]=(u8)(slice_idx>>U24_BITS);
+          whole_u8_idx++;
+        }
+      }
+    }
+    archive_u32_idx_max+=pdf_slot_count;
+    archive_u32_idx_min+=pdf_slot_count;
+    pdf_idx++;
+    if(pdf_idx==pdf_count){
+      archive_u32_idx_min=ARCHIVE_HEADER_U32_COUNT;
+      archive_u32_idx_max=archive_u32_idx_min+pdf_float_count-1;
+      pdf_idx=0;
+    }
+  }while((float_idx++)!=float_idx_max);
+  return NULL;
+}
+
+void
+slice_float_list_dispatch(ULONG float_count, u32 *float_list_base, slice_thread_t *slice_thread_list_base, ULONG thread_idx_max, u8 *whole_u8_list_base){
+/*
+Convert a list of floats into wholes by dividing it into one contiguous span per thread and running slice_float_list_convert() on each.
+
+In:
+
+  float_count is the number of floats at float_list_base, which must be a nonzero multiple of (slice_thread_list_base->pdf_count).
+
+  float_list_base is slice_float_list_convert():In:(thread_base->float_list_base).
+
+  slice_thread_list_base is the base of (thread_idx_max+1) (slice_thread_t)s, the first of which has archive_u32_list_base, pdf_count, pdf_float_count, pdf_slot_count, bucket_bits, flags, and granularity set as slice_float_list_convert():In requires.
+
+  thread_idx_max is the maximum number of threads to use, less one. It's reduced as necessary so that each thread has at least one float.
+
+  whole_u8_list_base is slice_float_list_convert():In:(thread_base->whole_u8_list_base).
+
+Out:
+
+  *whole_u8_list_base contains float_count wholes as defined in slice_float_list_convert():Out.
+
+  All other parameter blocks at slice_thread_list_base have been copied from the first, then given their own spans.
+*/
+  slice_thread_t *slice_thread_base;
+  ULONG thread_idx;
+
+  thread_idx_max=MIN(thread_idx_max, float_count-1);
+  slice_thread_base=slice_thread_list_base;
+  thread_idx=0;
+  do{
+    *slice_thread_base=*slice_thread_list_base;
+    slice_thread_base->float_list_base=float_list_base;
+    slice_thread_base->whole_u8_list_base=whole_u8_list_base;
+    thread_span_get(&slice_thread_base->float_idx_max, &slice_thread_base->float_idx_min, float_count, thread_idx, thread_idx_max);
+    slice_thread_base++;
+  }while((thread_idx++)!=thread_idx_max);
+/*
+Without a barrier, thread_list_run() processes every parameter block even if the OS refuses to create some of the threads.
+*/
+  thread_list_run(NULL, slice_float_list_convert, slice_thread_list_base, (ULONG)(sizeof(slice_thread_t)), thread_idx_max);
+  return;
+}
+
+char *
+slice_option_get(int *argc_base, char *argv[], char *name_base){
+/*
+Find an option of the form "--name=value" or "--name" in the parameter list and remove it, so that the remaining parameters are positional as before options existed.
+
+In:
+
+  *argc_base is main():In:argc.
+
+  argv is main():In:argv.
+
+  name_base is the name of the option without the leading "--".
+
+Out:
+
+  Returns NULL if the option wasn't found, else the base of its value, which is empty if there was no "=". If the option appears more than once, then the first instance is used.
+
+  *argc_base has been decremented and argv has been compacted if the option was found.
+*/
+  ULONG arg_idx;
+  ULONG arg_idx_post;
+  char *arg_base;
+  ULONG name_char_count;
+  char *value_base;
+
+  arg_idx=1;
+  arg_idx_post=(ULONG)(*argc_base);
+  name_char_count=(ULONG)(strlen(name_base));
+  value_base=NULL;
+  while(arg_idx<arg_idx_post){
+    arg_base=argv[arg_idx];
+    if((arg_base[0]=='-')&&(arg_base[1]=='-')&&!strncmp(&arg_base[2], name_base, (size_t)(name_char_count))){
+      value_base=&arg_base[name_char_count+2];
+      if(*value_base=='='){
+        value_base++;
+      }else if(*value_base){
+        value_base=NULL;
+      }
+      if(value_base){
+        arg_idx_post--;
+        while(arg_idx!=arg_idx_post){
+          argv[arg_idx]=argv[arg_idx+1];
+          arg_idx++;
+        }
+        *argc_base=(int)(arg_idx_post);
+        break;
+      }
+    }
+    arg_idx++;
+  }
+  return value_base;
+}
+
 void
 slice_out_of_memory_print(u8 emit_mode){
   slice_error_print(emit_mode, "Out of memory");
@@ -80,6 +309,145 @@ slice_progress_print(u8 emit_mode, char *text_base){
   return;
 }
 
+u8
+slice_stream_flush(ULONG chunk_idx, slice_stream_t *stream_base){
+/*
+Write the wholes of a given chunk to the whole file, either by appending them or by overwriting the rows to which they correspond.
+
+In:
+
+  chunk_idx is the index of the chunk, which must already have been converted into the half of the whole buffer which belongs to it.
+
+  stream_base is the base of the slice_stream_t prepared by main().
+
+Out:
+
+  Returns zero on success, else FILESYS_STATUS_NOT_FOUND if the whole file disappeared, else FILESYS_STATUS_WRITE_FAIL.
+*/
+  ULONG chunk_float_count;
+  ULONG chunk_float_idx_min;
+  u8 filesys_status;
+  u8 *whole_u8_list_base;
+  ULONG write_size;
+
+  chunk_float_count=stream_base->chunk_float_count;
+  chunk_float_idx_min=chunk_idx*chunk_float_count;
+  write_size=MIN(chunk_float_count, stream_base->float_count-chunk_float_idx_min)*stream_base->whole_size;
+  whole_u8_list_base=&stream_base->whole_u8_list_base[(chunk_idx&1)*chunk_float_count*stream_base->whole_size];
+  if(stream_base->append_status){
+    filesys_status=filesys_file_write_obnoxious(1, write_size, stream_base->whole_pathname_base, whole_u8_list_base);
+  }else{
+    filesys_status=filesys_subfile_write(0, stream_base->whole_pathname_base, write_size, (u64)(chunk_float_idx_min)*stream_base->whole_size+stream_base->row_u8_idx, whole_u8_list_base);
+  }
+  return filesys_status;
+}
+
+u8
+slice_stream_read(ULONG chunk_idx, slice_stream_t *stream_base){
+/*
+Fill the half of the float buffer which belongs to a given chunk with the rows of floats which it covers.
+
+In:
+
+  chunk_idx is the index of the chunk. If nonzero, then the other half of the buffer may be in use by slice_float_list_dispatch() because it's not touched here.
+
+  stream_base is the base of the slice_stream_t prepared by main().
+
+Out:
+
+  Returns zero on success, else FILESYS_STATUS_READ_FAIL, regardless of the reason, so that main() can tell it apart from slice_stream_flush():Out.
+
+  The half of (stream_base->float_list_base) at ((chunk_idx&1)*(stream_base->chunk_float_count)) contains the floats of the chunk, still in file order.
+*/
+  ULONG chunk_float_count;
+  ULONG chunk_float_idx_min;
+  u8 filesys_status;
+  ULONG read_size;
+
+  chunk_float_count=stream_base->chunk_float_count;
+  chunk_float_idx_min=chunk_idx*chunk_float_count;
+  read_size=MIN(chunk_float_count, stream_base->float_count-chunk_float_idx_min)<<U32_SIZE_LOG2;
+  filesys_status=filesys_subfile_read(0, stream_base->float_pathname_base, read_size, (u64)(chunk_float_idx_min)<<U32_SIZE_LOG2, &stream_base->float_list_base[(chunk_idx&1)*chunk_float_count]);
+  if(filesys_status){
+    filesys_status=FILESYS_STATUS_READ_FAIL;
+  }
+  return filesys_status;
+}
+
+void *
+slice_stream_thread(void *stream_base){
+/*
+Execute one thread's share of a chunked slice. Thread zero converts one chunk of floats into wholes while thread one writes the wholes of the previous chunk and reads the floats of the next, so that storage and compute overlap. If thread one could not be created, then thread zero does everything in turn.
+
+In:
+
+  stream_base is the base of a slice_stream_t prepared by main(). The chunk with index zero must already have been read.
+
+Out:
+
+  Returns NULL.
+
+  (stream_base->filesys_status) is zero on success, else the slice_stream_flush():Out or slice_stream_read():Out code of the failure which stopped the slice.
+
+  Each chunk of wholes has been written to the whole file in turn.
+*/
+  thread_barrier_t *barrier_base;
+  ULONG chunk_float_count;
+  ULONG chunk_float_idx_max;
+  ULONG chunk_idx;
+  ULONG chunk_idx_max;
+  u32 *float_list_base;
+  u8 filesys_status;
+  slice_stream_t *stream_base_local;
+  slice_stream_t *stream_list_base;
+  ULONG thread_idx;
+  ULONG thread_idx_max;
+
+  stream_base_local=(slice_stream_t *)(stream_base);
+  barrier_base=stream_base_local->barrier_base;
+  thread_barrier_wait(barrier_base);
+  thread_idx_max=barrier_base->thread_idx_max;
+  chunk_float_count=stream_base_local->chunk_float_count;
+  chunk_idx=0;
+  chunk_idx_max=stream_base_local->chunk_idx_max;
+  filesys_status=0;
+  stream_list_base=(slice_stream_t *)(stream_base_local->stream_list_base);
+  thread_idx=stream_base_local->thread_idx;
+  do{
+    if(!thread_idx){
+      chunk_float_idx_max=MIN(chunk_float_count, stream_base_local->float_count-chunk_idx*chunk_float_count)-1;
+      float_list_base=&stream_base_local->float_list_base[(chunk_idx&1)*chunk_float_count];
+      if(stream_base_local->slice_thread_list_base->flags&ARCHIVE_FLAG_KEY){
+        fakefloat_u32_list_key_encode(chunk_float_idx_max, 0, float_list_base);
+      }
+      slice_float_list_dispatch(chunk_float_idx_max+1, float_list_base, stream_base_local->slice_thread_list_base, stream_base_local->thread_idx_max, &stream_base_local->whole_u8_list_base[(chunk_idx&1)*chunk_float_count*stream_base_local->whole_size]);
+    }
+    if(thread_idx==thread_idx_max){
+      if(chunk_idx){
+        filesys_status=slice_stream_flush(chunk_idx-1, stream_base_local);
+      }
+      if((chunk_idx!=chunk_idx_max)&&!filesys_status){
+        filesys_status=slice_stream_read(chunk_idx+1, stream_base_local);
+      }
+    }
+    stream_base_local->filesys_status=filesys_status;
+    thread_barrier_wait(barrier_base);
+    filesys_status=stream_list_base[thread_idx_max].filesys_status;
+/*
+Wait again so that thread one can't overwrite its status with that of the next chunk before thread zero has read it, lest they disagree on whether to stop.
+*/
+    thread_barrier_wait(barrier_base);
+    if(filesys_status){
+      break;
+    }
+  }while((chunk_idx++)!=chunk_idx_max);
+  if((thread_idx==thread_idx_max)&&!filesys_status){
+    filesys_status=slice_stream_flush(chunk_idx_max, stream_base_local);
+    stream_base_local->filesys_status=filesys_status;
+  }
+  return NULL;
+}
+
 void
 slice_value_report(u8 emit_mode, u8 emit_priority, char *text_base, u64 value){
   if(emit_priority<=emit_mode){
@@ -110,17 +478,19 @@ int
 main(int argc, char *argv[]){
   u8 append_status;
   u64 archive_size_u64;
-  ULONG archive_u32_idx_max;
-  ULONG archive_u32_idx_min;
   u32 *archive_u32_list_base;
   ULONG arg_idx;
+  thread_barrier_t *barrier_base;
+  u8 bucket_bits;
+  ULONG buffer_float_count;
+  ULONG chunk_float_count;
+  ULONG chunk_row_count;
   int descriptor;
   u8 emit_mode;
   u8 filesys_status;
-  u32 float_0;
+  u8 flags;
   ULONG float_count;
   ULONG float_file_size;
-  ULONG float_idx;
   ULONG float_idx_max;
   u32 *float_list_base;
   char *float_pathname_base;
@@ -132,32 +502,39 @@ main(int argc, char *argv[]){
   u64 parameter;
   char *parameter_text_base;
   ULONG pdf_count;
-  ULONG pdf_count_copy;
   ULONG pdf_float_count;
   ULONG pdf_slot_count;
-  ULONG row_idx;
   ULONG row_count;
+  ULONG row_idx;
   ULONG row_size;
   ULONG row_u8_idx;
   ULONG row_u8_idx_post;
   u32 slice_count;
-  u32 slice_idx;
+  slice_thread_t *slice_thread_list_base;
   u8 status;
+  slice_stream_t stream_list_base[2];
+  char *stream_text_base;
+  ULONG thread_idx_max;
+  char *threads_text_base;
   ULONG whole_file_size;
   char *whole_pathname_base;
   u8 whole_size;
-  ULONG whole_u8_idx;
   u8 *whole_u8_list_base;
   ULONG whole_u8_list_size;
 
-  status=archive_init(ARCHIVE_BUILD_BREAK_COUNT_EXPECTED, 0);
+  status=archive_init(ARCHIVE_BUILD_BREAK_COUNT_EXPECTED, 3);
   status=(u8)(status|ascii_init(ASCII_BUILD_BREAK_COUNT_EXPECTED, 0));
-  status=(u8)(status|fakefloat_init(FAKEFLOAT_BUILD_BREAK_COUNT_EXPECTED, 0));
+  status=(u8)(status|fakefloat_init(FAKEFLOAT_BUILD_BREAK_COUNT_EXPECTED, 3));
   status=(u8)(status|filesys_init(FILESYS_BUILD_BREAK_COUNT_EXPECTED, 5));
+  status=(u8)(status|thread_init(THREAD_BUILD_BREAK_COUNT_EXPECTED, 0));
   emit_mode=EMIT3;
+  barrier_base=NULL;
   header_base=NULL;
   float_list_base=NULL;
+  slice_thread_list_base=NULL;
   whole_u8_list_base=NULL;
+  stream_text_base=slice_option_get(&argc, argv, "stream");
+  threads_text_base=slice_option_get(&argc, argv, "threads");
   do{
     if(status){
       slice_error_print(emit_mode, "Outdated source code");
@@ -166,16 +543,19 @@ main(int argc, char *argv[]){
     status=1;
     if((argc!=5)&&(argc!=6)){
       EMIT_WRITE("Slice\nCopyright 2021 Russell Leidich\nhttps://github.com/egione/Widebandit");
-      EMIT_WRITE("Build 1");
+      EMIT_WRITE("Build 6");
       EMIT_WRITE("Convert floats into wholes.\n");
       EMIT_WRITE("Syntax:\n");
-      EMIT_WRITE("  slice verbosity index_file float_file whole_file [row_index]\n");
+      EMIT_WRITE("  slice verbosity index_file float_file whole_file [row_index] [--stream[=(rows)]]");
+      EMIT_WRITE("    [--threads=(count)]\n");
       EMIT_WRITE("where:\n");
       EMIT_WRITE("  (verbosity) is one of:\n");
       EMIT_WRITE("    0: Report only errors.\n");
       EMIT_WRITE("    1: Report errors and warnings.\n");
       EMIT_WRITE("    2: Report errors, warnings, and progress information.\n");
-      EMIT_WRITE("  (index_file) is a Spectrafy archive which has been optimized for lookup.\n");
+      EMIT_WRITE("  (index_file) is a Spectrafy archive which has been optimized for lookup, such");
+      EMIT_WRITE("  as the output of Downsample. Any (layout) given to Downsample is detected");
+      EMIT_WRITE("  automatically.\n");
       EMIT_WRITE("  (float_file) is the name of a file containing a list of 32-bit IEEE754");
       EMIT_WRITE("  floating-point values (\"floats\"). All numeric types other than NaN are");
       EMIT_WRITE("  acceptable.\n");
@@ -186,7 +566,15 @@ main(int argc, char *argv[]){
       EMIT_WRITE("  (row_index), if present, is the zero-based row number to overwrite with the");
       EMIT_WRITE("  newly computed row(s) of wholes. (whole_file) must have sufficient size such");
       EMIT_WRITE("  that no data would need to be appended. If (row_index) is unspecified, then");
-      EMIT_WRITE("  the row(s) will be appended.");
+      EMIT_WRITE("  the row(s) will be appended.\n");
+      EMIT_WRITE("  --stream[=(rows)] reads (float_file) in chunks of (rows) rows, while the");
+      EMIT_WRITE("  previous chunk is being converted, and writes each chunk of wholes to");
+      EMIT_WRITE("  (whole_file) as soon as it's done, instead of loading it all at once. Memory");
+      EMIT_WRITE("  usage is then independent of the number of rows. By default, each chunk");
+      EMIT_WRITE("  holds about 1 MiB of floats. Results are identical regardless.\n");
+      EMIT_WRITE("  --threads=(count) divides the floats among (count) threads, up to 256, each");
+      EMIT_WRITE("  of which converts a contiguous span of them. The default is 1. Results are");
+      EMIT_WRITE("  identical regardless.");
       break;
     }
     arg_idx=0;
@@ -226,6 +614,32 @@ Increment emit_mode because we provide 3 levels, whereas emit.h provides 4. The
       status=1;
       row_idx=(ULONG)(parameter);
     }
+    thread_idx_max=0;
+    if(threads_text_base){
+      status=ascii_decimal_to_u64_convert(threads_text_base, &parameter, THREAD_IDX_MAX_MAX+1);
+      status=(u8)(status|!parameter);
+      if(status){
+        slice_parameter_error_print(emit_mode, "threads");
+        break;
+      }
+      status=1;
+      thread_idx_max=(ULONG)(parameter-1);
+    }
+    chunk_row_count=0;
+    if(stream_text_base){
+      parameter=0;
+      status=0;
+      if(*stream_text_base){
+        status=ascii_decimal_to_u64_convert(stream_text_base, &parameter, ULONG_MAX);
+        status=(u8)(status|!parameter);
+      }
+      if(status){
+        slice_parameter_error_print(emit_mode, "stream");
+        break;
+      }
+      status=1;
+      chunk_row_count=(ULONG)(parameter);
+    }
     index_pathname_base=argv[2];
     filesys_status=filesys_file_mem_map(&descriptor, &archive_size_u64, index_pathname_base, (void **)(&archive_u32_list_base), 0);
     if(filesys_status){
@@ -248,6 +662,17 @@ Increment emit_mode because we provide 3 levels, whereas emit.h provides 4. The
       break;
     }
     status=1;
+    flags=archive_header_flags_get(header_base);
+    if(flags&ARCHIVE_FLAG_EYTZINGER){
+      slice_progress_print(emit_mode, "(index_file) is in Eytzinger order");
+    }
+    if(flags&ARCHIVE_FLAG_KEY){
+      slice_progress_print(emit_mode, "(index_file) contains integer keys");
+    }
+    bucket_bits=archive_bucket_bits_get(header_base);
+    if(bucket_bits){
+      slice_value_report(emit_mode, EMIT3, "Bucket table bits per PDF is", bucket_bits);
+    }
     slice_value_report(emit_mode, EMIT3, "Floats per PDF is", pdf_float_count);
     slice_count=(u32)(pdf_float_count+1);
     if(slice_count!=(pdf_float_count+1)){
@@ -277,17 +702,6 @@ Increment emit_mode because we provide 3 levels, whereas emit.h provides 4. The
       slice_error_print(emit_mode, "The number of floats in (float_file) must be a multiple of the number of PDFs in (index_file)");
       break;
     }
-    float_idx_max=float_count-1;
-    float_list_base=fakefloat_u32_list_malloc(0, float_idx_max);
-    filesys_status=filesys_file_read_exact(float_file_size, float_pathname_base, float_list_base);
-    if(filesys_status){
-      if(filesys_status==FILESYS_STATUS_NOT_FOUND){
-        slice_error_print(emit_mode, "(float_file) disappeared during execution");
-      }else{
-        slice_error_print(emit_mode, "(float_file) changed size during execution");
-      }
-      break;
-    }
     granularity=U8_BYTE_MAX;
     if(pdf_float_count>>U8_BITS){
       granularity=U16_BYTE_MAX;
@@ -304,11 +718,6 @@ Increment emit_mode because we provide 3 levels, whereas emit.h provides 4. The
         }
       }
     }
-    whole_u8_list_base=whole_list_malloc(granularity, float_idx_max);
-    if(!whole_u8_list_base){
-      slice_out_of_memory_print(emit_mode);
-      break;
-    }
     whole_size=(u8)(granularity+1);
     slice_value_report(emit_mode, EMIT3, "Bytes per whole is", whole_size);
     whole_u8_list_size=float_count*whole_size;
@@ -337,60 +746,143 @@ Increment emit_mode because we provide 3 levels, whereas emit.h provides 4. The
         break;
       }
     }
-    float_idx=0;
-    whole_u8_idx=0;
-    do{
-      archive_u32_idx_max=pdf_float_count+ARCHIVE_HEADER_U32_COUNT-1;
-      archive_u32_idx_min=ARCHIVE_HEADER_U32_COUNT;
-      pdf_count_copy=pdf_count;
-      do{
-        float_0=float_list_base[float_idx];
-        slice_idx=fakefloat_to_slice_idx(archive_u32_idx_max, archive_u32_idx_min, float_0, archive_u32_list_base);
-        whole_u8_list_base[whole_u8_idx]=(u8)(slice_idx);
-        whole_u8_idx++;
-        if(granularity){
-          whole_u8_list_base[whole_u8_idx]=(u8)(slice_idx>>U8_BITS);
-          whole_u8_idx++;
-          if(U16_BYTE_MAX<granularity){
-            whole_u8_list_base[whole_u8_idx]=(u8)(slice_idx>>U16_BITS);
-            whole_u8_idx++;
-            if(U24_BYTE_MAX<granularity){
-              whole_u8_list_base[whole_u8_idx]=(u8)(slice_idx>>U24_BITS);
-              whole_u8_idx++;
-            }
-          }
-        }
-        archive_u32_idx_max+=pdf_slot_count;
-        archive_u32_idx_min+=pdf_slot_count;
-        float_idx++;
-      }while(--pdf_count_copy);
-    }while(--row_count);
-    filesys_status=filesys_file_mem_unmap(descriptor, archive_size_u64, archive_u32_list_base);
-    if(filesys_status){
-      slice_error_print(emit_mode, "Could not close memory map for (index_file)");
+/*
+Without streaming, the whole float file is one chunk. Otherwise, each chunk consists of whole rows, and the buffers hold 2 chunks so that one can be read or written while the other is being converted.
+*/
+    chunk_float_count=float_count;
+    if(stream_text_base){
+      if(!chunk_row_count){
+        chunk_row_count=MAX(SLICE_STREAM_SIZE_MIN/(pdf_count<<U32_SIZE_LOG2), 1);
+      }
+      chunk_row_count=MIN(chunk_row_count, row_count);
+      chunk_float_count=chunk_row_count*pdf_count;
+      slice_value_report(emit_mode, EMIT3, "Rows per chunk is", chunk_row_count);
+    }
+/*
+A lone chunk needs only one half of the buffers. Otherwise, each chunk is at most half of the float file, so doubling it can't overflow.
+*/
+    buffer_float_count=chunk_float_count;
+    if(chunk_float_count!=float_count){
+      buffer_float_count<<=1;
+    }
+    float_idx_max=buffer_float_count-1;
+    float_list_base=fakefloat_u32_list_malloc(0, float_idx_max);
+    whole_u8_list_base=whole_list_malloc(granularity, float_idx_max);
+    thread_idx_max=MIN(thread_idx_max, chunk_float_count-1);
+    slice_thread_list_base=DEBUG_CALLOC_PARANOID((thread_idx_max+1)*(ULONG)(sizeof(slice_thread_t)));
+    if(!(float_list_base&&slice_thread_list_base&&whole_u8_list_base)){
+      slice_out_of_memory_print(emit_mode);
       break;
     }
-    if(!append_status){
-      filesys_status=filesys_subfile_write(0, whole_pathname_base, whole_u8_idx, row_u8_idx, whole_u8_list_base);
+    if(thread_idx_max){
+      slice_value_report(emit_mode, EMIT3, "Thread count is", thread_idx_max+1);
+    }
+    slice_thread_list_base->archive_u32_list_base=archive_u32_list_base;
+    slice_thread_list_base->pdf_count=pdf_count;
+    slice_thread_list_base->pdf_float_count=pdf_float_count;
+    slice_thread_list_base->pdf_slot_count=pdf_slot_count;
+    slice_thread_list_base->bucket_bits=bucket_bits;
+    slice_thread_list_base->flags=flags;
+    slice_thread_list_base->granularity=granularity;
+    if(!stream_text_base){
+      filesys_status=filesys_file_read_exact(float_file_size, float_pathname_base, float_list_base);
       if(filesys_status){
         if(filesys_status==FILESYS_STATUS_NOT_FOUND){
-          slice_error_print(emit_mode, "(whole_file) disappeared during execution");
-          break;
+          slice_error_print(emit_mode, "(float_file) disappeared during execution");
         }else{
-          slice_error_print(emit_mode, "Cannot update (whole_file)");
-          break;
+          slice_error_print(emit_mode, "(float_file) changed size during execution");
         }
+        break;
       }
+/*
+If the index contains keys, then convert the floats to keys as well, so that each lookup is purely an integer search.
+*/
+      if(flags&ARCHIVE_FLAG_KEY){
+        fakefloat_u32_list_key_encode(float_count-1, 0, float_list_base);
+      }
+      slice_float_list_dispatch(float_count, float_list_base, slice_thread_list_base, thread_idx_max, whole_u8_list_base);
     }else{
-      filesys_status=filesys_file_write_obnoxious(1, whole_u8_idx, whole_pathname_base, whole_u8_list_base);
+      stream_list_base[0].float_list_base=float_list_base;
+      stream_list_base[0].float_pathname_base=float_pathname_base;
+      stream_list_base[0].slice_thread_list_base=slice_thread_list_base;
+      stream_list_base[0].stream_list_base=stream_list_base;
+      stream_list_base[0].whole_pathname_base=whole_pathname_base;
+      stream_list_base[0].whole_u8_list_base=whole_u8_list_base;
+      stream_list_base[0].chunk_float_count=chunk_float_count;
+      stream_list_base[0].chunk_idx_max=(row_count-1)/chunk_row_count;
+      stream_list_base[0].float_count=float_count;
+      stream_list_base[0].row_u8_idx=row_u8_idx;
+      stream_list_base[0].thread_idx=0;
+      stream_list_base[0].thread_idx_max=thread_idx_max;
+      stream_list_base[0].append_status=append_status;
+      stream_list_base[0].filesys_status=0;
+      stream_list_base[0].whole_size=whole_size;
+      filesys_status=slice_stream_read(0, &stream_list_base[0]);
       if(filesys_status){
-        slice_error_print(emit_mode, "Cannot append to (whole_file)");
+        slice_error_print(emit_mode, "(float_file) changed size during execution");
+        break;
+      }
+      barrier_base=thread_barrier_malloc(1);
+      if(!barrier_base){
+        slice_out_of_memory_print(emit_mode);
+        break;
+      }
+      stream_list_base[0].barrier_base=barrier_base;
+      stream_list_base[1]=stream_list_base[0];
+      stream_list_base[1].thread_idx=1;
+      thread_list_run(barrier_base, slice_stream_thread, stream_list_base, (ULONG)(sizeof(slice_stream_t)), 1);
+      filesys_status=stream_list_base[0].filesys_status;
+      if(!filesys_status){
+        filesys_status=stream_list_base[1].filesys_status;
+      }
+      if(filesys_status==FILESYS_STATUS_READ_FAIL){
+        slice_error_print(emit_mode, "(float_file) changed size during execution");
+        break;
+      }else if(filesys_status==FILESYS_STATUS_NOT_FOUND){
+        slice_error_print(emit_mode, "(whole_file) disappeared during execution");
+        break;
+      }else if(filesys_status){
+        if(append_status){
+          slice_error_print(emit_mode, "Cannot append to (whole_file)");
+        }else{
+          slice_error_print(emit_mode, "Cannot update (whole_file)");
+        }
         break;
       }
     }
+    filesys_status=filesys_file_mem_unmap(descriptor, archive_size_u64, archive_u32_list_base);
+    if(filesys_status){
+      slice_error_print(emit_mode, "Could not close memory map for (index_file)");
+      break;
+    }
+/*
+When streaming, every chunk has already been written.
+*/
+    if(!stream_text_base){
+      if(!append_status){
+        filesys_status=filesys_subfile_write(0, whole_pathname_base, whole_u8_list_size, row_u8_idx, whole_u8_list_base);
+        if(filesys_status){
+          if(filesys_status==FILESYS_STATUS_NOT_FOUND){
+            slice_error_print(emit_mode, "(whole_file) disappeared during execution");
+            break;
+          }else{
+            slice_error_print(emit_mode, "Cannot update (whole_file)");
+            break;
+          }
+        }
+      }else{
+        filesys_status=filesys_file_write_obnoxious(1, whole_u8_list_size, whole_pathname_base, whole_u8_list_base);
+        if(filesys_status){
+          slice_error_print(emit_mode, "Cannot append to (whole_file)");
+          break;
+        }
+      }
+    }
     slice_progress_print(emit_mode, "Done");
     status=0;
   }while(0);
+  thread_barrier_free(barrier_base);
+  DEBUG_FREE_PARANOID(slice_thread_list_base);
   whole_free(whole_u8_list_base);
   fakefloat_free(float_list_base);
   archive_free(header_base);
@@ -395,6 +395,10 @@ If we delete floats instead of append them, we'll need to reevaluate the archive
         break;
       }
       status=1;
+      if(archive_header_flags_get(header_base)){
+        spectrafy_error_print(emit_mode, "(sfy_file) is a lookup index, which is only suitable for Slice");
+        break;
+      }
       pdf_free_count=pdf_slot_count-pdf_float_count;
       if(!check_status){
         if(!tune_status){
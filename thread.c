@@ -0,0 +1,272 @@
+/*
+Widebandit
+Copyright 2021 Russell Leidich
+
+This collection of files constitutes the Widebandit Library. (This is a
+library in the abstact sense; it's not intended to compile to a ".lib"
+file.)
+
+The Widebandit Library is free software: you can redistribute it and/or
+modify it under the terms of the GNU Limited General Public License as
+published by the Free Software Foundation, version 3.
+
+The Widebandit Library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Limited General Public License version 3 for more details.
+
+You should have received a copy of the GNU Limited General Public
+License version 3 along with the Widebandit Library (filename
+"COPYING"). If not, see http://www.gnu.org/licenses/ .
+*/
+/*
+Thread Functions
+*/
+#include "flag.h"
+#include "flag_thread.h"
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "constant.h"
+#include "debug.h"
+#include "debug_xtrn.h"
+#include "thread.h"
+#include "thread_xtrn.h"
+
+thread_barrier_t *
+thread_barrier_free(thread_barrier_t *barrier_base){
+/*
+Free a barrier allocated by thread_barrier_malloc().
+
+In:
+
+  barrier_base is thread_barrier_malloc():Out. May be NULL.
+
+Out:
+
+  Returns NULL so that the caller can easily maintain the good practice of NULLing out invalid pointers.
+
+  *barrier_base is freed.
+*/
+  if(barrier_base){
+    pthread_cond_destroy(&barrier_base->cond);
+    pthread_mutex_destroy(&barrier_base->mutex);
+    DEBUG_FREE_PARANOID(barrier_base);
+  }
+  return NULL;
+}
+
+thread_barrier_t *
+thread_barrier_malloc(ULONG thread_idx_max){
+/*
+Allocate a reusable barrier at which a fixed number of threads must all arrive before any of them can proceed. This is implemented with a mutex and a condition variable because pthread_barrier_t isn't available on all platforms.
+
+In:
+
+  thread_idx_max is the number of threads which will call thread_barrier_wait() on each cycle, less one.
+
+Out:
+
+  Returns NULL on failure, else the base of a barrier which must eventually be freed via thread_barrier_free().
+*/
+  thread_barrier_t *barrier_base;
+  int status;
+
+  barrier_base=DEBUG_MALLOC_PARANOID(sizeof(thread_barrier_t));
+  if(barrier_base){
+    barrier_base->generation=0;
+    barrier_base->thread_idx=0;
+    barrier_base->thread_idx_max=thread_idx_max;
+    status=pthread_mutex_init(&barrier_base->mutex, NULL);
+    if(!status){
+      status=pthread_cond_init(&barrier_base->cond, NULL);
+      if(status){
+        pthread_mutex_destroy(&barrier_base->mutex);
+      }
+    }
+    if(status){
+      DEBUG_FREE_PARANOID(barrier_base);
+      barrier_base=NULL;
+    }
+  }
+  return barrier_base;
+}
+
+void
+thread_barrier_wait(thread_barrier_t *barrier_base){
+/*
+Wait until all threads sharing a barrier have arrived at it.
+
+In:
+
+  barrier_base is thread_barrier_malloc():Out.
+
+Out:
+
+  (barrier_base->thread_idx_max+1) threads have called here since the previous release, so all of them have been released. All memory writes made by any of them prior to calling here are visible to all the others.
+*/
+  ULONG generation;
+
+  pthread_mutex_lock(&barrier_base->mutex);
+  generation=barrier_base->generation;
+  if(barrier_base->thread_idx!=barrier_base->thread_idx_max){
+    barrier_base->thread_idx++;
+    do{
+      pthread_cond_wait(&barrier_base->cond, &barrier_base->mutex);
+    }while(generation==barrier_base->generation);
+  }else{
+    barrier_base->generation=generation+1;
+    barrier_base->thread_idx=0;
+    pthread_cond_broadcast(&barrier_base->cond);
+  }
+  pthread_mutex_unlock(&barrier_base->mutex);
+  return;
+}
+
+void *
+thread_free(void *base){
+/*
+To maximize portability and debuggability, this is the only function in which Thread calls free().
+
+In:
+
+  base is the base of a memory region to free. May be NULL.
+
+Out:
+
+  Returns NULL so that the caller can easily maintain the good practice of NULLing out invalid pointers.
+
+  *base is freed.
+*/
+  DEBUG_FREE_PARANOID(base);
+  return NULL;
+}
+
+u8
+thread_init(u32 build_break_count, u32 build_feature_count){
+/*
+Verify that the source code is sufficiently updated.
+
+In:
+
+  build_break_count is the caller's most recent knowledge of THREAD_BUILD_BREAK_COUNT, which will fail if the caller is unaware of all critical updates.
+
+  build_feature_count is the caller's most recent knowledge of THREAD_BUILD_FEATURE_COUNT, which will fail if this library is not up to date with the caller's expectations.
+
+Out:
+
+  Returns one if (build_break_count!=THREAD_BUILD_BREAK_COUNT) or (build_feature_count>THREAD_BUILD_FEATURE_COUNT). Otherwise, returns zero.
+*/
+  u8 status;
+
+  status=(u8)(build_break_count!=THREAD_BUILD_BREAK_COUNT);
+  status=(u8)(status|(THREAD_BUILD_FEATURE_COUNT<build_feature_count));
+  return status;
+}
+
+ULONG
+thread_list_run(thread_barrier_t *barrier_base, void *(*function_base)(void *), void *parameter_list_base, ULONG parameter_size, ULONG thread_idx_max){
+/*
+Run a function on a list of parameter blocks in parallel, using the calling thread for the first block, and return when all of them have finished.
+
+In:
+
+  barrier_base is NULL if the workers never call thread_barrier_wait(), else thread_barrier_malloc(thread_idx_max):Out, in which case each worker must call thread_barrier_wait() exactly once before doing anything else, then read (barrier_base->thread_idx_max) in order to learn how many workers are actually running.
+
+  function_base is the base of the function to run, which takes the base of its parameter block and returns NULL.
+
+  parameter_list_base is the base of (thread_idx_max+1) parameter blocks, each of size parameter_size.
+
+  parameter_size is the size of each parameter block.
+
+  thread_idx_max is the number of threads to run, less one. On [0, THREAD_IDX_MAX_MAX].
+
+Out:
+
+  Returns the number of threads which actually ran, less one. If this is less than thread_idx_max, then the OS refused to create more threads. If barrier_base is NULL, then the parameter blocks which could not be assigned to their own threads have been processed sequentially by the calling thread, so all of them have been processed regardless. Otherwise, (barrier_base->thread_idx_max) has been reduced accordingly before any worker could proceed beyond its first call to thread_barrier_wait(), so that it can redistribute the work; parameter blocks at indexes greater than the return value have not been used.
+*/
+  u8 *parameter_base;
+  u8 *parameter_list_base_u8;
+  int status;
+  pthread_t *thread_list_base;
+  ULONG thread_idx;
+  ULONG thread_idx_max_actual;
+
+  parameter_list_base_u8=(u8 *)(parameter_list_base);
+  thread_idx_max_actual=0;
+  thread_list_base=NULL;
+  if(thread_idx_max){
+    thread_list_base=DEBUG_MALLOC_PARANOID(thread_idx_max*(ULONG)(sizeof(pthread_t)));
+    if(thread_list_base){
+      do{
+        parameter_base=&parameter_list_base_u8[(thread_idx_max_actual+1)*parameter_size];
+        status=pthread_create(&thread_list_base[thread_idx_max_actual], NULL, function_base, parameter_base);
+        if(status){
+          break;
+        }
+      }while((++thread_idx_max_actual)!=thread_idx_max);
+    }
+    if(barrier_base&&(thread_idx_max_actual!=thread_idx_max)){
+      pthread_mutex_lock(&barrier_base->mutex);
+      barrier_base->thread_idx_max=thread_idx_max_actual;
+      pthread_mutex_unlock(&barrier_base->mutex);
+    }
+  }
+  function_base(parameter_list_base);
+  if(!barrier_base){
+    thread_idx=thread_idx_max_actual;
+    while(thread_idx!=thread_idx_max){
+      thread_idx++;
+      function_base(&parameter_list_base_u8[thread_idx*parameter_size]);
+    }
+  }
+  thread_idx=0;
+  while(thread_idx!=thread_idx_max_actual){
+    pthread_join(thread_list_base[thread_idx], NULL);
+    thread_idx++;
+  }
+  DEBUG_FREE_PARANOID(thread_list_base);
+  return thread_idx_max_actual;
+}
+
+void
+thread_span_get(ULONG *idx_max_base, ULONG *idx_min_base, ULONG idx_post, ULONG thread_idx, ULONG thread_idx_max){
+/*
+Divide a range of indexes into contiguous spans of nearly equal size, one per thread, and return the span belonging to a particular thread.
+
+In:
+
+  *idx_max_base is undefined.
+
+  *idx_min_base is undefined.
+
+  idx_post is the number of indexes to divide. At least (thread_idx_max+1).
+
+  thread_idx is the index of the thread in question. On [0, thread_idx_max].
+
+  thread_idx_max is the number of threads, less one.
+
+Out:
+
+  *idx_max_base is the greatest index in the span of thread_idx.
+
+  *idx_min_base is the least index in the span of thread_idx. Spans are in ascending order of thread index, and their sizes differ by at most one.
+*/
+  ULONG idx_min;
+  ULONG span_remainder;
+  ULONG span_size;
+  ULONG thread_count;
+
+  thread_count=thread_idx_max+1;
+  span_size=idx_post/thread_count;
+  span_remainder=idx_post%thread_count;
+  idx_min=span_size*thread_idx;
+  idx_min+=MIN(thread_idx, span_remainder);
+  if(thread_idx<span_remainder){
+    span_size++;
+  }
+  *idx_max_base=idx_min+span_size-1;
+  *idx_min_base=idx_min;
+  return;
+}
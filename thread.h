@@ -0,0 +1,30 @@
+/*
+Widebandit
+Copyright 2021 Russell Leidich
+
+This collection of files constitutes the Widebandit Library. (This is a
+library in the abstact sense; it's not intended to compile to a ".lib"
+file.)
+
+The Widebandit Library is free software: you can redistribute it and/or
+modify it under the terms of the GNU Limited General Public License as
+published by the Free Software Foundation, version 3.
+
+The Widebandit Library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Limited General Public License version 3 for more details.
+
+You should have received a copy of the GNU Limited General Public
+License version 3 along with the Widebandit Library (filename
+"COPYING"). If not, see http://www.gnu.org/licenses/ .
+*/
+#define THREAD_IDX_MAX_MAX 0xFFU
+
+TYPEDEF_START
+  pthread_cond_t cond;
+  pthread_mutex_t mutex;
+  ULONG generation;
+  ULONG thread_idx;
+  ULONG thread_idx_max;
+TYPEDEF_END(thread_barrier_t)
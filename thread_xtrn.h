@@ -0,0 +1,28 @@
+/*
+Widebandit
+Copyright 2021 Russell Leidich
+
+This collection of files constitutes the Widebandit Library. (This is a
+library in the abstact sense; it's not intended to compile to a ".lib"
+file.)
+
+The Widebandit Library is free software: you can redistribute it and/or
+modify it under the terms of the GNU Limited General Public License as
+published by the Free Software Foundation, version 3.
+
+The Widebandit Library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Limited General Public License version 3 for more details.
+
+You should have received a copy of the GNU Limited General Public
+License version 3 along with the Widebandit Library (filename
+"COPYING"). If not, see http://www.gnu.org/licenses/ .
+*/
+extern thread_barrier_t *thread_barrier_free(thread_barrier_t *barrier_base);
+extern thread_barrier_t *thread_barrier_malloc(ULONG thread_idx_max);
+extern void thread_barrier_wait(thread_barrier_t *barrier_base);
+extern void *thread_free(void *base);
+extern u8 thread_init(u32 build_break_count, u32 build_feature_count);
+extern ULONG thread_list_run(thread_barrier_t *barrier_base, void *(*function_base)(void *), void *parameter_list_base, ULONG parameter_size, ULONG thread_idx_max);
+extern void thread_span_get(ULONG *idx_max_base, ULONG *idx_min_base, ULONG idx_post, ULONG thread_idx, ULONG thread_idx_max);
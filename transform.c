@@ -23,813 +23,3255 @@ License version 3 along with the Widebandit Library (filename
 Whole Number Functions
 */
 #include "flag.h"
+#include "flag_filesys.h"
 #include "flag_fracterval_u128.h"
 #include "flag_fracterval_u64.h"
+#include "flag_thread.h"
 #include "flag_transform.h"
+#include <pthread.h>
 #include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#ifdef TRANSFORM_STATS
+  #include <time.h>
+#endif
 #include "constant.h"
 #include "debug.h"
 #include "debug_xtrn.h"
+#include "filesys.h"
+#include "filesys_xtrn.h"
 #include "fracterval_u128.h"
 #include "fracterval_u128_xtrn.h"
 #include "fracterval_u64.h"
 #include "fracterval_u64_xtrn.h"
+#include "lmd2.h"
+#include "thread.h"
+#include "thread_xtrn.h"
 #include "transform.h"
 #include "transform_xtrn.h"
 
-u8
-transform_delta_delta_list_init(fru128 **entropy_delta_delta_fru128_list_base_base, fru64 **entropy_delta_delta_fru64_list_base_base, u8 precise_status){
+static char *transform_logfreedom_memo_pathname_base;
+static char *transform_lookup_cache_pathname_base;
+static ULONG transform_lookup_thread_idx_max;
+#ifdef TRANSFORM_STATS
+  static u64 transform_stats_list_base[TRANSFORM_STATS_IDX_MAX+1];
+#endif
+
+void
+transform_clone(entropy_t *entropy_base, entropy_t **entropy_clone_base_base, transform_t *transform_base, transform_t **transform_clone_base_base){
 /*
-Initialize (allocate and populate) a lookup table of (changes in (changes in entropy)).
+Create an independent copy of the scan state returned by transform_malloc() so that another thread can scan a different part of the same array of wholes. Lookup lists, which are readonly after initialization, are shared with the original rather than recomputed.
 
 In:
 
-  *entropy_delta_delta_fru128_list_base_base is undefined.
+  entropy_base is transform_malloc():Out:*entropy_base_base.
 
-  *entropy_delta_delta_fru64_list_base_base is undefined.
+  *entropy_clone_base_base is undefined.
 
-  precise_status is zero for 32.32 or one for 64.64 fixed-points expressed as 64-bit or 128-bit fractervals, respectively.
+  transform_base is transform_malloc():Out:*transform_base_base.
+
+  *transform_clone_base_base is undefined.
 
 Out:
 
-  Returns one on failure, else zero.
+  *entropy_clone_base_base is NULL on failure, else a copy of entropy_base, including (entropy_base->fakefloat_list_base), which is shared. If transform_rank_init() was called on entropy_base, then the copy has its own empty rank lists.
 
-  *entropy_delta_delta_fru(64/128)_list_base_base is the base of TRANSFORM_DELTA_DELTA_FREQ_POST (64/128)-bit fractervals as defined in the summary, depending on precise_status. The other is NULL.
+  *transform_clone_base_base is NULL iff *entropy_clone_base_base is NULL. Otherwise, it has its own frequency, population, and entropy delta lists. It must be freed via transform_free_all() before transform_base, which must not be freed while it's in use.
 */
-  fru128 entropy_delta_delta_delta;
-  fru128 entropy_delta_delta_fru128;
-  fru128 *entropy_delta_delta_fru128_list_base;
-  fru64 entropy_delta_delta_fru64;
-  fru64 *entropy_delta_delta_fru64_list_base;
-  ULONG freq;
-  u8 status;
-  u64 term_u64;
-
-  entropy_delta_delta_fru64_list_base=NULL;
-  entropy_delta_delta_fru128_list_base=NULL;
-  if(!precise_status){
-    entropy_delta_delta_fru64_list_base=fracterval_u64_list_malloc(TRANSFORM_DELTA_DELTA_FREQ_MAX);
-    status=!entropy_delta_delta_fru64_list_base;
-  }else{
-    entropy_delta_delta_fru128_list_base=fracterval_u128_list_malloc(TRANSFORM_DELTA_DELTA_FREQ_MAX);
-    status=!entropy_delta_delta_fru128_list_base;
-  }
-  if(!status){
-    FRU128_SET_ZERO(entropy_delta_delta_fru128);
-    freq=0;
-    do{
-      if(freq){
-        term_u64=freq;
-        FRU128_LOG_DELTA_U64(entropy_delta_delta_delta, term_u64, status);
-        FRU128_SHIFT_RIGHT_SELF(entropy_delta_delta_delta, U64_BITS-U64_BITS_LOG2);
-        FRU128_MULTIPLY_U64(entropy_delta_delta_fru128, entropy_delta_delta_delta, term_u64, status);
-        term_u64++;
-        FRU128_LOG_U64(entropy_delta_delta_delta, term_u64, status);
-        FRU128_SHIFT_RIGHT_SELF(entropy_delta_delta_delta, U64_BITS-U64_BITS_LOG2);
-        FRU128_ADD_FRU128_SELF(entropy_delta_delta_fru128, entropy_delta_delta_delta, status);
-      }
-      if(!precise_status){
-        FRU128_SHIFT_RIGHT_SELF(entropy_delta_delta_fru128, U32_BITS);
-        U128_TO_U64_LO(entropy_delta_delta_fru64.a, entropy_delta_delta_fru128.a);
-        U128_TO_U64_LO(entropy_delta_delta_fru64.b, entropy_delta_delta_fru128.b);
-        entropy_delta_delta_fru64_list_base[freq]=entropy_delta_delta_fru64;
-      }else{
-        entropy_delta_delta_fru128_list_base[freq]=entropy_delta_delta_fru128;
-      }
-    }while((freq++)!=TRANSFORM_DELTA_DELTA_FREQ_MAX);
-  }
-  *entropy_delta_delta_fru128_list_base_base=entropy_delta_delta_fru128_list_base;
-  *entropy_delta_delta_fru64_list_base_base=entropy_delta_delta_fru64_list_base;
-  return status;
+  transform_clone_resize(entropy_base, entropy_clone_base_base, transform_base, transform_clone_base_base, entropy_base->window_y_idx_max);
+  return;
 }
 
 u8
-transform_dispatch(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base){
+transform_clone_reset(entropy_t *entropy_base, transform_t *transform_base, ULONG whole_y_idx_max){
 /*
-Excute a 2D channelized entropy transform by scrolling a window across all columns (channels), then across all rows (spectra).
+Prepare the scan state returned by transform_clone() for reuse on another array of wholes of the same width, but possibly a different number of rows, without reallocating its column lists or recomputing the lookup lists which it shares with the original.
 
 In:
 
-  entropy_base is transform_malloc():Out:*entropy_base_base.
+  entropy_base is transform_clone():Out:*entropy_clone_base_base. (entropy_base->fakefloat_list_base) must be NULL because its dimensions would differ. transform_transpose_init() must not have been called on the original because its copy would describe a different array.
 
-  transform_base is transform_malloc():Out:*transform_base_base.
+  transform_base is transform_clone():Out:*transform_clone_base_base.
 
-  whole_u8_list_base is the base of (entropy_base->whole_count) wholes, each of size (entropy_base->granularity+1) and not exceeding (entropy_base->whole_max_max).
+  whole_y_idx_max is the number of rows in the new array of wholes, less one. None of its wholes may exceed (entropy_base->whole_max_max).
 
 Out:
 
-  Returns one if fracterval underflow or overflow occured (which is usually benign) else zero.
+  Returns one if whole_y_idx_max is less than (entropy_base->window_y_idx_max), the new array would be too big, or (entropy_base->fakefloat_list_base) is not NULL, in which case *entropy_base and *transform_base are unchanged. Else zero.
 
-  The transform has been done according to transform_malloc():In. If transform_malloc():In:fakefloat_list_base was not NULL, then an array of fakefloats corresponding to window entropy values, and indexed in the same way as *whole_u8_list_base, but having width (entropy_base->fakefloat_x_idx_max+1) and height (entropy_base->fakefloat_y_idx_max+1) has been created at (entropy_base->fakefloat_list_base).
+  *entropy_base pertains to an array of (whole_y_idx_max+1) rows, so that it can be passed to transform_dispatch() along with that array. The frequency and population lists in *transform_base have been zeroed, as they were when allocated, because transform_dispatch() leaves them describing the last window.
 */
-  u64 entropy_max_max_u64;
-  u128 entropy_max_max_u128;
-  ULONG entropy_max_max_x_idx;
-  u64 entropy_min_min_u64;
-  ULONG entropy_min_min_x_idx;
-  u128 entropy_min_min_u128;
-  ULONG entropy_y_idx;
-  ULONG entropy_y_idx_max;
-  u8 optimize_status;
-  u8 precise_status;
+  void **freq_list_base_list_base;
+  ULONG freq_list_idx;
+  ULONG **pop_list_base_list_base;
   u8 status;
-  u8 status_delta;
+  ULONG whole_count;
+  ULONG whole_y_idx_post;
 
-  optimize_status=transform_base->optimize_status;
-  precise_status=entropy_base->precise_status;
-  status=0;
-  entropy_base->max_max_y_idx=0;
-  entropy_base->min_min_y_idx=0;
-  U128_SET_ZERO(entropy_max_max_u128);
-  entropy_max_max_u64=0;
-  entropy_max_max_x_idx=0;
-  U128_NOT(entropy_min_min_u128, entropy_max_max_u128);
-  entropy_min_min_u64=~entropy_max_max_u64;
-  entropy_min_min_x_idx=0;
-  entropy_y_idx=0;
-  entropy_y_idx_max=entropy_base->fakefloat_y_idx_max;
-  do{
-    if(!precise_status){
-      if(optimize_status&&entropy_y_idx){
-        status_delta=transform_whole_list_line_entropy_delta_get_fru64(entropy_base, transform_base, whole_u8_list_base, entropy_y_idx);
-      }else{
-        status_delta=transform_whole_list_line_entropy_get_fru64(entropy_base, transform_base, whole_u8_list_base, entropy_y_idx);
-      }
-      if(entropy_max_max_u64<entropy_base->max_max_u64){
-        entropy_base->max_max_y_idx=entropy_y_idx;
-        entropy_max_max_u64=entropy_base->max_max_u64;
-        entropy_max_max_x_idx=entropy_base->max_max_x_idx;
-      }
-      if(entropy_base->min_min_u64<entropy_min_min_u64){
-        entropy_base->min_min_y_idx=entropy_y_idx;
-        entropy_min_min_u64=entropy_base->min_min_u64;
-        entropy_min_min_x_idx=entropy_base->min_min_x_idx;
-      }
-    }else{
-      if(optimize_status&&entropy_y_idx){
-        status_delta=transform_whole_list_line_entropy_delta_get_fru128(entropy_base, transform_base, whole_u8_list_base, entropy_y_idx);
-      }else{
-        status_delta=transform_whole_list_line_entropy_get_fru128(entropy_base, transform_base, whole_u8_list_base, entropy_y_idx);
-      }
-      if(U128_IS_LESS(entropy_max_max_u128, entropy_base->max_max_u128)){
-        entropy_base->max_max_y_idx=entropy_y_idx;
-        entropy_max_max_u128=entropy_base->max_max_u128;
-        entropy_max_max_x_idx=entropy_base->max_max_x_idx;
-      }
-      if(U128_IS_LESS(entropy_base->min_min_u128, entropy_min_min_u128)){
-        entropy_base->min_min_y_idx=entropy_y_idx;
-        entropy_min_min_u128=entropy_base->min_min_u128;
-        entropy_min_min_x_idx=entropy_base->min_min_x_idx;
+  whole_y_idx_post=whole_y_idx_max+1;
+  whole_count=entropy_base->whole_x_idx_post*whole_y_idx_post;
+  status=(u8)((whole_y_idx_max<entropy_base->window_y_idx_max)|!whole_y_idx_post);
+  status=(u8)(status|((whole_count/entropy_base->whole_x_idx_post)!=whole_y_idx_post)|!!entropy_base->fakefloat_list_base);
+  if(!status){
+    entropy_base->fakefloat_y_idx_max=whole_y_idx_max-entropy_base->window_y_idx_max;
+    entropy_base->whole_count=whole_count;
+    entropy_base->whole_y_idx_max=whole_y_idx_max;
+    entropy_base->whole_y_idx_post=whole_y_idx_post;
+    freq_list_base_list_base=transform_base->freq_list_base_list_base;
+    pop_list_base_list_base=transform_base->pop_list_base_list_base;
+    freq_list_idx=0;
+    do{
+      transform_freq_list_zero(freq_list_base_list_base[freq_list_idx], transform_base->freq_size_log2, entropy_base->whole_max_max);
+      if(pop_list_base_list_base){
+        transform_ulong_list_zero(entropy_base->window_y_idx_post, pop_list_base_list_base[freq_list_idx]);
       }
-    }
-    status=(u8)(status|status_delta);
-  }while((entropy_y_idx++)!=entropy_y_idx_max);
-  entropy_base->max_max_u128=entropy_max_max_u128;
-  entropy_base->max_max_u64=entropy_max_max_u64;
-  entropy_base->max_max_x_idx=entropy_max_max_x_idx;
-  entropy_base->min_min_u128=entropy_min_min_u128;
-  entropy_base->min_min_u64=entropy_min_min_u64;
-  entropy_base->min_min_x_idx=entropy_min_min_x_idx;
-  if(entropy_base->discount_status){
-    status_delta=transform_entropy_to_discount(entropy_base);
-    status=(u8)(status|status_delta);
+    }while((freq_list_idx++)!=transform_base->freq_list_idx_max);
   }
   return status;
 }
 
-u8
-transform_entropy_to_discount(entropy_t *entropy_base){
+void
+transform_clone_resize(entropy_t *entropy_base, entropy_t **entropy_clone_base_base, transform_t *transform_base, transform_t **transform_clone_base_base, ULONG window_y_idx_max){
 /*
-Subtract min and max entropy values from the theoretical maximum window entropy, then exchange the (x, y) coordinates of the corresponding windows (because discounting inverts min and max).
+Create an independent copy of the scan state returned by transform_malloc(), but with a window height no greater than the original, so that the lookup lists of the original, which suffice for any such height, can be shared rather than recomputed. Don't call here directly unless the height differs; use transform_clone() instead.
 
 In:
 
   entropy_base is transform_malloc():Out:*entropy_base_base.
 
-Out:
-
-  Returns one if fracterval underflow or overflow occured else zero. This can only occur if either (1) the upper bound of a computed entropy value was at least the maximum estimated entropy or (2) said maximum is actually less than its true value. Either way, the result is saturation to zero discount nats, which is probably benign if not exactly correct.
-
-  *entropy_base has been adjusted in the following items in order to reflect discount nats: max_max_u128, max_max_u64, max_max_x_idx, max_max_y_idx, min_min_u128, min_min_u64, min_min_x_idx, and min_min_y_idx.
-*/
-  fru128 entropy_fru128;
-  fru64 entropy_fru64;
-  ULONG entropy_idx;
-  fru128 entropy_max_max_max_fru128;
-  fru64 entropy_max_max_max_fru64;
-  u8 status;
-  u64 term_u64;
-
-  status=0;
-  term_u64=(u64)(entropy_base->window_x_idx_post);
-  if(!entropy_base->precise_status){
-    entropy_fru64.a=entropy_base->min_min_u64;
-    entropy_fru64.b=entropy_base->max_max_u64;
-    entropy_max_max_max_fru64=entropy_base->window_max_max_fru64;
-    FRU64_SUBTRACT_FROM_FRU64_SELF(entropy_fru64, entropy_max_max_max_fru64, status);
-    FRU64_DIVIDE_U64_SELF(entropy_fru64, term_u64, status);
-    entropy_base->max_max_u64=entropy_fru64.b;
-    entropy_base->min_min_u64=entropy_fru64.a;
-  }else{
-    entropy_fru128.a=entropy_base->min_min_u128;
-    entropy_fru128.b=entropy_base->max_max_u128;
-    entropy_max_max_max_fru128=entropy_base->window_max_max_fru128;
-    FRU128_SUBTRACT_FROM_FRU128_SELF(entropy_fru128, entropy_max_max_max_fru128, status);
-    FRU128_DIVIDE_U64_SELF(entropy_fru128, term_u64, status);
-    entropy_base->max_max_u128=entropy_fru128.b;
-    entropy_base->min_min_u128=entropy_fru128.a;
-  }
-  entropy_idx=entropy_base->max_max_x_idx;
-  entropy_base->max_max_x_idx=entropy_base->min_min_x_idx;
-  entropy_base->min_min_x_idx=entropy_idx;
-  entropy_idx=entropy_base->max_max_y_idx;
-  entropy_base->max_max_y_idx=entropy_base->min_min_y_idx;
-  entropy_base->min_min_y_idx=entropy_idx;
-  return status;
-}
-
-u32 *
-transform_fakefloat_list_malloc(ULONG *fakefloat_list_size_base, ULONG whole_x_idx_max, ULONG whole_y_idx_max, ULONG window_x_idx_max, ULONG window_y_idx_max){
-/*
-Allocate an array of fakefloats ((u32)s which are bitwise equivalent to, but not identified as, floats).
-
-In:
-
-  *fakefloat_list_size_base is undefined.
+  *entropy_clone_base_base is undefined.
 
-  whole_x_idx_max is the number of columns (channels) per row (spectrum) in the array of wholes to scan, less one.
-
-  whole_y_idx_max is the number of rows in the array of wholes to scan, less one.
+  transform_base is transform_malloc():Out:*transform_base_base.
 
-  window_x_idx_max is the number of columns (channels) per row (spectrum) in the window of wholes to scan, less one. On [0, whole_x_idx_max].
+  *transform_clone_base_base is undefined.
 
-  window_y_idx_max is the number of rows in the window of wholes to scan, less one. On [0, whole_y_idx_max].
+  window_y_idx_max is the number of rows in the window of the clone, less one. On [1, (entropy_base->window_y_idx_max)].
 
 Out:
 
-  Returns NULL on failure, else the base of (whole_x_idx_max+1)*(whole_y_idx_max+1) fakefloat (u32)s.
+  *entropy_clone_base_base and *transform_clone_base_base are as defined in transform_clone():Out, except that if window_y_idx_max differs from (entropy_base->window_y_idx_max), then (1) all window parameters, including the window entropy offsets, pertain to the new height, (2) (*entropy_clone_base_base)->fakefloat_list_base is NULL because its dimensions would differ, and (3) the frequency lists of the clone retain the counter size of the original, which is at least as large as necessary.
 */
-  ULONG fakefloat_idx_post;
-  u32 *fakefloat_list_base;
-  ULONG fakefloat_x_idx_post;
-  ULONG fakefloat_y_idx_post;
-  ULONG list_size;
+  entropy_t *entropy_clone_base;
+  ULONG pop_list_size;
+  u8 status;
+  transform_t *transform_clone_base;
 
-  fakefloat_list_base=NULL;
-  if((window_x_idx_max<=whole_x_idx_max)&&(window_y_idx_max<=whole_y_idx_max)){
-    fakefloat_x_idx_post=whole_x_idx_max-window_x_idx_max+1;
-    fakefloat_y_idx_post=whole_y_idx_max-window_y_idx_max+1;
-    fakefloat_idx_post=fakefloat_x_idx_post*fakefloat_y_idx_post;
-    if(fakefloat_idx_post&&((fakefloat_idx_post/fakefloat_x_idx_post)==fakefloat_y_idx_post)){
-      list_size=fakefloat_idx_post<<U32_SIZE_LOG2;
-      if((list_size>>U32_SIZE_LOG2)==fakefloat_idx_post){
-        *fakefloat_list_size_base=list_size;
-        fakefloat_list_base=DEBUG_MALLOC_PARANOID(list_size);
+  entropy_clone_base=DEBUG_MALLOC_PARANOID((ULONG)(sizeof(entropy_t)));
+  transform_clone_base=DEBUG_MALLOC_PARANOID((ULONG)(sizeof(transform_t)));
+  status=!(entropy_clone_base&&transform_clone_base);
+  if(!status){
+    memcpy(entropy_clone_base, entropy_base, sizeof(entropy_t));
+    memcpy(transform_clone_base, transform_base, sizeof(transform_t));
+    entropy_clone_base->rank_max_fru128_list_base=NULL;
+    entropy_clone_base->rank_max_fru64_list_base=NULL;
+    entropy_clone_base->rank_max_xy_list_base=NULL;
+    entropy_clone_base->rank_min_fru128_list_base=NULL;
+    entropy_clone_base->rank_min_fru64_list_base=NULL;
+    entropy_clone_base->rank_min_xy_list_base=NULL;
+    entropy_clone_base->rank_row_fru128_list_base=NULL;
+    entropy_clone_base->hit_list_base=NULL;
+    entropy_clone_base->hit_max_status=0;
+    entropy_clone_base->hit_min_status=0;
+    entropy_clone_base->rank_row_fru64_list_base=NULL;
+    transform_clone_base->entropy_delta_fru128_list_base=NULL;
+    transform_clone_base->entropy_delta_fru64_list_base=NULL;
+    transform_clone_base->freq_list_base_list_base=NULL;
+    transform_clone_base->pop_list_base=NULL;
+    transform_clone_base->pop_list_base_list_base=NULL;
+    transform_clone_base->pop_list_best_base=NULL;
+    transform_clone_base->pop_list_best_best_base=NULL;
+    transform_clone_base->clone_status=1;
+    if(window_y_idx_max!=entropy_base->window_y_idx_max){
+      entropy_clone_base->fakefloat_list_base=NULL;
+      entropy_clone_base->fakefloat_y_idx_max=entropy_base->whole_y_idx_max-window_y_idx_max;
+      entropy_clone_base->window_y_idx_max=window_y_idx_max;
+      entropy_clone_base->window_y_idx_post=window_y_idx_max+1;
+/*
+Logfreedom offsets require scratch population lists of their own, which transform_malloc() would otherwise have allocated.
+*/
+      if(transform_base->algo_status==TRANSFORM_ALGO_STATUS_LOGFREEDOM){
+        pop_list_size=(window_y_idx_max+2)<<ULONG_SIZE_LOG2;
+        transform_clone_base->pop_list_best_base=DEBUG_MALLOC_PARANOID(pop_list_size);
+        transform_clone_base->pop_list_best_best_base=DEBUG_MALLOC_PARANOID(pop_list_size);
+        status=!(transform_clone_base->pop_list_best_base&&transform_clone_base->pop_list_best_best_base);
       }
     }
+    if(!status){
+      status=transform_column_lists_malloc(entropy_clone_base, transform_clone_base);
+    }
+    if((!status)&&(window_y_idx_max!=entropy_base->window_y_idx_max)){
+      status=transform_window_entropy_offsets_get(entropy_clone_base, transform_clone_base);
+    }
+    if((!status)&&entropy_base->rank_status){
+      status=transform_rank_init(entropy_clone_base, entropy_base->rank_overlap_status, entropy_base->rank_idx_max_max);
+    }
+    if(status){
+      transform_free_all(&entropy_clone_base, &transform_clone_base);
+    }
+  }else{
+    DEBUG_FREE_PARANOID(transform_clone_base);
+    DEBUG_FREE_PARANOID(entropy_clone_base);
+    entropy_clone_base=NULL;
+    transform_clone_base=NULL;
   }
-  return fakefloat_list_base;
+  *entropy_clone_base_base=entropy_clone_base;
+  *transform_clone_base_base=transform_clone_base;
+  return;
 }
 
-void *
-transform_free(void *base){
+TRANSFORM_INLINE u8
+transform_column_entropy_delta_get_fru128(u8 algo_status, entropy_t *entropy_base, u8 granularity, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx){
 /*
-To maximize portability and debuggability, this is the only function in which Transform calls free().
+Update the entropy delta of each column in a given range for a given algo and granularity, as transform_whole_list_column_entropy_delta_get_fru128() describes. This is always expanded inline, so when algo_status and granularity are constant, the compiler removes all branches on them from the inner loop. Don't call here directly; use transform_whole_list_column_entropy_delta_get_fru128() instead.
 
 In:
 
-  base is the base of a memory region to free. May be NULL.
-
-Out:
-
-  Returns NULL so that the caller can easily maintain the good practice of NULLing out invalid pointers.
-
-  *base is freed.
-*/
-  DEBUG_FREE_PARANOID(base);
-  return NULL;
-}
-
-void
-transform_free_all(entropy_t **entropy_base_base, transform_t **transform_base_base){
-/*
-Free all transform data structures.
+  algo_status is transform_malloc():In:algo_status.
 
-In:
+  entropy_base is as defined in transform_whole_list_column_entropy_delta_get_fru128():In.
 
-  entropy_base is transform_malloc():Out:*entropy_base_base. May be NULL only if transform_base is NULL.
+  granularity is transform_malloc():In:granularity.
 
-  transform_base is transform_malloc():Out:*transform_base_base. May be NULL.
+  transform_base, whole_u8_list_base, whole_x_idx_max, whole_x_idx_min, and whole_y_idx are as defined in transform_whole_list_column_entropy_delta_get_fru128():In.
 
 Out:
 
-  *entropy_base_base is NULL and all its children have been freed except for *fakefloat_list_base (because it was never the property of Transform).
-
-  *transform_base_base is NULL and all its children have been freed.
+  Returns and updates as transform_whole_list_column_entropy_delta_get_fru128():Out describes.
 */
-  entropy_t *entropy_base;
-  ULONG *freq_list_base;
-  ULONG **freq_list_base_list_base;
-  ULONG freq_list_idx;
+  u32 digit;
+  fru128 entropy_delta;
+  fru128 entropy_delta_delta;
+  fru128 *entropy_delta_delta_fru128_list_base;
+  fru128 *entropy_delta_list_base;
+  ULONG freq;
+  void *freq_list_base;
+  void **freq_list_base_list_base;
+  ULONG freq_old;
+  u8 freq_size_log2;
+  fru128 *log_delta_list_base;
+  fru128 *log_list_base;
+  ULONG pop;
+  ULONG pop_freq_old;
   ULONG *pop_list_base;
   ULONG **pop_list_base_list_base;
-  transform_t *transform_base;
+  TRANSFORM_STATS_DECLARE(stats_unchanged_count)
+  u8 status;
+  u64 term_u64;
+  u32 whole;
+  u32 whole_old;
+  u8 whole_size;
+  ULONG whole_u8_idx;
+  ULONG whole_u8_idx_delta;
+  ULONG whole_x_idx;
+  ULONG window_y_idx_post;
 
-  entropy_base=*entropy_base_base;
-  transform_base=*transform_base_base;
-  if(transform_base){
-    if(!entropy_base->precise_status){
-      fracterval_u64_free(transform_base->entropy_delta_delta_fru64_list_base);
-      transform_lookup_lists_free(transform_base);
-      fracterval_u64_free(transform_base->entropy_delta_fru64_list_base);
-    }else{
-      fracterval_u128_free(transform_base->entropy_delta_delta_fru128_list_base);
-      transform_lookup_lists_free(transform_base);
-      fracterval_u128_free(transform_base->entropy_delta_fru128_list_base);
+  status=0;
+  TRANSFORM_STATS_SET_ZERO(stats_unchanged_count);
+  entropy_delta_delta_fru128_list_base=transform_base->entropy_delta_delta_fru128_list_base;
+  entropy_delta_list_base=transform_base->entropy_delta_fru128_list_base;
+  freq_list_base_list_base=transform_base->freq_list_base_list_base;
+  freq_size_log2=transform_base->freq_size_log2;
+  log_delta_list_base=transform_base->log_delta_fru128_list_base;
+  log_list_base=transform_base->log_fru128_list_base;
+  pop_list_base=NULL;
+  pop_list_base_list_base=transform_base->pop_list_base_list_base;
+  whole_size=(u8)(granularity+1);
+  window_y_idx_post=entropy_base->window_y_idx_post;
+  whole_u8_idx_delta=whole_size*entropy_base->whole_x_idx_post;
+  whole_u8_idx=whole_u8_idx_delta*(whole_y_idx-1)+whole_size*whole_x_idx_min;
+  whole_u8_idx_delta*=window_y_idx_post;
+  whole_x_idx=whole_x_idx_min;
+  do{
+    entropy_delta=entropy_delta_list_base[whole_x_idx];
+    freq_list_base=freq_list_base_list_base[whole_x_idx];
+    if(algo_status==TRANSFORM_ALGO_STATUS_LOGFREEDOM){
+      pop_list_base=pop_list_base_list_base[whole_x_idx];
     }
-    freq_list_base_list_base=transform_base->freq_list_base_list_base;
-    pop_list_base_list_base=transform_base->pop_list_base_list_base;
-    if(freq_list_base_list_base){
-      freq_list_idx=transform_base->freq_list_idx_max;
-      do{
-        if(pop_list_base_list_base){
-          pop_list_base=pop_list_base_list_base[freq_list_idx];
-          DEBUG_FREE_PARANOID(pop_list_base);
+    whole_old=whole_u8_list_base[whole_u8_idx];
+    whole=whole_u8_list_base[whole_u8_idx+whole_u8_idx_delta];
+    whole_u8_idx++;
+    if(granularity){
+      digit=whole_u8_list_base[whole_u8_idx];
+      whole_old|=digit<<U8_BITS;
+      digit=whole_u8_list_base[whole_u8_idx+whole_u8_idx_delta];
+      whole|=digit<<U8_BITS;
+      whole_u8_idx++;
+      if(U16_BYTE_MAX<granularity){
+        digit=whole_u8_list_base[whole_u8_idx];
+        whole_old|=digit<<U16_BITS;
+        digit=whole_u8_list_base[whole_u8_idx+whole_u8_idx_delta];
+        whole|=digit<<U16_BITS;
+        whole_u8_idx++;
+        if(U24_BYTE_MAX<granularity){
+          digit=whole_u8_list_base[whole_u8_idx];
+          whole_old|=digit<<U24_BITS;
+          digit=whole_u8_list_base[whole_u8_idx+whole_u8_idx_delta];
+          whole|=digit<<U24_BITS;
+          whole_u8_idx++;
         }
-        freq_list_base=freq_list_base_list_base[freq_list_idx];
-        DEBUG_FREE_PARANOID(freq_list_base);
-      }while(freq_list_idx--);
+      }
     }
-    DEBUG_FREE_PARANOID(transform_base->pop_list_best_best_base);
-    DEBUG_FREE_PARANOID(transform_base->pop_list_best_base);
-    DEBUG_FREE_PARANOID(pop_list_base_list_base);
-    DEBUG_FREE_PARANOID(freq_list_base_list_base);
-    DEBUG_FREE_PARANOID(transform_base->pop_list_base);
-    DEBUG_FREE_PARANOID(transform_base);
-    *transform_base_base=NULL;
-  }
-  entropy_base=*entropy_base_base;
-  DEBUG_FREE_PARANOID(entropy_base);
-  *entropy_base_base=NULL;
-  return;
-}
-
-u8
-transform_freq_list_entropy_get_fru128(u8 algo_status, fru128 *entropy_fru128_base, ULONG *freq_list_base, fru128 *lookup_list_base, ULONG *pop_list_base, ULONG whole_idx_max, u32 whole_max_max){
+    TRANSFORM_STATS_EQUAL_COUNT(stats_unchanged_count, whole, whole_old);
+    if(whole!=whole_old){
+      TRANSFORM_FREQ_GET(freq, freq_list_base, freq_size_log2, whole);
+      TRANSFORM_FREQ_GET(freq_old, freq_list_base, freq_size_log2, whole_old);
+      if(algo_status==TRANSFORM_ALGO_STATUS_AGNENTROPY){
 /*
-Get the entropy delta implied by a frequency list, which the caller must then subtract from the entropy bias, for example, from (entropy_base->window_bias_fru128), in order to obtain entropy.
-
-In:
-
-  algo_status is one of the TRANSFORM_ALGO_STATUS constants, which implies which definition of entropy to use.
-
-  *entropy_fru128_base is undefined.
-
-  *freq_list_base contains the frequency (occurrences count) each corresponding whole on [0, whole_max_max].
-
-  *lookup_list_base is (transform_base->log_fru128_list_base) for (algo_status==TRANSFORM_ALGO_STATUS_SHANNON) or (transform_base->log_factorial_fru128_list_base) otherwise, as initialized by transform_lookup_lists_init().
-
-  *pop_list_base is writable on [0, whole_idx_max+1].
-
-  whole_idx_max is sum of all of *freq_list_base, less one.
-
-  whole_max_max is the maximum index of *freq_list_base.
-
-Out:
-
-  Returns one if fracterval underflow or overflow occured (which is usually benign) else zero.
+The negative of the agnentropy difference, dA, is given by:
 
-  *entropy_fru128_list_base is the entropy delta described in the summary, as determined according to algo_status.
+  -dA=log(freq+1)-log(freq_old)
 */
-  fru128 entropy;
-  fru128 entropy_delta;
-  ULONG freq;
-  ULONG freq_x_pop;
-  ULONG freq_x_pop_sum;
-  ULONG pop;
-  u8 status;
-  u64 term_u64;
+        TRANSFORM_FREQ_SET(freq_list_base, freq_size_log2, whole, freq+1);
+        if(freq){
+          entropy_delta_delta=log_list_base[freq+1];
+          FRU128_ADD_FRU128_SELF(entropy_delta, entropy_delta_delta, status);
+        }
+        TRANSFORM_FREQ_SET(freq_list_base, freq_size_log2, whole_old, freq_old-1);
+        if(freq_old!=1){
+          entropy_delta_delta=log_list_base[freq_old];
+          FRU128_SUBTRACT_FRU128_SELF(entropy_delta, entropy_delta_delta, status);
+        }
+      }else if(algo_status==TRANSFORM_ALGO_STATUS_SHANNON){
+/*
+The negative of the Shannon entropy difference, dS, is given by:
 
-  transform_pop_list_fill(freq_list_base, pop_list_base, whole_idx_max, whole_max_max);
-  status=0;
-  FRU128_SET_ZERO(entropy);
-  freq_x_pop_sum=pop_list_base[1];
-  if(algo_status==TRANSFORM_ALGO_STATUS_LOGFREEDOM){
+  -dS=freq*log_delta(freq)+log(freq+1)-(freq_old-1)*log_delta(freq_old-1)-log(freq_old)
+*/
+        TRANSFORM_FREQ_SET(freq_list_base, freq_size_log2, whole, freq+1);
+        if(freq){
+          if(freq<=TRANSFORM_DELTA_DELTA_FREQ_MAX){
+            entropy_delta_delta=entropy_delta_delta_fru128_list_base[freq];
+          }else{
+            entropy_delta_delta=log_delta_list_base[freq];
+            term_u64=freq;
+            FRU128_MULTIPLY_U64_SELF(entropy_delta_delta, term_u64, status);
+            FRU128_ADD_FRU128_SELF(entropy_delta, entropy_delta_delta, status);
+            entropy_delta_delta=log_list_base[freq+1];
+          }
+          FRU128_ADD_FRU128_SELF(entropy_delta, entropy_delta_delta, status);
+        }
+        TRANSFORM_FREQ_SET(freq_list_base, freq_size_log2, whole_old, freq_old-1);
+        if(freq_old!=1){
+          if(freq_old<=(TRANSFORM_DELTA_DELTA_FREQ_MAX+1)){
+            entropy_delta_delta=entropy_delta_delta_fru128_list_base[freq_old-1];
+          }else{
+            entropy_delta_delta=log_delta_list_base[freq_old-1];
+            term_u64=freq_old-1;
+            FRU128_MULTIPLY_U64_SELF(entropy_delta_delta, term_u64, status);
+            FRU128_SUBTRACT_FRU128_SELF(entropy_delta, entropy_delta_delta, status);
+            entropy_delta_delta=log_list_base[freq_old];
+          }
+          FRU128_SUBTRACT_FRU128_SELF(entropy_delta, entropy_delta_delta, status);
+        }
+      }else{
 /*
-Maintain maximum precision by avoiding unnecessary arithmetic.
+The negative of the logfreedom difference in terms the frequencies in question and their respective populations, dL, is:
+
+  -dL=+log(freq+1)-log(freq_old)+log(pop(freq_old-1)+1)-log(pop(freq_old))+log(pop(freq+1)+1)-log(pop(freq))
+
+where we need to serialize updates to the populations of the old and new masks, hence the processing all freq_old terms before all freq terms.
 */
-    if(freq_x_pop_sum){
-      entropy=lookup_list_base[freq_x_pop_sum];
-      pop=pop_list_base[0];
-      if(pop){
-        entropy_delta=lookup_list_base[pop];
-        FRU128_ADD_FRU128_SELF(entropy, entropy_delta, status);
-      }
-    }else{
-      pop=pop_list_base[0];
-      entropy=lookup_list_base[pop];
-    }
-  }
-  if(freq_x_pop_sum<=whole_idx_max){
-    freq=2;
-    do{
-      pop=pop_list_base[freq];
-      if(pop){
-        freq_x_pop=freq*pop;
-        if(algo_status==TRANSFORM_ALGO_STATUS_AGNENTROPY){
-          entropy_delta=lookup_list_base[freq];
-          term_u64=pop;
-          FRU128_MULTIPLY_U64_SELF(entropy_delta, term_u64, status);
-          FRU128_ADD_FRU128_SELF(entropy, entropy_delta, status);
-        }else if(algo_status==TRANSFORM_ALGO_STATUS_SHANNON){
-          entropy_delta=lookup_list_base[freq];
-          term_u64=freq_x_pop;
-          FRU128_MULTIPLY_U64_SELF(entropy_delta, term_u64, status);
-          FRU128_ADD_FRU128_SELF(entropy, entropy_delta, status);
-        }else{
-          entropy_delta=lookup_list_base[freq];
+        TRANSFORM_FREQ_SET(freq_list_base, freq_size_log2, whole, freq+1);
+        TRANSFORM_FREQ_SET(freq_list_base, freq_size_log2, whole_old, freq_old-1);
+        if(freq_old!=(freq+1)){
+          entropy_delta_delta=log_list_base[freq+1];
+          FRU128_ADD_FRU128_SELF(entropy_delta, entropy_delta_delta, status);
+          pop=pop_list_base[freq_old-1];
+          pop++;
+          pop_list_base[freq_old-1]=pop;
           if(pop!=1){
-            term_u64=pop;
-            FRU128_MULTIPLY_U64_SELF(entropy_delta, term_u64, status);
+            entropy_delta_delta=log_list_base[pop];
+            FRU128_ADD_FRU128_SELF(entropy_delta, entropy_delta_delta, status);
           }
-          FRU128_ADD_FRU128_SELF(entropy, entropy_delta, status);
+          pop_freq_old=pop_list_base[freq_old];
+          pop_list_base[freq_old]=pop_freq_old-1;
+          pop=pop_list_base[freq+1];
+          pop++;
+          pop_list_base[freq+1]=pop;
           if(pop!=1){
-            entropy_delta=lookup_list_base[pop];
-            FRU128_ADD_FRU128_SELF(entropy, entropy_delta, status);
+            entropy_delta_delta=log_list_base[pop];
+            FRU128_ADD_FRU128_SELF(entropy_delta, entropy_delta_delta, status);
+          }
+          pop=pop_list_base[freq];
+          pop_list_base[freq]=pop-1;
+          if(pop!=1){
+            entropy_delta_delta=log_list_base[pop];
+            FRU128_SUBTRACT_FRU128_SELF(entropy_delta, entropy_delta_delta, status);
+          }
+          if(pop_freq_old!=1){
+            entropy_delta_delta=log_list_base[pop_freq_old];
+            FRU128_SUBTRACT_FRU128_SELF(entropy_delta, entropy_delta_delta, status);
+          }
+          if(freq_old){
+            entropy_delta_delta=log_list_base[freq_old];
+            FRU128_SUBTRACT_FRU128_SELF(entropy_delta, entropy_delta_delta, status);
           }
         }
-        freq_x_pop_sum+=freq_x_pop;
       }
-      freq++;
-    }while(freq_x_pop_sum<=whole_idx_max);
-  }
-  *entropy_fru128_base=entropy;
+    }
+    entropy_delta_list_base[whole_x_idx]=entropy_delta;
+  }while((whole_x_idx++)!=whole_x_idx_max);
+  TRANSFORM_STATS_ADD(TRANSFORM_STATS_IDX_WHOLE_UNCHANGED_COUNT, stats_unchanged_count);
   return status;
 }
 
-u8
-transform_freq_list_entropy_get_fru64(u8 algo_status, fru64 *entropy_fru64_base, ULONG *freq_list_base, fru64 *lookup_list_base, ULONG *pop_list_base, ULONG whole_idx_max, u32 whole_max_max){
+TRANSFORM_INLINE u8
+transform_column_entropy_delta_get_fru64(u8 algo_status, entropy_t *entropy_base, u8 granularity, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx){
 /*
-This is the 64-bit fracterval equivalent of transform_freq_list_entropy_get_fru128(). Replace all occurrences of "128" with "64" in its definition.
+This is the 64-bit fracterval equivalent of transform_column_entropy_delta_get_fru128(). Replace all occurrences of "128" with "64" in its definition.
 */
-  fru64 entropy;
+  u32 digit;
   fru64 entropy_delta;
+  fru64 entropy_delta_delta;
+  fru64 *entropy_delta_delta_fru64_list_base;
+  fru64 *entropy_delta_list_base;
   ULONG freq;
-  ULONG freq_x_pop;
-  ULONG freq_x_pop_sum;
+  void *freq_list_base;
+  void **freq_list_base_list_base;
+  ULONG freq_old;
+  u8 freq_size_log2;
+  fru64 *log_delta_list_base;
+  fru64 *log_list_base;
   ULONG pop;
+  ULONG pop_freq_old;
+  ULONG *pop_list_base;
+  ULONG **pop_list_base_list_base;
+  TRANSFORM_STATS_DECLARE(stats_unchanged_count)
   u8 status;
   u64 term_u64;
+  u32 whole;
+  u32 whole_old;
+  u8 whole_size;
+  ULONG whole_u8_idx;
+  ULONG whole_u8_idx_delta;
+  ULONG whole_x_idx;
+  ULONG window_y_idx_post;
 
-  transform_pop_list_fill(freq_list_base, pop_list_base, whole_idx_max, whole_max_max);
   status=0;
-  FRU64_SET_ZERO(entropy);
-  if(algo_status==TRANSFORM_ALGO_STATUS_LOGFREEDOM){
-/*
-Maintain maximum precision by avoiding unnecessary arithmetic.
-*/
-    pop=pop_list_base[0];
-    if(pop){
-      entropy=lookup_list_base[pop];
-      pop=pop_list_base[1];
-      if(pop){
-        entropy_delta=lookup_list_base[pop];
-        FRU64_ADD_FRU64_SELF(entropy, entropy_delta, status);
+  TRANSFORM_STATS_SET_ZERO(stats_unchanged_count);
+  entropy_delta_delta_fru64_list_base=transform_base->entropy_delta_delta_fru64_list_base;
+  entropy_delta_list_base=transform_base->entropy_delta_fru64_list_base;
+  freq_list_base_list_base=transform_base->freq_list_base_list_base;
+  freq_size_log2=transform_base->freq_size_log2;
+  log_delta_list_base=transform_base->log_delta_fru64_list_base;
+  log_list_base=transform_base->log_fru64_list_base;
+  pop_list_base=NULL;
+  pop_list_base_list_base=transform_base->pop_list_base_list_base;
+  whole_size=(u8)(granularity+1);
+  window_y_idx_post=entropy_base->window_y_idx_post;
+  whole_u8_idx_delta=whole_size*entropy_base->whole_x_idx_post;
+  whole_u8_idx=whole_u8_idx_delta*(whole_y_idx-1)+whole_size*whole_x_idx_min;
+  whole_u8_idx_delta*=window_y_idx_post;
+  whole_x_idx=whole_x_idx_min;
+  do{
+    entropy_delta=entropy_delta_list_base[whole_x_idx];
+    freq_list_base=freq_list_base_list_base[whole_x_idx];
+    if(algo_status==TRANSFORM_ALGO_STATUS_LOGFREEDOM){
+      pop_list_base=pop_list_base_list_base[whole_x_idx];
+    }
+    whole_old=whole_u8_list_base[whole_u8_idx];
+    whole=whole_u8_list_base[whole_u8_idx+whole_u8_idx_delta];
+    whole_u8_idx++;
+    if(granularity){
+      digit=whole_u8_list_base[whole_u8_idx];
+      whole_old|=digit<<U8_BITS;
+      digit=whole_u8_list_base[whole_u8_idx+whole_u8_idx_delta];
+      whole|=digit<<U8_BITS;
+      whole_u8_idx++;
+      if(U16_BYTE_MAX<granularity){
+        digit=whole_u8_list_base[whole_u8_idx];
+        whole_old|=digit<<U16_BITS;
+        digit=whole_u8_list_base[whole_u8_idx+whole_u8_idx_delta];
+        whole|=digit<<U16_BITS;
+        whole_u8_idx++;
+        if(U24_BYTE_MAX<granularity){
+          digit=whole_u8_list_base[whole_u8_idx];
+          whole_old|=digit<<U24_BITS;
+          digit=whole_u8_list_base[whole_u8_idx+whole_u8_idx_delta];
+          whole|=digit<<U24_BITS;
+          whole_u8_idx++;
+        }
       }
-    }else{
-      pop=pop_list_base[1];
-      entropy=lookup_list_base[pop];
     }
-  }
-  freq_x_pop_sum=pop_list_base[1];
-  if(freq_x_pop_sum<=whole_idx_max){
-    freq=2;
-    do{
-      pop=pop_list_base[freq];
-      if(pop){
-        freq_x_pop=freq*pop;
-        if(algo_status==TRANSFORM_ALGO_STATUS_AGNENTROPY){
-          entropy_delta=lookup_list_base[freq];
-          term_u64=pop;
-          FRU64_MULTIPLY_U64_SELF(entropy_delta, term_u64, status);
-          FRU64_ADD_FRU64_SELF(entropy, entropy_delta, status);
-        }else if(algo_status==TRANSFORM_ALGO_STATUS_SHANNON){
-          entropy_delta=lookup_list_base[freq];
-          term_u64=freq_x_pop;
-          FRU64_MULTIPLY_U64_SELF(entropy_delta, term_u64, status);
-          FRU64_ADD_FRU64_SELF(entropy, entropy_delta, status);
-        }else{
-          entropy_delta=lookup_list_base[freq];
+    TRANSFORM_STATS_EQUAL_COUNT(stats_unchanged_count, whole, whole_old);
+    if(whole!=whole_old){
+      TRANSFORM_FREQ_GET(freq, freq_list_base, freq_size_log2, whole);
+      TRANSFORM_FREQ_GET(freq_old, freq_list_base, freq_size_log2, whole_old);
+      if(algo_status==TRANSFORM_ALGO_STATUS_AGNENTROPY){
+/*
+The negative of the agnentropy difference, dA, is given by:
+
+  -dA=log(freq+1)-log(freq_old)
+*/
+        TRANSFORM_FREQ_SET(freq_list_base, freq_size_log2, whole, freq+1);
+        if(freq){
+          entropy_delta_delta=log_list_base[freq+1];
+          FRU64_ADD_FRU64_SELF(entropy_delta, entropy_delta_delta, status);
+        }
+        TRANSFORM_FREQ_SET(freq_list_base, freq_size_log2, whole_old, freq_old-1);
+        if(freq_old!=1){
+          entropy_delta_delta=log_list_base[freq_old];
+          FRU64_SUBTRACT_FRU64_SELF(entropy_delta, entropy_delta_delta, status);
+        }
+      }else if(algo_status==TRANSFORM_ALGO_STATUS_SHANNON){
+/*
+The negative of the Shannon entropy difference, dS, is given by:
+
+  -dS=freq*log_delta(freq)+log(freq+1)-(freq_old-1)*log_delta(freq_old-1)-log(freq_old)
+*/
+        TRANSFORM_FREQ_SET(freq_list_base, freq_size_log2, whole, freq+1);
+        if(freq){
+          if(freq<=TRANSFORM_DELTA_DELTA_FREQ_MAX){
+            entropy_delta_delta=entropy_delta_delta_fru64_list_base[freq];
+          }else{
+            entropy_delta_delta=log_delta_list_base[freq];
+            term_u64=freq;
+            FRU64_MULTIPLY_U64_SELF(entropy_delta_delta, term_u64, status);
+            FRU64_ADD_FRU64_SELF(entropy_delta, entropy_delta_delta, status);
+            entropy_delta_delta=log_list_base[freq+1];
+          }
+          FRU64_ADD_FRU64_SELF(entropy_delta, entropy_delta_delta, status);
+        }
+        TRANSFORM_FREQ_SET(freq_list_base, freq_size_log2, whole_old, freq_old-1);
+        if(freq_old!=1){
+          if(freq_old<=(TRANSFORM_DELTA_DELTA_FREQ_MAX+1)){
+            entropy_delta_delta=entropy_delta_delta_fru64_list_base[freq_old-1];
+          }else{
+            entropy_delta_delta=log_delta_list_base[freq_old-1];
+            term_u64=freq_old-1;
+            FRU64_MULTIPLY_U64_SELF(entropy_delta_delta, term_u64, status);
+            FRU64_SUBTRACT_FRU64_SELF(entropy_delta, entropy_delta_delta, status);
+            entropy_delta_delta=log_list_base[freq_old];
+          }
+          FRU64_SUBTRACT_FRU64_SELF(entropy_delta, entropy_delta_delta, status);
+        }
+      }else{
+/*
+The negative of the logfreedom difference in terms the frequencies in question and their respective populations, dL, is:
+
+  -dL=+log(freq+1)-log(freq_old)+log(pop(freq_old-1)+1)-log(pop(freq_old))+log(pop(freq+1)+1)-log(pop(freq))
+
+where we need to serialize updates to the populations of the old and new masks, hence the processing all freq_old terms before all freq terms.
+*/
+        TRANSFORM_FREQ_SET(freq_list_base, freq_size_log2, whole, freq+1);
+        TRANSFORM_FREQ_SET(freq_list_base, freq_size_log2, whole_old, freq_old-1);
+        if(freq_old!=(freq+1)){
+          entropy_delta_delta=log_list_base[freq+1];
+          FRU64_ADD_FRU64_SELF(entropy_delta, entropy_delta_delta, status);
+          pop=pop_list_base[freq_old-1];
+          pop++;
+          pop_list_base[freq_old-1]=pop;
           if(pop!=1){
-            term_u64=pop;
-            FRU64_MULTIPLY_U64_SELF(entropy_delta, term_u64, status);
+            entropy_delta_delta=log_list_base[pop];
+            FRU64_ADD_FRU64_SELF(entropy_delta, entropy_delta_delta, status);
           }
-          FRU64_ADD_FRU64_SELF(entropy, entropy_delta, status);
+          pop_freq_old=pop_list_base[freq_old];
+          pop_list_base[freq_old]=pop_freq_old-1;
+          pop=pop_list_base[freq+1];
+          pop++;
+          pop_list_base[freq+1]=pop;
           if(pop!=1){
-            entropy_delta=lookup_list_base[pop];
-            FRU64_ADD_FRU64_SELF(entropy, entropy_delta, status);
+            entropy_delta_delta=log_list_base[pop];
+            FRU64_ADD_FRU64_SELF(entropy_delta, entropy_delta_delta, status);
+          }
+          pop=pop_list_base[freq];
+          pop_list_base[freq]=pop-1;
+          if(pop!=1){
+            entropy_delta_delta=log_list_base[pop];
+            FRU64_SUBTRACT_FRU64_SELF(entropy_delta, entropy_delta_delta, status);
+          }
+          if(pop_freq_old!=1){
+            entropy_delta_delta=log_list_base[pop_freq_old];
+            FRU64_SUBTRACT_FRU64_SELF(entropy_delta, entropy_delta_delta, status);
+          }
+          if(freq_old){
+            entropy_delta_delta=log_list_base[freq_old];
+            FRU64_SUBTRACT_FRU64_SELF(entropy_delta, entropy_delta_delta, status);
           }
         }
-        freq_x_pop_sum+=freq_x_pop;
       }
-      freq++;
-    }while(freq_x_pop_sum<=whole_idx_max);
-  }
-  *entropy_fru64_base=entropy;
+    }
+    entropy_delta_list_base[whole_x_idx]=entropy_delta;
+  }while((whole_x_idx++)!=whole_x_idx_max);
+  TRANSFORM_STATS_ADD(TRANSFORM_STATS_IDX_WHOLE_UNCHANGED_COUNT, stats_unchanged_count);
   return status;
 }
 
+transform_column_kernel_t
+transform_column_kernel_get(u8 algo_status, u8 granularity, u8 precise_status){
+/*
+Choose the specialization of transform_whole_list_column_entropy_delta_get_fru128() or transform_whole_list_column_entropy_delta_get_fru64() appropriate to a given scan configuration.
+
+In:
+
+  algo_status is transform_malloc():In:algo_status.
+
+  granularity is transform_malloc():In:granularity.
+
+  precise_status is transform_malloc():In:precise_status.
+
+Out:
+
+  Returns the specialization in question.
+*/
+  static const transform_column_kernel_t column_kernel_list_base[TRANSFORM_COLUMN_KERNEL_IDX_POST]={
+    [TRANSFORM_COLUMN_KERNEL_IDX(TRANSFORM_ALGO_STATUS_SHANNON, U8_BYTE_MAX, 0U)]=transform_whole_list_column_entropy_delta_get_fru64_shannon_u8,
+    [TRANSFORM_COLUMN_KERNEL_IDX(TRANSFORM_ALGO_STATUS_SHANNON, U16_BYTE_MAX, 0U)]=transform_whole_list_column_entropy_delta_get_fru64_shannon_u16,
+    [TRANSFORM_COLUMN_KERNEL_IDX(TRANSFORM_ALGO_STATUS_SHANNON, U24_BYTE_MAX, 0U)]=transform_whole_list_column_entropy_delta_get_fru64_shannon_u24,
+    [TRANSFORM_COLUMN_KERNEL_IDX(TRANSFORM_ALGO_STATUS_SHANNON, U32_BYTE_MAX, 0U)]=transform_whole_list_column_entropy_delta_get_fru64_shannon_u32,
+    [TRANSFORM_COLUMN_KERNEL_IDX(TRANSFORM_ALGO_STATUS_AGNENTROPY, U8_BYTE_MAX, 0U)]=transform_whole_list_column_entropy_delta_get_fru64_agnentropy_u8,
+    [TRANSFORM_COLUMN_KERNEL_IDX(TRANSFORM_ALGO_STATUS_AGNENTROPY, U16_BYTE_MAX, 0U)]=transform_whole_list_column_entropy_delta_get_fru64_agnentropy_u16,
+    [TRANSFORM_COLUMN_KERNEL_IDX(TRANSFORM_ALGO_STATUS_AGNENTROPY, U24_BYTE_MAX, 0U)]=transform_whole_list_column_entropy_delta_get_fru64_agnentropy_u24,
+    [TRANSFORM_COLUMN_KERNEL_IDX(TRANSFORM_ALGO_STATUS_AGNENTROPY, U32_BYTE_MAX, 0U)]=transform_whole_list_column_entropy_delta_get_fru64_agnentropy_u32,
+    [TRANSFORM_COLUMN_KERNEL_IDX(TRANSFORM_ALGO_STATUS_LOGFREEDOM, U8_BYTE_MAX, 0U)]=transform_whole_list_column_entropy_delta_get_fru64_logfreedom_u8,
+    [TRANSFORM_COLUMN_KERNEL_IDX(TRANSFORM_ALGO_STATUS_LOGFREEDOM, U16_BYTE_MAX, 0U)]=transform_whole_list_column_entropy_delta_get_fru64_logfreedom_u16,
+    [TRANSFORM_COLUMN_KERNEL_IDX(TRANSFORM_ALGO_STATUS_LOGFREEDOM, U24_BYTE_MAX, 0U)]=transform_whole_list_column_entropy_delta_get_fru64_logfreedom_u24,
+    [TRANSFORM_COLUMN_KERNEL_IDX(TRANSFORM_ALGO_STATUS_LOGFREEDOM, U32_BYTE_MAX, 0U)]=transform_whole_list_column_entropy_delta_get_fru64_logfreedom_u32,
+    [TRANSFORM_COLUMN_KERNEL_IDX(TRANSFORM_ALGO_STATUS_SHANNON, U8_BYTE_MAX, 1U)]=transform_whole_list_column_entropy_delta_get_fru128_shannon_u8,
+    [TRANSFORM_COLUMN_KERNEL_IDX(TRANSFORM_ALGO_STATUS_SHANNON, U16_BYTE_MAX, 1U)]=transform_whole_list_column_entropy_delta_get_fru128_shannon_u16,
+    [TRANSFORM_COLUMN_KERNEL_IDX(TRANSFORM_ALGO_STATUS_SHANNON, U24_BYTE_MAX, 1U)]=transform_whole_list_column_entropy_delta_get_fru128_shannon_u24,
+    [TRANSFORM_COLUMN_KERNEL_IDX(TRANSFORM_ALGO_STATUS_SHANNON, U32_BYTE_MAX, 1U)]=transform_whole_list_column_entropy_delta_get_fru128_shannon_u32,
+    [TRANSFORM_COLUMN_KERNEL_IDX(TRANSFORM_ALGO_STATUS_AGNENTROPY, U8_BYTE_MAX, 1U)]=transform_whole_list_column_entropy_delta_get_fru128_agnentropy_u8,
+    [TRANSFORM_COLUMN_KERNEL_IDX(TRANSFORM_ALGO_STATUS_AGNENTROPY, U16_BYTE_MAX, 1U)]=transform_whole_list_column_entropy_delta_get_fru128_agnentropy_u16,
+    [TRANSFORM_COLUMN_KERNEL_IDX(TRANSFORM_ALGO_STATUS_AGNENTROPY, U24_BYTE_MAX, 1U)]=transform_whole_list_column_entropy_delta_get_fru128_agnentropy_u24,
+    [TRANSFORM_COLUMN_KERNEL_IDX(TRANSFORM_ALGO_STATUS_AGNENTROPY, U32_BYTE_MAX, 1U)]=transform_whole_list_column_entropy_delta_get_fru128_agnentropy_u32,
+    [TRANSFORM_COLUMN_KERNEL_IDX(TRANSFORM_ALGO_STATUS_LOGFREEDOM, U8_BYTE_MAX, 1U)]=transform_whole_list_column_entropy_delta_get_fru128_logfreedom_u8,
+    [TRANSFORM_COLUMN_KERNEL_IDX(TRANSFORM_ALGO_STATUS_LOGFREEDOM, U16_BYTE_MAX, 1U)]=transform_whole_list_column_entropy_delta_get_fru128_logfreedom_u16,
+    [TRANSFORM_COLUMN_KERNEL_IDX(TRANSFORM_ALGO_STATUS_LOGFREEDOM, U24_BYTE_MAX, 1U)]=transform_whole_list_column_entropy_delta_get_fru128_logfreedom_u24,
+    [TRANSFORM_COLUMN_KERNEL_IDX(TRANSFORM_ALGO_STATUS_LOGFREEDOM, U32_BYTE_MAX, 1U)]=transform_whole_list_column_entropy_delta_get_fru128_logfreedom_u32
+  };
+  transform_column_kernel_t column_kernel;
+
+  column_kernel=column_kernel_list_base[TRANSFORM_COLUMN_KERNEL_IDX(algo_status, granularity, precise_status)];
+  return column_kernel;
+}
+
 u8
-transform_init(u32 build_break_count, u32 build_feature_count){
+transform_column_lists_malloc(entropy_t *entropy_base, transform_t *transform_base){
 /*
-Verify that the source code is sufficiently updated.
+Allocate the lists which hold the per-column state of a scan, namely frequency lists, population lists (for logfreedom, or for any algo without (transform_base->optimize_status), whereupon they're maintained incrementally alongside the frequency lists), and entropy deltas. Don't call here directly; use transform_malloc() or transform_clone() instead.
 
 In:
 
-  build_break_count is the caller's most recent knowledge of TRANSFORM_BUILD_BREAK_COUNT, which will fail if the caller is unaware of all critical updates.
+  entropy_base is the base of an entropy_t in which all scan parameters are valid.
 
-  build_feature_count is the caller's most recent knowledge of TRANSFORM_BUILD_FEATURE_COUNT, which will fail if this library is not up to date with the caller's expectations.
+  transform_base is the base of a transform_t in which algo_status, freq_list_idx_max, freq_size_log2, and optimize_status are valid, and all bases of the lists in question are NULL.
 
 Out:
 
-  Returns one if (build_break_count!=TRANSFORM_BUILD_BREAK_COUNT) or (build_feature_count>TRANSFORM_BUILD_FEATURE_COUNT), or if fracterval_u128_init() or fracterval_u64_init() fails. Otherwise, returns zero.
+  Returns one on failure, else zero. Either way, the lists which could be allocated have been placed in *transform_base, so transform_free_all() will free them.
 */
-  u8 fracterval_u128_status;
-  u8 fracterval_u64_status;
+  fru128 *entropy_delta_fru128_list_base;
+  fru64 *entropy_delta_fru64_list_base;
+  void *freq_list_base;
+  void **freq_list_base_list_base;
+  ULONG freq_list_base_list_size;
+  ULONG freq_list_idx;
+  ULONG freq_list_idx_max;
+  ULONG freq_list_size;
+  ULONG *pop_list_base;
+  ULONG **pop_list_base_list_base;
+  ULONG pop_list_size;
   u8 status;
 
-  fracterval_u128_status=fracterval_u128_init(FRU128_BUILD_BREAK_COUNT_EXPECTED, 4);
-  fracterval_u64_status=fracterval_u64_init(FRU64_BUILD_BREAK_COUNT_EXPECTED, 2);
-  status=(u8)(fracterval_u128_status|fracterval_u64_status);
-  status=(u8)(status|(build_break_count!=TRANSFORM_BUILD_BREAK_COUNT));
-  status=(u8)(status|(TRANSFORM_BUILD_FEATURE_COUNT<build_feature_count));
+  freq_list_idx_max=transform_base->freq_list_idx_max;
+  freq_list_base_list_size=(freq_list_idx_max+1)*(ULONG)(sizeof(u32 *));
+  freq_list_size=((ULONG)(entropy_base->whole_max_max)+1)<<transform_base->freq_size_log2;
+  pop_list_size=(entropy_base->window_y_idx_post+1)<<ULONG_SIZE_LOG2;
+  pop_list_base=DEBUG_MALLOC_PARANOID(pop_list_size);
+  status=!pop_list_base;
+  transform_base->pop_list_base=pop_list_base;
+  freq_list_base_list_base=DEBUG_CALLOC_PARANOID(freq_list_base_list_size);
+  status=(u8)(status|!freq_list_base_list_base);
+  transform_base->freq_list_base_list_base=freq_list_base_list_base;
+  pop_list_base_list_base=NULL;
+  if((transform_base->algo_status==TRANSFORM_ALGO_STATUS_LOGFREEDOM)||!transform_base->optimize_status){
+    pop_list_base_list_base=DEBUG_CALLOC_PARANOID(freq_list_base_list_size);
+    status=(u8)(status|!pop_list_base_list_base);
+    transform_base->pop_list_base_list_base=pop_list_base_list_base;
+  }
+  if(!status){
+    freq_list_idx=0;
+    do{
+      freq_list_base=DEBUG_CALLOC_PARANOID(freq_list_size);
+      if(!freq_list_base){
+        status=1;
+        break;
+      }
+      freq_list_base_list_base[freq_list_idx]=freq_list_base;
+      if(pop_list_base_list_base){
+        pop_list_base=DEBUG_CALLOC_PARANOID(pop_list_size);
+        if(!pop_list_base){
+          status=1;
+          break;
+        }
+        pop_list_base_list_base[freq_list_idx]=pop_list_base;
+      }
+    }while((freq_list_idx++)!=freq_list_idx_max);
+    if(!status){
+      if(!entropy_base->precise_status){
+        entropy_delta_fru64_list_base=fracterval_u64_list_malloc(freq_list_idx_max);
+        status=!entropy_delta_fru64_list_base;
+        transform_base->entropy_delta_fru64_list_base=entropy_delta_fru64_list_base;
+      }else{
+        entropy_delta_fru128_list_base=fracterval_u128_list_malloc(freq_list_idx_max);
+        status=!entropy_delta_fru128_list_base;
+        transform_base->entropy_delta_fru128_list_base=entropy_delta_fru128_list_base;
+      }
+    }
+  }
   return status;
 }
 
 u8
-transform_logfreedom_max_approximate(entropy_t *entropy_base, u32 iteration_max, fru128 *logfreedom_max_base, transform_t *transform_base){
+transform_delta_delta_list_init(fru128 **entropy_delta_delta_fru128_list_base_base, fru64 **entropy_delta_delta_fru64_list_base_base, u8 precise_status){
 /*
-From its definition, approximate maximum possible logfreedom for a given whole_idx_max (Q-1) and whole_max_max (Z-1). Do this with a heuristic involving a iterations of gradient descent followed by population perturbation. This was adapted from existing debugged code in Dyspoissometer but has been improved to converge to the global maximum in all tested cases.
+Initialize (allocate and populate) a lookup table of (changes in (changes in entropy)).
 
 In:
 
-  entropy_base is transform_malloc():Out:*entropy_base_base.
-
-  iteration is the number of genetic iterations to perform, less one. The largest iteration_max observed in testing was less than 10, but could be somewhat larger in rare cases involving huge datasets. U64_BITS would seem to be a conservative upper bound over all values of Q and Z supported by Transform.
+  *entropy_delta_delta_fru128_list_base_base is undefined.
 
-  *logfreedom_max_base is undefined.
+  *entropy_delta_delta_fru64_list_base_base is undefined.
 
-  transform_base is transform_malloc():Out:*transform_base_base.
+  precise_status is zero for 32.32 or one for 64.64 fixed-points expressed as 64-bit or 128-bit fractervals, respectively.
 
 Out:
 
-  Returns one if fracterval underflow or overflow occured (which should be regarded as a fatal error in this particular case) else zero.
+  Returns one on failure, else zero.
 
-  *logfreedom_max_base is a 64.64 fixed-point, expressed as a 128-bit fracterval, which is virtually certain to contain the actual maximum possible logfreedom. There is a theoretical chance that the latter lies above the upper limit, but no chance that it lies below the lower limit.
+  *entropy_delta_delta_fru(64/128)_list_base_base is the base of TRANSFORM_DELTA_DELTA_FREQ_POST (64/128)-bit fractervals as defined in the summary, depending on precise_status. The other is NULL.
 */
-  fru128 freq_expression_minus;
-  fru128 freq_expression_plus;
-  ULONG freq_delta;
-  ULONG freq_down_right;
-  ULONG freq_max;
-  ULONG freq_max_max;
-  ULONG freq_min;
-  ULONG freq_min_min;
-  ULONG freq_span;
-  ULONG freq_up_left;
-  u32 iteration;
-  fru128 *log_factorial_list_base;
-  fru128 *log_list_base;
-  fru128 logfreedom_best;
-  fru128 logfreedom_best_best;
-  fru128 logfreedom_delta_delta_minus;
-  fru128 logfreedom_delta_delta_plus;
-  fru128 logfreedom_delta_minus;
-  fru128 logfreedom_delta_plus;
-  fru128 logfreedom_delta_sum_minus;
-  fru128 logfreedom_delta_sum_plus;
-  u32 marsaglia_c;
-  u32 marsaglia_x;
-  u128 mean_minus;
-  u128 mean_plus;
-  ULONG pop_delta;
-  ULONG pop_delta_max;
-  ULONG pop_delta_max_minus_1;
-  ULONG pop_delta_min;
-  ULONG pop_down_left;
-  ULONG pop_down_right;
-  ULONG pop_freq_max;
-  ULONG pop_freq_min;
-  ULONG pop_up_left;
-  ULONG pop_up_right;
-  ULONG *pop_list_base;
-  ULONG *pop_list_best_base;
-  ULONG *pop_list_best_best_base;
-  ULONG pop_list_size;
-  u8 progress_status;
-  u64 random;
+  fru128 entropy_delta_delta_delta;
+  fru128 entropy_delta_delta_fru128;
+  fru128 *entropy_delta_delta_fru128_list_base;
+  fru64 entropy_delta_delta_fru64;
+  fru64 *entropy_delta_delta_fru64_list_base;
+  ULONG freq;
   u8 status;
-  u8 status_delta;
   u64 term_u64;
-  fru128 term_fru128;
-  ULONG whole_count;
-  ULONG whole_idx_max;
-  u32 whole_max_max;
-  ULONG whole_span_max;
 
-  log_factorial_list_base=transform_base->log_factorial_fru128_list_base;
-  log_list_base=transform_base->log_fru128_list_base;
-  pop_list_base=transform_base->pop_list_base;
-  pop_list_best_base=transform_base->pop_list_best_base;
-  pop_list_best_best_base=transform_base->pop_list_best_best_base;
-  iteration=0;
-  random=0;
-  random=~random;
-  whole_idx_max=entropy_base->window_y_idx_max;
-  whole_count=whole_idx_max+1;
-  whole_max_max=entropy_base->whole_max_max;
-  whole_span_max=(ULONG)(whole_max_max)+1;
-  freq_max=whole_count/whole_span_max;
-  freq_min=freq_max;
-  pop_freq_max=whole_count%whole_span_max;
-  pop_freq_min=whole_span_max;
-  if(pop_freq_max){
-    freq_max++;
-    pop_freq_min-=pop_freq_max;
+  entropy_delta_delta_fru64_list_base=NULL;
+  entropy_delta_delta_fru128_list_base=NULL;
+  if(!precise_status){
+    entropy_delta_delta_fru64_list_base=fracterval_u64_list_malloc(TRANSFORM_DELTA_DELTA_FREQ_MAX);
+    status=!entropy_delta_delta_fru64_list_base;
+  }else{
+    entropy_delta_delta_fru128_list_base=fracterval_u128_list_malloc(TRANSFORM_DELTA_DELTA_FREQ_MAX);
+    status=!entropy_delta_delta_fru128_list_base;
   }
-  freq_max_max=freq_max;
-  freq_min_min=freq_min;
-  pop_list_size=(whole_count+1)<<ULONG_SIZE_LOG2;
-  memset(pop_list_base, 0, (size_t)(pop_list_size));
-  memset(pop_list_best_base, 0, (size_t)(pop_list_size));
-  memset(pop_list_best_best_base, 0, (size_t)(pop_list_size));
-  pop_list_base[freq_max]=pop_freq_max;
-  pop_list_base[freq_min]=pop_freq_min;
-  pop_list_best_best_base[freq_max]=pop_freq_max;
-  pop_list_best_best_base[freq_min]=pop_freq_min;
-  status=transform_pop_list_logfreedom_get(log_factorial_list_base, &logfreedom_best_best, pop_list_base, whole_idx_max, whole_max_max);
-  do{
+  if(!status){
+    FRU128_SET_ZERO(entropy_delta_delta_fru128);
+    freq=0;
     do{
-      progress_status=0;
-      pop_list_size=(freq_max_max-freq_min_min+1)<<ULONG_SIZE_LOG2;
-      memcpy(&pop_list_best_base[freq_min_min], &pop_list_base[freq_min_min], (size_t)(pop_list_size));
-      freq_up_left=freq_min;
-      do{
-        freq_down_right=freq_min+!freq_min;
-        do{
-          pop_up_left=pop_list_base[freq_up_left];
-          if(!pop_up_left){
-            break;
-          }
-          pop_down_right=pop_list_base[freq_down_right];
-          pop_down_left=pop_list_base[freq_down_right-1];
-          pop_up_right=pop_list_base[freq_up_left+1];
-          if(pop_down_right&&(((freq_down_right-1)!=freq_up_left)&&((pop_down_right!=1)||(freq_down_right!=freq_up_left)))){
+      if(freq){
+        term_u64=freq;
+        FRU128_LOG_DELTA_U64(entropy_delta_delta_delta, term_u64, status);
+        FRU128_SHIFT_RIGHT_SELF(entropy_delta_delta_delta, U64_BITS-U64_BITS_LOG2);
+        FRU128_MULTIPLY_U64(entropy_delta_delta_fru128, entropy_delta_delta_delta, term_u64, status);
+        term_u64++;
+        FRU128_LOG_U64(entropy_delta_delta_delta, term_u64, status);
+        FRU128_SHIFT_RIGHT_SELF(entropy_delta_delta_delta, U64_BITS-U64_BITS_LOG2);
+        FRU128_ADD_FRU128_SELF(entropy_delta_delta_fru128, entropy_delta_delta_delta, status);
+      }
+      if(!precise_status){
+        FRU128_SHIFT_RIGHT_SELF(entropy_delta_delta_fru128, U32_BITS);
+        U128_TO_U64_LO(entropy_delta_delta_fru64.a, entropy_delta_delta_fru128.a);
+        U128_TO_U64_LO(entropy_delta_delta_fru64.b, entropy_delta_delta_fru128.b);
+        entropy_delta_delta_fru64_list_base[freq]=entropy_delta_delta_fru64;
+      }else{
+        entropy_delta_delta_fru128_list_base[freq]=entropy_delta_delta_fru128;
+      }
+    }while((freq++)!=TRANSFORM_DELTA_DELTA_FREQ_MAX);
+  }
+  *entropy_delta_delta_fru128_list_base_base=entropy_delta_delta_fru128_list_base;
+  *entropy_delta_delta_fru64_list_base_base=entropy_delta_delta_fru64_list_base;
+  return status;
+}
+
+u8
+transform_dispatch(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base){
 /*
-The following logfreedom gradient descent code was adapted from dyspoissometer_logfreedom_max_get() in Dyspoissometer, which explains all the transformations.
+Excute a 2D channelized entropy transform by scrolling a window across all columns (channels), then across all rows (spectra).
+
+In:
+
+  entropy_base is transform_malloc():Out:*entropy_base_base.
+
+  transform_base is transform_malloc():Out:*transform_base_base.
+
+  whole_u8_list_base is the base of (entropy_base->whole_count) wholes, each of size (entropy_base->granularity+1) and not exceeding (entropy_base->whole_max_max).
+
+Out:
+
+  Returns one if fracterval underflow or overflow occured (which is usually benign) else zero.
+
+  The transform has been done according to transform_malloc():In. If transform_malloc():In:fakefloat_list_base was not NULL, then an array of fakefloats corresponding to window entropy values, and indexed in the same way as *whole_u8_list_base, but having width (entropy_base->fakefloat_x_idx_max+1) and height (entropy_base->fakefloat_y_idx_max+1) has been created at (entropy_base->fakefloat_list_base).
+
+  If transform_rank_init() was called beforehand, then the rank lists in *entropy_base have been populated as transform_rank_init():Out describes.
+
+  If transform_hit_init() was called beforehand, then the hit list in *entropy_base has been extended as transform_hit_init():Out describes.
 */
-            freq_delta=freq_down_right-freq_up_left;
-            FRU128_SET_ZERO(logfreedom_delta_sum_minus);
-            FRU128_SET_ZERO(logfreedom_delta_sum_plus);
-            freq_expression_minus=log_list_base[freq_up_left+1];
-            freq_expression_plus=log_list_base[freq_down_right];
-            logfreedom_delta_minus=log_list_base[pop_down_left+1];
-            FRU128_ADD_FRU128_SELF(logfreedom_delta_minus, freq_expression_minus, status);
-            logfreedom_delta_plus=freq_expression_plus;
-            pop_delta_max=MIN(pop_down_right, pop_up_left);
-            pop_delta_min=1;
-            if(2<freq_delta){
-              term_fru128=log_list_base[pop_down_right];
-              FRU128_ADD_FRU128_SELF(logfreedom_delta_plus, term_fru128, status);
-              term_fru128=log_list_base[pop_up_left];
-              FRU128_ADD_FRU128_SELF(logfreedom_delta_plus, term_fru128, status);
-              term_fru128=log_list_base[pop_up_right+1];
-              FRU128_ADD_FRU128_SELF(logfreedom_delta_minus, term_fru128, status);
-            }else if(!freq_delta){
-              pop_delta_max>>=1;
-              term_fru128=log_list_base[pop_down_right];
-              FRU128_ADD_FRU128_SELF(logfreedom_delta_plus, term_fru128, status);
-              term_fru128=log_list_base[pop_down_right-1];
-              FRU128_ADD_FRU128_SELF(logfreedom_delta_plus, term_fru128, status);
-              term_fru128=log_list_base[pop_up_right+1];
-              FRU128_ADD_FRU128_SELF(logfreedom_delta_minus, term_fru128, status);
-            }else{
-              term_fru128=log_list_base[pop_down_left+2];
-              FRU128_ADD_FRU128_SELF(logfreedom_delta_minus, term_fru128, status);
-              term_fru128=log_list_base[pop_down_right];
-              FRU128_ADD_FRU128_SELF(logfreedom_delta_plus, term_fru128, status);
-              term_fru128=log_list_base[pop_up_left];
-              FRU128_ADD_FRU128_SELF(logfreedom_delta_plus, term_fru128, status);
-            }
-            pop_delta_max_minus_1=pop_delta_max-pop_delta_min;
-            if(pop_delta_max_minus_1){
-              logfreedom_delta_delta_minus=freq_expression_minus;
-              logfreedom_delta_delta_plus=freq_expression_plus;
-              if(2<freq_delta){
-                term_fru128=log_list_base[pop_down_left+2];
-                FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_minus, term_fru128, status);
-                term_fru128=log_list_base[pop_down_right-1];
-                FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_plus, term_fru128, status);
-                term_fru128=log_list_base[pop_up_right+2];
-                FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_minus, term_fru128, status);
-                term_fru128=log_list_base[pop_up_left-1];
-                FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_plus, term_fru128, status);
-              }else if(!freq_delta){
-                term_fru128=log_list_base[pop_down_left+2];
-                FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_minus, term_fru128, status);
-                term_fru128=log_list_base[pop_down_right-3];
-                FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_plus, term_fru128, status);
-                term_fru128=log_list_base[pop_down_right-2];
-                FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_plus, term_fru128, status);
-                term_fru128=log_list_base[pop_up_right+2];
-                FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_minus, term_fru128, status);
-              }else{
-                term_fru128=log_list_base[pop_down_left+3];
-                FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_minus, term_fru128, status);
-                term_fru128=log_list_base[pop_down_left+4];
-                FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_minus, term_fru128, status);
-                term_fru128=log_list_base[pop_down_right-1];
-                FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_plus, term_fru128, status);
-                term_fru128=log_list_base[pop_up_left-1];
-                FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_plus, term_fru128, status);
-              }
-              FRU128_MEAN_TO_FTD128(mean_minus, logfreedom_delta_delta_minus);
-              FRU128_MEAN_TO_FTD128(mean_plus, logfreedom_delta_delta_plus);
-              if(U128_IS_LESS(mean_minus, mean_plus)){
-                while(pop_delta_max_minus_1!=pop_delta_min){
-                  pop_delta=pop_delta_max_minus_1-((pop_delta_max_minus_1-pop_delta_min)>>1);
-                  logfreedom_delta_delta_minus=freq_expression_minus;
-                  logfreedom_delta_delta_plus=freq_expression_plus;
-                  if(2<freq_delta){
-                    term_fru128=log_list_base[pop_down_left+pop_delta+1];
-                    FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_minus, term_fru128, status);
-                    term_fru128=log_list_base[pop_up_right+pop_delta+1];
-                    FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_minus, term_fru128, status);
-                    term_fru128=log_list_base[pop_down_right-pop_delta];
-                    FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_plus, term_fru128, status);
-                    term_fru128=log_list_base[pop_up_left-pop_delta];
-                    FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_plus, term_fru128, status);
-                  }else if(!freq_delta){
-                    term_fru128=log_list_base[pop_down_left+pop_delta+1];
-                    FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_minus, term_fru128, status);
-                    term_fru128=log_list_base[pop_up_right+pop_delta+1];
-                    FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_minus, term_fru128, status);
-                    term_fru128=log_list_base[pop_down_right-(pop_delta<<1)-1];
-                    FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_plus, term_fru128, status);
-                    term_fru128=log_list_base[pop_down_right-(pop_delta<<1)];
-                    FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_plus, term_fru128, status);
-                  }else{
-                    term_fru128=log_list_base[pop_down_left+(pop_delta<<1)+1];
-                    FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_minus, term_fru128, status);
-                    term_fru128=log_list_base[pop_down_left+(pop_delta<<1)+2];
-                    FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_minus, term_fru128, status);
-                    term_fru128=log_list_base[pop_down_right-pop_delta];
-                    FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_plus, term_fru128, status);
-                    term_fru128=log_list_base[pop_up_left-pop_delta];
-                    FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_plus, term_fru128, status);
-                  }
-                  FRU128_MEAN_TO_FTD128(mean_minus, logfreedom_delta_delta_minus);
-                  FRU128_MEAN_TO_FTD128(mean_plus, logfreedom_delta_delta_plus);
-                  if(U128_IS_LESS(mean_minus, mean_plus)){
-                    pop_delta_min=pop_delta;
-                  }else{
-                    pop_delta_max_minus_1=pop_delta-1;
-                  }
-                }
-                pop_delta_min++;
-              }
-            }
-            pop_delta=pop_delta_min;
-            term_u64=pop_delta;
-            FRU128_MULTIPLY_U64(logfreedom_delta_minus, freq_expression_minus, term_u64, status);
-            FRU128_MULTIPLY_U64(logfreedom_delta_plus, freq_expression_plus, term_u64, status);
-            term_fru128=log_factorial_list_base[pop_down_left];
-            FRU128_ADD_FRU128_SELF(logfreedom_delta_plus, term_fru128, status);
-            term_fru128=log_factorial_list_base[pop_down_right];
-            FRU128_ADD_FRU128_SELF(logfreedom_delta_plus, term_fru128, status);
-            if(2<freq_delta){
-              term_fru128=log_factorial_list_base[pop_up_left];
-              FRU128_ADD_FRU128_SELF(logfreedom_delta_plus, term_fru128, status);
-              term_fru128=log_factorial_list_base[pop_up_right];
-              FRU128_ADD_FRU128_SELF(logfreedom_delta_plus, term_fru128, status);
-              pop_down_left+=pop_delta;
-              pop_down_right-=pop_delta;
-              pop_up_left-=pop_delta;
-              pop_up_right+=pop_delta;
-              term_fru128=log_factorial_list_base[pop_down_left];
-              FRU128_ADD_FRU128_SELF(logfreedom_delta_minus, term_fru128, status);
-              term_fru128=log_factorial_list_base[pop_down_right];
-              FRU128_ADD_FRU128_SELF(logfreedom_delta_minus, term_fru128, status);
-              term_fru128=log_factorial_list_base[pop_up_left];
-              FRU128_ADD_FRU128_SELF(logfreedom_delta_minus, term_fru128, status);
-              term_fru128=log_factorial_list_base[pop_up_right];
-              FRU128_ADD_FRU128_SELF(logfreedom_delta_minus, term_fru128, status);
-            }else if(!freq_delta){
-              term_fru128=log_factorial_list_base[pop_up_right];
-              FRU128_ADD_FRU128_SELF(logfreedom_delta_plus, term_fru128, status);
-              pop_down_left+=pop_delta;
+  u8 status;
+  u8 status_delta;
+
+  status=transform_dispatch_row_span(entropy_base, transform_base, whole_u8_list_base, entropy_base->fakefloat_y_idx_max, 0);
+  if(entropy_base->discount_status){
+    status_delta=transform_entropy_to_discount(entropy_base);
+    status=(u8)(status|status_delta);
+  }
+  return status;
+}
+
+void *
+transform_dispatch_band(void *thread_base){
+/*
+Execute one thread's share of transform_dispatch_banded(), namely, a band of contiguous rows. Don't call here directly; use transform_dispatch_banded() instead.
+
+In:
+
+  thread_base is the base of a transform_thread_t prepared by transform_dispatch_banded().
+
+Out:
+
+  Returns NULL.
+
+  (thread_base->status) is as defined in transform_dispatch_row_span():Out.
+
+  (thread_base->entropy_base) has been updated as transform_dispatch_row_span():Out describes.
+*/
+  transform_thread_t *thread_base_local;
+
+  thread_base_local=(transform_thread_t *)(thread_base);
+  thread_base_local->status=transform_dispatch_row_span(thread_base_local->entropy_base, thread_base_local->transform_base, thread_base_local->whole_u8_list_base, thread_base_local->whole_y_idx_max, thread_base_local->whole_y_idx_min);
+  return NULL;
+}
+
+u8
+transform_dispatch_banded(entropy_t *entropy_base, ULONG thread_idx_max, transform_t *transform_base, u8 *whole_u8_list_base){
+/*
+Execute the same transform as transform_dispatch() using multiple threads, each of which handles a horizontal band of rows using its own clone of the scan state. This is mainly useful for tall, narrow arrays of wholes, wherein transform_dispatch_threaded() would have few columns per thread.
+
+In:
+
+  entropy_base is as defined in transform_dispatch():In.
+
+  thread_idx_max is the number of threads to use, less one. On [0, THREAD_IDX_MAX_MAX]. If (transform_base->optimize_status) is one, then each band must begin by computing its first row from scratch, which costs about as much as (entropy_base->window_y_idx_post) incremental rows, so thread_idx_max is reduced as required in order that each band contain at least TRANSFORM_BAND_WINDOW_HEIGHT_RATIO times that many rows. If resources for threading cannot be allocated, then this is equivalent to transform_dispatch().
+
+  transform_base is as defined in transform_dispatch():In.
+
+  whole_u8_list_base is as defined in transform_dispatch():In.
+
+Out:
+
+  Returns and outputs the same as transform_dispatch(). If (transform_base->optimize_status) is zero, then this is bit-for-bit identical because every row is computed from scratch in any event. Otherwise, each band begins with fresh fractervals, so entropies may differ slightly from those of transform_dispatch() (but are no less accurate) and ties between minima or maxima in different bands could therefore resolve differently. Rank lists are merged in band order, so they obey the same caveat, except that if (entropy_base->rank_overlap_status) is one, then suppression across band boundaries may also differ because it's greedy.
+*/
+  ULONG band_y_idx_post;
+  ULONG band_y_idx_post_min;
+  entropy_t *entropy_band_base;
+  ULONG list_size;
+  u8 precise_status;
+  u8 status;
+  u8 status_delta;
+  transform_thread_t *thread_base;
+  ULONG thread_idx;
+  transform_thread_t *thread_list_base;
+  transform_t *transform_band_base;
+
+  band_y_idx_post=entropy_base->fakefloat_y_idx_max+1;
+  band_y_idx_post_min=1;
+  if(transform_base->optimize_status){
+    band_y_idx_post_min=entropy_base->window_y_idx_post*TRANSFORM_BAND_WINDOW_HEIGHT_RATIO;
+    if((band_y_idx_post_min/TRANSFORM_BAND_WINDOW_HEIGHT_RATIO)!=entropy_base->window_y_idx_post){
+      band_y_idx_post_min=band_y_idx_post;
+    }
+  }
+  thread_idx=band_y_idx_post/band_y_idx_post_min;
+  if(thread_idx){
+    thread_idx--;
+  }
+  thread_idx_max=MIN(thread_idx_max, thread_idx);
+  thread_list_base=NULL;
+  if(thread_idx_max){
+    list_size=(thread_idx_max+1)*(ULONG)(sizeof(transform_thread_t));
+    thread_list_base=DEBUG_CALLOC_PARANOID(list_size);
+  }
+  status=!thread_list_base;
+  if(!status){
+    thread_base=thread_list_base;
+    thread_idx=0;
+    do{
+      entropy_band_base=entropy_base;
+      transform_band_base=transform_base;
+      if(thread_idx){
+        transform_clone(entropy_base, &entropy_band_base, transform_base, &transform_band_base);
+        status=!entropy_band_base;
+      }
+      thread_base->entropy_base=entropy_band_base;
+      thread_base->thread_idx=thread_idx;
+      thread_base->transform_base=transform_band_base;
+      thread_base->whole_u8_list_base=whole_u8_list_base;
+      thread_span_get(&thread_base->whole_y_idx_max, &thread_base->whole_y_idx_min, band_y_idx_post, thread_idx, thread_idx_max);
+      thread_base++;
+    }while((!status)&&((thread_idx++)!=thread_idx_max));
+  }
+  if(!status){
+    thread_list_run(NULL, transform_dispatch_band, thread_list_base, (ULONG)(sizeof(transform_thread_t)), thread_idx_max);
+    precise_status=entropy_base->precise_status;
+    status=thread_list_base->status;
+    thread_base=thread_list_base;
+    thread_idx=1;
+    do{
+      thread_base++;
+      entropy_band_base=thread_base->entropy_base;
+      status=(u8)(status|thread_base->status);
+      if(!precise_status){
+        if(entropy_base->max_max_u64<entropy_band_base->max_max_u64){
+          entropy_base->max_max_u64=entropy_band_base->max_max_u64;
+          entropy_base->max_max_x_idx=entropy_band_base->max_max_x_idx;
+          entropy_base->max_max_y_idx=entropy_band_base->max_max_y_idx;
+        }
+        if(entropy_band_base->min_min_u64<entropy_base->min_min_u64){
+          entropy_base->min_min_u64=entropy_band_base->min_min_u64;
+          entropy_base->min_min_x_idx=entropy_band_base->min_min_x_idx;
+          entropy_base->min_min_y_idx=entropy_band_base->min_min_y_idx;
+        }
+      }else{
+        if(U128_IS_LESS(entropy_base->max_max_u128, entropy_band_base->max_max_u128)){
+          entropy_base->max_max_u128=entropy_band_base->max_max_u128;
+          entropy_base->max_max_x_idx=entropy_band_base->max_max_x_idx;
+          entropy_base->max_max_y_idx=entropy_band_base->max_max_y_idx;
+        }
+        if(U128_IS_LESS(entropy_band_base->min_min_u128, entropy_base->min_min_u128)){
+          entropy_base->min_min_u128=entropy_band_base->min_min_u128;
+          entropy_base->min_min_x_idx=entropy_band_base->min_min_x_idx;
+          entropy_base->min_min_y_idx=entropy_band_base->min_min_y_idx;
+        }
+      }
+      if(entropy_base->rank_status){
+        transform_rank_list_merge(entropy_base, entropy_band_base);
+      }
+    }while((thread_idx++)!=thread_idx_max);
+    if(entropy_base->discount_status){
+      status_delta=transform_entropy_to_discount(entropy_base);
+      status=(u8)(status|status_delta);
+    }
+  }else{
+    status=transform_dispatch(entropy_base, transform_base, whole_u8_list_base);
+  }
+  if(thread_list_base){
+    thread_base=thread_list_base;
+    thread_idx=0;
+    do{
+      if(thread_base->transform_base&&thread_base->transform_base->clone_status){
+        transform_free_all(&thread_base->entropy_base, &thread_base->transform_base);
+      }
+      thread_base++;
+    }while((thread_idx++)!=thread_idx_max);
+  }
+  DEBUG_FREE_PARANOID(thread_list_base);
+  return status;
+}
+
+u8
+transform_dispatch_row_span(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_y_idx_max, ULONG whole_y_idx_min){
+/*
+Execute a 2D channelized entropy transform over a contiguous range of rows, without any discount adjustment. Don't call here directly; use transform_dispatch() instead.
+
+In:
+
+  entropy_base is as defined in transform_dispatch():In.
+
+  transform_base is as defined in transform_dispatch():In.
+
+  whole_u8_list_base is as defined in transform_dispatch():In.
+
+  whole_y_idx_max is the greatest row index at which a window may start. On [whole_y_idx_min, (entropy_base->fakefloat_y_idx_max)].
+
+  whole_y_idx_min is the least row index at which a window may start. This row is always computed from scratch.
+
+Out:
+
+  Returns one if fracterval underflow or overflow occured (which is usually benign) else zero.
+
+  The transform has been done as transform_dispatch():Out describes, but only for windows starting on [whole_y_idx_min, whole_y_idx_max], and the minimum and maximum entropies and their coordinates in *entropy_base pertain only to those windows. In the event of ties, the least row index, then the least column index, wins. If transform_screen_init() was called, then rows which provably contain neither extreme may have been skipped, as described therein.
+*/
+  u64 entropy_max_max_u64;
+  u128 entropy_max_max_u128;
+  ULONG entropy_max_max_x_idx;
+  ULONG entropy_max_max_y_idx;
+  u64 entropy_min_min_u64;
+  ULONG entropy_min_min_x_idx;
+  ULONG entropy_min_min_y_idx;
+  u128 entropy_min_min_u128;
+  ULONG entropy_y_idx;
+  void **freq_list_base_list_base;
+  ULONG freq_list_idx;
+  u8 optimize_status;
+  u8 precise_status;
+  double screen_error;
+  ULONG screen_idx;
+  ULONG screen_idx_post;
+  double *screen_list_base;
+  double screen_max;
+  double screen_max_min;
+  double screen_min;
+  double screen_min_max;
+  u8 screen_status;
+  u8 status;
+  u8 status_delta;
+
+  optimize_status=transform_base->optimize_status;
+  precise_status=entropy_base->precise_status;
+  status=0;
+  U128_SET_ZERO(entropy_max_max_u128);
+  entropy_max_max_u64=0;
+  entropy_max_max_x_idx=0;
+  entropy_max_max_y_idx=whole_y_idx_min;
+  U128_NOT(entropy_min_min_u128, entropy_max_max_u128);
+  entropy_min_min_u64=~entropy_max_max_u64;
+  entropy_min_min_x_idx=0;
+  entropy_min_min_y_idx=whole_y_idx_min;
+  screen_list_base=NULL;
+  screen_status=(transform_base->screen_status&&!(optimize_status||entropy_base->fakefloat_list_base||entropy_base->rank_status||entropy_base->hit_list_base));
+  if(screen_status){
+    screen_idx_post=(whole_y_idx_max-whole_y_idx_min+1)<<1;
+    screen_list_base=DEBUG_MALLOC_PARANOID(screen_idx_post*(ULONG)(sizeof(double)));
+    screen_status=!!screen_list_base;
+  }
+  screen_max_min=0.0;
+  screen_min_max=0.0;
+  if(screen_status){
+/*
+Estimate every row first, so that each row can then be judged against the estimated extremes of the entire span. A row can contain the window of maximum entropy only if its greatest estimate plus error reaches the greatest estimate minus error of any row, and likewise for the minimum.
+*/
+    freq_list_base_list_base=transform_base->freq_list_base_list_base;
+    freq_list_idx=transform_base->freq_list_idx_max;
+    do{
+      transform_freq_list_zero(freq_list_base_list_base[freq_list_idx], transform_base->freq_size_log2, entropy_base->whole_max_max);
+    }while(freq_list_idx--);
+    screen_idx=0;
+    entropy_y_idx=whole_y_idx_min;
+    do{
+      transform_whole_list_line_entropy_screen(entropy_base, &screen_max, &screen_min, &screen_error, transform_base, whole_u8_list_base, entropy_y_idx);
+      screen_list_base[screen_idx]=screen_max+screen_error;
+      screen_list_base[screen_idx+1]=screen_min-screen_error;
+      if((entropy_y_idx==whole_y_idx_min)||(screen_max_min<(screen_max-screen_error))){
+        screen_max_min=screen_max-screen_error;
+      }
+      if((entropy_y_idx==whole_y_idx_min)||((screen_min+screen_error)<screen_min_max)){
+        screen_min_max=screen_min+screen_error;
+      }
+      screen_idx+=2;
+    }while((entropy_y_idx++)!=whole_y_idx_max);
+/*
+The estimates bound the exact entropy of each window, but the extremes are chosen by the limits of its fracterval, which may lie as much as (transform_base->screen_width) beyond it. Lower the bar for the maximum and raise it for the minimum by that much, so that a row is only skipped when no such difference could make it win.
+*/
+    screen_max_min-=transform_base->screen_width;
+    screen_min_max+=transform_base->screen_width;
+  }
+  screen_idx=0;
+  entropy_y_idx=whole_y_idx_min;
+  do{
+    if((!screen_status)||(screen_max_min<=screen_list_base[screen_idx])||(screen_list_base[screen_idx+1]<=screen_min_max)){
+      if(!precise_status){
+        if(optimize_status&&(entropy_y_idx!=whole_y_idx_min)){
+          status_delta=transform_whole_list_line_entropy_delta_get_fru64(entropy_base, transform_base, whole_u8_list_base, entropy_y_idx);
+        }else{
+          status_delta=transform_whole_list_line_entropy_get_fru64(entropy_base, transform_base, whole_u8_list_base, entropy_y_idx);
+        }
+        if(entropy_max_max_u64<entropy_base->max_max_u64){
+          entropy_max_max_y_idx=entropy_y_idx;
+          entropy_max_max_u64=entropy_base->max_max_u64;
+          entropy_max_max_x_idx=entropy_base->max_max_x_idx;
+        }
+        if(entropy_base->min_min_u64<entropy_min_min_u64){
+          entropy_min_min_y_idx=entropy_y_idx;
+          entropy_min_min_u64=entropy_base->min_min_u64;
+          entropy_min_min_x_idx=entropy_base->min_min_x_idx;
+        }
+      }else{
+        if(optimize_status&&(entropy_y_idx!=whole_y_idx_min)){
+          status_delta=transform_whole_list_line_entropy_delta_get_fru128(entropy_base, transform_base, whole_u8_list_base, entropy_y_idx);
+        }else{
+          status_delta=transform_whole_list_line_entropy_get_fru128(entropy_base, transform_base, whole_u8_list_base, entropy_y_idx);
+        }
+        if(U128_IS_LESS(entropy_max_max_u128, entropy_base->max_max_u128)){
+          entropy_max_max_y_idx=entropy_y_idx;
+          entropy_max_max_u128=entropy_base->max_max_u128;
+          entropy_max_max_x_idx=entropy_base->max_max_x_idx;
+        }
+        if(U128_IS_LESS(entropy_base->min_min_u128, entropy_min_min_u128)){
+          entropy_min_min_y_idx=entropy_y_idx;
+          entropy_min_min_u128=entropy_base->min_min_u128;
+          entropy_min_min_x_idx=entropy_base->min_min_x_idx;
+        }
+      }
+      status=(u8)(status|status_delta);
+      if(entropy_base->rank_status){
+        transform_rank_row_update(entropy_base, entropy_y_idx);
+      }
+      if(entropy_base->hit_list_base){
+        status_delta=transform_hit_row_update(entropy_base, entropy_y_idx);
+        status=(u8)(status|status_delta);
+      }
+    }else{
+      TRANSFORM_STATS_ADD(TRANSFORM_STATS_IDX_SCREEN_SKIP_COUNT, 1);
+    }
+    screen_idx+=2;
+  }while((entropy_y_idx++)!=whole_y_idx_max);
+  DEBUG_FREE_PARANOID(screen_list_base);
+  entropy_base->max_max_u128=entropy_max_max_u128;
+  entropy_base->max_max_u64=entropy_max_max_u64;
+  entropy_base->max_max_x_idx=entropy_max_max_x_idx;
+  entropy_base->max_max_y_idx=entropy_max_max_y_idx;
+  entropy_base->min_min_u128=entropy_min_min_u128;
+  entropy_base->min_min_u64=entropy_min_min_u64;
+  entropy_base->min_min_x_idx=entropy_min_min_x_idx;
+  entropy_base->min_min_y_idx=entropy_min_min_y_idx;
+  return status;
+}
+
+u8
+transform_dispatch_stream(ULONG buffer_y_idx_min, entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_y_idx_max, ULONG whole_y_idx_min){
+/*
+Execute the same transform as transform_dispatch() over a contiguous range of rows, the wholes of which reside either in a buffer containing only those rows which the range requires, or in the entire array of wholes, so that the caller can stream an arbitrarily large array of wholes, or the fakefloats computed therefrom, through bounded memory. Ranges must be submitted in ascending order, starting with row zero (or transform_state_import():Out:*entropy_y_idx_post_base when resuming from a checkpoint) and ending with row (entropy_base->fakefloat_y_idx_max), without gaps or overlaps. Unlike transform_dispatch(), this function never converts to discount nats, so that the state remains exportable via transform_state_export(); the caller must call transform_entropy_to_discount() after the last range if (entropy_base->discount_status) is one.
+
+In:
+
+  buffer_y_idx_min is the index of row whole_y_idx_min within *whole_u8_list_base. One if the latter is a stream buffer, else whole_y_idx_min.
+
+  entropy_base is as defined in transform_dispatch():In, except that (entropy_base->fakefloat_list_base), if not NULL, need only be large enough for (whole_y_idx_max-whole_y_idx_min+2) rows of fakefloats. The caller may point it at a different such list on each call.
+
+  transform_base is as defined in transform_dispatch():In.
+
+  whole_u8_list_base is, if buffer_y_idx_min is one, the base of (whole_y_idx_max-whole_y_idx_min+(entropy_base->window_y_idx_post)+1) rows of wholes, the first of which is row (whole_y_idx_min-1) of the whole array, in which case transform_transpose_init() must not have been called, because its copy would describe a different array. If whole_y_idx_min is zero, then the first row is never accessed. Otherwise, it's as defined in transform_dispatch():In.
+
+  whole_y_idx_max is the greatest row index at which a window may start. On [whole_y_idx_min, (entropy_base->fakefloat_y_idx_max)].
+
+  whole_y_idx_min is the least row index at which a window may start. Zero on the first call, else one more than whole_y_idx_max of the previous call, whether in this process or in the one which called transform_state_export().
+
+Out:
+
+  Returns one if fracterval underflow or overflow occured (which is usually benign) else zero.
+
+  The minimum and maximum entropies and their coordinates in *entropy_base pertain to all rows submitted so far, as do any rank lists. After the call in which whole_y_idx_max is (entropy_base->fakefloat_y_idx_max), they are bit-for-bit identical to the outputs of transform_dispatch(), once converted by transform_entropy_to_discount() if applicable.
+
+  (*(entropy_base->fakefloat_list_base)), if not NULL, contains the fakefloats of window row y at row (y-whole_y_idx_min+1), so that every window occupies the same relative row index in both lists. The first row is undefined.
+
+  If transform_hit_init() was called beforehand, then the hit list has been extended by the hits on rows [whole_y_idx_min, whole_y_idx_max], so that the caller can drain it between calls.
+*/
+  ULONG buffer_y_idx;
+  u64 entropy_max_max_u64;
+  u128 entropy_max_max_u128;
+  ULONG entropy_max_max_x_idx;
+  ULONG entropy_max_max_y_idx;
+  u64 entropy_min_min_u64;
+  ULONG entropy_min_min_x_idx;
+  ULONG entropy_min_min_y_idx;
+  u128 entropy_min_min_u128;
+  ULONG entropy_y_idx;
+  u8 optimize_status;
+  u8 precise_status;
+  u8 status;
+  u8 status_delta;
+
+  optimize_status=transform_base->optimize_status;
+  precise_status=entropy_base->precise_status;
+  status=0;
+  if(!whole_y_idx_min){
+    U128_SET_ZERO(entropy_max_max_u128);
+    entropy_max_max_u64=0;
+    entropy_max_max_x_idx=0;
+    entropy_max_max_y_idx=0;
+    U128_NOT(entropy_min_min_u128, entropy_max_max_u128);
+    entropy_min_min_u64=~entropy_max_max_u64;
+    entropy_min_min_x_idx=0;
+    entropy_min_min_y_idx=0;
+  }else{
+/*
+The line entropy functions below overwrite the extremes in *entropy_base, so save those accumulated by previous calls.
+*/
+    entropy_max_max_u128=entropy_base->max_max_u128;
+    entropy_max_max_u64=entropy_base->max_max_u64;
+    entropy_max_max_x_idx=entropy_base->max_max_x_idx;
+    entropy_max_max_y_idx=entropy_base->max_max_y_idx;
+    entropy_min_min_u128=entropy_base->min_min_u128;
+    entropy_min_min_u64=entropy_base->min_min_u64;
+    entropy_min_min_x_idx=entropy_base->min_min_x_idx;
+    entropy_min_min_y_idx=entropy_base->min_min_y_idx;
+  }
+/*
+Bias fakefloat row indexes so that window row whole_y_idx_min lands on row one regardless of where the wholes reside. If buffer_y_idx_min is zero, then the bias wraps to ULONG_MAX, which has the same effect in unsigned arithmetic.
+*/
+  buffer_y_idx=buffer_y_idx_min;
+  entropy_base->fakefloat_y_idx_min=buffer_y_idx_min-1;
+  entropy_y_idx=whole_y_idx_min;
+  do{
+    if(!precise_status){
+      if(optimize_status&&entropy_y_idx){
+        status_delta=transform_whole_list_line_entropy_delta_get_fru64(entropy_base, transform_base, whole_u8_list_base, buffer_y_idx);
+      }else{
+        status_delta=transform_whole_list_line_entropy_get_fru64(entropy_base, transform_base, whole_u8_list_base, buffer_y_idx);
+      }
+      if(entropy_max_max_u64<entropy_base->max_max_u64){
+        entropy_max_max_y_idx=entropy_y_idx;
+        entropy_max_max_u64=entropy_base->max_max_u64;
+        entropy_max_max_x_idx=entropy_base->max_max_x_idx;
+      }
+      if(entropy_base->min_min_u64<entropy_min_min_u64){
+        entropy_min_min_y_idx=entropy_y_idx;
+        entropy_min_min_u64=entropy_base->min_min_u64;
+        entropy_min_min_x_idx=entropy_base->min_min_x_idx;
+      }
+    }else{
+      if(optimize_status&&entropy_y_idx){
+        status_delta=transform_whole_list_line_entropy_delta_get_fru128(entropy_base, transform_base, whole_u8_list_base, buffer_y_idx);
+      }else{
+        status_delta=transform_whole_list_line_entropy_get_fru128(entropy_base, transform_base, whole_u8_list_base, buffer_y_idx);
+      }
+      if(U128_IS_LESS(entropy_max_max_u128, entropy_base->max_max_u128)){
+        entropy_max_max_y_idx=entropy_y_idx;
+        entropy_max_max_u128=entropy_base->max_max_u128;
+        entropy_max_max_x_idx=entropy_base->max_max_x_idx;
+      }
+      if(U128_IS_LESS(entropy_base->min_min_u128, entropy_min_min_u128)){
+        entropy_min_min_y_idx=entropy_y_idx;
+        entropy_min_min_u128=entropy_base->min_min_u128;
+        entropy_min_min_x_idx=entropy_base->min_min_x_idx;
+      }
+    }
+    status=(u8)(status|status_delta);
+    if(entropy_base->rank_status){
+      transform_rank_row_update(entropy_base, entropy_y_idx);
+    }
+    if(entropy_base->hit_list_base){
+      status_delta=transform_hit_row_update(entropy_base, entropy_y_idx);
+      status=(u8)(status|status_delta);
+    }
+    buffer_y_idx++;
+  }while((entropy_y_idx++)!=whole_y_idx_max);
+  entropy_base->fakefloat_y_idx_min=0;
+  entropy_base->max_max_u128=entropy_max_max_u128;
+  entropy_base->max_max_u64=entropy_max_max_u64;
+  entropy_base->max_max_x_idx=entropy_max_max_x_idx;
+  entropy_base->max_max_y_idx=entropy_max_max_y_idx;
+  entropy_base->min_min_u128=entropy_min_min_u128;
+  entropy_base->min_min_u64=entropy_min_min_u64;
+  entropy_base->min_min_x_idx=entropy_min_min_x_idx;
+  entropy_base->min_min_y_idx=entropy_min_min_y_idx;
+  return status;
+}
+
+u8
+transform_dispatch_sweep(entropy_t **entropy_base_list_base, ULONG entropy_list_idx_max, transform_t *transform_base, u8 *whole_u8_list_base){
+/*
+Execute the same transform as transform_dispatch() for several window widths at once, all with the same window height, so that the column state of each row, namely the frequency lists and entropy deltas, is computed only once and then summed at every width.
+
+In:
+
+  *entropy_base_list_base is a list of (entropy_list_idx_max+1) outputs of transform_entropy_clone(), all made from the same entropy_t, with (fakefloat_list_base) NULL and no rank lists.
+
+  entropy_list_idx_max is the number of items in *entropy_base_list_base, less one.
+
+  transform_base is the transform_t which was passed to transform_entropy_clone(), the window width of which must be at least that of every item in *entropy_base_list_base.
+
+  whole_u8_list_base is as defined in transform_dispatch():In.
+
+Out:
+
+  Returns one if fracterval underflow or overflow occured (which is usually benign) else zero.
+
+  The minimum and maximum entropies and their coordinates in each item of *entropy_base_list_base are bit-for-bit identical to what transform_dispatch() would have produced for a transform_malloc() with the corresponding window size, including any discount adjustment.
+*/
+  entropy_t *entropy_base;
+  ULONG entropy_list_idx;
+  u64 entropy_max_max_u64;
+  u128 entropy_max_max_u128;
+  ULONG entropy_max_max_x_idx;
+  ULONG entropy_max_max_y_idx;
+  u64 entropy_min_min_u64;
+  u128 entropy_min_min_u128;
+  ULONG entropy_min_min_x_idx;
+  ULONG entropy_min_min_y_idx;
+  ULONG entropy_y_idx;
+  ULONG entropy_y_idx_max;
+  u8 optimize_status;
+  u8 precise_status;
+  u8 status;
+  u8 status_delta;
+  transform_thread_t thread;
+
+  entropy_base=entropy_base_list_base[0];
+  entropy_y_idx_max=entropy_base->fakefloat_y_idx_max;
+  optimize_status=transform_base->optimize_status;
+  precise_status=entropy_base->precise_status;
+  status=0;
+  entropy_y_idx=0;
+  do{
+    if(optimize_status&&entropy_y_idx){
+/*
+Update the column state once for all widths. The line entropy functions below then only differ by the bias and the number of deltas summed per window.
+*/
+      entropy_base=entropy_base_list_base[0];
+      if(!precise_status){
+        status_delta=transform_whole_list_column_entropy_delta_get_fru64(entropy_base, transform_base, whole_u8_list_base, entropy_base->whole_x_idx_max, 0, entropy_y_idx);
+      }else{
+        status_delta=transform_whole_list_column_entropy_delta_get_fru128(entropy_base, transform_base, whole_u8_list_base, entropy_base->whole_x_idx_max, 0, entropy_y_idx);
+      }
+      status=(u8)(status|status_delta);
+    }
+/*
+In optimize mode, the first row is computed from scratch only at the first width, which fills the frequency lists and entropy deltas of every column. The remaining widths then merely sum those deltas, in the same order that transform_whole_list_line_entropy_get_fru(64/128)() would have.
+*/
+    entropy_list_idx=0;
+    do{
+      entropy_base=entropy_base_list_base[entropy_list_idx];
+      entropy_max_max_u128=entropy_base->max_max_u128;
+      entropy_max_max_u64=entropy_base->max_max_u64;
+      entropy_max_max_x_idx=entropy_base->max_max_x_idx;
+      entropy_max_max_y_idx=entropy_base->max_max_y_idx;
+      entropy_min_min_u128=entropy_base->min_min_u128;
+      entropy_min_min_u64=entropy_base->min_min_u64;
+      entropy_min_min_x_idx=entropy_base->min_min_x_idx;
+      entropy_min_min_y_idx=entropy_base->min_min_y_idx;
+      if(!precise_status){
+        if(optimize_status&&(entropy_y_idx|entropy_list_idx)){
+          status_delta=transform_entropy_delta_list_line_entropy_get_fru64(entropy_base, entropy_base->fakefloat_x_idx_max, 0, &thread, transform_base, entropy_y_idx);
+          entropy_base->max_max_u64=thread.max_max_u64;
+          entropy_base->max_max_x_idx=thread.max_max_x_idx;
+          entropy_base->min_min_u64=thread.min_min_u64;
+          entropy_base->min_min_x_idx=thread.min_min_x_idx;
+        }else{
+          status_delta=transform_whole_list_line_entropy_get_fru64(entropy_base, transform_base, whole_u8_list_base, entropy_y_idx);
+        }
+      }else{
+        if(optimize_status&&(entropy_y_idx|entropy_list_idx)){
+          status_delta=transform_entropy_delta_list_line_entropy_get_fru128(entropy_base, entropy_base->fakefloat_x_idx_max, 0, &thread, transform_base, entropy_y_idx);
+          entropy_base->max_max_u128=thread.max_max_u128;
+          entropy_base->max_max_x_idx=thread.max_max_x_idx;
+          entropy_base->min_min_u128=thread.min_min_u128;
+          entropy_base->min_min_x_idx=thread.min_min_x_idx;
+        }else{
+          status_delta=transform_whole_list_line_entropy_get_fru128(entropy_base, transform_base, whole_u8_list_base, entropy_y_idx);
+        }
+      }
+      status=(u8)(status|status_delta);
+/*
+*entropy_base now holds the extremes of this row alone, so merge them with those of previous rows, favoring the earlier row in case of a tie as transform_dispatch_row_span() does.
+*/
+      entropy_base->max_max_y_idx=entropy_y_idx;
+      entropy_base->min_min_y_idx=entropy_y_idx;
+      if(entropy_y_idx){
+        if(!precise_status){
+          if(!(entropy_max_max_u64<entropy_base->max_max_u64)){
+            entropy_base->max_max_u64=entropy_max_max_u64;
+            entropy_base->max_max_x_idx=entropy_max_max_x_idx;
+            entropy_base->max_max_y_idx=entropy_max_max_y_idx;
+          }
+          if(!(entropy_base->min_min_u64<entropy_min_min_u64)){
+            entropy_base->min_min_u64=entropy_min_min_u64;
+            entropy_base->min_min_x_idx=entropy_min_min_x_idx;
+            entropy_base->min_min_y_idx=entropy_min_min_y_idx;
+          }
+        }else{
+          if(!U128_IS_LESS(entropy_max_max_u128, entropy_base->max_max_u128)){
+            entropy_base->max_max_u128=entropy_max_max_u128;
+            entropy_base->max_max_x_idx=entropy_max_max_x_idx;
+            entropy_base->max_max_y_idx=entropy_max_max_y_idx;
+          }
+          if(!U128_IS_LESS(entropy_base->min_min_u128, entropy_min_min_u128)){
+            entropy_base->min_min_u128=entropy_min_min_u128;
+            entropy_base->min_min_x_idx=entropy_min_min_x_idx;
+            entropy_base->min_min_y_idx=entropy_min_min_y_idx;
+          }
+        }
+      }
+    }while((entropy_list_idx++)!=entropy_list_idx_max);
+  }while((entropy_y_idx++)!=entropy_y_idx_max);
+  entropy_list_idx=0;
+  do{
+    entropy_base=entropy_base_list_base[entropy_list_idx];
+    if(entropy_base->discount_status){
+      status_delta=transform_entropy_to_discount(entropy_base);
+      status=(u8)(status|status_delta);
+    }
+  }while((entropy_list_idx++)!=entropy_list_idx_max);
+  return status;
+}
+
+void *
+transform_dispatch_thread(void *thread_base){
+/*
+Execute one thread's share of transform_dispatch_threaded(), namely, every row after the first, one stripe of columns at a time. Don't call here directly; use transform_dispatch_threaded() instead.
+
+In:
+
+  thread_base is the base of a transform_thread_t prepared by transform_dispatch_threaded().
+
+Out:
+
+  Returns NULL.
+
+  (thread_base->status) is one if fracterval underflow or overflow occured (which is usually benign) else zero.
+
+  If (thread_base->thread_idx) is zero, then (thread_base->entropy_base) has been updated to reflect the minimum and maximum entropies over all rows, exactly as transform_dispatch() would have done prior to any discount adjustment.
+*/
+  thread_barrier_t *barrier_base;
+  entropy_t *entropy_base;
+  u128 entropy_ceiling_u128;
+  u64 entropy_ceiling_u64;
+  u128 entropy_delta_max_u128;
+  u64 entropy_delta_max_u64;
+  ULONG entropy_x_idx_max;
+  ULONG entropy_x_idx_min;
+  ULONG entropy_y_idx;
+  ULONG entropy_y_idx_max;
+  u8 precise_status;
+  u8 status;
+  u8 status_delta;
+  u8 status_stripe;
+  transform_thread_t *thread_base_local;
+  ULONG thread_idx;
+  ULONG thread_idx_max;
+  transform_thread_t *thread_list_base;
+  transform_thread_t *thread_peer_base;
+  ULONG thread_peer_idx;
+  transform_t *transform_base;
+  u8 *whole_u8_list_base;
+  ULONG whole_x_idx_max;
+  ULONG whole_x_idx_min;
+  u8 wrap_status;
+
+  thread_base_local=(transform_thread_t *)(thread_base);
+  barrier_base=thread_base_local->barrier_base;
+  thread_barrier_wait(barrier_base);
+  thread_idx_max=barrier_base->thread_idx_max;
+  entropy_base=thread_base_local->entropy_base;
+  thread_idx=thread_base_local->thread_idx;
+  thread_list_base=(transform_thread_t *)(thread_base_local->thread_list_base);
+  transform_base=thread_base_local->transform_base;
+  whole_u8_list_base=thread_base_local->whole_u8_list_base;
+  thread_span_get(&entropy_x_idx_max, &entropy_x_idx_min, entropy_base->fakefloat_x_idx_max+1, thread_idx, thread_idx_max);
+  thread_span_get(&whole_x_idx_max, &whole_x_idx_min, entropy_base->whole_x_idx_post, thread_idx, thread_idx_max);
+  entropy_y_idx=1;
+  entropy_y_idx_max=entropy_base->fakefloat_y_idx_max;
+  precise_status=entropy_base->precise_status;
+  status=0;
+  do{
+/*
+Update the entropy deltas of our own columns, then wait for all other threads to do likewise. Then total the changes in entropy across our own stripe of window positions in modular arithmetic and wait again, whereupon the entropy at the left edge of each stripe is the entropy at column zero plus the totals of all stripes to its left. Modular addition is associative, so each stripe can then roll its own window entropies forward from there, producing the same bits as the single-threaded case would have, provided that it never saturated. Wait again so that every thread can verify that. Saturation could only have occurred if some limit of some window position plus the upper limit of some delta exceeded the maximum, or if some lower limit wrapped below zero, in which case its modular value would be at least that maximum less the greatest such upper limit. So it suffices that every limit over all stripes is less than the ones complement of the greatest upper limit of any delta. In the rare event that it fails, every thread reverts to summing the deltas of all columns up to the right edge of its own windows with saturation, and waits once more before the deltas are overwritten. Finally, thread zero merges the minimum and maximum of each stripe in ascending column order.
+*/
+    if(!precise_status){
+      status_delta=transform_whole_list_column_entropy_delta_get_fru64(entropy_base, transform_base, whole_u8_list_base, whole_x_idx_max, whole_x_idx_min, entropy_y_idx);
+      status=(u8)(status|status_delta);
+      thread_barrier_wait(barrier_base);
+      status_delta=transform_entropy_delta_list_stripe_sum_get_fru64(entropy_base, entropy_x_idx_max, entropy_x_idx_min, thread_base_local, transform_base);
+      status=(u8)(status|status_delta);
+      thread_barrier_wait(barrier_base);
+      status_stripe=transform_entropy_delta_list_stripe_entropy_get_fru64(entropy_base, entropy_x_idx_max, entropy_x_idx_min, thread_base_local, transform_base, entropy_y_idx);
+      thread_barrier_wait(barrier_base);
+      entropy_ceiling_u64=0;
+      entropy_delta_max_u64=0;
+      thread_peer_base=thread_list_base;
+      thread_peer_idx=0;
+      do{
+        entropy_ceiling_u64=(entropy_ceiling_u64<thread_peer_base->ceiling_u64)?thread_peer_base->ceiling_u64:entropy_ceiling_u64;
+        entropy_delta_max_u64=(entropy_delta_max_u64<thread_peer_base->delta_max_u64)?thread_peer_base->delta_max_u64:entropy_delta_max_u64;
+        thread_peer_base++;
+      }while((thread_peer_idx++)!=thread_idx_max);
+      wrap_status=(entropy_ceiling_u64<(~entropy_delta_max_u64));
+      if(!wrap_status){
+        status_stripe=transform_entropy_delta_list_line_entropy_get_fru64(entropy_base, entropy_x_idx_max, entropy_x_idx_min, thread_base_local, transform_base, entropy_y_idx);
+      }
+    }else{
+      status_delta=transform_whole_list_column_entropy_delta_get_fru128(entropy_base, transform_base, whole_u8_list_base, whole_x_idx_max, whole_x_idx_min, entropy_y_idx);
+      status=(u8)(status|status_delta);
+      thread_barrier_wait(barrier_base);
+      status_delta=transform_entropy_delta_list_stripe_sum_get_fru128(entropy_base, entropy_x_idx_max, entropy_x_idx_min, thread_base_local, transform_base);
+      status=(u8)(status|status_delta);
+      thread_barrier_wait(barrier_base);
+      status_stripe=transform_entropy_delta_list_stripe_entropy_get_fru128(entropy_base, entropy_x_idx_max, entropy_x_idx_min, thread_base_local, transform_base, entropy_y_idx);
+      thread_barrier_wait(barrier_base);
+      U128_SET_ZERO(entropy_ceiling_u128);
+      U128_SET_ZERO(entropy_delta_max_u128);
+      thread_peer_base=thread_list_base;
+      thread_peer_idx=0;
+      do{
+        if(U128_IS_LESS(entropy_ceiling_u128, thread_peer_base->ceiling_u128)){
+          entropy_ceiling_u128=thread_peer_base->ceiling_u128;
+        }
+        if(U128_IS_LESS(entropy_delta_max_u128, thread_peer_base->delta_max_u128)){
+          entropy_delta_max_u128=thread_peer_base->delta_max_u128;
+        }
+        thread_peer_base++;
+      }while((thread_peer_idx++)!=thread_idx_max);
+      U128_NOT_SELF(entropy_delta_max_u128);
+      wrap_status=U128_IS_LESS(entropy_ceiling_u128, entropy_delta_max_u128);
+      if(!wrap_status){
+        status_stripe=transform_entropy_delta_list_line_entropy_get_fru128(entropy_base, entropy_x_idx_max, entropy_x_idx_min, thread_base_local, transform_base, entropy_y_idx);
+      }
+    }
+    status=(u8)(status|status_stripe);
+    if(!wrap_status){
+      thread_barrier_wait(barrier_base);
+    }
+    if(!thread_idx){
+      thread_peer_base=thread_list_base;
+      thread_peer_idx=0;
+      do{
+        if(!precise_status){
+          if(entropy_base->max_max_u64<thread_peer_base->max_max_u64){
+            entropy_base->max_max_u64=thread_peer_base->max_max_u64;
+            entropy_base->max_max_x_idx=thread_peer_base->max_max_x_idx;
+            entropy_base->max_max_y_idx=entropy_y_idx;
+          }
+          if(thread_peer_base->min_min_u64<entropy_base->min_min_u64){
+            entropy_base->min_min_u64=thread_peer_base->min_min_u64;
+            entropy_base->min_min_x_idx=thread_peer_base->min_min_x_idx;
+            entropy_base->min_min_y_idx=entropy_y_idx;
+          }
+        }else{
+          if(U128_IS_LESS(entropy_base->max_max_u128, thread_peer_base->max_max_u128)){
+            entropy_base->max_max_u128=thread_peer_base->max_max_u128;
+            entropy_base->max_max_x_idx=thread_peer_base->max_max_x_idx;
+            entropy_base->max_max_y_idx=entropy_y_idx;
+          }
+          if(U128_IS_LESS(thread_peer_base->min_min_u128, entropy_base->min_min_u128)){
+            entropy_base->min_min_u128=thread_peer_base->min_min_u128;
+            entropy_base->min_min_x_idx=thread_peer_base->min_min_x_idx;
+            entropy_base->min_min_y_idx=entropy_y_idx;
+          }
+        }
+        thread_peer_base++;
+      }while((thread_peer_idx++)!=thread_idx_max);
+      if(entropy_base->rank_status){
+        transform_rank_row_update(entropy_base, entropy_y_idx);
+      }
+    }
+  }while((entropy_y_idx++)!=entropy_y_idx_max);
+  thread_base_local->status=status;
+  return NULL;
+}
+
+u8
+transform_dispatch_threaded(entropy_t *entropy_base, ULONG thread_idx_max, transform_t *transform_base, u8 *whole_u8_list_base){
+/*
+Execute the same transform as transform_dispatch() using multiple threads, each of which handles a vertical stripe of columns.
+
+In:
+
+  entropy_base is as defined in transform_dispatch():In.
+
+  thread_idx_max is the number of threads to use, less one. On [0, THREAD_IDX_MAX_MAX]. This is reduced as required so that every stripe contains at least one window position. If (transform_base->optimize_status) is zero, then rows are independent, so this defers to transform_dispatch_banded(), which is also bit-identical. If resources for threading cannot be allocated, then this is equivalent to transform_dispatch().
+
+  transform_base is as defined in transform_dispatch():In.
+
+  whole_u8_list_base is as defined in transform_dispatch():In.
+
+Out:
+
+  Returns and outputs exactly what transform_dispatch() would have, bit for bit, regardless of thread_idx_max.
+*/
+  thread_barrier_t *barrier_base;
+  ULONG list_size;
+  u8 precise_status;
+  u8 status;
+  u8 status_delta;
+  transform_thread_t *thread_base;
+  ULONG thread_idx;
+  transform_thread_t *thread_list_base;
+
+  barrier_base=NULL;
+  thread_list_base=NULL;
+  if(transform_base->optimize_status){
+    thread_idx_max=MIN(thread_idx_max, entropy_base->fakefloat_x_idx_max);
+    if(thread_idx_max&&entropy_base->fakefloat_y_idx_max){
+      barrier_base=thread_barrier_malloc(thread_idx_max);
+      list_size=(thread_idx_max+1)*(ULONG)(sizeof(transform_thread_t));
+      thread_list_base=DEBUG_CALLOC_PARANOID(list_size);
+    }
+  }
+  if(barrier_base&&thread_list_base){
+    precise_status=entropy_base->precise_status;
+    if(!precise_status){
+      status=transform_whole_list_line_entropy_get_fru64(entropy_base, transform_base, whole_u8_list_base, 0);
+    }else{
+      status=transform_whole_list_line_entropy_get_fru128(entropy_base, transform_base, whole_u8_list_base, 0);
+    }
+    entropy_base->max_max_y_idx=0;
+    entropy_base->min_min_y_idx=0;
+    if(entropy_base->rank_status){
+      transform_rank_row_update(entropy_base, 0);
+    }
+    thread_base=thread_list_base;
+    thread_idx=0;
+    do{
+      thread_base->barrier_base=barrier_base;
+      thread_base->entropy_base=entropy_base;
+      thread_base->thread_idx=thread_idx;
+      thread_base->thread_list_base=thread_list_base;
+      thread_base->transform_base=transform_base;
+      thread_base->whole_u8_list_base=whole_u8_list_base;
+      thread_base++;
+    }while((thread_idx++)!=thread_idx_max);
+    thread_idx_max=thread_list_run(barrier_base, transform_dispatch_thread, thread_list_base, (ULONG)(sizeof(transform_thread_t)), thread_idx_max);
+    thread_base=thread_list_base;
+    thread_idx=0;
+    do{
+      status=(u8)(status|thread_base->status);
+      thread_base++;
+    }while((thread_idx++)!=thread_idx_max);
+    if(entropy_base->discount_status){
+      status_delta=transform_entropy_to_discount(entropy_base);
+      status=(u8)(status|status_delta);
+    }
+  }else if(!transform_base->optimize_status){
+    status=transform_dispatch_banded(entropy_base, thread_idx_max, transform_base, whole_u8_list_base);
+  }else{
+    status=transform_dispatch(entropy_base, transform_base, whole_u8_list_base);
+  }
+  thread_barrier_free(barrier_base);
+  DEBUG_FREE_PARANOID(thread_list_base);
+  return status;
+}
+
+entropy_t *
+transform_entropy_clone(entropy_t *entropy_base, transform_t *transform_base, ULONG window_x_idx_max){
+/*
+Create a copy of the scan parameters returned by transform_malloc() or transform_clone_resize(), but with a window width no greater than the original, so that transform_dispatch_sweep() can derive the window entropies at several widths from the same column state.
+
+In:
+
+  entropy_base is transform_malloc():Out:*entropy_base_base.
+
+  transform_base is transform_malloc():Out:*transform_base_base, corresponding to entropy_base.
+
+  window_x_idx_max is the number of columns in the window of the copy, less one. On [0, (entropy_base->window_x_idx_max)].
+
+Out:
+
+  Returns NULL if allocation failed or the window entropy offsets could not be computed, else the base of a copy of *entropy_base with all window parameters pertaining to the new width, (fakefloat_list_base) NULL, and no rank lists. It must be freed via transform_free() before transform_base is freed.
+*/
+  entropy_t *entropy_clone_base;
+  u8 status;
+
+  entropy_clone_base=DEBUG_MALLOC_PARANOID((ULONG)(sizeof(entropy_t)));
+  if(entropy_clone_base){
+    memcpy(entropy_clone_base, entropy_base, sizeof(entropy_t));
+    entropy_clone_base->fakefloat_list_base=NULL;
+    entropy_clone_base->fakefloat_x_idx_max=entropy_base->whole_x_idx_max-window_x_idx_max;
+    entropy_clone_base->rank_max_fru128_list_base=NULL;
+    entropy_clone_base->rank_max_fru64_list_base=NULL;
+    entropy_clone_base->rank_max_xy_list_base=NULL;
+    entropy_clone_base->rank_min_fru128_list_base=NULL;
+    entropy_clone_base->rank_min_fru64_list_base=NULL;
+    entropy_clone_base->rank_min_xy_list_base=NULL;
+    entropy_clone_base->rank_row_fru128_list_base=NULL;
+    entropy_clone_base->hit_list_base=NULL;
+    entropy_clone_base->hit_max_status=0;
+    entropy_clone_base->hit_min_status=0;
+    entropy_clone_base->rank_row_fru64_list_base=NULL;
+    entropy_clone_base->rank_status=0;
+    entropy_clone_base->window_x_idx_max=window_x_idx_max;
+    entropy_clone_base->window_x_idx_post=window_x_idx_max+1;
+    status=transform_window_entropy_offsets_get(entropy_clone_base, transform_base);
+    if(status){
+      DEBUG_FREE_PARANOID(entropy_clone_base);
+      entropy_clone_base=NULL;
+    }
+  }
+  return entropy_clone_base;
+}
+
+u8
+transform_entropy_delta_list_line_entropy_get_fru128(entropy_t *entropy_base, ULONG entropy_x_idx_max, ULONG entropy_x_idx_min, transform_thread_t *thread_base, transform_t *transform_base, ULONG whole_y_idx){
+/*
+Sum the entropy deltas of a row, which must already be up to date, in order to obtain the entropy of each window position in a given range of columns. Don't call here directly; use transform_whole_list_line_entropy_delta_get_fru128() or transform_dispatch_threaded() instead.
+
+In:
+
+  entropy_base is transform_malloc():Out:*entropy_base_base.
+
+  entropy_x_idx_max is the greatest column index of a window position to evaluate. On [entropy_x_idx_min, (entropy_base->fakefloat_x_idx_max)].
+
+  entropy_x_idx_min is the least column index of a window position to evaluate.
+
+  thread_base is the base of the transform_thread_t to which to report results.
+
+  transform_base is transform_malloc():Out:*transform_base_base.
+
+  whole_y_idx is the row index. On [1, (entropy_base->whole_y_idx_max)-(entropy_base->window_y_idx_max)].
+
+Out:
+
+  Returns one if fracterval underflow or overflow occured (which is usually benign) else zero.
+
+  (thread_base->max_max_u128), (thread_base->max_max_x_idx), (thread_base->min_min_u128), and (thread_base->min_min_x_idx) are as transform_whole_list_line_entropy_delta_get_fru128():Out would have set in (entropy_base), but only over the window positions in question. In order to produce bit-identical results, all deltas to the left of entropy_x_idx_min are summed as well.
+
+  (*(entropy_base->fakefloat_list_base)), if not NULL, has been populated at the window positions in question as transform_whole_list_line_entropy_delta_get_fru128():Out describes.
+*/
+  u8 discount_status;
+  fru128 entropy;
+  u128 entropy_ceiling;
+  fru128 entropy_copy;
+  fru128 entropy_delta;
+  fru128 *entropy_delta_list_base;
+  u128 entropy_delta_max;
+  fru128 entropy_delta_old;
+  u128 entropy_max_max;
+  fru128 entropy_max_max_max;
+  ULONG entropy_max_max_x_idx;
+  u128 entropy_min_min;
+  ULONG entropy_min_min_x_idx;
+  fru128 *entropy_row_list_base;
+  u32 entropy_u32;
+  ULONG entropy_u32_idx;
+  u32 *entropy_u32_list_base;
+  fru128 entropy_wrap;
+  ULONG entropy_x_idx;
+#ifdef FRU128_LANES
+  fru128_lanes_u128 entropy_ceiling_lanes;
+  fru128_lanes entropy_lanes;
+  fru128_lanes_u128 entropy_max_max_lanes;
+  fru128_lanes_u64 entropy_max_max_x_idx_lanes;
+  fru128_lanes_u128 entropy_min_min_lanes;
+  fru128_lanes_u64 entropy_min_min_x_idx_lanes;
+  fru128_lanes_u64 entropy_x_idx_lanes;
+  u8 lane_idx;
+  u128 lane_u128;
+#endif
+  u8 rounding_status;
+  TRANSFORM_STATS_DECLARE(stats_time)
+  u8 status;
+  ULONG whole_x_idx;
+  ULONG window_x_idx_max;
+  u8 wrap_status;
+
+  TRANSFORM_STATS_TIME_GET(stats_time);
+  discount_status=entropy_base->discount_status;
+  rounding_status=entropy_base->rounding_status;
+  status=0;
+  entropy=entropy_base->window_bias_fru128;
+  entropy_delta_list_base=transform_base->entropy_delta_fru128_list_base;
+  U128_SET_ZERO(entropy_delta_max);
+  U128_SET_ZERO(entropy_max_max);
+  entropy_max_max_max=entropy_base->window_max_max_fru128;
+  entropy_max_max_x_idx=entropy_x_idx_min;
+  U128_NOT(entropy_min_min, entropy_max_max);
+  entropy_min_min_x_idx=entropy_x_idx_min;
+  entropy_row_list_base=entropy_base->rank_row_fru128_list_base;
+  entropy_u32_list_base=entropy_base->fakefloat_list_base;
+  entropy_u32_idx=(entropy_base->fakefloat_x_idx_max+1)*(whole_y_idx-entropy_base->fakefloat_y_idx_min)+entropy_x_idx_min;
+  window_x_idx_max=entropy_base->window_x_idx_max;
+  whole_x_idx=0;
+  do{
+    entropy_delta=entropy_delta_list_base[whole_x_idx];
+    if(U128_IS_LESS(entropy_delta_max, entropy_delta.b)){
+      entropy_delta_max=entropy_delta.b;
+    }
+    FRU128_SUBTRACT_FRU128_SELF(entropy, entropy_delta, status);
+  }while((whole_x_idx++)!=window_x_idx_max);
+/*
+Each subsequent window position adds back the delta of the column which just left the window and subtracts that of the column which just entered it.
+
+If only the extremes are required, first try doing so in modular arithmetic, which leaves a loop body free of saturation checks and their branches. The saturating path would have saturated only if (1) the upper limit of some window position plus that of a delta exceeded U128_MAX or (2) the lower limit of some window position wrapped below zero, in which case its modular value would be at least (U128_MAX-entropy_delta_max). So if every limit of every window position is less than (U128_MAX-entropy_delta_max), where entropy_delta_max is the greatest upper limit of any delta in the row, then the modular result is bit-identical to the saturating one. Otherwise, fall back to the saturating path.
+*/
+  wrap_status=!(entropy_row_list_base||entropy_u32_list_base);
+  if(wrap_status){
+    whole_x_idx=window_x_idx_max;
+    while(whole_x_idx!=(entropy_x_idx_max+window_x_idx_max)){
+      whole_x_idx++;
+      entropy_delta=entropy_delta_list_base[whole_x_idx];
+      if(U128_IS_LESS(entropy_delta_max, entropy_delta.b)){
+        entropy_delta_max=entropy_delta.b;
+      }
+    }
+    entropy_ceiling=entropy.b;
+    if(U128_IS_LESS(entropy_ceiling, entropy.a)){
+      entropy_ceiling=entropy.a;
+    }
+    entropy_wrap=entropy;
+    entropy_x_idx=0;
+    while(entropy_x_idx!=entropy_x_idx_min){
+      entropy_delta_old=entropy_delta_list_base[entropy_x_idx];
+      entropy_delta=entropy_delta_list_base[entropy_x_idx+window_x_idx_max+1];
+      FRU128_ADD_FRU128_SUBTRACT_FRU128_WRAP_SELF(entropy_wrap, entropy_delta_old, entropy_delta);
+      if(U128_IS_LESS(entropy_ceiling, entropy_wrap.a)){
+        entropy_ceiling=entropy_wrap.a;
+      }
+      if(U128_IS_LESS(entropy_ceiling, entropy_wrap.b)){
+        entropy_ceiling=entropy_wrap.b;
+      }
+      entropy_x_idx++;
+    }
+    entropy_max_max=entropy_wrap.b;
+    entropy_min_min=entropy_wrap.a;
+    if(U128_IS_LESS(entropy_ceiling, entropy_wrap.a)){
+      entropy_ceiling=entropy_wrap.a;
+    }
+#ifdef FRU128_LANES
+/*
+As in transform_entropy_delta_list_line_entropy_get_fru64(), roll FRU128_LANE_COUNT window positions at a time, then merge the lanes so that the least index wins ties.
+*/
+    FRU128_LANES_U128_FROM_U128(entropy_ceiling_lanes, entropy_ceiling);
+    FRU128_LANES_U128_FROM_U128(entropy_max_max_lanes, entropy_max_max);
+    FRU128_LANES_U64_FROM_U64(entropy_max_max_x_idx_lanes, entropy_max_max_x_idx);
+    FRU128_LANES_U128_FROM_U128(entropy_min_min_lanes, entropy_min_min);
+    FRU128_LANES_U64_FROM_U64(entropy_min_min_x_idx_lanes, entropy_min_min_x_idx);
+    FRU128_LANES_U64_FROM_U64_SEQUENCE(entropy_x_idx_lanes, entropy_x_idx+1);
+    while(FRU128_LANE_COUNT<=(entropy_x_idx_max-entropy_x_idx)){
+      FRU128_LANES_SUBTRACT_FRU128_LIST_WRAP(entropy_lanes, &entropy_delta_list_base[entropy_x_idx], &entropy_delta_list_base[entropy_x_idx+window_x_idx_max+1]);
+      FRU128_LANES_ACCUMULATE_WRAP_SELF(entropy_lanes, entropy_wrap);
+      FRU128_LANES_U128_MAX_INDEX_SELF(entropy_max_max_lanes, entropy_max_max_x_idx_lanes, entropy_lanes.b, entropy_x_idx_lanes);
+      FRU128_LANES_U128_MIN_INDEX_SELF(entropy_min_min_lanes, entropy_min_min_x_idx_lanes, entropy_lanes.a, entropy_x_idx_lanes);
+      FRU128_LANES_U128_MAX_SELF(entropy_ceiling_lanes, entropy_lanes.a);
+      FRU128_LANES_TO_FRU128(entropy_wrap, FRU128_LANE_COUNT-1, entropy_lanes);
+      entropy_x_idx+=FRU128_LANE_COUNT;
+      entropy_x_idx_lanes+=FRU128_LANE_COUNT;
+    }
+    lane_idx=0;
+    do{
+      U128_FROM_U64_PAIR(lane_u128, entropy_max_max_lanes.lo[lane_idx], entropy_max_max_lanes.hi[lane_idx]);
+      if(U128_IS_LESS(entropy_max_max, lane_u128)||(U128_IS_EQUAL(entropy_max_max, lane_u128)&&(entropy_max_max_x_idx_lanes[lane_idx]<entropy_max_max_x_idx))){
+        entropy_max_max=lane_u128;
+        entropy_max_max_x_idx=(ULONG)(entropy_max_max_x_idx_lanes[lane_idx]);
+      }
+      U128_FROM_U64_PAIR(lane_u128, entropy_min_min_lanes.lo[lane_idx], entropy_min_min_lanes.hi[lane_idx]);
+      if(U128_IS_LESS(lane_u128, entropy_min_min)||(U128_IS_EQUAL(entropy_min_min, lane_u128)&&(entropy_min_min_x_idx_lanes[lane_idx]<entropy_min_min_x_idx))){
+        entropy_min_min=lane_u128;
+        entropy_min_min_x_idx=(ULONG)(entropy_min_min_x_idx_lanes[lane_idx]);
+      }
+      U128_FROM_U64_PAIR(lane_u128, entropy_ceiling_lanes.lo[lane_idx], entropy_ceiling_lanes.hi[lane_idx]);
+      if(U128_IS_LESS(entropy_ceiling, lane_u128)){
+        entropy_ceiling=lane_u128;
+      }
+    }while((lane_idx++)!=(FRU128_LANE_COUNT-1));
+#endif
+    while(entropy_x_idx!=entropy_x_idx_max){
+      entropy_delta_old=entropy_delta_list_base[entropy_x_idx];
+      entropy_delta=entropy_delta_list_base[entropy_x_idx+window_x_idx_max+1];
+      FRU128_ADD_FRU128_SUBTRACT_FRU128_WRAP_SELF(entropy_wrap, entropy_delta_old, entropy_delta);
+      entropy_x_idx++;
+      if(U128_IS_LESS(entropy_max_max, entropy_wrap.b)){
+        entropy_max_max=entropy_wrap.b;
+        entropy_max_max_x_idx=entropy_x_idx;
+      }
+      if(U128_IS_LESS(entropy_wrap.a, entropy_min_min)){
+        entropy_min_min=entropy_wrap.a;
+        entropy_min_min_x_idx=entropy_x_idx;
+      }
+      if(U128_IS_LESS(entropy_ceiling, entropy_wrap.a)){
+        entropy_ceiling=entropy_wrap.a;
+      }
+    }
+    if(U128_IS_LESS(entropy_ceiling, entropy_max_max)){
+      entropy_ceiling=entropy_max_max;
+    }
+    U128_NOT_SELF(entropy_delta_max);
+    if(U128_IS_LESS_EQUAL(entropy_delta_max, entropy_ceiling)){
+      wrap_status=0;
+      U128_SET_ZERO(entropy_max_max);
+      entropy_max_max_x_idx=entropy_x_idx_min;
+      U128_NOT(entropy_min_min, entropy_max_max);
+      entropy_min_min_x_idx=entropy_x_idx_min;
+    }
+  }
+  if(!wrap_status){
+    entropy_x_idx=0;
+    do{
+      if(entropy_x_idx){
+        entropy_delta_old=entropy_delta_list_base[entropy_x_idx-1];
+        entropy_delta=entropy_delta_list_base[entropy_x_idx+window_x_idx_max];
+        FRU128_ADD_FRU128_SUBTRACT_FRU128_SELF(entropy, entropy_delta_old, entropy_delta, status);
+      }
+      if(entropy_x_idx_min<=entropy_x_idx){
+        if(U128_IS_LESS(entropy_max_max, entropy.b)){
+          entropy_max_max=entropy.b;
+          entropy_max_max_x_idx=entropy_x_idx;
+        }
+        if(U128_IS_LESS(entropy.a, entropy_min_min)){
+          entropy_min_min=entropy.a;
+          entropy_min_min_x_idx=entropy_x_idx;
+        }
+        if(entropy_row_list_base){
+          entropy_row_list_base[entropy_x_idx]=entropy;
+        }
+        if(entropy_u32_list_base){
+          entropy_copy=entropy;
+          if(discount_status){
+            FRU128_SUBTRACT_FRU128(entropy_copy, entropy_max_max_max, entropy, status);
+          }
+          if(rounding_status==TRANSFORM_ROUNDING_STATUS_NEAREST_EVEN){
+            entropy_u32=fracterval_u128_to_fakefloat(entropy_copy, U64_BITS);
+          }else if(rounding_status==TRANSFORM_ROUNDING_STATUS_NEGATIVE){
+            entropy_u32=fractoid_u128_to_fakefloat_floor(entropy_copy.a, U64_BITS);
+          }else{
+            entropy_u32=fractoid_u128_to_fakefloat_ceil(entropy_copy.b, U64_BITS);
+          }
+          entropy_u32_list_base[entropy_u32_idx]=entropy_u32;
+          entropy_u32_idx++;
+        }
+      }
+    }while((entropy_x_idx++)!=entropy_x_idx_max);
+  }
+  thread_base->max_max_u128=entropy_max_max;
+  thread_base->max_max_x_idx=entropy_max_max_x_idx;
+  thread_base->min_min_u128=entropy_min_min;
+  thread_base->min_min_x_idx=entropy_min_min_x_idx;
+  TRANSFORM_STATS_TIME_ADD(TRANSFORM_STATS_IDX_KERNEL_NS, stats_time);
+  TRANSFORM_STATS_ADD(TRANSFORM_STATS_IDX_FAKEFLOAT_COUNT, (entropy_u32_list_base?(entropy_x_idx_max-entropy_x_idx_min+1):0));
+  TRANSFORM_STATS_ADD(TRANSFORM_STATS_IDX_SATURATION_COUNT, status);
+  return status;
+}
+
+u8
+transform_entropy_delta_list_line_entropy_get_fru64(entropy_t *entropy_base, ULONG entropy_x_idx_max, ULONG entropy_x_idx_min, transform_thread_t *thread_base, transform_t *transform_base, ULONG whole_y_idx){
+/*
+This is the 64-bit fracterval equivalent of transform_entropy_delta_list_line_entropy_get_fru128(). Replace all occurrences of "128" with "64" in its definition.
+*/
+  u8 discount_status;
+  fru64 entropy;
+  u64 entropy_ceiling;
+  fru64 entropy_copy;
+  fru64 entropy_delta;
+  fru64 *entropy_delta_list_base;
+  u64 entropy_delta_max;
+  fru64 entropy_delta_old;
+  u64 entropy_max_max;
+  fru64 entropy_max_max_max;
+  ULONG entropy_max_max_x_idx;
+  u64 entropy_min_min;
+  ULONG entropy_min_min_x_idx;
+  fru64 *entropy_row_list_base;
+  u32 entropy_u32;
+  ULONG entropy_u32_idx;
+  u32 *entropy_u32_list_base;
+  fru64 entropy_wrap;
+  ULONG entropy_x_idx;
+#ifdef FRU64_LANES
+  fru64_lanes_u64 entropy_ceiling_lanes;
+  fru64_lanes entropy_lanes;
+  fru64_lanes_u64 entropy_max_max_lanes;
+  fru64_lanes_u64 entropy_max_max_x_idx_lanes;
+  fru64_lanes_u64 entropy_min_min_lanes;
+  fru64_lanes_u64 entropy_min_min_x_idx_lanes;
+  fru64_lanes_u64 entropy_x_idx_lanes;
+  u8 lane_idx;
+#endif
+  u8 rounding_status;
+  TRANSFORM_STATS_DECLARE(stats_time)
+  u8 status;
+  ULONG whole_x_idx;
+  ULONG window_x_idx_max;
+  u8 wrap_status;
+
+  TRANSFORM_STATS_TIME_GET(stats_time);
+  discount_status=entropy_base->discount_status;
+  rounding_status=entropy_base->rounding_status;
+  status=0;
+  entropy=entropy_base->window_bias_fru64;
+  entropy_delta_list_base=transform_base->entropy_delta_fru64_list_base;
+  entropy_delta_max=0;
+  entropy_max_max=0;
+  entropy_max_max_max=entropy_base->window_max_max_fru64;
+  entropy_max_max_x_idx=entropy_x_idx_min;
+  entropy_min_min=~entropy_max_max;
+  entropy_min_min_x_idx=entropy_x_idx_min;
+  entropy_row_list_base=entropy_base->rank_row_fru64_list_base;
+  entropy_u32_list_base=entropy_base->fakefloat_list_base;
+  entropy_u32_idx=(entropy_base->fakefloat_x_idx_max+1)*(whole_y_idx-entropy_base->fakefloat_y_idx_min)+entropy_x_idx_min;
+  window_x_idx_max=entropy_base->window_x_idx_max;
+  whole_x_idx=0;
+  do{
+    entropy_delta=entropy_delta_list_base[whole_x_idx];
+    entropy_delta_max=(entropy_delta_max<entropy_delta.b)?entropy_delta.b:entropy_delta_max;
+    FRU64_SUBTRACT_FRU64_SELF(entropy, entropy_delta, status);
+  }while((whole_x_idx++)!=window_x_idx_max);
+/*
+Each subsequent window position adds back the delta of the column which just left the window and subtracts that of the column which just entered it.
+
+If only the extremes are required, first try doing so in modular arithmetic, which leaves a loop body free of saturation checks and their branches. The saturating path would have saturated only if (1) the upper limit of some window position plus that of a delta exceeded U64_MAX or (2) the lower limit of some window position wrapped below zero, in which case its modular value would be at least (U64_MAX-entropy_delta_max). So if every limit of every window position is less than (U64_MAX-entropy_delta_max), where entropy_delta_max is the greatest upper limit of any delta in the row, then the modular result is bit-identical to the saturating one. Otherwise, fall back to the saturating path.
+*/
+  wrap_status=!(entropy_row_list_base||entropy_u32_list_base);
+  if(wrap_status){
+    whole_x_idx=window_x_idx_max;
+    while(whole_x_idx!=(entropy_x_idx_max+window_x_idx_max)){
+      whole_x_idx++;
+      entropy_delta=entropy_delta_list_base[whole_x_idx];
+      entropy_delta_max=(entropy_delta_max<entropy_delta.b)?entropy_delta.b:entropy_delta_max;
+    }
+    entropy_ceiling=(entropy.a<entropy.b)?entropy.b:entropy.a;
+    entropy_wrap=entropy;
+    entropy_x_idx=0;
+    while(entropy_x_idx!=entropy_x_idx_min){
+      entropy_delta_old=entropy_delta_list_base[entropy_x_idx];
+      entropy_delta=entropy_delta_list_base[entropy_x_idx+window_x_idx_max+1];
+      FRU64_ADD_FRU64_SUBTRACT_FRU64_WRAP_SELF(entropy_wrap, entropy_delta_old, entropy_delta);
+      entropy_ceiling=(entropy_ceiling<entropy_wrap.a)?entropy_wrap.a:entropy_ceiling;
+      entropy_ceiling=(entropy_ceiling<entropy_wrap.b)?entropy_wrap.b:entropy_ceiling;
+      entropy_x_idx++;
+    }
+    entropy_max_max=entropy_wrap.b;
+    entropy_min_min=entropy_wrap.a;
+    entropy_ceiling=(entropy_ceiling<entropy_wrap.a)?entropy_wrap.a:entropy_ceiling;
+#ifdef FRU64_LANES
+/*
+Roll FRU64_LANE_COUNT window positions at a time. Each lane keeps the first of its own extremes, so the least index wins ties when the lanes are merged, exactly as in the scalar loop, which finishes any remaining positions.
+*/
+    FRU64_LANES_U64_FROM_U64(entropy_ceiling_lanes, entropy_ceiling);
+    FRU64_LANES_U64_FROM_U64(entropy_max_max_lanes, entropy_max_max);
+    FRU64_LANES_U64_FROM_U64(entropy_max_max_x_idx_lanes, entropy_max_max_x_idx);
+    FRU64_LANES_U64_FROM_U64(entropy_min_min_lanes, entropy_min_min);
+    FRU64_LANES_U64_FROM_U64(entropy_min_min_x_idx_lanes, entropy_min_min_x_idx);
+    FRU64_LANES_U64_FROM_U64_SEQUENCE(entropy_x_idx_lanes, entropy_x_idx+1);
+    while(FRU64_LANE_COUNT<=(entropy_x_idx_max-entropy_x_idx)){
+      FRU64_LANES_SUBTRACT_FRU64_LIST_WRAP(entropy_lanes, &entropy_delta_list_base[entropy_x_idx], &entropy_delta_list_base[entropy_x_idx+window_x_idx_max+1]);
+      FRU64_LANES_ACCUMULATE_WRAP_SELF(entropy_lanes, entropy_wrap);
+      FRU64_LANES_U64_MAX_INDEX_SELF(entropy_max_max_lanes, entropy_max_max_x_idx_lanes, entropy_lanes.b, entropy_x_idx_lanes);
+      FRU64_LANES_U64_MIN_INDEX_SELF(entropy_min_min_lanes, entropy_min_min_x_idx_lanes, entropy_lanes.a, entropy_x_idx_lanes);
+      FRU64_LANES_U64_MAX_SELF(entropy_ceiling_lanes, entropy_lanes.a);
+      FRU64_LANES_TO_FRU64(entropy_wrap, FRU64_LANE_COUNT-1, entropy_lanes);
+      entropy_x_idx+=FRU64_LANE_COUNT;
+      entropy_x_idx_lanes+=FRU64_LANE_COUNT;
+    }
+    lane_idx=0;
+    do{
+      if((entropy_max_max<entropy_max_max_lanes[lane_idx])||((entropy_max_max==entropy_max_max_lanes[lane_idx])&&(entropy_max_max_x_idx_lanes[lane_idx]<entropy_max_max_x_idx))){
+        entropy_max_max=entropy_max_max_lanes[lane_idx];
+        entropy_max_max_x_idx=(ULONG)(entropy_max_max_x_idx_lanes[lane_idx]);
+      }
+      if((entropy_min_min_lanes[lane_idx]<entropy_min_min)||((entropy_min_min==entropy_min_min_lanes[lane_idx])&&(entropy_min_min_x_idx_lanes[lane_idx]<entropy_min_min_x_idx))){
+        entropy_min_min=entropy_min_min_lanes[lane_idx];
+        entropy_min_min_x_idx=(ULONG)(entropy_min_min_x_idx_lanes[lane_idx]);
+      }
+      entropy_ceiling=(entropy_ceiling<entropy_ceiling_lanes[lane_idx])?entropy_ceiling_lanes[lane_idx]:entropy_ceiling;
+    }while((lane_idx++)!=(FRU64_LANE_COUNT-1));
+#endif
+    while(entropy_x_idx!=entropy_x_idx_max){
+      entropy_delta_old=entropy_delta_list_base[entropy_x_idx];
+      entropy_delta=entropy_delta_list_base[entropy_x_idx+window_x_idx_max+1];
+      FRU64_ADD_FRU64_SUBTRACT_FRU64_WRAP_SELF(entropy_wrap, entropy_delta_old, entropy_delta);
+      entropy_x_idx++;
+      if(entropy_max_max<entropy_wrap.b){
+        entropy_max_max=entropy_wrap.b;
+        entropy_max_max_x_idx=entropy_x_idx;
+      }
+      if(entropy_wrap.a<entropy_min_min){
+        entropy_min_min=entropy_wrap.a;
+        entropy_min_min_x_idx=entropy_x_idx;
+      }
+      entropy_ceiling=(entropy_ceiling<entropy_wrap.a)?entropy_wrap.a:entropy_ceiling;
+    }
+    entropy_ceiling=(entropy_ceiling<entropy_max_max)?entropy_max_max:entropy_ceiling;
+    if((~entropy_delta_max)<=entropy_ceiling){
+      wrap_status=0;
+      entropy_max_max=0;
+      entropy_max_max_x_idx=entropy_x_idx_min;
+      entropy_min_min=~entropy_max_max;
+      entropy_min_min_x_idx=entropy_x_idx_min;
+    }
+  }
+  if(!wrap_status){
+    entropy_x_idx=0;
+    do{
+      if(entropy_x_idx){
+        entropy_delta_old=entropy_delta_list_base[entropy_x_idx-1];
+        entropy_delta=entropy_delta_list_base[entropy_x_idx+window_x_idx_max];
+        FRU64_ADD_FRU64_SUBTRACT_FRU64_SELF(entropy, entropy_delta_old, entropy_delta, status);
+      }
+      if(entropy_x_idx_min<=entropy_x_idx){
+        if(entropy_max_max<entropy.b){
+          entropy_max_max=entropy.b;
+          entropy_max_max_x_idx=entropy_x_idx;
+        }
+        if(entropy.a<entropy_min_min){
+          entropy_min_min=entropy.a;
+          entropy_min_min_x_idx=entropy_x_idx;
+        }
+        if(entropy_row_list_base){
+          entropy_row_list_base[entropy_x_idx]=entropy;
+        }
+        if(entropy_u32_list_base){
+          entropy_copy=entropy;
+          if(discount_status){
+            FRU64_SUBTRACT_FRU64(entropy_copy, entropy_max_max_max, entropy, status);
+          }
+          if(rounding_status==TRANSFORM_ROUNDING_STATUS_NEAREST_EVEN){
+            entropy_u32=fracterval_u64_to_fakefloat(entropy_copy, U32_BITS);
+          }else if(rounding_status==TRANSFORM_ROUNDING_STATUS_NEGATIVE){
+            entropy_u32=fractoid_u64_to_fakefloat_floor(entropy_copy.a, U32_BITS);
+          }else{
+            entropy_u32=fractoid_u64_to_fakefloat_ceil(entropy_copy.b, U32_BITS);
+          }
+          entropy_u32_list_base[entropy_u32_idx]=entropy_u32;
+          entropy_u32_idx++;
+        }
+      }
+    }while((entropy_x_idx++)!=entropy_x_idx_max);
+  }
+  thread_base->max_max_u64=entropy_max_max;
+  thread_base->max_max_x_idx=entropy_max_max_x_idx;
+  thread_base->min_min_u64=entropy_min_min;
+  thread_base->min_min_x_idx=entropy_min_min_x_idx;
+  TRANSFORM_STATS_TIME_ADD(TRANSFORM_STATS_IDX_KERNEL_NS, stats_time);
+  TRANSFORM_STATS_ADD(TRANSFORM_STATS_IDX_FAKEFLOAT_COUNT, (entropy_u32_list_base?(entropy_x_idx_max-entropy_x_idx_min+1):0));
+  TRANSFORM_STATS_ADD(TRANSFORM_STATS_IDX_SATURATION_COUNT, status);
+  return status;
+}
+
+u8
+transform_entropy_delta_list_stripe_entropy_get_fru128(entropy_t *entropy_base, ULONG entropy_x_idx_max, ULONG entropy_x_idx_min, transform_thread_t *thread_base, transform_t *transform_base, ULONG whole_y_idx){
+/*
+Compute the entropy of each window position in one stripe of a row, starting from the sum of the stripe totals found by transform_entropy_delta_list_stripe_sum_get_fru128() to its left, in modular arithmetic. Don't call here directly; use transform_dispatch_threaded() instead.
+
+In:
+
+  entropy_base is transform_malloc():Out:*entropy_base_base.
+
+  entropy_x_idx_max is the greatest column index of a window position in the stripe. On [entropy_x_idx_min, (entropy_base->fakefloat_x_idx_max)].
+
+  entropy_x_idx_min is the least column index of a window position in the stripe.
+
+  thread_base is the base of the transform_thread_t of the stripe, which is an element of (thread_base->thread_list_base). transform_entropy_delta_list_stripe_sum_get_fru128() must already have been called for every stripe at a lesser (thread_idx), as well as for the stripe containing column zero, with the same entropy deltas.
+
+  transform_base is transform_malloc():Out:*transform_base_base.
+
+  whole_y_idx is the row index. On [1, (entropy_base->whole_y_idx_max)-(entropy_base->window_y_idx_max)].
+
+Out:
+
+  Returns one if fracterval underflow or overflow occured while discounting fakefloats (which is usually benign) else zero.
+
+  (thread_base->ceiling_u128) is the greatest lower or upper limit of the entropy at any window position in the stripe, in modular arithmetic. If it and that of every other stripe is less than the ones complement of the greatest (thread_base->delta_max_u128) of any stripe, then no saturation could have occurred, so everything below is bit-identical to what transform_entropy_delta_list_line_entropy_get_fru128() would have produced. Otherwise the caller must discard the return value and call that instead.
+
+  (thread_base->max_max_u128), (thread_base->max_max_x_idx), (thread_base->min_min_u128), and (thread_base->min_min_x_idx) are as transform_entropy_delta_list_line_entropy_get_fru128():Out describes.
+
+  The rank row and (*(entropy_base->fakefloat_list_base)), if not NULL, have been populated at the window positions in the stripe as transform_entropy_delta_list_line_entropy_get_fru128():Out describes.
+*/
+  u8 discount_status;
+  fru128 entropy;
+  u128 entropy_ceiling;
+  fru128 entropy_copy;
+  fru128 entropy_delta;
+  fru128 *entropy_delta_list_base;
+  fru128 entropy_delta_old;
+  u128 entropy_max_max;
+  fru128 entropy_max_max_max;
+  ULONG entropy_max_max_x_idx;
+  u128 entropy_min_min;
+  ULONG entropy_min_min_x_idx;
+  fru128 *entropy_row_list_base;
+  u32 entropy_u32;
+  ULONG entropy_u32_idx;
+  u32 *entropy_u32_list_base;
+  ULONG entropy_x_idx;
+  u8 rounding_status;
+  TRANSFORM_STATS_DECLARE(stats_time)
+  u8 status;
+  ULONG thread_idx;
+  transform_thread_t *thread_peer_base;
+  ULONG window_x_idx_max;
+
+  TRANSFORM_STATS_TIME_GET(stats_time);
+  discount_status=entropy_base->discount_status;
+  rounding_status=entropy_base->rounding_status;
+  status=0;
+  entropy_delta_list_base=transform_base->entropy_delta_fru128_list_base;
+  thread_peer_base=(transform_thread_t *)(thread_base->thread_list_base);
+  entropy=thread_peer_base->entropy_start_fru128;
+  thread_idx=thread_base->thread_idx;
+  while(thread_idx--){
+    U128_ADD_U128_SELF(entropy.a, thread_peer_base->entropy_sum_fru128.a);
+    U128_ADD_U128_SELF(entropy.b, thread_peer_base->entropy_sum_fru128.b);
+    thread_peer_base++;
+  }
+  U128_SET_ZERO(entropy_ceiling);
+  U128_SET_ZERO(entropy_max_max);
+  entropy_max_max_max=entropy_base->window_max_max_fru128;
+  entropy_max_max_x_idx=entropy_x_idx_min;
+  U128_NOT(entropy_min_min, entropy_max_max);
+  entropy_min_min_x_idx=entropy_x_idx_min;
+  entropy_row_list_base=entropy_base->rank_row_fru128_list_base;
+  entropy_u32_list_base=entropy_base->fakefloat_list_base;
+  entropy_u32_idx=(entropy_base->fakefloat_x_idx_max+1)*(whole_y_idx-entropy_base->fakefloat_y_idx_min)+entropy_x_idx_min;
+  window_x_idx_max=entropy_base->window_x_idx_max;
+  entropy_x_idx=entropy_x_idx_min;
+  do{
+    if(entropy_x_idx){
+      entropy_delta_old=entropy_delta_list_base[entropy_x_idx-1];
+      entropy_delta=entropy_delta_list_base[entropy_x_idx+window_x_idx_max];
+      FRU128_ADD_FRU128_SUBTRACT_FRU128_WRAP_SELF(entropy, entropy_delta_old, entropy_delta);
+    }
+    if(U128_IS_LESS(entropy_max_max, entropy.b)){
+      entropy_max_max=entropy.b;
+      entropy_max_max_x_idx=entropy_x_idx;
+    }
+    if(U128_IS_LESS(entropy.a, entropy_min_min)){
+      entropy_min_min=entropy.a;
+      entropy_min_min_x_idx=entropy_x_idx;
+    }
+    if(U128_IS_LESS(entropy_ceiling, entropy.a)){
+      entropy_ceiling=entropy.a;
+    }
+    if(entropy_row_list_base){
+      entropy_row_list_base[entropy_x_idx]=entropy;
+    }
+    if(entropy_u32_list_base){
+      entropy_copy=entropy;
+      if(discount_status){
+        FRU128_SUBTRACT_FRU128(entropy_copy, entropy_max_max_max, entropy, status);
+      }
+      if(rounding_status==TRANSFORM_ROUNDING_STATUS_NEAREST_EVEN){
+        entropy_u32=fracterval_u128_to_fakefloat(entropy_copy, U64_BITS);
+      }else if(rounding_status==TRANSFORM_ROUNDING_STATUS_NEGATIVE){
+        entropy_u32=fractoid_u128_to_fakefloat_floor(entropy_copy.a, U64_BITS);
+      }else{
+        entropy_u32=fractoid_u128_to_fakefloat_ceil(entropy_copy.b, U64_BITS);
+      }
+      entropy_u32_list_base[entropy_u32_idx]=entropy_u32;
+      entropy_u32_idx++;
+    }
+  }while((entropy_x_idx++)!=entropy_x_idx_max);
+  if(U128_IS_LESS(entropy_ceiling, entropy_max_max)){
+    entropy_ceiling=entropy_max_max;
+  }
+  thread_base->ceiling_u128=entropy_ceiling;
+  thread_base->max_max_u128=entropy_max_max;
+  thread_base->max_max_x_idx=entropy_max_max_x_idx;
+  thread_base->min_min_u128=entropy_min_min;
+  thread_base->min_min_x_idx=entropy_min_min_x_idx;
+  TRANSFORM_STATS_TIME_ADD(TRANSFORM_STATS_IDX_KERNEL_NS, stats_time);
+  TRANSFORM_STATS_ADD(TRANSFORM_STATS_IDX_FAKEFLOAT_COUNT, (entropy_u32_list_base?(entropy_x_idx_max-entropy_x_idx_min+1):0));
+  return status;
+}
+
+u8
+transform_entropy_delta_list_stripe_entropy_get_fru64(entropy_t *entropy_base, ULONG entropy_x_idx_max, ULONG entropy_x_idx_min, transform_thread_t *thread_base, transform_t *transform_base, ULONG whole_y_idx){
+/*
+This is the 64-bit fracterval equivalent of transform_entropy_delta_list_stripe_entropy_get_fru128(). Replace all occurrences of "128" with "64" in its definition.
+*/
+  u8 discount_status;
+  fru64 entropy;
+  u64 entropy_ceiling;
+  fru64 entropy_copy;
+  fru64 entropy_delta;
+  fru64 *entropy_delta_list_base;
+  fru64 entropy_delta_old;
+  u64 entropy_max_max;
+  fru64 entropy_max_max_max;
+  ULONG entropy_max_max_x_idx;
+  u64 entropy_min_min;
+  ULONG entropy_min_min_x_idx;
+  fru64 *entropy_row_list_base;
+  u32 entropy_u32;
+  ULONG entropy_u32_idx;
+  u32 *entropy_u32_list_base;
+  ULONG entropy_x_idx;
+  u8 rounding_status;
+  TRANSFORM_STATS_DECLARE(stats_time)
+  u8 status;
+  ULONG thread_idx;
+  transform_thread_t *thread_peer_base;
+  ULONG window_x_idx_max;
+
+  TRANSFORM_STATS_TIME_GET(stats_time);
+  discount_status=entropy_base->discount_status;
+  rounding_status=entropy_base->rounding_status;
+  status=0;
+  entropy_delta_list_base=transform_base->entropy_delta_fru64_list_base;
+  thread_peer_base=(transform_thread_t *)(thread_base->thread_list_base);
+  entropy=thread_peer_base->entropy_start_fru64;
+  thread_idx=thread_base->thread_idx;
+  while(thread_idx--){
+    entropy.a+=thread_peer_base->entropy_sum_fru64.a;
+    entropy.b+=thread_peer_base->entropy_sum_fru64.b;
+    thread_peer_base++;
+  }
+  entropy_ceiling=0;
+  entropy_max_max=0;
+  entropy_max_max_max=entropy_base->window_max_max_fru64;
+  entropy_max_max_x_idx=entropy_x_idx_min;
+  entropy_min_min=~entropy_max_max;
+  entropy_min_min_x_idx=entropy_x_idx_min;
+  entropy_row_list_base=entropy_base->rank_row_fru64_list_base;
+  entropy_u32_list_base=entropy_base->fakefloat_list_base;
+  entropy_u32_idx=(entropy_base->fakefloat_x_idx_max+1)*(whole_y_idx-entropy_base->fakefloat_y_idx_min)+entropy_x_idx_min;
+  window_x_idx_max=entropy_base->window_x_idx_max;
+  entropy_x_idx=entropy_x_idx_min;
+  do{
+    if(entropy_x_idx){
+      entropy_delta_old=entropy_delta_list_base[entropy_x_idx-1];
+      entropy_delta=entropy_delta_list_base[entropy_x_idx+window_x_idx_max];
+      FRU64_ADD_FRU64_SUBTRACT_FRU64_WRAP_SELF(entropy, entropy_delta_old, entropy_delta);
+    }
+    if(entropy_max_max<entropy.b){
+      entropy_max_max=entropy.b;
+      entropy_max_max_x_idx=entropy_x_idx;
+    }
+    if(entropy.a<entropy_min_min){
+      entropy_min_min=entropy.a;
+      entropy_min_min_x_idx=entropy_x_idx;
+    }
+    entropy_ceiling=(entropy_ceiling<entropy.a)?entropy.a:entropy_ceiling;
+    if(entropy_row_list_base){
+      entropy_row_list_base[entropy_x_idx]=entropy;
+    }
+    if(entropy_u32_list_base){
+      entropy_copy=entropy;
+      if(discount_status){
+        FRU64_SUBTRACT_FRU64(entropy_copy, entropy_max_max_max, entropy, status);
+      }
+      if(rounding_status==TRANSFORM_ROUNDING_STATUS_NEAREST_EVEN){
+        entropy_u32=fracterval_u64_to_fakefloat(entropy_copy, U32_BITS);
+      }else if(rounding_status==TRANSFORM_ROUNDING_STATUS_NEGATIVE){
+        entropy_u32=fractoid_u64_to_fakefloat_floor(entropy_copy.a, U32_BITS);
+      }else{
+        entropy_u32=fractoid_u64_to_fakefloat_ceil(entropy_copy.b, U32_BITS);
+      }
+      entropy_u32_list_base[entropy_u32_idx]=entropy_u32;
+      entropy_u32_idx++;
+    }
+  }while((entropy_x_idx++)!=entropy_x_idx_max);
+  entropy_ceiling=(entropy_ceiling<entropy_max_max)?entropy_max_max:entropy_ceiling;
+  thread_base->ceiling_u64=entropy_ceiling;
+  thread_base->max_max_u64=entropy_max_max;
+  thread_base->max_max_x_idx=entropy_max_max_x_idx;
+  thread_base->min_min_u64=entropy_min_min;
+  thread_base->min_min_x_idx=entropy_min_min_x_idx;
+  TRANSFORM_STATS_TIME_ADD(TRANSFORM_STATS_IDX_KERNEL_NS, stats_time);
+  TRANSFORM_STATS_ADD(TRANSFORM_STATS_IDX_FAKEFLOAT_COUNT, (entropy_u32_list_base?(entropy_x_idx_max-entropy_x_idx_min+1):0));
+  return status;
+}
+
+u8
+transform_entropy_delta_list_stripe_sum_get_fru128(entropy_t *entropy_base, ULONG entropy_x_idx_max, ULONG entropy_x_idx_min, transform_thread_t *thread_base, transform_t *transform_base){
+/*
+Sum, in modular arithmetic, the changes in entropy from each window position to the next across one stripe of a row, so that transform_entropy_delta_list_stripe_entropy_get_fru128() can find the entropy at the left edge of every stripe without summing the deltas of any other. Don't call here directly; use transform_dispatch_threaded() instead.
+
+In:
+
+  entropy_base is transform_malloc():Out:*entropy_base_base.
+
+  entropy_x_idx_max is the greatest column index of a window position in the stripe. On [entropy_x_idx_min, (entropy_base->fakefloat_x_idx_max)].
+
+  entropy_x_idx_min is the least column index of a window position in the stripe.
+
+  thread_base is the base of the transform_thread_t of the stripe.
+
+  transform_base is transform_malloc():Out:*transform_base_base, with entropy deltas which are already up to date for the row.
+
+Out:
+
+  Returns one if fracterval underflow or overflow occured (which is usually benign) else zero. This can only happen if entropy_x_idx_min is zero.
+
+  (thread_base->delta_max_u128) is the greatest upper limit of any entropy delta read on behalf of the stripe.
+
+  (thread_base->entropy_start_fru128) is, if entropy_x_idx_min is zero, the entropy at column zero, computed with saturation exactly as in transform_entropy_delta_list_line_entropy_get_fru128(). Otherwise it's unchanged.
+
+  (thread_base->entropy_sum_fru128) is the modular sum of the changes in entropy to each window position on [MAX(entropy_x_idx_min, 1), entropy_x_idx_max] from the one to its left. Because modular addition is associative, summing these over stripes in ascending order yields exactly the same bits as rolling the entropy across all of them one column at a time.
+*/
+  fru128 entropy;
+  fru128 entropy_delta;
+  fru128 *entropy_delta_list_base;
+  u128 entropy_delta_max;
+  fru128 entropy_delta_old;
+  fru128 entropy_sum;
+  ULONG entropy_x_idx;
+  TRANSFORM_STATS_DECLARE(stats_time)
+  u8 status;
+  ULONG whole_x_idx;
+  ULONG window_x_idx_max;
+
+  TRANSFORM_STATS_TIME_GET(stats_time);
+  status=0;
+  entropy_delta_list_base=transform_base->entropy_delta_fru128_list_base;
+  U128_SET_ZERO(entropy_delta_max);
+  U128_SET_ZERO(entropy_sum.a);
+  U128_SET_ZERO(entropy_sum.b);
+  window_x_idx_max=entropy_base->window_x_idx_max;
+  entropy_x_idx=entropy_x_idx_min;
+  if(entropy_x_idx){
+    entropy_x_idx--;
+  }else{
+    entropy=entropy_base->window_bias_fru128;
+    whole_x_idx=0;
+    do{
+      entropy_delta=entropy_delta_list_base[whole_x_idx];
+      if(U128_IS_LESS(entropy_delta_max, entropy_delta.b)){
+        entropy_delta_max=entropy_delta.b;
+      }
+      FRU128_SUBTRACT_FRU128_SELF(entropy, entropy_delta, status);
+    }while((whole_x_idx++)!=window_x_idx_max);
+    thread_base->entropy_start_fru128=entropy;
+  }
+  while(entropy_x_idx!=entropy_x_idx_max){
+    entropy_delta_old=entropy_delta_list_base[entropy_x_idx];
+    entropy_delta=entropy_delta_list_base[entropy_x_idx+window_x_idx_max+1];
+    if(U128_IS_LESS(entropy_delta_max, entropy_delta_old.b)){
+      entropy_delta_max=entropy_delta_old.b;
+    }
+    if(U128_IS_LESS(entropy_delta_max, entropy_delta.b)){
+      entropy_delta_max=entropy_delta.b;
+    }
+    FRU128_ADD_FRU128_SUBTRACT_FRU128_WRAP_SELF(entropy_sum, entropy_delta_old, entropy_delta);
+    entropy_x_idx++;
+  }
+  thread_base->delta_max_u128=entropy_delta_max;
+  thread_base->entropy_sum_fru128=entropy_sum;
+  TRANSFORM_STATS_TIME_ADD(TRANSFORM_STATS_IDX_KERNEL_NS, stats_time);
+  TRANSFORM_STATS_ADD(TRANSFORM_STATS_IDX_SATURATION_COUNT, status);
+  return status;
+}
+
+u8
+transform_entropy_delta_list_stripe_sum_get_fru64(entropy_t *entropy_base, ULONG entropy_x_idx_max, ULONG entropy_x_idx_min, transform_thread_t *thread_base, transform_t *transform_base){
+/*
+This is the 64-bit fracterval equivalent of transform_entropy_delta_list_stripe_sum_get_fru128(). Replace all occurrences of "128" with "64" in its definition.
+*/
+  fru64 entropy;
+  fru64 entropy_delta;
+  fru64 *entropy_delta_list_base;
+  u64 entropy_delta_max;
+  fru64 entropy_delta_old;
+  fru64 entropy_sum;
+  ULONG entropy_x_idx;
+  TRANSFORM_STATS_DECLARE(stats_time)
+  u8 status;
+  ULONG whole_x_idx;
+  ULONG window_x_idx_max;
+
+  TRANSFORM_STATS_TIME_GET(stats_time);
+  status=0;
+  entropy_delta_list_base=transform_base->entropy_delta_fru64_list_base;
+  entropy_delta_max=0;
+  entropy_sum.a=0;
+  entropy_sum.b=0;
+  window_x_idx_max=entropy_base->window_x_idx_max;
+  entropy_x_idx=entropy_x_idx_min;
+  if(entropy_x_idx){
+    entropy_x_idx--;
+  }else{
+    entropy=entropy_base->window_bias_fru64;
+    whole_x_idx=0;
+    do{
+      entropy_delta=entropy_delta_list_base[whole_x_idx];
+      entropy_delta_max=(entropy_delta_max<entropy_delta.b)?entropy_delta.b:entropy_delta_max;
+      FRU64_SUBTRACT_FRU64_SELF(entropy, entropy_delta, status);
+    }while((whole_x_idx++)!=window_x_idx_max);
+    thread_base->entropy_start_fru64=entropy;
+  }
+  while(entropy_x_idx!=entropy_x_idx_max){
+    entropy_delta_old=entropy_delta_list_base[entropy_x_idx];
+    entropy_delta=entropy_delta_list_base[entropy_x_idx+window_x_idx_max+1];
+    entropy_delta_max=(entropy_delta_max<entropy_delta_old.b)?entropy_delta_old.b:entropy_delta_max;
+    entropy_delta_max=(entropy_delta_max<entropy_delta.b)?entropy_delta.b:entropy_delta_max;
+    FRU64_ADD_FRU64_SUBTRACT_FRU64_WRAP_SELF(entropy_sum, entropy_delta_old, entropy_delta);
+    entropy_x_idx++;
+  }
+  thread_base->delta_max_u64=entropy_delta_max;
+  thread_base->entropy_sum_fru64=entropy_sum;
+  TRANSFORM_STATS_TIME_ADD(TRANSFORM_STATS_IDX_KERNEL_NS, stats_time);
+  TRANSFORM_STATS_ADD(TRANSFORM_STATS_IDX_SATURATION_COUNT, status);
+  return status;
+}
+
+u8
+transform_entropy_to_discount(entropy_t *entropy_base){
+/*
+Subtract min and max entropy values from the theoretical maximum window entropy, then exchange the (x, y) coordinates of the corresponding windows (because discounting inverts min and max).
+
+In:
+
+  entropy_base is transform_malloc():Out:*entropy_base_base.
+
+Out:
+
+  Returns one if fracterval underflow or overflow occured else zero. This can only occur if either (1) the upper bound of a computed entropy value was at least the maximum estimated entropy or (2) said maximum is actually less than its true value. Either way, the result is saturation to zero discount nats, which is probably benign if not exactly correct.
+
+  *entropy_base has been adjusted in the following items in order to reflect discount nats: max_max_u128, max_max_u64, max_max_x_idx, max_max_y_idx, min_min_u128, min_min_u64, min_min_x_idx, and min_min_y_idx. If (entropy_base->rank_status) is one, then every rank list entry has likewise been converted, and the min and max rank lists (with their coordinates, counts, and thresholds) have been exchanged, which preserves their respective sort orders.
+*/
+  fru128 entropy_fru128;
+  fru128 *entropy_fru128_list_base;
+  fru64 entropy_fru64;
+  fru64 *entropy_fru64_list_base;
+  ULONG entropy_idx;
+  fru128 entropy_max_max_max_fru128;
+  fru64 entropy_max_max_max_fru64;
+  u8 max_status;
+  ULONG rank_count;
+  ULONG rank_idx;
+  ULONG *rank_xy_list_base;
+  TRANSFORM_STATS_DECLARE(stats_time)
+  u8 status;
+  u64 term_u64;
+  u128 threshold_u128;
+  u64 threshold_u64;
+
+  TRANSFORM_STATS_TIME_GET(stats_time);
+  status=0;
+  term_u64=(u64)(entropy_base->window_x_idx_post);
+  entropy_max_max_max_fru128=entropy_base->window_max_max_fru128;
+  entropy_max_max_max_fru64=entropy_base->window_max_max_fru64;
+  if(!entropy_base->precise_status){
+    entropy_fru64.a=entropy_base->min_min_u64;
+    entropy_fru64.b=entropy_base->max_max_u64;
+    FRU64_SUBTRACT_FROM_FRU64_SELF(entropy_fru64, entropy_max_max_max_fru64, status);
+    FRU64_DIVIDE_U64_SELF(entropy_fru64, term_u64, status);
+    entropy_base->max_max_u64=entropy_fru64.b;
+    entropy_base->min_min_u64=entropy_fru64.a;
+  }else{
+    entropy_fru128.a=entropy_base->min_min_u128;
+    entropy_fru128.b=entropy_base->max_max_u128;
+    FRU128_SUBTRACT_FROM_FRU128_SELF(entropy_fru128, entropy_max_max_max_fru128, status);
+    FRU128_DIVIDE_U64_SELF(entropy_fru128, term_u64, status);
+    entropy_base->max_max_u128=entropy_fru128.b;
+    entropy_base->min_min_u128=entropy_fru128.a;
+  }
+  entropy_idx=entropy_base->max_max_x_idx;
+  entropy_base->max_max_x_idx=entropy_base->min_min_x_idx;
+  entropy_base->min_min_x_idx=entropy_idx;
+  entropy_idx=entropy_base->max_max_y_idx;
+  entropy_base->max_max_y_idx=entropy_base->min_min_y_idx;
+  entropy_base->min_min_y_idx=entropy_idx;
+  if(entropy_base->rank_status){
+    max_status=0;
+    do{
+      rank_count=entropy_base->rank_min_count;
+      entropy_fru128_list_base=entropy_base->rank_min_fru128_list_base;
+      entropy_fru64_list_base=entropy_base->rank_min_fru64_list_base;
+      if(max_status){
+        rank_count=entropy_base->rank_max_count;
+        entropy_fru128_list_base=entropy_base->rank_max_fru128_list_base;
+        entropy_fru64_list_base=entropy_base->rank_max_fru64_list_base;
+      }
+      rank_idx=0;
+      while(rank_idx!=rank_count){
+        if(!entropy_base->precise_status){
+          entropy_fru64=entropy_fru64_list_base[rank_idx];
+          FRU64_SUBTRACT_FROM_FRU64_SELF(entropy_fru64, entropy_max_max_max_fru64, status);
+          FRU64_DIVIDE_U64_SELF(entropy_fru64, term_u64, status);
+          entropy_fru64_list_base[rank_idx]=entropy_fru64;
+        }else{
+          entropy_fru128=entropy_fru128_list_base[rank_idx];
+          FRU128_SUBTRACT_FROM_FRU128_SELF(entropy_fru128, entropy_max_max_max_fru128, status);
+          FRU128_DIVIDE_U64_SELF(entropy_fru128, term_u64, status);
+          entropy_fru128_list_base[rank_idx]=entropy_fru128;
+        }
+        rank_idx++;
+      }
+    }while((max_status++)!=1);
+    entropy_fru128_list_base=entropy_base->rank_max_fru128_list_base;
+    entropy_base->rank_max_fru128_list_base=entropy_base->rank_min_fru128_list_base;
+    entropy_base->rank_min_fru128_list_base=entropy_fru128_list_base;
+    entropy_fru64_list_base=entropy_base->rank_max_fru64_list_base;
+    entropy_base->rank_max_fru64_list_base=entropy_base->rank_min_fru64_list_base;
+    entropy_base->rank_min_fru64_list_base=entropy_fru64_list_base;
+    rank_xy_list_base=entropy_base->rank_max_xy_list_base;
+    entropy_base->rank_max_xy_list_base=entropy_base->rank_min_xy_list_base;
+    entropy_base->rank_min_xy_list_base=rank_xy_list_base;
+    rank_count=entropy_base->rank_max_count;
+    entropy_base->rank_max_count=entropy_base->rank_min_count;
+    entropy_base->rank_min_count=rank_count;
+    threshold_u128=entropy_base->rank_max_threshold_u128;
+    entropy_base->rank_max_threshold_u128=entropy_base->rank_min_threshold_u128;
+    entropy_base->rank_min_threshold_u128=threshold_u128;
+    threshold_u64=entropy_base->rank_max_threshold_u64;
+    entropy_base->rank_max_threshold_u64=entropy_base->rank_min_threshold_u64;
+    entropy_base->rank_min_threshold_u64=threshold_u64;
+  }
+  TRANSFORM_STATS_TIME_ADD(TRANSFORM_STATS_IDX_OUTPUT_NS, stats_time);
+  return status;
+}
+
+u32 *
+transform_fakefloat_list_malloc(ULONG *fakefloat_list_size_base, ULONG whole_x_idx_max, ULONG whole_y_idx_max, ULONG window_x_idx_max, ULONG window_y_idx_max){
+/*
+Allocate an array of fakefloats ((u32)s which are bitwise equivalent to, but not identified as, floats).
+
+In:
+
+  *fakefloat_list_size_base is undefined.
+
+  whole_x_idx_max is the number of columns (channels) per row (spectrum) in the array of wholes to scan, less one.
+
+  whole_y_idx_max is the number of rows in the array of wholes to scan, less one.
+
+  window_x_idx_max is the number of columns (channels) per row (spectrum) in the window of wholes to scan, less one. On [0, whole_x_idx_max].
+
+  window_y_idx_max is the number of rows in the window of wholes to scan, less one. On [0, whole_y_idx_max].
+
+Out:
+
+  Returns NULL on failure, else the base of (whole_x_idx_max+1)*(whole_y_idx_max+1) fakefloat (u32)s.
+*/
+  ULONG fakefloat_idx_post;
+  u32 *fakefloat_list_base;
+  ULONG fakefloat_x_idx_post;
+  ULONG fakefloat_y_idx_post;
+  ULONG list_size;
+
+  fakefloat_list_base=NULL;
+  if((window_x_idx_max<=whole_x_idx_max)&&(window_y_idx_max<=whole_y_idx_max)){
+    fakefloat_x_idx_post=whole_x_idx_max-window_x_idx_max+1;
+    fakefloat_y_idx_post=whole_y_idx_max-window_y_idx_max+1;
+    fakefloat_idx_post=fakefloat_x_idx_post*fakefloat_y_idx_post;
+    if(fakefloat_idx_post&&((fakefloat_idx_post/fakefloat_x_idx_post)==fakefloat_y_idx_post)){
+      list_size=fakefloat_idx_post<<U32_SIZE_LOG2;
+      if((list_size>>U32_SIZE_LOG2)==fakefloat_idx_post){
+        *fakefloat_list_size_base=list_size;
+        fakefloat_list_base=DEBUG_MALLOC_PARANOID(list_size);
+      }
+    }
+  }
+  return fakefloat_list_base;
+}
+
+void *
+transform_free(void *base){
+/*
+To maximize portability and debuggability, this is the only function in which Transform calls free().
+
+In:
+
+  base is the base of a memory region to free. May be NULL.
+
+Out:
+
+  Returns NULL so that the caller can easily maintain the good practice of NULLing out invalid pointers.
+
+  *base is freed.
+*/
+  DEBUG_FREE_PARANOID(base);
+  return NULL;
+}
+
+void
+transform_free_all(entropy_t **entropy_base_base, transform_t **transform_base_base){
+/*
+Free all transform data structures.
+
+In:
+
+  entropy_base is transform_malloc():Out:*entropy_base_base. May be NULL only if transform_base is NULL.
+
+  transform_base is transform_malloc():Out:*transform_base_base. May be NULL.
+
+Out:
+
+  *entropy_base_base is NULL and all its children, including any rank lists allocated by transform_rank_init(), have been freed except for *fakefloat_list_base (because it was never the property of Transform).
+
+  *transform_base_base is NULL and all its children have been freed, except for lookup lists and any copy made by transform_transpose_init() if it was created by transform_clone().
+*/
+  entropy_t *entropy_base;
+  void *freq_list_base;
+  void **freq_list_base_list_base;
+  ULONG freq_list_idx;
+  ULONG *pop_list_base;
+  ULONG **pop_list_base_list_base;
+  transform_t *transform_base;
+
+  entropy_base=*entropy_base_base;
+  transform_base=*transform_base_base;
+  if(transform_base){
+    if(!entropy_base->precise_status){
+      if(!transform_base->clone_status){
+        fracterval_u64_free(transform_base->entropy_delta_delta_fru64_list_base);
+        transform_lookup_lists_free(transform_base);
+      }
+      fracterval_u64_free(transform_base->entropy_delta_fru64_list_base);
+    }else{
+      if(!transform_base->clone_status){
+        fracterval_u128_free(transform_base->entropy_delta_delta_fru128_list_base);
+        transform_lookup_lists_free(transform_base);
+      }
+      fracterval_u128_free(transform_base->entropy_delta_fru128_list_base);
+    }
+    freq_list_base_list_base=transform_base->freq_list_base_list_base;
+    pop_list_base_list_base=transform_base->pop_list_base_list_base;
+    if(freq_list_base_list_base){
+      freq_list_idx=transform_base->freq_list_idx_max;
+      do{
+        if(pop_list_base_list_base){
+          pop_list_base=pop_list_base_list_base[freq_list_idx];
+          DEBUG_FREE_PARANOID(pop_list_base);
+        }
+        freq_list_base=freq_list_base_list_base[freq_list_idx];
+        DEBUG_FREE_PARANOID(freq_list_base);
+      }while(freq_list_idx--);
+    }
+    if(!transform_base->clone_status){
+      DEBUG_FREE_PARANOID(transform_base->whole_transpose_u8_list_base);
+    }
+    DEBUG_FREE_PARANOID(transform_base->pop_list_best_best_base);
+    DEBUG_FREE_PARANOID(transform_base->pop_list_best_base);
+    DEBUG_FREE_PARANOID(pop_list_base_list_base);
+    DEBUG_FREE_PARANOID(freq_list_base_list_base);
+    DEBUG_FREE_PARANOID(transform_base->pop_list_base);
+    DEBUG_FREE_PARANOID(transform_base);
+    *transform_base_base=NULL;
+  }
+  entropy_base=*entropy_base_base;
+  if(entropy_base){
+    DEBUG_FREE_PARANOID(entropy_base->hit_list_base);
+    fracterval_u128_free(entropy_base->rank_max_fru128_list_base);
+    fracterval_u64_free(entropy_base->rank_max_fru64_list_base);
+    DEBUG_FREE_PARANOID(entropy_base->rank_max_xy_list_base);
+    fracterval_u128_free(entropy_base->rank_min_fru128_list_base);
+    fracterval_u64_free(entropy_base->rank_min_fru64_list_base);
+    DEBUG_FREE_PARANOID(entropy_base->rank_min_xy_list_base);
+    fracterval_u128_free(entropy_base->rank_row_fru128_list_base);
+    fracterval_u64_free(entropy_base->rank_row_fru64_list_base);
+  }
+  DEBUG_FREE_PARANOID(entropy_base);
+  *entropy_base_base=NULL;
+  return;
+}
+
+void
+transform_freq_list_zero(void *freq_list_base, u8 freq_size_log2, u32 whole_max_max){
+/*
+Zero a frequency list.
+
+In:
+
+  *freq_list_base is a frequency list as defined in transform_freq_list_entropy_get_fru128():In.
+
+  freq_size_log2 is as defined in transform_freq_list_entropy_get_fru128():In.
+
+  whole_max_max is the maximum index of *freq_list_base.
+
+Out:
+
+  *freq_list_base is zero on [0, whole_max_max].
+*/
+  ULONG list_size;
+
+  list_size=((ULONG)(whole_max_max)+1)<<freq_size_log2;
+  memset(freq_list_base, 0, list_size);
+  return;
+}
+
+u8
+transform_freq_list_entropy_get_fru128(u8 algo_status, fru128 *entropy_fru128_base, void *freq_list_base, u8 freq_size_log2, fru128 *lookup_list_base, ULONG *pop_list_base, ULONG whole_idx_max, u32 whole_max_max){
+/*
+Get the entropy delta implied by a frequency list, which the caller must then subtract from the entropy bias, for example, from (entropy_base->window_bias_fru128), in order to obtain entropy.
+
+In:
+
+  algo_status is one of the TRANSFORM_ALGO_STATUS constants, which implies which definition of entropy to use.
+
+  *entropy_fru128_base is undefined.
+
+  *freq_list_base contains the frequency (occurrences count) each corresponding whole on [0, whole_max_max].
+
+  freq_size_log2 is (transform_base->freq_size_log2), which gives the size of each frequency at freq_list_base.
+
+  *lookup_list_base is (transform_base->log_fru128_list_base) for (algo_status==TRANSFORM_ALGO_STATUS_SHANNON) or (transform_base->log_factorial_fru128_list_base) otherwise, as initialized by transform_lookup_lists_init().
+
+  *pop_list_base is writable on [0, whole_idx_max+1].
+
+  whole_idx_max is sum of all of *freq_list_base, less one.
+
+  whole_max_max is the maximum index of *freq_list_base.
+
+Out:
+
+  Returns one if fracterval underflow or overflow occured (which is usually benign) else zero.
+
+  *entropy_fru128_list_base is the entropy delta described in the summary, as determined according to algo_status.
+*/
+  u8 status;
+
+  transform_pop_list_fill(freq_list_base, freq_size_log2, pop_list_base, whole_idx_max, whole_max_max);
+  status=transform_pop_list_entropy_get_fru128(algo_status, entropy_fru128_base, lookup_list_base, pop_list_base, whole_idx_max);
+  return status;
+}
+
+u8
+transform_freq_list_entropy_get_fru64(u8 algo_status, fru64 *entropy_fru64_base, void *freq_list_base, u8 freq_size_log2, fru64 *lookup_list_base, ULONG *pop_list_base, ULONG whole_idx_max, u32 whole_max_max){
+/*
+This is the 64-bit fracterval equivalent of transform_freq_list_entropy_get_fru128(). Replace all occurrences of "128" with "64" in its definition.
+*/
+  u8 status;
+
+  transform_pop_list_fill(freq_list_base, freq_size_log2, pop_list_base, whole_idx_max, whole_max_max);
+  status=transform_pop_list_entropy_get_fru64(algo_status, entropy_fru64_base, lookup_list_base, pop_list_base, whole_idx_max);
+  return status;
+}
+
+u8
+transform_hit_init(entropy_t *entropy_base, u8 max_status, u128 threshold_u128, u64 threshold_u64){
+/*
+Enable collection of the windows whose entropies cross a threshold during subsequent calls to transform_dispatch_row_span() (via transform_dispatch()) or transform_dispatch_stream(), so that the caller can output only those windows instead of the entire array of fakefloats. This may be called once with max_status zero and once with max_status one in order to collect windows beyond either of two thresholds.
+
+In:
+
+  entropy_base is transform_malloc():Out:*entropy_base_base. It must not have been created by transform_clone() or transform_entropy_clone(), and thread_idx_max must be zero on any call to transform_dispatch_threaded().
+
+  max_status is one to collect windows whose mean entropy is at least the threshold, else zero to collect those whose mean entropy is at most the threshold.
+
+  threshold_u128 is the threshold as a 64.64 fixed-point value if (entropy_base->precise_status) is one, else ignored. It's expressed in the same units as the fakefloats, so if (entropy_base->discount_status) is one, then it's in discount nats below (entropy_base->window_max_max_fru128).
+
+  threshold_u64 is the 32.32 equivalent of threshold_u128, used if (entropy_base->precise_status) is zero.
+
+Out:
+
+  Returns one if allocation failed, else zero. Either way, everything allocated will be freed by transform_free_all().
+
+  After each subsequent dispatch, (entropy_base->hit_list_base) contains (entropy_base->hit_count) transform_hit_t records in row-major order, one for each window whose mean entropy crossed either threshold. The caller should consume them and then set (entropy_base->hit_count) to zero, or they will accumulate. If (entropy_base->hit_fail_status) is one, then the list could not be grown, and the records which didn't fit have been lost.
+*/
+  ULONG fakefloat_x_idx_max;
+  ULONG list_size;
+  u8 status;
+
+  fakefloat_x_idx_max=entropy_base->fakefloat_x_idx_max;
+  if(!max_status){
+    entropy_base->hit_min_status=1;
+    entropy_base->hit_min_threshold_u128=threshold_u128;
+    entropy_base->hit_min_threshold_u64=threshold_u64;
+  }else{
+    entropy_base->hit_max_status=1;
+    entropy_base->hit_max_threshold_u128=threshold_u128;
+    entropy_base->hit_max_threshold_u64=threshold_u64;
+  }
+  status=0;
+  if(!entropy_base->hit_list_base){
+/*
+Start with room for one row of hits. transform_hit_row_update() will double it as required.
+*/
+    entropy_base->hit_count=0;
+    entropy_base->hit_fail_status=0;
+    entropy_base->hit_idx_max=fakefloat_x_idx_max;
+    list_size=(fakefloat_x_idx_max+1)*(ULONG)(sizeof(transform_hit_t));
+    status=1;
+    if((list_size/(ULONG)(sizeof(transform_hit_t)))==(fakefloat_x_idx_max+1)){
+      entropy_base->hit_list_base=DEBUG_MALLOC_PARANOID(list_size);
+      status=!entropy_base->hit_list_base;
+    }
+  }
+/*
+The line entropy functions leave the window entropies of each row in the same list used by transform_rank_row_update(), so share it if it exists.
+*/
+  if(!entropy_base->precise_status){
+    if(!entropy_base->rank_row_fru64_list_base){
+      entropy_base->rank_row_fru64_list_base=fracterval_u64_list_malloc(fakefloat_x_idx_max);
+      status=(u8)(status|!entropy_base->rank_row_fru64_list_base);
+    }
+  }else{
+    if(!entropy_base->rank_row_fru128_list_base){
+      entropy_base->rank_row_fru128_list_base=fracterval_u128_list_malloc(fakefloat_x_idx_max);
+      status=(u8)(status|!entropy_base->rank_row_fru128_list_base);
+    }
+  }
+  return status;
+}
+
+u8
+transform_hit_row_update(entropy_t *entropy_base, ULONG whole_y_idx){
+/*
+Append a record to the hit list for every window in a row whose entropy crosses a threshold. Don't call here directly; use transform_dispatch() or transform_dispatch_stream() instead.
+
+In:
+
+  entropy_base is transform_hit_init():In:entropy_base. (entropy_base->rank_row_fru*_list_base) must contain the window entropies of the row, as left there by the most recent line entropy computation.
+
+  whole_y_idx is the row index.
+
+Out:
+
+  Returns one if fracterval underflow occurred during conversion to discount nats, as described in transform_entropy_to_discount():Out, else zero.
+
+  The hit list has been updated as transform_hit_init():Out describes.
+*/
+  u8 discount_status;
+  fru128 entropy_fru128;
+  fru128 *entropy_fru128_list_base;
+  fru64 entropy_fru64;
+  fru64 *entropy_fru64_list_base;
+  fru128 entropy_max_max_max_fru128;
+  fru64 entropy_max_max_max_fru64;
+  u32 entropy_max_u32;
+  u32 entropy_min_u32;
+  ULONG entropy_x_idx;
+  ULONG entropy_x_idx_max;
+  ULONG hit_count;
+  ULONG hit_idx_max;
+  transform_hit_t *hit_list_base;
+  transform_hit_t *hit_list_base_new;
+  u8 hit_max_status;
+  u8 hit_min_status;
+  u8 hit_status;
+  ULONG list_size;
+  u128 mean_u128;
+  u64 mean_u64;
+  TRANSFORM_STATS_DECLARE(stats_time)
+  u8 status;
+
+  TRANSFORM_STATS_TIME_GET(stats_time);
+  discount_status=entropy_base->discount_status;
+  entropy_max_max_max_fru128=entropy_base->window_max_max_fru128;
+  entropy_max_max_max_fru64=entropy_base->window_max_max_fru64;
+  entropy_x_idx=0;
+  entropy_x_idx_max=entropy_base->fakefloat_x_idx_max;
+  entropy_fru128_list_base=entropy_base->rank_row_fru128_list_base;
+  entropy_fru64_list_base=entropy_base->rank_row_fru64_list_base;
+  hit_count=entropy_base->hit_count;
+  hit_idx_max=entropy_base->hit_idx_max;
+  hit_list_base=entropy_base->hit_list_base;
+  hit_max_status=entropy_base->hit_max_status;
+  hit_min_status=entropy_base->hit_min_status;
+  status=0;
+  do{
+/*
+Compare the mean in the units of the fakefloats, so that a window is a hit if and only if the fakefloat which would have been written for it crosses the threshold (to within rounding).
+*/
+    if(!entropy_base->precise_status){
+      entropy_fru64=entropy_fru64_list_base[entropy_x_idx];
+      if(discount_status){
+        FRU64_SUBTRACT_FROM_FRU64_SELF(entropy_fru64, entropy_max_max_max_fru64, status);
+      }
+      FRU64_MEAN_TO_FTD64(mean_u64, entropy_fru64);
+      hit_status=(u8)(hit_min_status&&(mean_u64<=entropy_base->hit_min_threshold_u64));
+      hit_status=(u8)(hit_status|(hit_max_status&&(entropy_base->hit_max_threshold_u64<=mean_u64)));
+      if(hit_status){
+        entropy_max_u32=fractoid_u64_to_fakefloat_ceil(entropy_fru64.b, U32_BITS);
+        entropy_min_u32=fractoid_u64_to_fakefloat_floor(entropy_fru64.a, U32_BITS);
+      }
+    }else{
+      entropy_fru128=entropy_fru128_list_base[entropy_x_idx];
+      if(discount_status){
+        FRU128_SUBTRACT_FROM_FRU128_SELF(entropy_fru128, entropy_max_max_max_fru128, status);
+      }
+      FRU128_MEAN_TO_FTD128(mean_u128, entropy_fru128);
+      hit_status=(u8)(hit_min_status&&U128_IS_LESS_EQUAL(mean_u128, entropy_base->hit_min_threshold_u128));
+      hit_status=(u8)(hit_status|(hit_max_status&&U128_IS_LESS_EQUAL(entropy_base->hit_max_threshold_u128, mean_u128)));
+      if(hit_status){
+        entropy_max_u32=fractoid_u128_to_fakefloat_ceil(entropy_fru128.b, U64_BITS);
+        entropy_min_u32=fractoid_u128_to_fakefloat_floor(entropy_fru128.a, U64_BITS);
+      }
+    }
+    if(hit_status){
+      if(hit_count>hit_idx_max){
+        hit_list_base_new=NULL;
+        list_size=((hit_idx_max+1)<<1)*(ULONG)(sizeof(transform_hit_t));
+        if((list_size/(ULONG)(sizeof(transform_hit_t)))==((hit_idx_max+1)<<1)){
+          hit_list_base_new=DEBUG_REALLOC_PARANOID(hit_list_base, list_size);
+        }
+        if(!hit_list_base_new){
+          entropy_base->hit_fail_status=1;
+          break;
+        }
+        hit_idx_max=(hit_idx_max<<1)+1;
+        hit_list_base=hit_list_base_new;
+      }
+      hit_list_base[hit_count].x_idx=(u64)(entropy_x_idx);
+      hit_list_base[hit_count].y_idx=(u64)(whole_y_idx);
+      hit_list_base[hit_count].entropy_max_u32=entropy_max_u32;
+      hit_list_base[hit_count].entropy_min_u32=entropy_min_u32;
+      hit_count++;
+    }
+  }while((entropy_x_idx++)!=entropy_x_idx_max);
+  TRANSFORM_STATS_ADD(TRANSFORM_STATS_IDX_FAKEFLOAT_COUNT, (hit_count-entropy_base->hit_count)<<1);
+  entropy_base->hit_count=hit_count;
+  entropy_base->hit_idx_max=hit_idx_max;
+  entropy_base->hit_list_base=hit_list_base;
+  TRANSFORM_STATS_TIME_ADD(TRANSFORM_STATS_IDX_OUTPUT_NS, stats_time);
+  return status;
+}
+
+u8
+transform_init(u32 build_break_count, u32 build_feature_count){
+/*
+Verify that the source code is sufficiently updated.
+
+In:
+
+  build_break_count is the caller's most recent knowledge of TRANSFORM_BUILD_BREAK_COUNT, which will fail if the caller is unaware of all critical updates.
+
+  build_feature_count is the caller's most recent knowledge of TRANSFORM_BUILD_FEATURE_COUNT, which will fail if this library is not up to date with the caller's expectations.
+
+Out:
+
+  Returns one if (build_break_count!=TRANSFORM_BUILD_BREAK_COUNT) or (build_feature_count>TRANSFORM_BUILD_FEATURE_COUNT), or if filesys_init(), fracterval_u128_init(), or fracterval_u64_init() fails. Otherwise, returns zero.
+*/
+  u8 filesys_status;
+  u8 fracterval_u128_status;
+  u8 fracterval_u64_status;
+  u8 status;
+
+  filesys_status=filesys_init(FILESYS_BUILD_BREAK_COUNT_EXPECTED, 5);
+  fracterval_u128_status=fracterval_u128_init(FRU128_BUILD_BREAK_COUNT_EXPECTED, 4);
+  fracterval_u64_status=fracterval_u64_init(FRU64_BUILD_BREAK_COUNT_EXPECTED, 3);
+  status=(u8)(filesys_status|fracterval_u128_status|fracterval_u64_status);
+  status=(u8)(status|(build_break_count!=TRANSFORM_BUILD_BREAK_COUNT));
+  status=(u8)(status|(TRANSFORM_BUILD_FEATURE_COUNT<build_feature_count));
+  return status;
+}
+
+u8
+transform_logfreedom_max_approximate(u32 iteration_max, fru128 *logfreedom_max_base, transform_t *transform_base, ULONG whole_idx_max, u32 whole_max_max){
+/*
+From its definition, approximate maximum possible logfreedom for a given whole_idx_max (Q-1) and whole_max_max (Z-1). Do this with a heuristic involving a iterations of gradient descent followed by population perturbation. This was adapted from existing debugged code in Dyspoissometer but has been improved to converge to the global maximum in all tested cases. The result is deterministic. Call transform_logfreedom_max_get() instead in order to take advantage of any memo file.
+
+In:
+
+  iteration is the number of genetic iterations to perform, less one. The largest iteration_max observed in testing was less than 10, but could be somewhat larger in rare cases involving huge datasets. U64_BITS would seem to be a conservative upper bound over all values of Q and Z supported by Transform.
+
+  *logfreedom_max_base is undefined.
+
+  transform_base is transform_malloc():Out:*transform_base_base, for which algo_status was TRANSFORM_ALGO_STATUS_LOGFREEDOM.
+
+  whole_idx_max is the number of wholes in a window, less one. On [1, transform_malloc():In:window_y_idx_max].
+
+  whole_max_max is the maximum possible whole. On [0, transform_malloc():In:whole_max_max].
+
+Out:
+
+  Returns one if fracterval underflow or overflow occured (which should be regarded as a fatal error in this particular case) else zero.
+
+  *logfreedom_max_base is a 64.64 fixed-point, expressed as a 128-bit fracterval, which is virtually certain to contain the actual maximum possible logfreedom. There is a theoretical chance that the latter lies above the upper limit, but no chance that it lies below the lower limit.
+*/
+  fru128 freq_expression_minus;
+  fru128 freq_expression_plus;
+  ULONG freq_delta;
+  ULONG freq_down_right;
+  ULONG freq_max;
+  ULONG freq_max_max;
+  ULONG freq_min;
+  ULONG freq_min_min;
+  ULONG freq_span;
+  ULONG freq_up_left;
+  u32 iteration;
+  fru128 *log_factorial_list_base;
+  fru128 *log_list_base;
+  fru128 logfreedom_best;
+  fru128 logfreedom_best_best;
+  fru128 logfreedom_delta_delta_minus;
+  fru128 logfreedom_delta_delta_plus;
+  fru128 logfreedom_delta_minus;
+  fru128 logfreedom_delta_plus;
+  fru128 logfreedom_delta_sum_minus;
+  fru128 logfreedom_delta_sum_plus;
+  u32 marsaglia_c;
+  u32 marsaglia_x;
+  u128 mean_minus;
+  u128 mean_plus;
+  ULONG pop_delta;
+  ULONG pop_delta_max;
+  ULONG pop_delta_max_minus_1;
+  ULONG pop_delta_min;
+  ULONG pop_down_left;
+  ULONG pop_down_right;
+  ULONG pop_freq_max;
+  ULONG pop_freq_min;
+  ULONG pop_up_left;
+  ULONG pop_up_right;
+  ULONG *pop_list_base;
+  ULONG *pop_list_best_base;
+  ULONG *pop_list_best_best_base;
+  ULONG pop_list_size;
+  u8 progress_status;
+  u64 random;
+  TRANSFORM_STATS_DECLARE(stats_time)
+  u8 status;
+  u8 status_delta;
+  u64 term_u64;
+  fru128 term_fru128;
+  ULONG whole_count;
+  ULONG whole_span_max;
+
+  TRANSFORM_STATS_TIME_GET(stats_time);
+  log_factorial_list_base=transform_base->log_factorial_fru128_list_base;
+  log_list_base=transform_base->log_fru128_list_base;
+  pop_list_base=transform_base->pop_list_base;
+  pop_list_best_base=transform_base->pop_list_best_base;
+  pop_list_best_best_base=transform_base->pop_list_best_best_base;
+  iteration=0;
+  random=0;
+  random=~random;
+  whole_count=whole_idx_max+1;
+  whole_span_max=(ULONG)(whole_max_max)+1;
+  freq_max=whole_count/whole_span_max;
+  freq_min=freq_max;
+  pop_freq_max=whole_count%whole_span_max;
+  pop_freq_min=whole_span_max;
+  if(pop_freq_max){
+    freq_max++;
+    pop_freq_min-=pop_freq_max;
+  }
+  freq_max_max=freq_max;
+  freq_min_min=freq_min;
+  pop_list_size=(whole_count+1)<<ULONG_SIZE_LOG2;
+  memset(pop_list_base, 0, (size_t)(pop_list_size));
+  memset(pop_list_best_base, 0, (size_t)(pop_list_size));
+  memset(pop_list_best_best_base, 0, (size_t)(pop_list_size));
+  pop_list_base[freq_max]=pop_freq_max;
+  pop_list_base[freq_min]=pop_freq_min;
+  pop_list_best_best_base[freq_max]=pop_freq_max;
+  pop_list_best_best_base[freq_min]=pop_freq_min;
+  status=transform_pop_list_logfreedom_get(log_factorial_list_base, &logfreedom_best_best, pop_list_base, whole_idx_max, whole_max_max);
+  do{
+    do{
+      progress_status=0;
+      pop_list_size=(freq_max_max-freq_min_min+1)<<ULONG_SIZE_LOG2;
+      memcpy(&pop_list_best_base[freq_min_min], &pop_list_base[freq_min_min], (size_t)(pop_list_size));
+      freq_up_left=freq_min;
+      do{
+        freq_down_right=freq_min+!freq_min;
+        do{
+          pop_up_left=pop_list_base[freq_up_left];
+          if(!pop_up_left){
+            break;
+          }
+          pop_down_right=pop_list_base[freq_down_right];
+          pop_down_left=pop_list_base[freq_down_right-1];
+          pop_up_right=pop_list_base[freq_up_left+1];
+          if(pop_down_right&&(((freq_down_right-1)!=freq_up_left)&&((pop_down_right!=1)||(freq_down_right!=freq_up_left)))){
+/*
+The following logfreedom gradient descent code was adapted from dyspoissometer_logfreedom_max_get() in Dyspoissometer, which explains all the transformations.
+*/
+            freq_delta=freq_down_right-freq_up_left;
+            FRU128_SET_ZERO(logfreedom_delta_sum_minus);
+            FRU128_SET_ZERO(logfreedom_delta_sum_plus);
+            freq_expression_minus=log_list_base[freq_up_left+1];
+            freq_expression_plus=log_list_base[freq_down_right];
+            logfreedom_delta_minus=log_list_base[pop_down_left+1];
+            FRU128_ADD_FRU128_SELF(logfreedom_delta_minus, freq_expression_minus, status);
+            logfreedom_delta_plus=freq_expression_plus;
+            pop_delta_max=MIN(pop_down_right, pop_up_left);
+            pop_delta_min=1;
+            if(2<freq_delta){
+              term_fru128=log_list_base[pop_down_right];
+              FRU128_ADD_FRU128_SELF(logfreedom_delta_plus, term_fru128, status);
+              term_fru128=log_list_base[pop_up_left];
+              FRU128_ADD_FRU128_SELF(logfreedom_delta_plus, term_fru128, status);
+              term_fru128=log_list_base[pop_up_right+1];
+              FRU128_ADD_FRU128_SELF(logfreedom_delta_minus, term_fru128, status);
+            }else if(!freq_delta){
+              pop_delta_max>>=1;
+              term_fru128=log_list_base[pop_down_right];
+              FRU128_ADD_FRU128_SELF(logfreedom_delta_plus, term_fru128, status);
+              term_fru128=log_list_base[pop_down_right-1];
+              FRU128_ADD_FRU128_SELF(logfreedom_delta_plus, term_fru128, status);
+              term_fru128=log_list_base[pop_up_right+1];
+              FRU128_ADD_FRU128_SELF(logfreedom_delta_minus, term_fru128, status);
+            }else{
+              term_fru128=log_list_base[pop_down_left+2];
+              FRU128_ADD_FRU128_SELF(logfreedom_delta_minus, term_fru128, status);
+              term_fru128=log_list_base[pop_down_right];
+              FRU128_ADD_FRU128_SELF(logfreedom_delta_plus, term_fru128, status);
+              term_fru128=log_list_base[pop_up_left];
+              FRU128_ADD_FRU128_SELF(logfreedom_delta_plus, term_fru128, status);
+            }
+            pop_delta_max_minus_1=pop_delta_max-pop_delta_min;
+            if(pop_delta_max_minus_1){
+              logfreedom_delta_delta_minus=freq_expression_minus;
+              logfreedom_delta_delta_plus=freq_expression_plus;
+              if(2<freq_delta){
+                term_fru128=log_list_base[pop_down_left+2];
+                FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_minus, term_fru128, status);
+                term_fru128=log_list_base[pop_down_right-1];
+                FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_plus, term_fru128, status);
+                term_fru128=log_list_base[pop_up_right+2];
+                FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_minus, term_fru128, status);
+                term_fru128=log_list_base[pop_up_left-1];
+                FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_plus, term_fru128, status);
+              }else if(!freq_delta){
+                term_fru128=log_list_base[pop_down_left+2];
+                FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_minus, term_fru128, status);
+                term_fru128=log_list_base[pop_down_right-3];
+                FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_plus, term_fru128, status);
+                term_fru128=log_list_base[pop_down_right-2];
+                FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_plus, term_fru128, status);
+                term_fru128=log_list_base[pop_up_right+2];
+                FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_minus, term_fru128, status);
+              }else{
+                term_fru128=log_list_base[pop_down_left+3];
+                FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_minus, term_fru128, status);
+                term_fru128=log_list_base[pop_down_left+4];
+                FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_minus, term_fru128, status);
+                term_fru128=log_list_base[pop_down_right-1];
+                FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_plus, term_fru128, status);
+                term_fru128=log_list_base[pop_up_left-1];
+                FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_plus, term_fru128, status);
+              }
+              FRU128_MEAN_TO_FTD128(mean_minus, logfreedom_delta_delta_minus);
+              FRU128_MEAN_TO_FTD128(mean_plus, logfreedom_delta_delta_plus);
+              if(U128_IS_LESS(mean_minus, mean_plus)){
+                while(pop_delta_max_minus_1!=pop_delta_min){
+                  pop_delta=pop_delta_max_minus_1-((pop_delta_max_minus_1-pop_delta_min)>>1);
+                  logfreedom_delta_delta_minus=freq_expression_minus;
+                  logfreedom_delta_delta_plus=freq_expression_plus;
+                  if(2<freq_delta){
+                    term_fru128=log_list_base[pop_down_left+pop_delta+1];
+                    FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_minus, term_fru128, status);
+                    term_fru128=log_list_base[pop_up_right+pop_delta+1];
+                    FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_minus, term_fru128, status);
+                    term_fru128=log_list_base[pop_down_right-pop_delta];
+                    FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_plus, term_fru128, status);
+                    term_fru128=log_list_base[pop_up_left-pop_delta];
+                    FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_plus, term_fru128, status);
+                  }else if(!freq_delta){
+                    term_fru128=log_list_base[pop_down_left+pop_delta+1];
+                    FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_minus, term_fru128, status);
+                    term_fru128=log_list_base[pop_up_right+pop_delta+1];
+                    FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_minus, term_fru128, status);
+                    term_fru128=log_list_base[pop_down_right-(pop_delta<<1)-1];
+                    FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_plus, term_fru128, status);
+                    term_fru128=log_list_base[pop_down_right-(pop_delta<<1)];
+                    FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_plus, term_fru128, status);
+                  }else{
+                    term_fru128=log_list_base[pop_down_left+(pop_delta<<1)+1];
+                    FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_minus, term_fru128, status);
+                    term_fru128=log_list_base[pop_down_left+(pop_delta<<1)+2];
+                    FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_minus, term_fru128, status);
+                    term_fru128=log_list_base[pop_down_right-pop_delta];
+                    FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_plus, term_fru128, status);
+                    term_fru128=log_list_base[pop_up_left-pop_delta];
+                    FRU128_ADD_FRU128_SELF(logfreedom_delta_delta_plus, term_fru128, status);
+                  }
+                  FRU128_MEAN_TO_FTD128(mean_minus, logfreedom_delta_delta_minus);
+                  FRU128_MEAN_TO_FTD128(mean_plus, logfreedom_delta_delta_plus);
+                  if(U128_IS_LESS(mean_minus, mean_plus)){
+                    pop_delta_min=pop_delta;
+                  }else{
+                    pop_delta_max_minus_1=pop_delta-1;
+                  }
+                }
+                pop_delta_min++;
+              }
+            }
+            pop_delta=pop_delta_min;
+            term_u64=pop_delta;
+            FRU128_MULTIPLY_U64(logfreedom_delta_minus, freq_expression_minus, term_u64, status);
+            FRU128_MULTIPLY_U64(logfreedom_delta_plus, freq_expression_plus, term_u64, status);
+            term_fru128=log_factorial_list_base[pop_down_left];
+            FRU128_ADD_FRU128_SELF(logfreedom_delta_plus, term_fru128, status);
+            term_fru128=log_factorial_list_base[pop_down_right];
+            FRU128_ADD_FRU128_SELF(logfreedom_delta_plus, term_fru128, status);
+            if(2<freq_delta){
+              term_fru128=log_factorial_list_base[pop_up_left];
+              FRU128_ADD_FRU128_SELF(logfreedom_delta_plus, term_fru128, status);
+              term_fru128=log_factorial_list_base[pop_up_right];
+              FRU128_ADD_FRU128_SELF(logfreedom_delta_plus, term_fru128, status);
+              pop_down_left+=pop_delta;
+              pop_down_right-=pop_delta;
+              pop_up_left-=pop_delta;
+              pop_up_right+=pop_delta;
+              term_fru128=log_factorial_list_base[pop_down_left];
+              FRU128_ADD_FRU128_SELF(logfreedom_delta_minus, term_fru128, status);
+              term_fru128=log_factorial_list_base[pop_down_right];
+              FRU128_ADD_FRU128_SELF(logfreedom_delta_minus, term_fru128, status);
+              term_fru128=log_factorial_list_base[pop_up_left];
+              FRU128_ADD_FRU128_SELF(logfreedom_delta_minus, term_fru128, status);
+              term_fru128=log_factorial_list_base[pop_up_right];
+              FRU128_ADD_FRU128_SELF(logfreedom_delta_minus, term_fru128, status);
+            }else if(!freq_delta){
+              term_fru128=log_factorial_list_base[pop_up_right];
+              FRU128_ADD_FRU128_SELF(logfreedom_delta_plus, term_fru128, status);
+              pop_down_left+=pop_delta;
               pop_down_right-=pop_delta<<1;
               pop_up_left=pop_down_right;
               pop_up_right+=pop_delta;
@@ -854,1218 +3296,2626 @@ The following logfreedom gradient descent code was adapted from dyspoissometer_l
               FRU128_ADD_FRU128_SELF(logfreedom_delta_minus, term_fru128, status);
             }
 /*
-At this point, Dyspoissometer updates all the affected populations, regardless of whether the logfreedom increased or not. This is done to provide a degree of noise in order to avoid getting stuck in local minima. But here, we won't do so unless the logfreedom increases, simply because we have explicit randomization following each gradient descent.
+At this point, Dyspoissometer updates all the affected populations, regardless of whether the logfreedom increased or not. This is done to provide a degree of noise in order to avoid getting stuck in local minima. But here, we won't do so unless the logfreedom increases, simply because we have explicit randomization following each gradient descent.
+*/
+            FRU128_ADD_FRU128_SELF(logfreedom_delta_sum_minus, logfreedom_delta_minus, status);
+            FRU128_ADD_FRU128_SELF(logfreedom_delta_sum_plus, logfreedom_delta_plus, status);
+            FRU128_MEAN_TO_FTD128(mean_minus, logfreedom_delta_sum_minus);
+            FRU128_MEAN_TO_FTD128(mean_plus, logfreedom_delta_sum_plus);
+            if(U128_IS_LESS(mean_minus, mean_plus)){
+              pop_list_base[freq_down_right-1]=pop_down_left;
+              pop_list_base[freq_down_right]=pop_down_right;
+              pop_list_base[freq_up_left]=pop_up_left;
+              pop_list_base[freq_up_left+1]=pop_up_right;
+/*
+Decrement freq_min and/or increment freq_max if necessary, which in general will leave some possible values of (freq_down_right, freq_up_left) unexplored, but that's OK because this is just a heuristic. Then prepare to copy *pop_list_base to *pop_list_best_base as efficiently as possible (because it might be huge and full of zeroes).
+*/
+              freq_max+=(freq_up_left==freq_max);
+              freq_max_max=MAX(freq_max, freq_max_max);
+              freq_min-=(freq_down_right==freq_min);
+              freq_min_min=MIN(freq_min, freq_min_min);              
+              pop_list_size=(freq_max_max-freq_min_min+1)<<ULONG_SIZE_LOG2;
+              memcpy(&pop_list_best_base[freq_min_min], &pop_list_base[freq_min_min], (size_t)(pop_list_size));
+              FRU128_SET_ZERO(logfreedom_delta_sum_minus);
+              FRU128_SET_ZERO(logfreedom_delta_sum_plus);
+              progress_status=1;
+            }
+          }
+        }while((freq_down_right++)!=freq_max);
+      }while((freq_up_left!=freq_max)&&((++freq_up_left)!=whole_count));
+    }while(progress_status);
+    status_delta=transform_pop_list_logfreedom_get(log_factorial_list_base, &logfreedom_best, pop_list_best_base, whole_idx_max, whole_max_max);
+    status=(u8)(status|status_delta);
+    FRU128_MEAN_TO_FTD128(mean_minus, logfreedom_best_best);
+    FRU128_MEAN_TO_FTD128(mean_plus, logfreedom_best);
+    if(U128_IS_LESS(mean_minus, mean_plus)){
+      logfreedom_best_best=logfreedom_best;
+      pop_list_size=(freq_max_max-freq_min_min+1)<<ULONG_SIZE_LOG2;
+      memcpy(&pop_list_best_best_base[freq_min_min], &pop_list_best_base[freq_min_min], (size_t)(pop_list_size));
+    }
+/*
+Randomly perturb *pop_list_base so that we'll hopefully be able to settle into a deeper maximum on the next iteration. (We don't want to permute *pop_list_best_best_base because that's too narrow.)
+*/
+    freq_up_left=freq_min;
+    do{
+      pop_up_left=pop_list_base[freq_up_left];
+      if(pop_up_left){
+        freq_down_right=freq_min+!freq_min;
+        freq_span=freq_max-freq_down_right;
+        if(freq_span){
+          MARSAGLIA_ITERATE(marsaglia_c, marsaglia_x, random);
+          freq_down_right+=(ULONG)(random%freq_span);
+        }
+        if((freq_down_right-1)!=freq_up_left){
+          pop_down_right=pop_list_base[freq_down_right];
+          pop_delta_max=MIN(pop_down_right, pop_up_left);
+          if(freq_down_right==freq_up_left){
+            pop_delta_max>>=1;
+          }
+          if(pop_delta_max){
+            MARSAGLIA_ITERATE(marsaglia_c, marsaglia_x, random);
+            pop_delta=(ULONG)(random%pop_delta_max)+1;
+/*
+Move pop_delta population units from freq_down_right to (freq_down_right-1), and the same number from freq_up_left to (freq_up_left+1). Do the arithmetic one step at a time because it's possible that (freq_down_right==freq_up_left) or (freq_up_left==(freq_down_right-2)), resulting in a collision in the middle.
+*/
+            pop_list_base[freq_down_right-1]+=pop_delta;
+            pop_list_base[freq_down_right]-=pop_delta;
+            pop_list_base[freq_up_left]-=pop_delta;
+            pop_list_base[freq_up_left+1]+=pop_delta;
+            freq_max+=(freq_up_left==freq_max);
+            freq_min-=(freq_down_right==freq_min);
+          }
+        }
+      }
+    }while((freq_up_left!=freq_max)&&((++freq_up_left)!=whole_count));
+/*
+While not strictly necessary, we should tighten up [freq_min, freq_max] for better performance.
+*/
+    while(!pop_list_base[freq_max]){
+      freq_max--;
+    }
+    while(!pop_list_base[freq_min]){
+      freq_min++;
+    }
+    freq_max_max=MAX(freq_max, freq_max_max);
+    freq_min_min=MIN(freq_min, freq_min_min);
+  }while((iteration++)!=iteration_max);
+  *logfreedom_max_base=logfreedom_best_best;
+  TRANSFORM_STATS_TIME_ADD(TRANSFORM_STATS_IDX_LOGFREEDOM_MAX_NS, stats_time);
+  return status;
+}
+
+u8
+transform_logfreedom_max_get(fru128 *logfreedom_max_base, transform_t *transform_base, ULONG whole_idx_max, u32 whole_max_max){
+/*
+Obtain the maximum possible logfreedom for a given whole_idx_max (Q-1) and whole_max_max (Z-1) from the memo file set by transform_logfreedom_memo_set(), if any, or else via transform_logfreedom_max_approximate(), in which case the result is appended to the memo file.
+
+In:
+
+  *logfreedom_max_base is undefined.
+
+  transform_base is as defined in transform_logfreedom_max_approximate():In.
+
+  whole_idx_max is as defined in transform_logfreedom_max_approximate():In.
+
+  whole_max_max is as defined in transform_logfreedom_max_approximate():In.
+
+Out:
+
+  Returns transform_logfreedom_max_approximate():Out, or zero if the memo file contained the result.
+
+  *logfreedom_max_base is transform_logfreedom_max_approximate():Out:*logfreedom_max_base, bit for bit, regardless of whether it came from the memo file.
+*/
+  fru128 logfreedom_max;
+  u8 status;
+
+  status=transform_logfreedom_memo_find(&logfreedom_max, whole_idx_max, whole_max_max);
+  if(status){
+/*
+The iteration_max parameter is a gross overestimate even in the limits of maximal parameters, just to be safe.
+*/
+    status=transform_logfreedom_max_approximate(U64_BITS, &logfreedom_max, transform_base, whole_idx_max, whole_max_max);
+    if(!status){
+      transform_logfreedom_memo_append(logfreedom_max, whole_idx_max, whole_max_max);
+    }
+  }
+  *logfreedom_max_base=logfreedom_max;
+  return status;
+}
+
+void
+transform_logfreedom_memo_append(fru128 logfreedom_max, ULONG whole_idx_max, u32 whole_max_max){
+/*
+Append a record to the memo file set by transform_logfreedom_memo_set(), if any. Don't call here directly; use transform_logfreedom_max_get() instead.
+
+In:
+
+  logfreedom_max is transform_logfreedom_max_approximate():Out:*logfreedom_max_base, which did not saturate.
+
+  whole_idx_max is as defined in transform_logfreedom_max_approximate():In.
+
+  whole_max_max is as defined in transform_logfreedom_max_approximate():In.
+
+Out:
+
+  A transform_logfreedom_memo_t has been appended to the memo file. Failure to write it is ignored, as the memo is merely an optimization.
+*/
+  char *pathname_base;
+  transform_logfreedom_memo_t record;
+
+  pathname_base=transform_logfreedom_memo_pathname_base;
+  if(pathname_base){
+    memset(&record, 0, sizeof(transform_logfreedom_memo_t));
+    record.logfreedom_max=logfreedom_max;
+    record.build_id=TRANSFORM_BUILD_ID;
+    record.whole_idx_max=whole_idx_max;
+    record.whole_max_max=whole_max_max;
+    record.lmd2=transform_state_lmd2_get((ULONG)(sizeof(transform_logfreedom_memo_t)), (u8 *)(&record));
+    filesys_file_write_obnoxious(1, (ULONG)(sizeof(transform_logfreedom_memo_t)), pathname_base, &record);
+  }
+  return;
+}
+
+u8
+transform_logfreedom_memo_fill(ULONG whole_idx_max_idx_max, ULONG *whole_idx_max_list_base, ULONG whole_max_max_idx_max, ULONG *whole_max_max_list_base){
+/*
+Precompute the maximum possible logfreedom for every combination of whole_idx_max (Q-1) and whole_max_max (Z-1) in a pair of lists, and record each result not already in the memo file set by transform_logfreedom_memo_set(). This allows subsequent scans and window size sweeps to skip transform_logfreedom_max_approximate() entirely.
+
+In:
+
+  whole_idx_max_idx_max is the number of items at whole_idx_max_list_base, less one.
+
+  whole_idx_max_list_base is the base of a list of values of transform_logfreedom_max_approximate():In:whole_idx_max, each of them nonzero.
+
+  whole_max_max_idx_max is the number of items at whole_max_max_list_base, less one.
+
+  whole_max_max_list_base is the base of a list of values of transform_logfreedom_max_approximate():In:whole_max_max, each of them at most U32_MAX.
+
+Out:
+
+  Returns one if allocation failed, no memo file was set, or any approximation saturated, else zero. In any case, all results which could be computed have been recorded.
+*/
+  entropy_t *entropy_base;
+  fru128 logfreedom_max;
+  u8 granularity;
+  u8 status;
+  transform_t *transform_base;
+  ULONG whole_idx_max;
+  ULONG whole_idx_max_idx;
+  ULONG whole_idx_max_max;
+  u32 whole_max_max;
+  ULONG whole_max_max_idx;
+  ULONG whole_max_max_max;
+
+  whole_idx_max_max=0;
+  whole_idx_max_idx=0;
+  do{
+    whole_idx_max_max=MAX(whole_idx_max_max, whole_idx_max_list_base[whole_idx_max_idx]);
+  }while((whole_idx_max_idx++)!=whole_idx_max_idx_max);
+  whole_max_max_max=0;
+  whole_max_max_idx=0;
+  do{
+    whole_max_max_max=MAX(whole_max_max_max, whole_max_max_list_base[whole_max_max_idx]);
+  }while((whole_max_max_idx++)!=whole_max_max_idx_max);
+  granularity=U32_SIZE-1;
+  if(whole_max_max_max<=U16_MAX){
+    granularity=U16_SIZE-1;
+    if(whole_max_max_max<=U8_MAX){
+      granularity=U8_SIZE-1;
+    }
+  }
+/*
+Lookup and population lists suitable for the greatest Q and Z suffice for all lesser ones. Allocating them computes the result for that pair, too.
+*/
+  status=!transform_logfreedom_memo_pathname_base;
+  entropy_base=NULL;
+  transform_base=NULL;
+  if(!status){
+    transform_malloc(TRANSFORM_ALGO_STATUS_LOGFREEDOM, 0, &entropy_base, NULL, granularity, 0, 1, TRANSFORM_ROUNDING_STATUS_NEAREST_EVEN, &transform_base, (u32)(whole_max_max_max), 0, whole_idx_max_max, 0, whole_idx_max_max);
+    status=!transform_base;
+  }
+  if(!status){
+    whole_idx_max_idx=0;
+    do{
+      whole_idx_max=whole_idx_max_list_base[whole_idx_max_idx];
+      whole_max_max_idx=0;
+      do{
+        whole_max_max=(u32)(whole_max_max_list_base[whole_max_max_idx]);
+        status=(u8)(status|transform_logfreedom_max_get(&logfreedom_max, transform_base, whole_idx_max, whole_max_max));
+      }while((whole_max_max_idx++)!=whole_max_max_idx_max);
+    }while((whole_idx_max_idx++)!=whole_idx_max_idx_max);
+    transform_free_all(&entropy_base, &transform_base);
+  }
+  return status;
+}
+
+u8
+transform_logfreedom_memo_find(fru128 *logfreedom_max_base, ULONG whole_idx_max, u32 whole_max_max){
+/*
+Find the maximum possible logfreedom for a given whole_idx_max (Q-1) and whole_max_max (Z-1) in the memo file set by transform_logfreedom_memo_set(), if any. Don't call here directly; use transform_logfreedom_max_get() instead.
+
+In:
+
+  *logfreedom_max_base is undefined.
+
+  whole_idx_max is as defined in transform_logfreedom_max_approximate():In.
+
+  whole_max_max is as defined in transform_logfreedom_max_approximate():In.
+
+Out:
+
+  Returns one if no memo file was set, it could not be mapped, or it contained no valid record for this build of Transform with the given parameters, else zero. Records are validated individually, so a partially written or corrupt record only hides itself.
+
+  *logfreedom_max_base is undefined on failure, else the fracterval exactly as recorded.
+*/
+  int descriptor;
+  u64 file_size;
+  u64 lmd2;
+  void *mem_map_base;
+  char *pathname_base;
+  transform_logfreedom_memo_t record;
+  ULONG record_idx;
+  u8 status;
+
+  pathname_base=transform_logfreedom_memo_pathname_base;
+  status=1;
+  if(pathname_base){
+    descriptor=-1;
+    file_size=0;
+    mem_map_base=NULL;
+    if(!filesys_file_mem_map(&descriptor, &file_size, pathname_base, &mem_map_base, 0)){
+      record_idx=(ULONG)(file_size/sizeof(transform_logfreedom_memo_t));
+/*
+Search backwards because the most recent record is likely the most relevant.
+*/
+      while(status&&record_idx){
+        record_idx--;
+        memcpy(&record, &((u8 *)(mem_map_base))[record_idx*(ULONG)(sizeof(transform_logfreedom_memo_t))], sizeof(transform_logfreedom_memo_t));
+        if((record.whole_idx_max==whole_idx_max)&&(record.whole_max_max==whole_max_max)&&(record.build_id==TRANSFORM_BUILD_ID)){
+          lmd2=record.lmd2;
+          record.lmd2=0;
+          if(lmd2==transform_state_lmd2_get((ULONG)(sizeof(transform_logfreedom_memo_t)), (u8 *)(&record))){
+            *logfreedom_max_base=record.logfreedom_max;
+            status=0;
+          }
+        }
+      }
+      filesys_file_mem_unmap(descriptor, file_size, mem_map_base);
+    }
+  }
+  return status;
+}
+
+void
+transform_logfreedom_memo_set(char *pathname_base){
+/*
+Set the file in which transform_logfreedom_max_get() memoizes maximum logfreedom across runs of the process. The setting applies to all subsequent calls to transform_malloc().
+
+In:
+
+  *pathname_base is the null-terminated, writable pathname of the memo file, which need not exist, or NULL to approximate maximum logfreedom from scratch every time, which is the default. It must remain valid until no further calls to transform_malloc() will occur, or until this function is called again.
+
+Out:
+
+  The memo file has been set to *pathname_base.
+*/
+  transform_logfreedom_memo_pathname_base=pathname_base;
+  return;
+}
+
+void *
+transform_lookup_cache_free(int descriptor, u64 file_size, fru128 *log_list_base, void *mem_map_base){
+/*
+Release a log list returned by transform_lookup_cache_get().
+
+In:
+
+  descriptor is transform_lookup_cache_get():Out:*descriptor_base.
+
+  file_size is transform_lookup_cache_get():Out:*file_size_base.
+
+  log_list_base is the return value of transform_lookup_cache_get(), which may be NULL.
+
+  mem_map_base is transform_lookup_cache_get():Out:*mem_map_base_base.
+
+Out:
+
+  Returns NULL for convenience.
+
+  log_list_base has been unmapped or freed, as applicable.
+*/
+  if(mem_map_base){
+    filesys_file_mem_unmap(descriptor, file_size, mem_map_base);
+  }else{
+    fracterval_u128_free(log_list_base);
+  }
+  return NULL;
+}
+
+fru128 *
+transform_lookup_cache_get(int *descriptor_base, u64 *file_size_base, ULONG log_idx_max, void **mem_map_base_base){
+/*
+Obtain the unshifted logs of all whole numbers on [1, log_idx_max] from the lookup cache file set by transform_lookup_cache_set(). If the file is valid and long enough, it's mapped readonly and used in place. Otherwise the missing logs are computed by the number of threads set by transform_lookup_threads_set(), starting from the end of any valid but shorter file, and the file is replaced by one which covers the longer range. The replacement is written under a temporary name and then renamed, so another process which has the old file mapped is unaffected. Failure to write it is ignored, as the cache is merely an optimization.
+
+The logs don't depend on the algo or the precision in use, so the same file serves all of them. They are cached in their unshifted form because the shifts applied by transform_lookup_lists_init() to logs of factorials depend on the sequence of previous sums, but are cheap to replay.
+
+If no cache file has been set but more than one thread has, then the logs are still computed into an allocated list, so that they can be computed in parallel, but nothing is written.
+
+In:
+
+  *descriptor_base is undefined.
+
+  *file_size_base is undefined.
+
+  log_idx_max is the maximum whole number for which to obtain a log. Zero is treated as a failure.
+
+  *mem_map_base_base is undefined.
+
+Out:
+
+  Returns NULL if neither a cache file nor more than one thread has been set, log_idx_max was zero, allocation failed, or a log saturated, in which case the caller should compute the logs by itself. Otherwise, returns the base of a list of (fru128)s at which index N contains the output of FRU128_LOG_U64() for N, for all nonzero N up to and including log_idx_max. Index zero is the header of the cache file and should be ignored. The list must be released via transform_lookup_cache_free().
+
+  *descriptor_base, *file_size_base, and *mem_map_base_base are the values to pass to transform_lookup_cache_free(). *mem_map_base_base is NULL if the list was allocated rather than mapped, and undefined if NULL was returned.
+*/
+  int descriptor;
+  u64 file_size;
+  ULONG file_size_ulong;
+  transform_lookup_cache_t header;
+  ULONG log_cache_idx_max;
+  fru128 *log_list_base;
+  void *mem_map_base;
+  char *pathname_base;
+  ULONG pathname_size;
+  char *pathname_temp_base;
+  u8 status;
+  ULONG thread_idx_max;
+
+  log_list_base=NULL;
+  pathname_base=transform_lookup_cache_pathname_base;
+  thread_idx_max=transform_lookup_thread_idx_max;
+  if((pathname_base||thread_idx_max)&&log_idx_max){
+    descriptor=-1;
+    file_size=0;
+    log_cache_idx_max=0;
+    mem_map_base=NULL;
+    status=1;
+    if(pathname_base){
+      status=filesys_file_mem_map(&descriptor, &file_size, pathname_base, &mem_map_base, 0);
+    }
+    if(!status){
+/*
+Reject the file unless it consists of a header followed by at least one log, and all of it is addressable. Then check the header and the hash of the logs.
+*/
+      status=1;
+      file_size_ulong=(ULONG)(file_size);
+      if((file_size==file_size_ulong)&&(sizeof(fru128)<file_size_ulong)&&!(file_size_ulong%sizeof(fru128))){
+        memcpy(&header, mem_map_base, sizeof(transform_lookup_cache_t));
+        status=(header.signature!=TRANSFORM_LOOKUP_CACHE_SIGNATURE);
+        status=(u8)(status|(header.fru128_build_id!=FRU128_BUILD_ID));
+        status=(u8)(status|(header.log_idx_max!=((file_size_ulong/sizeof(fru128))-1)));
+        if(!status){
+          status=(header.lmd2!=transform_state_lmd2_get(file_size_ulong-(ULONG)(sizeof(fru128)), &((u8 *)(mem_map_base))[sizeof(fru128)]));
+        }
+      }
+      if(!status){
+        log_cache_idx_max=(ULONG)(header.log_idx_max);
+        if(log_idx_max<=log_cache_idx_max){
+          log_list_base=(fru128 *)(mem_map_base);
+          *descriptor_base=descriptor;
+          *file_size_base=file_size;
+        }
+      }else{
+        filesys_file_mem_unmap(descriptor, file_size, mem_map_base);
+        mem_map_base=NULL;
+      }
+    }
+    if(!log_list_base){
+      log_list_base=fracterval_u128_list_malloc(log_idx_max);
+      if(log_list_base&&log_cache_idx_max){
+        memcpy(&log_list_base[1], &((fru128 *)(mem_map_base))[1], (size_t)(log_cache_idx_max)*sizeof(fru128));
+      }
+      if(mem_map_base){
+        filesys_file_mem_unmap(descriptor, file_size, mem_map_base);
+        mem_map_base=NULL;
+      }
+      if(log_list_base){
+        status=0;
+        if(log_cache_idx_max!=log_idx_max){
+          status=transform_lookup_log_list_fill(log_list_base, log_idx_max, log_cache_idx_max+1, thread_idx_max);
+        }
+        if(!status&&pathname_base){
+          file_size_ulong=((ULONG)(log_idx_max)+1)*(ULONG)(sizeof(fru128));
+          memset(&header, 0, sizeof(transform_lookup_cache_t));
+          header.fru128_build_id=FRU128_BUILD_ID;
+          header.lmd2=transform_state_lmd2_get(file_size_ulong-(ULONG)(sizeof(fru128)), (u8 *)(&log_list_base[1]));
+          header.log_idx_max=log_idx_max;
+          header.signature=TRANSFORM_LOOKUP_CACHE_SIGNATURE;
+          memset(&log_list_base[0], 0, sizeof(fru128));
+          memcpy(&log_list_base[0], &header, sizeof(transform_lookup_cache_t));
+          pathname_size=(ULONG)(strlen(pathname_base));
+          pathname_temp_base=filesys_char_list_malloc(pathname_size+4);
+          if(pathname_temp_base){
+            memcpy(pathname_temp_base, pathname_base, (size_t)(pathname_size));
+            memcpy(&pathname_temp_base[pathname_size], ".tmp", 5);
+            status=filesys_file_write_obnoxious(0, file_size_ulong, pathname_temp_base, log_list_base);
+            if(!status){
+              status=!!rename(pathname_temp_base, pathname_base);
+            }
+            if(status){
+              remove(pathname_temp_base);
+            }
+            filesys_free(pathname_temp_base);
+          }
+        }else if(status){
+          log_list_base=fracterval_u128_free(log_list_base);
+        }
+      }
+      *mem_map_base_base=NULL;
+    }else{
+      *mem_map_base_base=mem_map_base;
+    }
+  }
+  return log_list_base;
+}
+
+void
+transform_lookup_cache_set(char *pathname_base){
+/*
+Set the file in which transform_lookup_lists_init() caches logs across runs of the process. The setting applies to all subsequent calls to transform_malloc().
+
+In:
+
+  *pathname_base is the null-terminated pathname of the cache file, which need not exist, or NULL to compute all logs from scratch, which is the default. It must remain valid until no further calls to transform_malloc() will occur, or until this function is called again.
+
+Out:
+
+  The cache file has been set to *pathname_base.
+*/
+  transform_lookup_cache_pathname_base=pathname_base;
+  return;
+}
+
+void
+transform_lookup_lists_free(transform_t *transform_base){
+/*
+Free all 128-bit fracterval lookup lists for log, logdelta, and log-of-factorial.
+
+In:
+
+  transform_base is transform_malloc():Out:*transform_base_base.
+
+Out:
+
+  All lookup lists at transform_base have been freed and their bases in *transform_base set to NULL.
+*/
+  transform_base->log_fru64_list_base=fracterval_u64_free(transform_base->log_fru64_list_base);
+  transform_base->log_factorial_fru64_list_base=fracterval_u64_free(transform_base->log_factorial_fru64_list_base);
+  transform_base->log_delta_fru64_list_base=fracterval_u64_free(transform_base->log_delta_fru64_list_base);
+  transform_base->log_fru128_list_base=fracterval_u128_free(transform_base->log_fru128_list_base);
+  transform_base->log_factorial_fru128_list_base=fracterval_u128_free(transform_base->log_factorial_fru128_list_base);
+  transform_base->log_delta_fru128_list_base=fracterval_u128_free(transform_base->log_delta_fru128_list_base);
+  DEBUG_FREE_PARANOID(transform_base->screen_double_list_base);
+  transform_base->screen_double_list_base=NULL;
+  transform_base->screen_status=0;
+  return;
+}
+
+u8
+transform_lookup_lists_init(entropy_t *entropy_base, transform_t *transform_base){
+/*
+Intialize (64/128)-bit fracterval lists of logs, logdeltas (differences of successive logs), and logs of factorials for fast lookup. Logs are taken from the file set by transform_lookup_cache_set(), if any, which is created or extended as needed, and any which must be computed are divided among the threads set by transform_lookup_threads_set(); see transform_lookup_cache_get().
+
+In:
+
+  entropy_base is transform_malloc():Out:*entropy_base_base.
+
+  transform_base is transform_malloc():Out:*transform_base_base.
+
+Out:
+
+  Returns one if allocation failed, in which case nothing has been allocated, else zero. In the latter case, it is still possible that fracterval underflow or overflow occurred, in which case one or both saturated limits have been used to populate the lookup lists where necessary. Unfortunately, it's computationally intractable to discover the precise lookup list index values at which this would occur.
+
+  The lookup lists themselves, the bases of which having been stored to *transform_base, have only been populated to the extent required in light of (entropy_base->algo_status). They must be freed via transform_lookup_lists_free() after all transforms using the same transform_malloc() parameters have completed.
+*/
+  u8 algo_status;
+  int cache_descriptor;
+  u64 cache_file_size;
+  void *cache_mem_map_base;
+  ULONG freq_span_max;
+  ULONG greater_span_max;
+  u8 ignored_status;
+  ULONG joint_span_max;
+  fru128 *log_cache_list_base;
+  fru128 log_delta_fru128;
+  fru128 *log_delta_fru128_list_base;
+  fru64 log_delta_fru64;
+  fru64 *log_delta_fru64_list_base;
+  ULONG log_delta_idx_max;
+  fru128 log_factorial_fru128;
+  fru128 *log_factorial_fru128_list_base;
+  fru128 log_factorial_fru128_precise;
+  fru64 log_factorial_fru64;
+  fru64 *log_factorial_fru64_list_base;
+  ULONG log_factorial_idx_max;
+  fru128 log_fru128;
+  fru128 *log_fru128_list_base;
+  fru128 log_fru128_old;
+  fru64 log_fru64;
+  fru64 *log_fru64_list_base;
+  ULONG log_idx_max;
+  ULONG lookup_idx;
+  ULONG lookup_idx_max;
+  u8 optimize_status;
+  u8 overflow_status;
+  u8 precise_status;
+  u8 shift;
+  u8 shift_max;
+  TRANSFORM_STATS_DECLARE(stats_time)
+  u8 status;
+  u64 term_u64;
+  u32 whole_max_max;
+  ULONG whole_span_max;
+
+  TRANSFORM_STATS_TIME_GET(stats_time);
+  algo_status=transform_base->algo_status;
+  freq_span_max=entropy_base->window_y_idx_post+1;
+  status=!freq_span_max;
+  log_delta_fru128_list_base=NULL;
+  log_factorial_fru128_list_base=NULL;
+  log_fru128_list_base=NULL;
+  log_delta_fru64_list_base=NULL;
+  log_factorial_fru64_list_base=NULL;
+  log_fru64_list_base=NULL;
+  whole_max_max=entropy_base->whole_max_max;
+  whole_span_max=(ULONG)(whole_max_max)+1;
+  greater_span_max=MAX(freq_span_max, whole_span_max);
+  joint_span_max=freq_span_max+whole_span_max;
+  status=(u8)(status|(joint_span_max<freq_span_max));
+  if(!status){
+    optimize_status=transform_base->optimize_status;
+    log_delta_idx_max=0;
+    log_factorial_idx_max=0;
+    log_idx_max=0;
+    if(algo_status==TRANSFORM_ALGO_STATUS_AGNENTROPY){
+      log_factorial_idx_max=joint_span_max-1;
+      if(optimize_status){
+        log_idx_max=freq_span_max+1;
+        status=(u8)(status|(!log_idx_max));
+      }
+    }else if(algo_status==TRANSFORM_ALGO_STATUS_SHANNON){
+      log_idx_max=freq_span_max;
+      if(optimize_status){
+        log_delta_idx_max=freq_span_max;
+        log_idx_max++;
+        status=(u8)(status|!log_idx_max);
+      }
+    }else{
+      log_factorial_idx_max=greater_span_max;
+      log_idx_max=log_factorial_idx_max+1;
+      status=(u8)(status|!log_idx_max);
+    }
+    precise_status=entropy_base->precise_status;
+    if(!status){
+      if(log_delta_idx_max){
+        if(precise_status){
+          log_delta_fru128_list_base=fracterval_u128_list_malloc(log_delta_idx_max);
+          status=(u8)(status|!log_delta_fru128_list_base);
+        }else{
+          log_delta_fru64_list_base=fracterval_u64_list_malloc(log_delta_idx_max);
+          status=(u8)(status|!log_delta_fru64_list_base);
+        }
+      }
+      if(log_factorial_idx_max){
+        if((algo_status==TRANSFORM_ALGO_STATUS_LOGFREEDOM)||precise_status){
+          log_factorial_fru128_list_base=fracterval_u128_list_malloc(log_factorial_idx_max);
+          status=(u8)(status|!log_factorial_fru128_list_base);
+        }
+        if(!precise_status){
+          log_factorial_fru64_list_base=fracterval_u64_list_malloc(log_factorial_idx_max);
+          status=(u8)(status|!log_factorial_fru64_list_base);
+        }
+      }
+      if(log_idx_max){
+        if((algo_status==TRANSFORM_ALGO_STATUS_LOGFREEDOM)||precise_status){
+          log_fru128_list_base=fracterval_u128_list_malloc(log_idx_max);
+          status=(u8)(status|!log_fru128_list_base);
+        }
+        if(!precise_status){
+          log_fru64_list_base=fracterval_u64_list_malloc(log_idx_max);
+          status=(u8)(status|!log_fru64_list_base);
+        }
+      }
+      if(!status){
+        lookup_idx_max=MAX(log_delta_idx_max, log_factorial_idx_max);
+        lookup_idx_max=MAX(log_idx_max, lookup_idx_max);
+/*
+Obtain the logs from the cache file, if any, through (lookup_idx_max+1) because the last logdelta requires it. If that's impossible, then compute them below.
+*/
+        cache_descriptor=-1;
+        cache_file_size=0;
+        cache_mem_map_base=NULL;
+        log_cache_list_base=transform_lookup_cache_get(&cache_descriptor, &cache_file_size, lookup_idx_max+1, &cache_mem_map_base);
+        FRU128_SET_ZERO(log_factorial_fru128_precise);
+        FRU128_SET_ZERO(log_fru128_old);
+        ignored_status=0;
+        lookup_idx=1;
+        shift=0;
+        shift_max=U64_BITS-U64_BITS_LOG2;
+        do{
+          if(!log_cache_list_base){
+            term_u64=lookup_idx;
+            FRU128_LOG_U64(log_fru128, term_u64, status);
+          }else{
+            log_fru128=log_cache_list_base[lookup_idx];
+          }
+          if(lookup_idx<=log_delta_idx_max){
+            FRU128_SUBTRACT_FRU128(log_delta_fru128, log_fru128, log_fru128_old, ignored_status);
+            FRU128_SHIFT_RIGHT_SELF(log_delta_fru128, shift_max);
+            if(log_delta_fru64_list_base){
+              FRU128_TO_FRU64_MID(log_delta_fru64, log_delta_fru128);
+              log_delta_fru64_list_base[lookup_idx-1]=log_delta_fru64;
+            }
+            if(log_delta_fru128_list_base){
+              log_delta_fru128_list_base[lookup_idx-1]=log_delta_fru128;
+            }
+          }
+          if(lookup_idx<=log_factorial_idx_max){
+            do{
+              FRU128_SHIFT_RIGHT(log_factorial_fru128, shift, log_fru128);
+              overflow_status=0;
+              FRU128_ADD_FRU128_SELF(log_factorial_fru128, log_factorial_fru128_precise, overflow_status);
+              if(!overflow_status){
+                log_factorial_fru128_precise=log_factorial_fru128;
+              }else{
+                if(shift==shift_max){
+  /*
+  log_factorial_fru128_precise has exhausted the maximum available precision, but don't bother to report an error. Instead, just set the result to ambiguous, so that if it's ever used (which is unlikely in practice), it will induce a fracterval precision error upon any subsequent computation. (We can't saturate to ones because we don't know if that's actually valid for the lower bound.)
+  */
+                  break;
+                }
+                shift++;
+                FRU128_SHIFT_RIGHT_SELF(log_factorial_fru128_precise, 1);
+              }
+            }while(overflow_status);
+            if(!overflow_status){
+              shift=(u8)(shift_max-shift);
+              FRU128_SHIFT_RIGHT_SELF(log_factorial_fru128, shift);
+              shift=(u8)(shift_max-shift);
+            }else{
+              FRU128_SET_AMBIGUOUS(log_factorial_fru128);
+            }
+            if(log_factorial_fru64_list_base){
+              FRU128_TO_FRU64_MID(log_factorial_fru64, log_factorial_fru128);
+              log_factorial_fru64_list_base[lookup_idx]=log_factorial_fru64;
+            }
+            if(log_factorial_fru128_list_base){
+              log_factorial_fru128_list_base[lookup_idx]=log_factorial_fru128;
+            }
+          }
+          log_fru128_old=log_fru128;
+          if(lookup_idx<=log_idx_max){
+            FRU128_SHIFT_RIGHT_SELF(log_fru128, shift_max);
+            if(log_fru64_list_base){
+              FRU128_TO_FRU64_MID(log_fru64, log_fru128);
+              log_fru64_list_base[lookup_idx]=log_fru64;
+            }
+            if(log_fru128_list_base){
+              log_fru128_list_base[lookup_idx]=log_fru128;
+            }
+          }
+          lookup_idx++;
+        }while(lookup_idx<=lookup_idx_max);
+        if(log_delta_idx_max){
+          if(!log_cache_list_base){
+            term_u64=(u64)(lookup_idx_max)+1;
+            FRU128_LOG_U64(log_fru128, term_u64, ignored_status);
+          }else{
+            log_fru128=log_cache_list_base[lookup_idx_max+1];
+          }
+          FRU128_SUBTRACT_FRU128(log_delta_fru128, log_fru128, log_fru128_old, ignored_status);
+  /*
+  Prevent the compiler from complaining about ignored_status.
+  */
+          status=(u8)(status|(ignored_status&0));  
+          FRU128_SHIFT_RIGHT_SELF(log_delta_fru128, shift_max);
+          if(log_delta_fru64_list_base){
+            FRU128_TO_FRU64_MID(log_delta_fru64, log_delta_fru128);
+            log_delta_fru64_list_base[log_delta_idx_max]=log_delta_fru64;
+            FRU64_SET_ONES(log_delta_fru64);
+            log_delta_fru64_list_base[0]=log_delta_fru64;
+          }
+          if(log_delta_fru128_list_base){
+            log_delta_fru128_list_base[log_delta_idx_max]=log_delta_fru128;
+            FRU128_SET_ONES(log_delta_fru128);
+            log_delta_fru128_list_base[0]=log_delta_fru128;
+          }
+        }
+        if(log_cache_list_base){
+          log_cache_list_base=transform_lookup_cache_free(cache_descriptor, cache_file_size, log_cache_list_base, cache_mem_map_base);
+        }
+        if(log_factorial_fru64_list_base){
+          FRU64_SET_ZERO(log_factorial_fru64);
+          log_factorial_fru64_list_base[0]=log_factorial_fru64;
+          log_factorial_fru64_list_base[1]=log_factorial_fru64;
+        }
+        if(log_factorial_fru128_list_base){
+          FRU128_SET_ZERO(log_factorial_fru128);
+          log_factorial_fru128_list_base[0]=log_factorial_fru128;
+          log_factorial_fru128_list_base[1]=log_factorial_fru128;
+        }
+        if(log_fru64_list_base){
+          FRU64_SET_ZERO(log_fru64);
+          log_fru64_list_base[0]=log_fru64;
+          log_fru64_list_base[1]=log_fru64;
+        }
+        if(log_fru128_list_base){
+          FRU128_SET_ZERO(log_fru128);
+          log_fru128_list_base[0]=log_fru128;
+          log_fru128_list_base[1]=log_fru128;
+        }
+      }
+    }
+    transform_base->log_delta_fru128_list_base=log_delta_fru128_list_base;
+    transform_base->log_factorial_fru128_list_base=log_factorial_fru128_list_base;
+    transform_base->log_fru128_list_base=log_fru128_list_base;
+    transform_base->log_delta_fru64_list_base=log_delta_fru64_list_base;
+    transform_base->log_factorial_fru64_list_base=log_factorial_fru64_list_base;
+    transform_base->log_fru64_list_base=log_fru64_list_base;
+    if(status){
+      transform_lookup_lists_free(transform_base);
+    }
+  }
+  TRANSFORM_STATS_TIME_ADD(TRANSFORM_STATS_IDX_LOOKUP_NS, stats_time);
+  return status;
+}
+
+u8
+transform_lookup_log_list_fill(fru128 *log_list_base, ULONG log_idx_max, ULONG log_idx_min, ULONG thread_idx_max){
+/*
+Compute the unshifted logs of a range of whole numbers in parallel. The log of each whole number is independent of all others, so the result is identical regardless of the number of threads.
+
+In:
+
+  log_list_base is the base of a list of at least (log_idx_max+1) (fru128)s.
+
+  log_idx_max is the greatest whole number for which to compute a log.
+
+  log_idx_min is the least whole number for which to compute a log. On [1, log_idx_max].
+
+  thread_idx_max is the number of threads to use, less one. On [0, THREAD_IDX_MAX_MAX]. This is reduced as required so that every thread computes at least one log. If resources for threading cannot be allocated, then all logs are computed by the calling thread.
+
+Out:
+
+  Returns one if fracterval underflow or overflow occurred in any log, else zero.
+
+  log_list_base[N] is the output of FRU128_LOG_U64() for N, for all N on [log_idx_min, log_idx_max].
+*/
+  ULONG list_size;
+  ULONG log_idx_post;
+  transform_lookup_thread_t lookup_thread;
+  transform_lookup_thread_t *lookup_thread_base;
+  transform_lookup_thread_t *lookup_thread_list_base;
+  u8 status;
+  ULONG thread_idx;
+
+  log_idx_post=log_idx_max-log_idx_min+1;
+  thread_idx_max=MIN(thread_idx_max, log_idx_post-1);
+  lookup_thread_list_base=NULL;
+  if(thread_idx_max){
+    list_size=(thread_idx_max+1)*(ULONG)(sizeof(transform_lookup_thread_t));
+    lookup_thread_list_base=DEBUG_CALLOC_PARANOID(list_size);
+  }
+  status=0;
+  if(lookup_thread_list_base){
+    lookup_thread_base=lookup_thread_list_base;
+    thread_idx=0;
+    do{
+      thread_span_get(&lookup_thread_base->log_idx_max, &lookup_thread_base->log_idx_min, log_idx_post, thread_idx, thread_idx_max);
+      lookup_thread_base->log_idx_max+=log_idx_min;
+      lookup_thread_base->log_idx_min+=log_idx_min;
+      lookup_thread_base->log_list_base=log_list_base;
+      lookup_thread_base++;
+    }while((thread_idx++)!=thread_idx_max);
+/*
+Without a barrier, thread_list_run() processes every parameter block even if the OS refuses to create some of the threads, so the return value doesn't matter.
+*/
+    thread_list_run(NULL, transform_lookup_log_list_fill_thread, lookup_thread_list_base, (ULONG)(sizeof(transform_lookup_thread_t)), thread_idx_max);
+    lookup_thread_base=lookup_thread_list_base;
+    thread_idx=0;
+    do{
+      status=(u8)(status|lookup_thread_base->status);
+      lookup_thread_base++;
+    }while((thread_idx++)!=thread_idx_max);
+    DEBUG_FREE_PARANOID(lookup_thread_list_base);
+  }else{
+    lookup_thread.log_idx_max=log_idx_max;
+    lookup_thread.log_idx_min=log_idx_min;
+    lookup_thread.log_list_base=log_list_base;
+    transform_lookup_log_list_fill_thread(&lookup_thread);
+    status=lookup_thread.status;
+  }
+  return status;
+}
+
+void *
+transform_lookup_log_list_fill_thread(void *thread_base){
+/*
+Compute the unshifted logs of one span of whole numbers on behalf of transform_lookup_log_list_fill(). Don't call here directly.
+
+In:
+
+  thread_base is the base of a transform_lookup_thread_t in which all fields but status have been set.
+
+Out:
+
+  Returns NULL.
+
+  (thread_base->status) is one if fracterval underflow or overflow occurred in any log, else zero.
+
+  (thread_base->log_list_base)[N] is the output of FRU128_LOG_U64() for N, for all N on [(thread_base->log_idx_min), (thread_base->log_idx_max)].
+*/
+  fru128 log_fru128;
+  ULONG log_idx;
+  ULONG log_idx_max;
+  fru128 *log_list_base;
+  transform_lookup_thread_t *lookup_thread_base;
+  u8 status;
+  u64 term_u64;
+
+  lookup_thread_base=(transform_lookup_thread_t *)(thread_base);
+  log_idx=lookup_thread_base->log_idx_min;
+  log_idx_max=lookup_thread_base->log_idx_max;
+  log_list_base=lookup_thread_base->log_list_base;
+  status=0;
+  do{
+    term_u64=log_idx;
+    FRU128_LOG_U64(log_fru128, term_u64, status);
+    log_list_base[log_idx]=log_fru128;
+  }while((log_idx++)!=log_idx_max);
+  lookup_thread_base->status=status;
+  return NULL;
+}
+
+void
+transform_lookup_threads_set(ULONG thread_idx_max){
+/*
+Set the number of threads with which transform_lookup_lists_init() computes logs which it doesn't find in the cache file. The setting applies to all subsequent calls to transform_malloc().
+
+In:
+
+  thread_idx_max is the number of threads to use, less one. On [0, THREAD_IDX_MAX_MAX]. Zero, which is the default, computes logs on the fly in the calling thread unless a cache file has been set. Otherwise the logs are computed into a temporary list as large as the largest lookup list.
+
+Out:
+
+  The number of threads has been set to (thread_idx_max+1).
+*/
+  transform_lookup_thread_idx_max=thread_idx_max;
+  return;
+}
+
+void
+transform_malloc(u8 algo_status, u8 discount_status, entropy_t **entropy_base_base, u32 *fakefloat_list_base, u8 granularity, u8 optimize_status, u8 precise_status, u8 rounding_status, transform_t **transform_base_base, u32 whole_max_max, ULONG whole_x_idx_max, ULONG whole_y_idx_max, ULONG window_x_idx_max, ULONG window_y_idx_max){
+/*
+Initialize data structures in preparation for one or more entropy scans with a given window size.
+
+In:
+
+  algo_status is one of the TRANSFORM_ALGO_STATUS constants, which implies which definition of entropy to use.
+
+  discount_status is one to compute discount nats, else zero for total entropy. Discount nats will be computed on a per-channel basis, whereas total entropy will be per-window.
+
+  *entropy_base_base is undefined.
+
+  fakefloat_list_base is NULL to compute only the minimum and maximum entropy across all windows, and to provide the coordinates of their upper left corners. Else the output of transform_fakefloat_list_malloc() with the same values of whole_x_idx_max, whole_y_idx_max, window_x_idx_max, and window_y_idx_max.
+
+  granularity is the size of a whole number, less one.
+
+  optimize_status is one to optimize performance at the expense of precision. In practice, it should only be set to zero in order to confirm and further resolve previous scan results.
+
+  precise_status is zero for 32.32 or one for 64.64 fixed-points expressed as 64-bit or 128-bit fractervals, respectively.
+
+  rounding_status is one of the TRANSFORM_ROUNDING_STATUS constants, which instructs Transform as to how to round fractervals during conversion to fakefloats. Generally, one should use TRANSFORM_ROUNDING_STATUS_NEAREST_EVEN unless the intention is to place more rigorous bounds on entropy values. This value has no effect currently if fakefloat_list_base is NULL, although it could if Transform eventually supports integrated float-to-whole conversion.
+
+  *transform_base_base is undefined.
+  
+  whole_max_max is the maximum possible whole number that _could_ ever be encountered during any scan using Out:*entropy_base_base and Out:*transform_base_base. Unless the caller has some prior knowledge of this value, it would typically be discovered via Whole:whole_max_get().
+
+  whole_x_idx_max is the number of columns (channels) per row (spectrum) in the array of wholes to scan, less one.
+
+  whole_y_idx_max is the number of rows in the array of wholes to scan, less one. At least one because the entropy of one whole is not meaningful.
+
+  window_x_idx_max is the number of columns (channels) per row (spectrum) in the window of wholes to scan, less one. On [0, whole_x_idx_max].
+
+  window_y_idx_max is the number of rows in the window of wholes to scan, less one. On [1, whole_y_idx_max].
+
+Out:
+
+  *entropy_base_base has been populated with scan parameters which the caller can safely read but not write. It's a readonly shared data structure in this sense. If it is NULL, then *transform_base_base is also NULL, and allocation has failed due to either memory exhaustion or invalid inputs.
+
+  *transform_base_base is NULL iff *entropy_base_base is null. Otherwise, it's the base of a private data structure to be used for scanning.
+*/
+  entropy_t *entropy_base;
+  ULONG freq_list_base_list_size;
+  ULONG freq_list_idx_max;
+  ULONG freq_list_idx_post;
+  ULONG freq_list_size;
+  u8 freq_size_log2;
+  ULONG pop_idx_post;
+  ULONG *pop_list_base;
+  ULONG pop_list_size;
+  u8 status;
+  transform_t *transform_base;
+  ULONG whole_count;
+  ULONG whole_span_max;
+  ULONG whole_x_idx_post;
+  ULONG whole_y_idx_post;
+  ULONG window_x_idx_post;
+  ULONG window_y_idx_post;
+
+  freq_list_idx_max=(optimize_status?whole_x_idx_max:window_x_idx_max);
+  freq_list_idx_post=freq_list_idx_max+1;
+  status=!freq_list_idx_post;
+  freq_list_base_list_size=freq_list_idx_post*(ULONG)(sizeof(u32 *));
+  status=(u8)(status|((freq_list_base_list_size/(ULONG)(sizeof(u32 *)))!=freq_list_idx_post));
+  status=(u8)(status|(whole_x_idx_max<window_x_idx_max));
+  whole_x_idx_post=whole_x_idx_max+1;
+  status=(u8)(status|!whole_x_idx_post);
+  status=(u8)(status|(whole_y_idx_max<window_y_idx_max));
+  whole_y_idx_post=whole_y_idx_max+1;
+  status=(u8)(status|!whole_y_idx_post);
+  whole_count=whole_x_idx_post*whole_y_idx_post;
+  status=(u8)(status|((!whole_count)||((whole_count/whole_x_idx_post)!=whole_y_idx_post)));
+  window_x_idx_post=window_x_idx_max+1;
+  status=(u8)(status|!window_x_idx_post);
+  window_y_idx_post=window_y_idx_max+1;
+  status=(u8)(status|!window_y_idx_post);
+  whole_span_max=(ULONG)(whole_max_max)+1;
+  #ifdef _32_
+    status=(u8)(status|!whole_span_max);
+  #endif
+  freq_size_log2=ULONG_SIZE_LOG2;
+  if(window_y_idx_post<U16_MAX){
+    freq_size_log2=U16_SIZE_LOG2;
+    if(window_y_idx_post<U8_MAX){
+      freq_size_log2=U8_SIZE_LOG2;
+    }
+  }
+  freq_list_size=whole_span_max<<freq_size_log2;
+  status=(u8)(status|((freq_list_size>>freq_size_log2)!=whole_span_max));
+  pop_idx_post=window_y_idx_post+1;
+  status=(u8)(status|!pop_idx_post);
+  pop_list_size=pop_idx_post<<ULONG_SIZE_LOG2;
+  status=(u8)(status|((pop_list_size>>ULONG_SIZE_LOG2)!=pop_idx_post));
+  entropy_base=NULL;
+  transform_base=NULL;
+  if(!status){
+    entropy_base=DEBUG_CALLOC_PARANOID((ULONG)(sizeof(entropy_t)));
+    transform_base=DEBUG_CALLOC_PARANOID((ULONG)(sizeof(transform_t)));
+    if(entropy_base&&transform_base){
+      entropy_base->fakefloat_list_base=fakefloat_list_base;
+      entropy_base->fakefloat_x_idx_max=whole_x_idx_max-window_x_idx_max;
+      entropy_base->fakefloat_y_idx_max=whole_y_idx_max-window_y_idx_max;
+      entropy_base->granularity=granularity;
+      entropy_base->discount_status=discount_status;
+      entropy_base->precise_status=precise_status;
+      entropy_base->rounding_status=rounding_status;
+      entropy_base->whole_count=whole_count;
+      entropy_base->whole_max_max=whole_max_max;
+      entropy_base->whole_x_idx_max=whole_x_idx_max;
+      entropy_base->whole_x_idx_post=whole_x_idx_post;
+      entropy_base->whole_y_idx_max=whole_y_idx_max;
+      entropy_base->whole_y_idx_post=whole_y_idx_post;
+      entropy_base->window_x_idx_max=window_x_idx_max;
+      entropy_base->window_x_idx_post=window_x_idx_post;
+      entropy_base->window_y_idx_max=window_y_idx_max;
+      entropy_base->window_y_idx_post=window_y_idx_post;
+      transform_base->algo_status=algo_status;
+      transform_base->column_kernel_base=(void (*)(void))(transform_column_kernel_get(algo_status, granularity, precise_status));
+      transform_base->freq_list_idx_max=freq_list_idx_max;
+      transform_base->freq_size_log2=freq_size_log2;
+      if(algo_status==TRANSFORM_ALGO_STATUS_LOGFREEDOM){
+        pop_list_base=DEBUG_MALLOC_PARANOID(pop_list_size);
+        status=(u8)(status|!pop_list_base);
+        transform_base->pop_list_best_base=pop_list_base;
+        pop_list_base=DEBUG_MALLOC_PARANOID(pop_list_size);
+        status=(u8)(status|!pop_list_base);
+        transform_base->pop_list_best_best_base=pop_list_base;
+      }
+      transform_base->optimize_status=optimize_status;
+      if(!status){
+        status=transform_column_lists_malloc(entropy_base, transform_base);
+        if(!status){
+          status=transform_lookup_lists_init(entropy_base, transform_base);
+          if(!status){
+            if((algo_status==TRANSFORM_ALGO_STATUS_SHANNON)&&optimize_status){
+              status=transform_delta_delta_list_init(&transform_base->entropy_delta_delta_fru128_list_base, &transform_base->entropy_delta_delta_fru64_list_base, precise_status);
+            }
+            if(!status){
+              status=transform_window_entropy_offsets_get(entropy_base, transform_base);
+            }
+          }
+        }
+      }
+    }
+    if(status){
+      transform_free_all(&entropy_base, &transform_base);
+    }
+  }
+  *entropy_base_base=entropy_base;
+  *transform_base_base=transform_base;
+  return;
+}
+
+u8
+transform_pop_list_entropy_get_fru128(u8 algo_status, fru128 *entropy_fru128_base, fru128 *lookup_list_base, ULONG *pop_list_base, ULONG whole_idx_max){
+/*
+Get the entropy delta implied by a population list. This is the tail of transform_freq_list_entropy_get_fru128(), for callers which maintain the population list themselves, so that it's already valid and need not be refilled from the frequency list.
+
+In:
+
+  algo_status is as defined in transform_freq_list_entropy_get_fru128():In.
+
+  *entropy_fru128_base is undefined.
+
+  *lookup_list_base is as defined in transform_freq_list_entropy_get_fru128():In.
+
+  *pop_list_base is transform_pop_list_fill():Out:*pop_list_base, or an equivalent list which has been kept consistent with the frequency list in question.
+
+  whole_idx_max is the sum of all frequencies in question, less one.
+
+Out:
+
+  Returns one if fracterval underflow or overflow occured (which is usually benign) else zero.
+
+  *entropy_fru128_base is as defined in transform_freq_list_entropy_get_fru128():Out.
+*/
+  fru128 entropy;
+  fru128 entropy_delta;
+  ULONG freq;
+  ULONG freq_x_pop;
+  ULONG freq_x_pop_sum;
+  ULONG pop;
+  u8 status;
+  u64 term_u64;
+
+  status=0;
+  FRU128_SET_ZERO(entropy);
+  freq_x_pop_sum=pop_list_base[1];
+  if(algo_status==TRANSFORM_ALGO_STATUS_LOGFREEDOM){
+/*
+Maintain maximum precision by avoiding unnecessary arithmetic.
+*/
+    if(freq_x_pop_sum){
+      entropy=lookup_list_base[freq_x_pop_sum];
+      pop=pop_list_base[0];
+      if(pop){
+        entropy_delta=lookup_list_base[pop];
+        FRU128_ADD_FRU128_SELF(entropy, entropy_delta, status);
+      }
+    }else{
+      pop=pop_list_base[0];
+      entropy=lookup_list_base[pop];
+    }
+  }
+  if(freq_x_pop_sum<=whole_idx_max){
+    freq=2;
+    do{
+      pop=pop_list_base[freq];
+      if(pop){
+        freq_x_pop=freq*pop;
+        if(algo_status==TRANSFORM_ALGO_STATUS_AGNENTROPY){
+          entropy_delta=lookup_list_base[freq];
+          term_u64=pop;
+          FRU128_MULTIPLY_U64_SELF(entropy_delta, term_u64, status);
+          FRU128_ADD_FRU128_SELF(entropy, entropy_delta, status);
+        }else if(algo_status==TRANSFORM_ALGO_STATUS_SHANNON){
+          entropy_delta=lookup_list_base[freq];
+          term_u64=freq_x_pop;
+          FRU128_MULTIPLY_U64_SELF(entropy_delta, term_u64, status);
+          FRU128_ADD_FRU128_SELF(entropy, entropy_delta, status);
+        }else{
+          entropy_delta=lookup_list_base[freq];
+          if(pop!=1){
+            term_u64=pop;
+            FRU128_MULTIPLY_U64_SELF(entropy_delta, term_u64, status);
+          }
+          FRU128_ADD_FRU128_SELF(entropy, entropy_delta, status);
+          if(pop!=1){
+            entropy_delta=lookup_list_base[pop];
+            FRU128_ADD_FRU128_SELF(entropy, entropy_delta, status);
+          }
+        }
+        freq_x_pop_sum+=freq_x_pop;
+      }
+      freq++;
+    }while(freq_x_pop_sum<=whole_idx_max);
+  }
+  *entropy_fru128_base=entropy;
+  return status;
+}
+
+u8
+transform_pop_list_entropy_get_fru64(u8 algo_status, fru64 *entropy_fru64_base, fru64 *lookup_list_base, ULONG *pop_list_base, ULONG whole_idx_max){
+/*
+This is the 64-bit fracterval equivalent of transform_pop_list_entropy_get_fru128(). Replace all occurrences of "128" with "64" in its definition.
+*/
+  fru64 entropy;
+  fru64 entropy_delta;
+  ULONG freq;
+  ULONG freq_x_pop;
+  ULONG freq_x_pop_sum;
+  ULONG pop;
+  u8 status;
+  u64 term_u64;
+
+  status=0;
+  FRU64_SET_ZERO(entropy);
+  if(algo_status==TRANSFORM_ALGO_STATUS_LOGFREEDOM){
+/*
+Maintain maximum precision by avoiding unnecessary arithmetic.
+*/
+    pop=pop_list_base[0];
+    if(pop){
+      entropy=lookup_list_base[pop];
+      pop=pop_list_base[1];
+      if(pop){
+        entropy_delta=lookup_list_base[pop];
+        FRU64_ADD_FRU64_SELF(entropy, entropy_delta, status);
+      }
+    }else{
+      pop=pop_list_base[1];
+      entropy=lookup_list_base[pop];
+    }
+  }
+  freq_x_pop_sum=pop_list_base[1];
+  if(freq_x_pop_sum<=whole_idx_max){
+    freq=2;
+    do{
+      pop=pop_list_base[freq];
+      if(pop){
+        freq_x_pop=freq*pop;
+        if(algo_status==TRANSFORM_ALGO_STATUS_AGNENTROPY){
+          entropy_delta=lookup_list_base[freq];
+          term_u64=pop;
+          FRU64_MULTIPLY_U64_SELF(entropy_delta, term_u64, status);
+          FRU64_ADD_FRU64_SELF(entropy, entropy_delta, status);
+        }else if(algo_status==TRANSFORM_ALGO_STATUS_SHANNON){
+          entropy_delta=lookup_list_base[freq];
+          term_u64=freq_x_pop;
+          FRU64_MULTIPLY_U64_SELF(entropy_delta, term_u64, status);
+          FRU64_ADD_FRU64_SELF(entropy, entropy_delta, status);
+        }else{
+          entropy_delta=lookup_list_base[freq];
+          if(pop!=1){
+            term_u64=pop;
+            FRU64_MULTIPLY_U64_SELF(entropy_delta, term_u64, status);
+          }
+          FRU64_ADD_FRU64_SELF(entropy, entropy_delta, status);
+          if(pop!=1){
+            entropy_delta=lookup_list_base[pop];
+            FRU64_ADD_FRU64_SELF(entropy, entropy_delta, status);
+          }
+        }
+        freq_x_pop_sum+=freq_x_pop;
+      }
+      freq++;
+    }while(freq_x_pop_sum<=whole_idx_max);
+  }
+  *entropy_fru64_base=entropy;
+  return status;
+}
+
+void
+transform_pop_list_fill(void *freq_list_base, u8 freq_size_log2, ULONG *pop_list_base, ULONG whole_idx_max, u32 whole_max_max){
+/*
+Given a valid frequency list, fill a population (frequency-of-frequency) list.
+
+In:
+
+  *freq_list_base contains the frequency (occurrence count) each corresponding whole on [0, whole_max_max].
+
+  freq_size_log2 is as defined in transform_freq_list_entropy_get_fru128():In.
+
+  *pop_list_base is writeable on [0, whole_idx_max+1].
+
+  whole_idx_max is transform_pop_list_malloc():In:whole_idx_max.
+
+  whole_max_max can be as low as the greatest whole with nonzero frequency at freq_list_base, but in general, will be the same value which was previously passed to transform_malloc().
+
+Out:
+
+  *pop_list_base contains the populations of all possible frequencies at freq_list_base. Index zero contains the number of zeroes at the latter. The last index, which is (whole_idx_max+1), is zero unless all wholes are identical, in which case it's one. A value of P at index F implies that that frequency F occurs P times at freq_list_base.
+*/
+  ULONG freq;
+  ULONG freq_idx;
+  ULONG freq_max_max;
+  ULONG freq_sum;
+
+  freq_max_max=whole_idx_max+1;
+  transform_ulong_list_zero(freq_max_max, pop_list_base);
+  freq_idx=0;
+  freq_sum=0;
+  do{
+    TRANSFORM_FREQ_GET(freq, freq_list_base, freq_size_log2, freq_idx);
+    freq_idx++;
+    freq_sum+=freq;
+    pop_list_base[freq]++;
+  }while(freq_sum<=whole_idx_max);
+  pop_list_base[0]+=(ULONG)(whole_max_max)+1-freq_idx;
+  return;
+}
+
+u8
+transform_pop_list_logfreedom_get(fru128 *log_factorial_list_base, fru128 *logfreedom_base, ULONG *pop_list_base, ULONG whole_idx_max, u32 whole_max_max){
+/*
+Calculate the logfreedom of a population list while attempting to maximize accuracy -- actual logfreedom, not a delta relative to a bias.
+
+In:
+
+  *log_factorial_list_base is (transform_base->log_factorial_fru128_list_base).
+
+  *logfreedom_base is undefined.
+
+  *pop_list_base is transform_pop_list_fill():Out:pop_list_base, defined on [0, whole_idx_max+1].
+
+  whole_idx_max is the sum of all items at pop_list_base times their respective indexes, i.e. the sum of population times frequency, less one.
+
+  whole_max_max is the sum of all items at pop_list_base, less one.
+
+Out:
+
+  Returns one if fracterval underflow or overflow occured (which is usually benign) else zero.
+
+  *logfreedom_base is the logfreedom implied by the inputs.
+*/
+  ULONG freq;
+  fru128 logfreedom;
+  fru128 logfreedom_delta;
+  ULONG pop;
+  ULONG pop_sum;
+  u8 status;
+  u64 term_u64;
+
+  status=0;
+  logfreedom=log_factorial_list_base[whole_idx_max+1];
+  logfreedom_delta=log_factorial_list_base[whole_max_max+1];
+  FRU128_ADD_FRU128_SELF(logfreedom, logfreedom_delta, status);
+  freq=0;
+  pop_sum=0;
+  do{
+    pop=pop_list_base[freq];
+    if(pop){
+      pop_sum+=pop;
+      if(pop!=1){
+        logfreedom_delta=log_factorial_list_base[pop];
+        FRU128_SUBTRACT_FRU128_SELF(logfreedom, logfreedom_delta, status);
+      }
+      if(1<freq){
+        logfreedom_delta=log_factorial_list_base[freq];
+        if(pop!=1){
+          term_u64=pop;
+          FRU128_MULTIPLY_U64_SELF(logfreedom_delta, term_u64, status);
+        }
+        FRU128_SUBTRACT_FRU128_SELF(logfreedom, logfreedom_delta, status);
+      }
+    }
+    freq++;
+  }while(pop_sum<=whole_max_max);
+  *logfreedom_base=logfreedom;
+  return status;
+}
+
+ULONG *
+transform_pop_list_malloc(ULONG whole_idx_max){
+/*
+Allocate a list of populations of frequencies of whole numbers.
+
+In:
+
+  whole_idx_max is one less than the maximum number of wholes for which the population list might need to be evaluated.
+
+Out:
+
+  Returns NULL on failure, else the base of (whole_idx_max+1) undefined (ULONG)s.
 */
-            FRU128_ADD_FRU128_SELF(logfreedom_delta_sum_minus, logfreedom_delta_minus, status);
-            FRU128_ADD_FRU128_SELF(logfreedom_delta_sum_plus, logfreedom_delta_plus, status);
-            FRU128_MEAN_TO_FTD128(mean_minus, logfreedom_delta_sum_minus);
-            FRU128_MEAN_TO_FTD128(mean_plus, logfreedom_delta_sum_plus);
-            if(U128_IS_LESS(mean_minus, mean_plus)){
-              pop_list_base[freq_down_right-1]=pop_down_left;
-              pop_list_base[freq_down_right]=pop_down_right;
-              pop_list_base[freq_up_left]=pop_up_left;
-              pop_list_base[freq_up_left+1]=pop_up_right;
+  ULONG list_size;
+  ULONG *pop_list_base;
+  ULONG pop_span;
+
+  pop_list_base=NULL;
+  pop_span=whole_idx_max+2;
+  if(1U<pop_span){
+    list_size=pop_span<<ULONG_SIZE_LOG2;
+    if((list_size>>ULONG_SIZE_LOG2)==pop_span){
+      pop_list_base=DEBUG_MALLOC_PARANOID(list_size);
+    }
+  }
+  return pop_list_base;
+}
+
+u8
+transform_rank_init(entropy_t *entropy_base, u8 overlap_status, ULONG rank_idx_max_max){
 /*
-Decrement freq_min and/or increment freq_max if necessary, which in general will leave some possible values of (freq_down_right, freq_up_left) unexplored, but that's OK because this is just a heuristic. Then prepare to copy *pop_list_base to *pop_list_best_base as efficiently as possible (because it might be huge and full of zeroes).
+Enable tracking of the windows with the greatest and least entropies during subsequent calls to any transform_dispatch*() function, so that more than just the single extremes in (entropy_base->max_max_*) and (entropy_base->min_min_*) can be reported without dumping the entire array of fakefloats.
+
+In:
+
+  entropy_base is transform_malloc():Out:*entropy_base_base.
+
+  overlap_status is one to suppress windows which overlap a window of more extreme entropy already in the same list, else zero to rank all windows regardless of overlap. Suppression is done greedily as windows arrive in row-major order, so a window which was evicted by a more extreme overlapping window does not itself suppress any window thereafter.
+
+  rank_idx_max_max is the number of windows to track in each list, less one.
+
+Out:
+
+  Returns one if allocation failed, else zero. Either way, everything allocated will be freed by transform_free_all().
+
+  (entropy_base->rank_min_fru*_list_base) and (entropy_base->rank_max_fru*_list_base), where "*" is "128" if (entropy_base->precise_status) is one, else "64", will contain the (entropy_base->rank_min_count) least and (entropy_base->rank_max_count) greatest window entropies, in ascending and descending order by mean, respectively, after dispatch. Ties are won by the window which arrives first in row-major order. (entropy_base->rank_min_xy_list_base) and (entropy_base->rank_max_xy_list_base) contain the corresponding coordinates as (x, y) pairs. If (entropy_base->discount_status) is one, then all of the foregoing has been converted to discount nats in the manner of transform_entropy_to_discount().
 */
-              freq_max+=(freq_up_left==freq_max);
-              freq_max_max=MAX(freq_max, freq_max_max);
-              freq_min-=(freq_down_right==freq_min);
-              freq_min_min=MIN(freq_min, freq_min_min);              
-              pop_list_size=(freq_max_max-freq_min_min+1)<<ULONG_SIZE_LOG2;
-              memcpy(&pop_list_best_base[freq_min_min], &pop_list_base[freq_min_min], (size_t)(pop_list_size));
-              FRU128_SET_ZERO(logfreedom_delta_sum_minus);
-              FRU128_SET_ZERO(logfreedom_delta_sum_plus);
-              progress_status=1;
-            }
-          }
-        }while((freq_down_right++)!=freq_max);
-      }while((freq_up_left!=freq_max)&&((++freq_up_left)!=whole_count));
-    }while(progress_status);
-    status_delta=transform_pop_list_logfreedom_get(log_factorial_list_base, &logfreedom_best, pop_list_best_base, whole_idx_max, whole_max_max);
-    status=(u8)(status|status_delta);
-    FRU128_MEAN_TO_FTD128(mean_minus, logfreedom_best_best);
-    FRU128_MEAN_TO_FTD128(mean_plus, logfreedom_best);
-    if(U128_IS_LESS(mean_minus, mean_plus)){
-      logfreedom_best_best=logfreedom_best;
-      pop_list_size=(freq_max_max-freq_min_min+1)<<ULONG_SIZE_LOG2;
-      memcpy(&pop_list_best_best_base[freq_min_min], &pop_list_best_base[freq_min_min], (size_t)(pop_list_size));
+  ULONG fakefloat_x_idx_max;
+  ULONG list_size;
+  u8 status;
+
+  entropy_base->rank_idx_max_max=rank_idx_max_max;
+  entropy_base->rank_max_count=0;
+  entropy_base->rank_min_count=0;
+  entropy_base->rank_overlap_status=overlap_status;
+  entropy_base->rank_status=1;
+  fakefloat_x_idx_max=entropy_base->fakefloat_x_idx_max;
+  status=1;
+  list_size=(rank_idx_max_max+2)<<(ULONG_SIZE_LOG2+1);
+  if(rank_idx_max_max==((list_size>>(ULONG_SIZE_LOG2+1))-2)){
+    entropy_base->rank_max_xy_list_base=DEBUG_MALLOC_PARANOID(list_size);
+    entropy_base->rank_min_xy_list_base=DEBUG_MALLOC_PARANOID(list_size);
+    status=!(entropy_base->rank_max_xy_list_base&&entropy_base->rank_min_xy_list_base);
+  }
+  if(!entropy_base->precise_status){
+    entropy_base->rank_max_threshold_u64=0;
+    entropy_base->rank_min_threshold_u64=~entropy_base->rank_max_threshold_u64;
+    entropy_base->rank_max_fru64_list_base=fracterval_u64_rank_list_malloc(rank_idx_max_max);
+    entropy_base->rank_min_fru64_list_base=fracterval_u64_rank_list_malloc(rank_idx_max_max);
+    if(!entropy_base->rank_row_fru64_list_base){
+      entropy_base->rank_row_fru64_list_base=fracterval_u64_list_malloc(fakefloat_x_idx_max);
+    }
+    status=(u8)(status|!(entropy_base->rank_max_fru64_list_base&&entropy_base->rank_min_fru64_list_base&&entropy_base->rank_row_fru64_list_base));
+  }else{
+    U128_SET_ZERO(entropy_base->rank_max_threshold_u128);
+    U128_NOT(entropy_base->rank_min_threshold_u128, entropy_base->rank_max_threshold_u128);
+    entropy_base->rank_max_fru128_list_base=fracterval_u128_rank_list_malloc(rank_idx_max_max);
+    entropy_base->rank_min_fru128_list_base=fracterval_u128_rank_list_malloc(rank_idx_max_max);
+    if(!entropy_base->rank_row_fru128_list_base){
+      entropy_base->rank_row_fru128_list_base=fracterval_u128_list_malloc(fakefloat_x_idx_max);
     }
+    status=(u8)(status|!(entropy_base->rank_max_fru128_list_base&&entropy_base->rank_min_fru128_list_base&&entropy_base->rank_row_fru128_list_base));
+  }
+  return status;
+}
+
+void
+transform_rank_insert_fru128(entropy_t *entropy_base, fru128 entropy, u8 max_status, ULONG entropy_x_idx, ULONG entropy_y_idx){
 /*
-Randomly perturb *pop_list_base so that we'll hopefully be able to settle into a deeper maximum on the next iteration. (We don't want to permute *pop_list_best_best_base because that's too narrow.)
+Attempt to insert the entropy of a window into one of the rank lists allocated by transform_rank_init(). Don't call here directly; use transform_rank_row_update() or transform_rank_list_merge() instead.
+
+In:
+
+  entropy_base is transform_rank_init():In:entropy_base.
+
+  entropy is the window entropy.
+
+  max_status is one to attempt insertion into the list of greatest entropies, else zero for the list of least entropies.
+
+  entropy_x_idx is the column index of the window.
+
+  entropy_y_idx is the row index of the window.
+
+Out:
+
+  The list in question and its coordinate list, count, and threshold have been updated as transform_rank_init():Out describes.
 */
-    freq_up_left=freq_min;
-    do{
-      pop_up_left=pop_list_base[freq_up_left];
-      if(pop_up_left){
-        freq_down_right=freq_min+!freq_min;
-        freq_span=freq_max-freq_down_right;
-        if(freq_span){
-          MARSAGLIA_ITERATE(marsaglia_c, marsaglia_x, random);
-          freq_down_right+=(ULONG)(random%freq_span);
+  u128 entropy_mean;
+  u8 overlap_status;
+  u128 rank_mean;
+  ULONG *rank_count_base;
+  ULONG rank_count;
+  ULONG rank_idx;
+  ULONG rank_idx_delta;
+  ULONG rank_idx_max_max;
+  fru128 *rank_list_base;
+  u8 status;
+  u128 threshold;
+  u128 *threshold_base;
+  ULONG window_x_idx_max;
+  ULONG window_y_idx_max;
+  ULONG xy_idx;
+  ULONG *xy_list_base;
+
+  if(!max_status){
+    rank_count_base=&entropy_base->rank_min_count;
+    rank_list_base=entropy_base->rank_min_fru128_list_base;
+    threshold_base=&entropy_base->rank_min_threshold_u128;
+    xy_list_base=entropy_base->rank_min_xy_list_base;
+  }else{
+    rank_count_base=&entropy_base->rank_max_count;
+    rank_list_base=entropy_base->rank_max_fru128_list_base;
+    threshold_base=&entropy_base->rank_max_threshold_u128;
+    xy_list_base=entropy_base->rank_max_xy_list_base;
+  }
+  FRU128_MEAN_TO_FTD128(entropy_mean, entropy);
+  threshold=*threshold_base;
+  if(!max_status){
+    status=U128_IS_LESS(threshold, entropy_mean);
+  }else{
+    status=U128_IS_LESS(entropy_mean, threshold);
+  }
+  if((!status)&&entropy_base->rank_overlap_status){
+/*
+The list is sorted from most to least extreme, so any overlapping window at least as extreme as this one will be found before any less extreme one, which then gets evicted.
+*/
+    rank_count=*rank_count_base;
+    rank_idx=0;
+    window_x_idx_max=entropy_base->window_x_idx_max;
+    window_y_idx_max=entropy_base->window_y_idx_max;
+    while(rank_idx!=rank_count){
+      xy_idx=rank_idx<<1;
+      overlap_status=(xy_list_base[xy_idx]<=(entropy_x_idx+window_x_idx_max))&&(entropy_x_idx<=(xy_list_base[xy_idx]+window_x_idx_max));
+      overlap_status=(u8)(overlap_status&&(xy_list_base[xy_idx+1]<=(entropy_y_idx+window_y_idx_max))&&(entropy_y_idx<=(xy_list_base[xy_idx+1]+window_y_idx_max)));
+      if(overlap_status){
+        FRU128_MEAN_TO_FTD128(rank_mean, rank_list_base[rank_idx]);
+        if(!max_status){
+          status=U128_IS_LESS_EQUAL(rank_mean, entropy_mean);
+        }else{
+          status=U128_IS_LESS_EQUAL(entropy_mean, rank_mean);
         }
-        if((freq_down_right-1)!=freq_up_left){
-          pop_down_right=pop_list_base[freq_down_right];
-          pop_delta_max=MIN(pop_down_right, pop_up_left);
-          if(freq_down_right==freq_up_left){
-            pop_delta_max>>=1;
-          }
-          if(pop_delta_max){
-            MARSAGLIA_ITERATE(marsaglia_c, marsaglia_x, random);
-            pop_delta=(ULONG)(random%pop_delta_max)+1;
+        if(status){
+          break;
+        }
+        rank_count--;
+        rank_idx_delta=rank_idx;
+        while(rank_idx_delta!=rank_count){
+          rank_list_base[rank_idx_delta]=rank_list_base[rank_idx_delta+1];
+          xy_list_base[xy_idx]=xy_list_base[xy_idx+2];
+          xy_list_base[xy_idx+1]=xy_list_base[xy_idx+3];
+          rank_idx_delta++;
+          xy_idx+=2;
+        }
+        U128_SET_ZERO(threshold);
+        if(!max_status){
+          U128_SET_ONES(threshold);
+        }
+        *threshold_base=threshold;
+      }else{
+        rank_idx++;
+      }
+    }
+    *rank_count_base=rank_count;
+  }
+  if(!status){
+    rank_count=*rank_count_base;
+    rank_idx_max_max=entropy_base->rank_idx_max_max;
+    if(!max_status){
+      status=fracterval_u128_rank_list_insert_ascending(entropy, rank_count_base, &rank_idx, rank_idx_max_max, rank_list_base, threshold_base);
+    }else{
+      status=fracterval_u128_rank_list_insert_descending(entropy, rank_count_base, &rank_idx, rank_idx_max_max, rank_list_base, threshold_base);
+    }
+    if(!status){
+      xy_idx=rank_count<<1;
+      while(xy_idx!=(rank_idx<<1)){
+        xy_list_base[xy_idx]=xy_list_base[xy_idx-2];
+        xy_list_base[xy_idx+1]=xy_list_base[xy_idx-1];
+        xy_idx-=2;
+      }
+      xy_list_base[xy_idx]=entropy_x_idx;
+      xy_list_base[xy_idx+1]=entropy_y_idx;
+    }
+  }
+  return;
+}
+
+void
+transform_rank_insert_fru64(entropy_t *entropy_base, fru64 entropy, u8 max_status, ULONG entropy_x_idx, ULONG entropy_y_idx){
 /*
-Move pop_delta population units from freq_down_right to (freq_down_right-1), and the same number from freq_up_left to (freq_up_left+1). Do the arithmetic one step at a time because it's possible that (freq_down_right==freq_up_left) or (freq_up_left==(freq_down_right-2)), resulting in a collision in the middle.
+This is the 64-bit fracterval equivalent of transform_rank_insert_fru128(). Replace all occurrences of "128" with "64" in its definition.
 */
-            pop_list_base[freq_down_right-1]+=pop_delta;
-            pop_list_base[freq_down_right]-=pop_delta;
-            pop_list_base[freq_up_left]-=pop_delta;
-            pop_list_base[freq_up_left+1]+=pop_delta;
-            freq_max+=(freq_up_left==freq_max);
-            freq_min-=(freq_down_right==freq_min);
-          }
+  u64 entropy_mean;
+  u8 overlap_status;
+  u64 rank_mean;
+  ULONG *rank_count_base;
+  ULONG rank_count;
+  ULONG rank_idx;
+  ULONG rank_idx_delta;
+  ULONG rank_idx_max_max;
+  fru64 *rank_list_base;
+  u8 status;
+  u64 threshold;
+  u64 *threshold_base;
+  ULONG window_x_idx_max;
+  ULONG window_y_idx_max;
+  ULONG xy_idx;
+  ULONG *xy_list_base;
+
+  if(!max_status){
+    rank_count_base=&entropy_base->rank_min_count;
+    rank_list_base=entropy_base->rank_min_fru64_list_base;
+    threshold_base=&entropy_base->rank_min_threshold_u64;
+    xy_list_base=entropy_base->rank_min_xy_list_base;
+  }else{
+    rank_count_base=&entropy_base->rank_max_count;
+    rank_list_base=entropy_base->rank_max_fru64_list_base;
+    threshold_base=&entropy_base->rank_max_threshold_u64;
+    xy_list_base=entropy_base->rank_max_xy_list_base;
+  }
+  FRU64_MEAN_TO_FTD64(entropy_mean, entropy);
+  threshold=*threshold_base;
+  if(!max_status){
+    status=(threshold<entropy_mean);
+  }else{
+    status=(entropy_mean<threshold);
+  }
+  if((!status)&&entropy_base->rank_overlap_status){
+    rank_count=*rank_count_base;
+    rank_idx=0;
+    window_x_idx_max=entropy_base->window_x_idx_max;
+    window_y_idx_max=entropy_base->window_y_idx_max;
+    while(rank_idx!=rank_count){
+      xy_idx=rank_idx<<1;
+      overlap_status=(xy_list_base[xy_idx]<=(entropy_x_idx+window_x_idx_max))&&(entropy_x_idx<=(xy_list_base[xy_idx]+window_x_idx_max));
+      overlap_status=(u8)(overlap_status&&(xy_list_base[xy_idx+1]<=(entropy_y_idx+window_y_idx_max))&&(entropy_y_idx<=(xy_list_base[xy_idx+1]+window_y_idx_max)));
+      if(overlap_status){
+        FRU64_MEAN_TO_FTD64(rank_mean, rank_list_base[rank_idx]);
+        if(!max_status){
+          status=(rank_mean<=entropy_mean);
+        }else{
+          status=(entropy_mean<=rank_mean);
+        }
+        if(status){
+          break;
+        }
+        rank_count--;
+        rank_idx_delta=rank_idx;
+        while(rank_idx_delta!=rank_count){
+          rank_list_base[rank_idx_delta]=rank_list_base[rank_idx_delta+1];
+          xy_list_base[xy_idx]=xy_list_base[xy_idx+2];
+          xy_list_base[xy_idx+1]=xy_list_base[xy_idx+3];
+          rank_idx_delta++;
+          xy_idx+=2;
         }
+        threshold=0;
+        if(!max_status){
+          threshold=~threshold;
+        }
+        *threshold_base=threshold;
+      }else{
+        rank_idx++;
       }
-    }while((freq_up_left!=freq_max)&&((++freq_up_left)!=whole_count));
+    }
+    *rank_count_base=rank_count;
+  }
+  if(!status){
+    rank_count=*rank_count_base;
+    rank_idx_max_max=entropy_base->rank_idx_max_max;
+    if(!max_status){
+      status=fracterval_u64_rank_list_insert_ascending(entropy, rank_count_base, &rank_idx, rank_idx_max_max, rank_list_base, threshold_base);
+    }else{
+      status=fracterval_u64_rank_list_insert_descending(entropy, rank_count_base, &rank_idx, rank_idx_max_max, rank_list_base, threshold_base);
+    }
+    if(!status){
+      xy_idx=rank_count<<1;
+      while(xy_idx!=(rank_idx<<1)){
+        xy_list_base[xy_idx]=xy_list_base[xy_idx-2];
+        xy_list_base[xy_idx+1]=xy_list_base[xy_idx-1];
+        xy_idx-=2;
+      }
+      xy_list_base[xy_idx]=entropy_x_idx;
+      xy_list_base[xy_idx+1]=entropy_y_idx;
+    }
+  }
+  return;
+}
+
+void
+transform_rank_list_merge(entropy_t *entropy_base, entropy_t *entropy_peer_base){
 /*
-While not strictly necessary, we should tighten up [freq_min, freq_max] for better performance.
+Merge the rank lists of a clone created by transform_clone() into those of another entropy_t. Don't call here directly; use transform_dispatch_banded() instead.
+
+In:
+
+  entropy_base is transform_rank_init():In:entropy_base. All its ranked windows must precede those of entropy_peer_base in row-major order.
+
+  entropy_peer_base is the clone whose rank lists to merge.
+
+Out:
+
+  The rank lists of entropy_base contain the most extreme windows of both as though they had been ranked by a single scan.
 */
-    while(!pop_list_base[freq_max]){
-      freq_max--;
+  fru128 entropy_fru128;
+  fru64 entropy_fru64;
+  u8 max_status;
+  ULONG rank_count;
+  ULONG rank_idx;
+  ULONG *xy_list_base;
+
+  max_status=0;
+  do{
+    rank_count=entropy_peer_base->rank_min_count;
+    xy_list_base=entropy_peer_base->rank_min_xy_list_base;
+    if(max_status){
+      rank_count=entropy_peer_base->rank_max_count;
+      xy_list_base=entropy_peer_base->rank_max_xy_list_base;
     }
-    while(!pop_list_base[freq_min]){
-      freq_min++;
+    rank_idx=0;
+    while(rank_idx!=rank_count){
+      if(!entropy_base->precise_status){
+        entropy_fru64=entropy_peer_base->rank_min_fru64_list_base[rank_idx];
+        if(max_status){
+          entropy_fru64=entropy_peer_base->rank_max_fru64_list_base[rank_idx];
+        }
+        transform_rank_insert_fru64(entropy_base, entropy_fru64, max_status, xy_list_base[rank_idx<<1], xy_list_base[(rank_idx<<1)+1]);
+      }else{
+        entropy_fru128=entropy_peer_base->rank_min_fru128_list_base[rank_idx];
+        if(max_status){
+          entropy_fru128=entropy_peer_base->rank_max_fru128_list_base[rank_idx];
+        }
+        transform_rank_insert_fru128(entropy_base, entropy_fru128, max_status, xy_list_base[rank_idx<<1], xy_list_base[(rank_idx<<1)+1]);
+      }
+      rank_idx++;
     }
-    freq_max_max=MAX(freq_max, freq_max_max);
-    freq_min_min=MIN(freq_min, freq_min_min);
-  }while((iteration++)!=iteration_max);
-  *logfreedom_max_base=logfreedom_best_best;
-  return status;
+  }while((max_status++)!=1);
+  return;
 }
 
 void
-transform_lookup_lists_free(transform_t *transform_base){
+transform_rank_row_update(entropy_t *entropy_base, ULONG whole_y_idx){
 /*
-Free all 128-bit fracterval lookup lists for log, logdelta, and log-of-factorial.
+Offer the entropy of every window in a row to the rank lists. Don't call here directly; use transform_dispatch() instead.
 
 In:
 
-  transform_base is transform_malloc():Out:*transform_base_base.
+  entropy_base is transform_rank_init():In:entropy_base. (entropy_base->rank_row_fru*_list_base) must contain the window entropies of the row, as left there by the most recent line entropy computation.
+
+  whole_y_idx is the row index.
+
+Out:
+
+  The rank lists have been updated as transform_rank_init():Out describes.
+*/
+  fru128 *entropy_fru128_list_base;
+  fru64 *entropy_fru64_list_base;
+  ULONG entropy_x_idx;
+  ULONG entropy_x_idx_max;
+  TRANSFORM_STATS_DECLARE(stats_time)
+
+  TRANSFORM_STATS_TIME_GET(stats_time);
+  entropy_x_idx=0;
+  entropy_x_idx_max=entropy_base->fakefloat_x_idx_max;
+  if(!entropy_base->precise_status){
+    entropy_fru64_list_base=entropy_base->rank_row_fru64_list_base;
+    do{
+      transform_rank_insert_fru64(entropy_base, entropy_fru64_list_base[entropy_x_idx], 0, entropy_x_idx, whole_y_idx);
+      transform_rank_insert_fru64(entropy_base, entropy_fru64_list_base[entropy_x_idx], 1, entropy_x_idx, whole_y_idx);
+    }while((entropy_x_idx++)!=entropy_x_idx_max);
+  }else{
+    entropy_fru128_list_base=entropy_base->rank_row_fru128_list_base;
+    do{
+      transform_rank_insert_fru128(entropy_base, entropy_fru128_list_base[entropy_x_idx], 0, entropy_x_idx, whole_y_idx);
+      transform_rank_insert_fru128(entropy_base, entropy_fru128_list_base[entropy_x_idx], 1, entropy_x_idx, whole_y_idx);
+    }while((entropy_x_idx++)!=entropy_x_idx_max);
+  }
+  TRANSFORM_STATS_TIME_ADD(TRANSFORM_STATS_IDX_OUTPUT_NS, stats_time);
+  return;
+}
+
+double
+transform_screen_fru128_to_double(double *error_base, fru128 value){
+/*
+Convert a 128-bit fracterval to double precision for the purpose of screening. Don't call here directly; use transform_screen_init() instead.
+
+In:
+
+  *error_base is undefined.
+
+  value is the fracterval to convert.
 
 Out:
 
-  All lookup lists at transform_base have been freed and their bases in *transform_base set to NULL.
+  Returns the double nearest (value.a), give or take rounding.
+
+  *error_base is an upper bound on the absolute difference between the return value and any value on [value.a, value.b], accounting for all roundings.
+*/
+  double error;
+  u64 value_hi;
+  u64 value_lo;
+  double value_double;
+  u128 width;
+  double width_double;
+
+  U128_TO_U64_PAIR(value_lo, value_hi, value.a);
+  value_double=(double)(value_hi)+(double)(value_lo)*TRANSFORM_SCREEN_FRU128_ULP;
+  U128_SUBTRACT_U128(width, value.b, value.a);
+  U128_TO_U64_PAIR(value_lo, value_hi, width);
+  width_double=(double)(value_hi)+(double)(value_lo)*TRANSFORM_SCREEN_FRU128_ULP;
+  error=width_double+4.0*TRANSFORM_SCREEN_ROUNDING*(width_double+value_double);
+  *error_base=error;
+  return value_double;
+}
+
+double
+transform_screen_fru64_to_double(double *error_base, fru64 value){
+/*
+This is the 64-bit fracterval equivalent of transform_screen_fru128_to_double(). Replace all occurrences of "128" with "64" in its definition.
 */
-  transform_base->log_fru64_list_base=fracterval_u64_free(transform_base->log_fru64_list_base);
-  transform_base->log_factorial_fru64_list_base=fracterval_u64_free(transform_base->log_factorial_fru64_list_base);
-  transform_base->log_delta_fru64_list_base=fracterval_u64_free(transform_base->log_delta_fru64_list_base);
-  transform_base->log_fru128_list_base=fracterval_u128_free(transform_base->log_fru128_list_base);
-  transform_base->log_factorial_fru128_list_base=fracterval_u128_free(transform_base->log_factorial_fru128_list_base);
-  transform_base->log_delta_fru128_list_base=fracterval_u128_free(transform_base->log_delta_fru128_list_base);
-  return;
+  double error;
+  double value_double;
+  double width_double;
+
+  value_double=(double)(value.a)*TRANSFORM_SCREEN_FRU64_ULP;
+  width_double=(double)(value.b-value.a)*TRANSFORM_SCREEN_FRU64_ULP;
+  error=width_double+4.0*TRANSFORM_SCREEN_ROUNDING*(width_double+value_double);
+  *error_base=error;
+  return value_double;
 }
 
 u8
-transform_lookup_lists_init(entropy_t *entropy_base, transform_t *transform_base){
+transform_screen_init(entropy_t *entropy_base, transform_t *transform_base){
 /*
-Intialize (64/128)-bit fracterval lists of logs, logdeltas (differences of successive logs), and logs of factorials for fast lookup.
+Enable two-tier scanning, wherein transform_dispatch_row_span() first estimates the entropy of every window in double precision, along with a proven bound on the error of the estimates, then computes fractervals only for those rows which could contain a window of minimum or maximum entropy. A row is skipped only if every window in it has an entropy which is provably greater than that of some other window, and also provably less than that of some other window. This only has an effect if (transform_base->optimize_status) is zero, (entropy_base->fakefloat_list_base) is NULL, and neither transform_rank_init() nor transform_hit_init() has been called, because otherwise the fracterval of every window is required. Nor does it affect transform_dispatch_stream() or transform_dispatch_sweep().
 
 In:
 
   entropy_base is transform_malloc():Out:*entropy_base_base.
 
-  transform_base is transform_malloc():Out:*transform_base_base.
+  transform_base is transform_malloc():Out:*transform_base_base. It must not have been created by transform_clone().
 
 Out:
 
-  Returns one if allocation failed, in which case nothing has been allocated, else zero. In the latter case, it is still possible that fracterval underflow or overflow occurred, in which case one or both saturated limits have been used to populate the lookup lists where necessary. Unfortunately, it's computationally intractable to discover the precise lookup list index values at which this would occur.
+  Returns one if allocation failed, else zero. Either way, everything allocated will be freed by transform_free_all().
 
-  The lookup lists themselves, the bases of which having been stored to *transform_base, have only been populated to the extent required in light of (entropy_base->algo_status). They must be freed via transform_lookup_lists_free() after all transforms using the same transform_malloc() parameters have completed.
+  On success, (transform_base->screen_double_list_base) contains the double-precision equivalent of the lookup list used by transform_freq_list_entropy_get_fru128(), except that for (transform_base->algo_status) Shannon, each log is multiplied by its index, so that every entropy delta is a sum of list items. (transform_base->screen_error) is an upper bound on the absolute error of each of its items, (transform_base->screen_term_max) is the greatest of them, (transform_base->screen_width) is an upper bound on the width of the fracterval of any window entropy computed without (transform_base->optimize_status), and (transform_base->screen_status) is one. The minimum and maximum entropies reported by the dispatch functions are still fractervals, and are identical to those which would otherwise have been reported.
 */
   u8 algo_status;
-  ULONG freq_span_max;
-  ULONG greater_span_max;
-  u8 ignored_status;
-  ULONG joint_span_max;
-  fru128 log_delta_fru128;
-  fru128 *log_delta_fru128_list_base;
-  fru64 log_delta_fru64;
-  fru64 *log_delta_fru64_list_base;
-  ULONG log_delta_idx_max;
-  fru128 log_factorial_fru128;
-  fru128 *log_factorial_fru128_list_base;
-  fru128 log_factorial_fru128_precise;
-  fru64 log_factorial_fru64;
-  fru64 *log_factorial_fru64_list_base;
-  ULONG log_factorial_idx_max;
-  fru128 log_fru128;
-  fru128 *log_fru128_list_base;
-  fru128 log_fru128_old;
-  fru64 log_fru64;
-  fru64 *log_fru64_list_base;
-  ULONG log_idx_max;
+  double bias_error;
+  double column_width;
+  double error;
+  double error_max;
+  double *lookup_double_list_base;
+  fru128 *lookup_fru128_list_base;
+  fru64 *lookup_fru64_list_base;
+  ULONG list_size;
   ULONG lookup_idx;
   ULONG lookup_idx_max;
-  u8 optimize_status;
-  u8 overflow_status;
+  ULONG lookup_idx_post;
   u8 precise_status;
-  u8 shift;
-  u8 shift_max;
   u8 status;
-  u64 term_u64;
-  u32 whole_max_max;
-  ULONG whole_span_max;
+  double ulp;
+  double value;
+  double value_max;
+  double width;
+  double width_max;
 
   algo_status=transform_base->algo_status;
-  freq_span_max=entropy_base->window_y_idx_post+1;
-  status=!freq_span_max;
-  log_delta_fru128_list_base=NULL;
-  log_factorial_fru128_list_base=NULL;
-  log_fru128_list_base=NULL;
-  log_delta_fru64_list_base=NULL;
-  log_factorial_fru64_list_base=NULL;
-  log_fru64_list_base=NULL;
-  whole_max_max=entropy_base->whole_max_max;
-  whole_span_max=(ULONG)(whole_max_max)+1;
-  greater_span_max=MAX(freq_span_max, whole_span_max);
-  joint_span_max=freq_span_max+whole_span_max;
-  status=(u8)(status|(joint_span_max<freq_span_max));
+  lookup_idx_max=entropy_base->window_y_idx_post;
+  lookup_fru128_list_base=transform_base->log_factorial_fru128_list_base;
+  lookup_fru64_list_base=transform_base->log_factorial_fru64_list_base;
+  if(algo_status==TRANSFORM_ALGO_STATUS_LOGFREEDOM){
+    lookup_idx_max=MAX(lookup_idx_max, (ULONG)(entropy_base->whole_max_max)+1);
+  }else if(algo_status==TRANSFORM_ALGO_STATUS_SHANNON){
+    lookup_fru128_list_base=transform_base->log_fru128_list_base;
+    lookup_fru64_list_base=transform_base->log_fru64_list_base;
+  }
+  lookup_idx_post=lookup_idx_max+1;
+  list_size=lookup_idx_post*(ULONG)(sizeof(double));
+  status=(u8)((!lookup_idx_post)||((list_size/(ULONG)(sizeof(double)))!=lookup_idx_post));
+  lookup_double_list_base=NULL;
   if(!status){
-    optimize_status=transform_base->optimize_status;
-    log_delta_idx_max=0;
-    log_factorial_idx_max=0;
-    log_idx_max=0;
-    if(algo_status==TRANSFORM_ALGO_STATUS_AGNENTROPY){
-      log_factorial_idx_max=joint_span_max-1;
-      if(optimize_status){
-        log_idx_max=freq_span_max+1;
-        status=(u8)(status|(!log_idx_max));
+    lookup_double_list_base=DEBUG_MALLOC_PARANOID(list_size);
+    status=!lookup_double_list_base;
+  }
+  transform_base->screen_double_list_base=lookup_double_list_base;
+  if(!status){
+    error_max=0.0;
+    precise_status=entropy_base->precise_status;
+    value_max=0.0;
+    width_max=0.0;
+    lookup_idx=0;
+    do{
+      if(!precise_status){
+        value=transform_screen_fru64_to_double(&error, lookup_fru64_list_base[lookup_idx]);
+      }else{
+        value=transform_screen_fru128_to_double(&error, lookup_fru128_list_base[lookup_idx]);
       }
-    }else if(algo_status==TRANSFORM_ALGO_STATUS_SHANNON){
-      log_idx_max=freq_span_max;
-      if(optimize_status){
-        log_delta_idx_max=freq_span_max;
-        log_idx_max++;
-        status=(u8)(status|!log_idx_max);
+      width_max=MAX(width_max, error);
+      if(algo_status==TRANSFORM_ALGO_STATUS_SHANNON){
+        value*=(double)(lookup_idx);
+        error=(double)(lookup_idx)*error+TRANSFORM_SCREEN_ROUNDING*value;
       }
+      lookup_double_list_base[lookup_idx]=value;
+      error_max=MAX(error_max, error);
+      value_max=MAX(value_max, value);
+    }while((lookup_idx++)!=lookup_idx_max);
+/*
+Bound the fracterval width of every window entropy that the kernels can report, so that transform_dispatch_row_span() can widen its thresholds accordingly. Fracterval addition, subtraction, and multiplication by a whole (v) preserve the invariant that the width plus one ULP is additive, or multiplied by v, respectively. Every entropy delta is the sum of lookup list items times multiplicities totalling at most (window_y_idx_post+2), starting from zero. A window at column index x is the bias minus (window_x_idx_post) such deltas, followed by x rolls, each of which adds one delta and subtracts another. Thus its width is at most that of the bias plus (window_x_idx_post+2x) times that of a delta, plus one ULP for each. The estimates in transform_screen_fru*_to_double() of lookup list item width are upper bounds, and (1+8*TRANSFORM_SCREEN_ROUNDING) more than covers the rounding of the few products and sums below.
+*/
+    if(!precise_status){
+      transform_screen_fru64_to_double(&bias_error, entropy_base->window_bias_fru64);
+      ulp=TRANSFORM_SCREEN_FRU64_ULP;
     }else{
-      log_factorial_idx_max=greater_span_max;
-      log_idx_max=log_factorial_idx_max+1;
-      status=(u8)(status|!log_idx_max);
+      transform_screen_fru128_to_double(&bias_error, entropy_base->window_bias_fru128);
+      ulp=TRANSFORM_SCREEN_FRU128_ULP;
     }
-    precise_status=entropy_base->precise_status;
+    column_width=((double)(entropy_base->window_y_idx_post)+3.0)*(width_max+ulp);
+    width=bias_error+ulp+((double)(entropy_base->window_x_idx_post)+2.0*(double)(entropy_base->fakefloat_x_idx_max))*column_width;
+    width*=1.0+8.0*TRANSFORM_SCREEN_ROUNDING;
+    transform_base->screen_error=error_max;
+    transform_base->screen_term_max=value_max;
+    transform_base->screen_width=width;
+    transform_base->screen_status=1;
+  }
+  return status;
+}
+
+u8
+transform_state_check(ULONG *entropy_y_idx_post_base, ULONG state_size, u8 *state_u8_list_base, u32 *whole_max_max_base){
+/*
+Verify the integrity of a checkpoint produced by transform_state_export(), and extract those parameters which the caller requires in order to call transform_malloc() prior to transform_state_import().
+
+In:
+
+  *entropy_y_idx_post_base is undefined.
+
+  state_size is the size of the checkpoint, in bytes.
+
+  state_u8_list_base is the base of the checkpoint, aligned to U64_SIZE. Its contents are modified temporarily, but restored before returning.
+
+  *whole_max_max_base is undefined.
+
+Out:
+
+  Returns one if the checkpoint is truncated or corrupt, or was produced by a build with a different ULONG size, else zero.
+
+  *entropy_y_idx_post_base is transform_state_export():In:entropy_y_idx_post if zero was returned, else undefined.
+
+  *whole_max_max_base is transform_malloc():In:whole_max_max as it was when the checkpoint was produced if zero was returned, else undefined.
+*/
+  u64 lmd2;
+  u64 lmd2_expected;
+  transform_state_t state;
+  u8 status;
+
+  status=1;
+  if((TRANSFORM_STATE_HEADER_SIZE<=state_size)&&!(state_size&(U64_SIZE-1))){
+    memcpy(&state, state_u8_list_base, sizeof(transform_state_t));
+    status=(state.signature!=TRANSFORM_STATE_SIGNATURE);
+    status=(u8)(status|(state.size!=state_size));
+    status=(u8)(status|(state.ulong_size_log2!=ULONG_SIZE_LOG2));
     if(!status){
-      if(log_delta_idx_max){
-        if(precise_status){
-          log_delta_fru128_list_base=fracterval_u128_list_malloc(log_delta_idx_max);
-          status=(u8)(status|!log_delta_fru128_list_base);
-        }else{
-          log_delta_fru64_list_base=fracterval_u64_list_malloc(log_delta_idx_max);
-          status=(u8)(status|!log_delta_fru64_list_base);
-        }
-      }
-      if(log_factorial_idx_max){
-        if((algo_status==TRANSFORM_ALGO_STATUS_LOGFREEDOM)||precise_status){
-          log_factorial_fru128_list_base=fracterval_u128_list_malloc(log_factorial_idx_max);
-          status=(u8)(status|!log_factorial_fru128_list_base);
-        }
-        if(!precise_status){
-          log_factorial_fru64_list_base=fracterval_u64_list_malloc(log_factorial_idx_max);
-          status=(u8)(status|!log_factorial_fru64_list_base);
-        }
-      }
-      if(log_idx_max){
-        if((algo_status==TRANSFORM_ALGO_STATUS_LOGFREEDOM)||precise_status){
-          log_fru128_list_base=fracterval_u128_list_malloc(log_idx_max);
-          status=(u8)(status|!log_fru128_list_base);
-        }
-        if(!precise_status){
-          log_fru64_list_base=fracterval_u64_list_malloc(log_idx_max);
-          status=(u8)(status|!log_fru64_list_base);
-        }
-      }
-      if(!status){
-        lookup_idx_max=MAX(log_delta_idx_max, log_factorial_idx_max);
-        lookup_idx_max=MAX(log_idx_max, lookup_idx_max);
-        FRU128_SET_ZERO(log_factorial_fru128_precise);
-        FRU128_SET_ZERO(log_fru128_old);
-        ignored_status=0;
-        lookup_idx=1;
-        shift=0;
-        shift_max=U64_BITS-U64_BITS_LOG2;
-        do{
-          term_u64=lookup_idx;
-          FRU128_LOG_U64(log_fru128, term_u64, status);
-          if(lookup_idx<=log_delta_idx_max){
-            FRU128_SUBTRACT_FRU128(log_delta_fru128, log_fru128, log_fru128_old, ignored_status);
-            FRU128_SHIFT_RIGHT_SELF(log_delta_fru128, shift_max);
-            if(log_delta_fru64_list_base){
-              FRU128_TO_FRU64_MID(log_delta_fru64, log_delta_fru128);
-              log_delta_fru64_list_base[lookup_idx-1]=log_delta_fru64;
-            }
-            if(log_delta_fru128_list_base){
-              log_delta_fru128_list_base[lookup_idx-1]=log_delta_fru128;
-            }
-          }
-          if(lookup_idx<=log_factorial_idx_max){
-            do{
-              FRU128_SHIFT_RIGHT(log_factorial_fru128, shift, log_fru128);
-              overflow_status=0;
-              FRU128_ADD_FRU128_SELF(log_factorial_fru128, log_factorial_fru128_precise, overflow_status);
-              if(!overflow_status){
-                log_factorial_fru128_precise=log_factorial_fru128;
-              }else{
-                if(shift==shift_max){
-  /*
-  log_factorial_fru128_precise has exhausted the maximum available precision, but don't bother to report an error. Instead, just set the result to ambiguous, so that if it's ever used (which is unlikely in practice), it will induce a fracterval precision error upon any subsequent computation. (We can't saturate to ones because we don't know if that's actually valid for the lower bound.)
-  */
-                  break;
-                }
-                shift++;
-                FRU128_SHIFT_RIGHT_SELF(log_factorial_fru128_precise, 1);
-              }
-            }while(overflow_status);
-            if(!overflow_status){
-              shift=(u8)(shift_max-shift);
-              FRU128_SHIFT_RIGHT_SELF(log_factorial_fru128, shift);
-              shift=(u8)(shift_max-shift);
-            }else{
-              FRU128_SET_AMBIGUOUS(log_factorial_fru128);
-            }
-            if(log_factorial_fru64_list_base){
-              FRU128_TO_FRU64_MID(log_factorial_fru64, log_factorial_fru128);
-              log_factorial_fru64_list_base[lookup_idx]=log_factorial_fru64;
-            }
-            if(log_factorial_fru128_list_base){
-              log_factorial_fru128_list_base[lookup_idx]=log_factorial_fru128;
-            }
-          }
-          log_fru128_old=log_fru128;
-          if(lookup_idx<=log_idx_max){
-            FRU128_SHIFT_RIGHT_SELF(log_fru128, shift_max);
-            if(log_fru64_list_base){
-              FRU128_TO_FRU64_MID(log_fru64, log_fru128);
-              log_fru64_list_base[lookup_idx]=log_fru64;
-            }
-            if(log_fru128_list_base){
-              log_fru128_list_base[lookup_idx]=log_fru128;
-            }
-          }
-          lookup_idx++;
-        }while(lookup_idx<=lookup_idx_max);
-        if(log_delta_idx_max){
-          term_u64=(u64)(lookup_idx_max)+1;
-          FRU128_LOG_U64(log_fru128, term_u64, ignored_status);
-          FRU128_SUBTRACT_FRU128(log_delta_fru128, log_fru128, log_fru128_old, ignored_status);
-  /*
-  Prevent the compiler from complaining about ignored_status.
-  */
-          status=(u8)(status|(ignored_status&0));  
-          FRU128_SHIFT_RIGHT_SELF(log_delta_fru128, shift_max);
-          if(log_delta_fru64_list_base){
-            FRU128_TO_FRU64_MID(log_delta_fru64, log_delta_fru128);
-            log_delta_fru64_list_base[log_delta_idx_max]=log_delta_fru64;
-            FRU64_SET_ONES(log_delta_fru64);
-            log_delta_fru64_list_base[0]=log_delta_fru64;
-          }
-          if(log_delta_fru128_list_base){
-            log_delta_fru128_list_base[log_delta_idx_max]=log_delta_fru128;
-            FRU128_SET_ONES(log_delta_fru128);
-            log_delta_fru128_list_base[0]=log_delta_fru128;
-          }
-        }
-        if(log_factorial_fru64_list_base){
-          FRU64_SET_ZERO(log_factorial_fru64);
-          log_factorial_fru64_list_base[0]=log_factorial_fru64;
-          log_factorial_fru64_list_base[1]=log_factorial_fru64;
-        }
-        if(log_factorial_fru128_list_base){
-          FRU128_SET_ZERO(log_factorial_fru128);
-          log_factorial_fru128_list_base[0]=log_factorial_fru128;
-          log_factorial_fru128_list_base[1]=log_factorial_fru128;
-        }
-        if(log_fru64_list_base){
-          FRU64_SET_ZERO(log_fru64);
-          log_fru64_list_base[0]=log_fru64;
-          log_fru64_list_base[1]=log_fru64;
-        }
-        if(log_fru128_list_base){
-          FRU128_SET_ZERO(log_fru128);
-          log_fru128_list_base[0]=log_fru128;
-          log_fru128_list_base[1]=log_fru128;
-        }
-      }
-    }
-    transform_base->log_delta_fru128_list_base=log_delta_fru128_list_base;
-    transform_base->log_factorial_fru128_list_base=log_factorial_fru128_list_base;
-    transform_base->log_fru128_list_base=log_fru128_list_base;
-    transform_base->log_delta_fru64_list_base=log_delta_fru64_list_base;
-    transform_base->log_factorial_fru64_list_base=log_factorial_fru64_list_base;
-    transform_base->log_fru64_list_base=log_fru64_list_base;
-    if(status){
-      transform_lookup_lists_free(transform_base);
+/*
+The hash was computed with its own field zeroed, so do likewise before recomputing it.
+*/
+      lmd2=state.lmd2;
+      state.lmd2=0;
+      memcpy(state_u8_list_base, &state, sizeof(transform_state_t));
+      lmd2_expected=transform_state_lmd2_get(state_size, state_u8_list_base);
+      state.lmd2=lmd2;
+      memcpy(state_u8_list_base, &state, sizeof(transform_state_t));
+      status=(lmd2!=lmd2_expected);
+      *entropy_y_idx_post_base=(ULONG)(state.entropy_y_idx_post);
+      *whole_max_max_base=state.whole_max_max;
     }
   }
   return status;
 }
 
 void
-transform_malloc(u8 algo_status, u8 discount_status, entropy_t **entropy_base_base, u32 *fakefloat_list_base, u8 granularity, u8 optimize_status, u8 precise_status, u8 rounding_status, transform_t **transform_base_base, u32 whole_max_max, ULONG whole_x_idx_max, ULONG whole_y_idx_max, ULONG window_x_idx_max, ULONG window_y_idx_max){
+transform_state_export(entropy_t *entropy_base, ULONG entropy_y_idx_post, ULONG state_size, u8 *state_u8_list_base, transform_t *transform_base){
 /*
-Initialize data structures in preparation for one or more entropy scans with a given window size.
+Serialize the state of a scan which has been dispatched via transform_dispatch_stream() so that it can be resumed later by transform_state_import(), for instance after more rows have been appended to the array of wholes.
 
 In:
 
-  algo_status is one of the TRANSFORM_ALGO_STATUS constants, which implies which definition of entropy to use.
+  entropy_base is transform_malloc():Out:*entropy_base_base. Its extremes must not yet have been converted by transform_entropy_to_discount().
 
-  discount_status is one to compute discount nats, else zero for total entropy. Discount nats will be computed on a per-channel basis, whereas total entropy will be per-window.
+  entropy_y_idx_post is the number of window rows processed so far, which is one more than transform_dispatch_stream():In:whole_y_idx_max of the last call.
 
-  *entropy_base_base is undefined.
+  state_size is the return value of transform_state_size_get().
 
-  fakefloat_list_base is NULL to compute only the minimum and maximum entropy across all windows, and to provide the coordinates of their upper left corners. Else the output of transform_fakefloat_list_malloc() with the same values of whole_x_idx_max, whole_y_idx_max, window_x_idx_max, and window_y_idx_max.
+  *state_u8_list_base is undefined and state_size bytes long, aligned to U64_SIZE.
 
-  granularity is the size of a whole number, less one.
+  transform_base is transform_malloc():Out:*transform_base_base.
 
-  optimize_status is one to optimize performance at the expense of precision. In practice, it should only be set to zero in order to confirm and further resolve previous scan results.
+Out:
 
-  precise_status is zero for 32.32 or one for 64.64 fixed-points expressed as 64-bit or 128-bit fractervals, respectively.
+  *state_u8_list_base is a checkpoint consisting of a transform_state_t padded to TRANSFORM_STATE_HEADER_SIZE, followed by: (1) the frequency list of each column, (2) the population list of each column if (transform_base->algo_status) is TRANSFORM_ALGO_STATUS_LOGFREEDOM, (3) the entropy delta list, (4) the rank lists and their coordinate lists, greatest entropies first, if (entropy_base->rank_status) is one, and (5) zero padding to a multiple of U64_SIZE. The header is protected by an LMD2 hash of the entire checkpoint.
+*/
+  transform_state_t state;
+
+  memset(&state, 0, sizeof(transform_state_t));
+  state.max_max_u128=entropy_base->max_max_u128;
+  state.min_min_u128=entropy_base->min_min_u128;
+  state.rank_max_threshold_u128=entropy_base->rank_max_threshold_u128;
+  state.rank_min_threshold_u128=entropy_base->rank_min_threshold_u128;
+  state.entropy_y_idx_post=entropy_y_idx_post;
+  state.freq_list_idx_max=transform_base->freq_list_idx_max;
+  state.max_max_u64=entropy_base->max_max_u64;
+  state.max_max_x_idx=entropy_base->max_max_x_idx;
+  state.max_max_y_idx=entropy_base->max_max_y_idx;
+  state.min_min_u64=entropy_base->min_min_u64;
+  state.min_min_x_idx=entropy_base->min_min_x_idx;
+  state.min_min_y_idx=entropy_base->min_min_y_idx;
+  state.rank_idx_max_max=entropy_base->rank_idx_max_max;
+  state.rank_max_count=entropy_base->rank_max_count;
+  state.rank_max_threshold_u64=entropy_base->rank_max_threshold_u64;
+  state.rank_min_count=entropy_base->rank_min_count;
+  state.rank_min_threshold_u64=entropy_base->rank_min_threshold_u64;
+  state.signature=TRANSFORM_STATE_SIGNATURE;
+  state.size=state_size;
+  state.whole_x_idx_max=entropy_base->whole_x_idx_max;
+  state.window_x_idx_max=entropy_base->window_x_idx_max;
+  state.window_y_idx_max=entropy_base->window_y_idx_max;
+  state.whole_max_max=entropy_base->whole_max_max;
+  state.algo_status=transform_base->algo_status;
+  state.discount_status=entropy_base->discount_status;
+  state.freq_size_log2=transform_base->freq_size_log2;
+  state.granularity=entropy_base->granularity;
+  state.optimize_status=transform_base->optimize_status;
+  state.precise_status=entropy_base->precise_status;
+  state.rank_overlap_status=entropy_base->rank_overlap_status;
+  state.rank_status=entropy_base->rank_status;
+  state.rounding_status=entropy_base->rounding_status;
+  state.ulong_size_log2=ULONG_SIZE_LOG2;
+  memset(state_u8_list_base, 0, state_size);
+  memcpy(state_u8_list_base, &state, sizeof(transform_state_t));
+  transform_state_lists_copy(entropy_base, 1, state_u8_list_base, transform_base);
+  state.lmd2=transform_state_lmd2_get(state_size, state_u8_list_base);
+  memcpy(state_u8_list_base, &state, sizeof(transform_state_t));
+  return;
+}
 
-  rounding_status is one of the TRANSFORM_ROUNDING_STATUS constants, which instructs Transform as to how to round fractervals during conversion to fakefloats. Generally, one should use TRANSFORM_ROUNDING_STATUS_NEAREST_EVEN unless the intention is to place more rigorous bounds on entropy values. This value has no effect currently if fakefloat_list_base is NULL, although it could if Transform eventually supports integrated float-to-whole conversion.
+u8
+transform_state_import(entropy_t *entropy_base, ULONG *entropy_y_idx_post_base, ULONG state_size, u8 *state_u8_list_base, transform_t *transform_base){
+/*
+Restore the state of a scan from a checkpoint produced by transform_state_export(), so that transform_dispatch_stream() can resume at the first window row which it had not yet processed. The array of wholes may since have grown by any number of rows, but must otherwise be unchanged.
 
-  *transform_base_base is undefined.
-  
-  whole_max_max is the maximum possible whole number that _could_ ever be encountered during any scan using Out:*entropy_base_base and Out:*transform_base_base. Unless the caller has some prior knowledge of this value, it would typically be discovered via Whole:whole_max_get().
+In:
 
-  whole_x_idx_max is the number of columns (channels) per row (spectrum) in the array of wholes to scan, less one.
+  entropy_base is transform_malloc():Out:*entropy_base_base, with all parameters, apart from whole_y_idx_max, identical to those used to produce the checkpoint. whole_max_max must be transform_state_check():Out:*whole_max_max_base. If the checkpoint was produced after transform_rank_init(), then transform_rank_init() must have been called with the same parameters.
 
-  whole_y_idx_max is the number of rows in the array of wholes to scan, less one. At least one because the entropy of one whole is not meaningful.
+  *entropy_y_idx_post_base is undefined.
 
-  window_x_idx_max is the number of columns (channels) per row (spectrum) in the window of wholes to scan, less one. On [0, whole_x_idx_max].
+  state_size is the size of the checkpoint, in bytes.
 
-  window_y_idx_max is the number of rows in the window of wholes to scan, less one. On [1, whole_y_idx_max].
+  state_u8_list_base is the base of the checkpoint, aligned to U64_SIZE.
+
+  transform_base is transform_malloc():Out:*transform_base_base.
 
 Out:
 
-  *entropy_base_base has been populated with scan parameters which the caller can safely read but not write. It's a readonly shared data structure in this sense. If it is NULL, then *transform_base_base is also NULL, and allocation has failed due to either memory exhaustion or invalid inputs.
+  Returns one if the checkpoint is corrupt or incompatible with the parameters of *entropy_base and *transform_base, in which case the latter might have been partially overwritten and should only be freed. Else zero.
 
-  *transform_base_base is NULL iff *entropy_base_base is null. Otherwise, it's the base of a private data structure to be used for scanning.
+  *entropy_y_idx_post_base is transform_state_export():In:entropy_y_idx_post, which is the value of transform_dispatch_stream():In:whole_y_idx_min with which to resume. It's at most one more than (entropy_base->fakefloat_y_idx_max), the equality case meaning that no new windows are available. Undefined if one was returned.
+
+  The extremes, rank lists, and per-column lists in *entropy_base and *transform_base are as they were at the time of export.
 */
-  entropy_t *entropy_base;
-  fru128 *entropy_delta_fru128_list_base;
-  fru64 *entropy_delta_fru64_list_base;
-  ULONG *freq_list_base;
-  ULONG **freq_list_base_list_base;
-  ULONG freq_list_base_list_size;
-  ULONG freq_list_idx;
-  ULONG freq_list_idx_max;
-  ULONG freq_list_idx_post;
-  ULONG freq_list_size;
-  ULONG pop_idx_post;
-  ULONG *pop_list_base;
-  ULONG **pop_list_base_list_base;
-  ULONG pop_list_size;
+  ULONG entropy_y_idx_post;
+  transform_state_t state;
   u8 status;
-  transform_t *transform_base;
-  ULONG whole_count;
-  ULONG whole_span_max;
-  ULONG whole_x_idx_post;
-  ULONG whole_y_idx_post;
-  ULONG window_x_idx_post;
-  ULONG window_y_idx_post;
+  u32 whole_max_max;
 
-  freq_list_idx_max=(optimize_status?whole_x_idx_max:window_x_idx_max);
-  freq_list_idx_post=freq_list_idx_max+1;
-  status=!freq_list_idx_post;
-  freq_list_base_list_size=freq_list_idx_post*(ULONG)(sizeof(u32 *));
-  status=(u8)(status|((freq_list_base_list_size/(ULONG)(sizeof(u32 *)))!=freq_list_idx_post));
-  status=(u8)(status|(whole_x_idx_max<window_x_idx_max));
-  whole_x_idx_post=whole_x_idx_max+1;
-  status=(u8)(status|!whole_x_idx_post);
-  status=(u8)(status|(whole_y_idx_max<window_y_idx_max));
-  whole_y_idx_post=whole_y_idx_max+1;
-  status=(u8)(status|!whole_y_idx_post);
-  whole_count=whole_x_idx_post*whole_y_idx_post;
-  status=(u8)(status|((!whole_count)||((whole_count/whole_x_idx_post)!=whole_y_idx_post)));
-  window_x_idx_post=window_x_idx_max+1;
-  status=(u8)(status|!window_x_idx_post);
-  window_y_idx_post=window_y_idx_max+1;
-  status=(u8)(status|!window_y_idx_post);
-  whole_span_max=(ULONG)(whole_max_max)+1;
-  #ifdef _32_
-    status=(u8)(status|!whole_span_max);
-  #endif
-  freq_list_size=whole_span_max<<ULONG_SIZE_LOG2;
-  #ifdef _32_
-    status=(u8)(status|((freq_list_size>>ULONG_SIZE_LOG2)!=whole_span_max));
-  #endif
-  pop_idx_post=window_y_idx_post+1;
-  status=(u8)(status|!pop_idx_post);
-  pop_list_size=pop_idx_post<<ULONG_SIZE_LOG2;
-  status=(u8)(status|((pop_list_size>>ULONG_SIZE_LOG2)!=pop_idx_post));
-  entropy_base=NULL;
-  transform_base=NULL;
+  status=transform_state_check(&entropy_y_idx_post, state_size, state_u8_list_base, &whole_max_max);
   if(!status){
-    entropy_base=DEBUG_CALLOC_PARANOID((ULONG)(sizeof(entropy_t)));
-    transform_base=DEBUG_CALLOC_PARANOID((ULONG)(sizeof(transform_t)));
-    if(entropy_base&&transform_base){
-      entropy_base->fakefloat_list_base=fakefloat_list_base;
-      entropy_base->fakefloat_x_idx_max=whole_x_idx_max-window_x_idx_max;
-      entropy_base->fakefloat_y_idx_max=whole_y_idx_max-window_y_idx_max;
-      entropy_base->granularity=granularity;
-      entropy_base->discount_status=discount_status;
-      entropy_base->precise_status=precise_status;
-      entropy_base->rounding_status=rounding_status;
-      entropy_base->whole_count=whole_count;
-      entropy_base->whole_max_max=whole_max_max;
-      entropy_base->whole_x_idx_max=whole_x_idx_max;
-      entropy_base->whole_x_idx_post=whole_x_idx_post;
-      entropy_base->whole_y_idx_max=whole_y_idx_max;
-      entropy_base->whole_y_idx_post=whole_y_idx_post;
-      entropy_base->window_x_idx_max=window_x_idx_max;
-      entropy_base->window_x_idx_post=window_x_idx_post;
-      entropy_base->window_y_idx_max=window_y_idx_max;
-      entropy_base->window_y_idx_post=window_y_idx_post;
-      transform_base->algo_status=algo_status;
-      transform_base->freq_list_idx_max=freq_list_idx_max;
-      pop_list_base=DEBUG_MALLOC_PARANOID(pop_list_size);
-      status=(u8)(status|!pop_list_base);
-      transform_base->pop_list_base=pop_list_base;
-      freq_list_base_list_base=DEBUG_CALLOC_PARANOID(freq_list_base_list_size);
-      status=(u8)(status|!freq_list_base_list_base);
-      transform_base->freq_list_base_list_base=freq_list_base_list_base;
-      if(algo_status==TRANSFORM_ALGO_STATUS_LOGFREEDOM){
-        pop_list_base_list_base=DEBUG_CALLOC_PARANOID(freq_list_base_list_size);
-        status=(u8)(status|!pop_list_base_list_base);
-        transform_base->pop_list_base_list_base=pop_list_base_list_base;
-        pop_list_base=DEBUG_MALLOC_PARANOID(pop_list_size);
-        status=(u8)(status|!pop_list_base);
-        transform_base->pop_list_best_base=pop_list_base;
-        pop_list_base=DEBUG_MALLOC_PARANOID(pop_list_size);
-        status=(u8)(status|!pop_list_base);
-        transform_base->pop_list_best_best_base=pop_list_base;
-      }
-      transform_base->optimize_status=optimize_status;
+    memcpy(&state, state_u8_list_base, sizeof(transform_state_t));
+    status=transform_state_parameters_check(transform_base->algo_status, entropy_base->discount_status, entropy_base->granularity, transform_base->optimize_status, entropy_base->precise_status, entropy_base->rank_idx_max_max, entropy_base->rank_overlap_status, entropy_base->rank_status, entropy_base->rounding_status, state_u8_list_base, entropy_base->whole_x_idx_max, entropy_base->window_x_idx_max, entropy_base->window_y_idx_max);
+    status=(u8)(status|(state.freq_list_idx_max!=transform_base->freq_list_idx_max));
+    status=(u8)(status|(state.freq_size_log2!=transform_base->freq_size_log2));
+    status=(u8)(status|(state.whole_max_max!=entropy_base->whole_max_max));
+    status=(u8)(status|!entropy_y_idx_post);
+    status=(u8)(status|(entropy_base->fakefloat_y_idx_max<(entropy_y_idx_post-1)));
+    if(entropy_base->rank_status){
+      status=(u8)(status|((state.rank_idx_max_max+1)<state.rank_max_count));
+      status=(u8)(status|((state.rank_idx_max_max+1)<state.rank_min_count));
       if(!status){
-        freq_list_idx=0;
-        do{
-          freq_list_base=DEBUG_CALLOC_PARANOID(freq_list_size);
-          if(!freq_list_base){
-            status=1;
-            break;
-          }
-          freq_list_base_list_base[freq_list_idx]=freq_list_base;
-          if(algo_status==TRANSFORM_ALGO_STATUS_LOGFREEDOM){
-            pop_list_base=DEBUG_CALLOC_PARANOID(pop_list_size);
-            if(!pop_list_base){
-              status=1;
-              break;
-            }
-            pop_list_base_list_base[freq_list_idx]=pop_list_base;
-          }
-        }while((freq_list_idx++)!=freq_list_idx_max);
-        if(!precise_status){
-          entropy_delta_fru64_list_base=fracterval_u64_list_malloc(freq_list_idx_max);
-          status=!entropy_delta_fru64_list_base;
-          transform_base->entropy_delta_fru64_list_base=entropy_delta_fru64_list_base;
-        }else{
-          entropy_delta_fru128_list_base=fracterval_u128_list_malloc(freq_list_idx_max);
-          status=!entropy_delta_fru128_list_base;
-          transform_base->entropy_delta_fru128_list_base=entropy_delta_fru128_list_base;
-        }
-        if(!status){
-          status=transform_lookup_lists_init(entropy_base, transform_base);
-          if(!status){
-            if((algo_status==TRANSFORM_ALGO_STATUS_SHANNON)&&optimize_status){
-              status=transform_delta_delta_list_init(&transform_base->entropy_delta_delta_fru128_list_base, &transform_base->entropy_delta_delta_fru64_list_base, precise_status);
-            }
-            if(!status){
-              status=transform_window_entropy_offsets_get(entropy_base, transform_base);
-            }
-          }
-        }
+        entropy_base->rank_max_count=(ULONG)(state.rank_max_count);
+        entropy_base->rank_min_count=(ULONG)(state.rank_min_count);
       }
     }
-    if(status){
-      transform_free_all(&entropy_base, &transform_base);
+    if(!status){
+      status=(transform_state_size_get(entropy_base, transform_base)!=state_size);
+    }
+    if(!status){
+      entropy_base->max_max_u128=state.max_max_u128;
+      entropy_base->min_min_u128=state.min_min_u128;
+      entropy_base->rank_max_threshold_u128=state.rank_max_threshold_u128;
+      entropy_base->rank_min_threshold_u128=state.rank_min_threshold_u128;
+      entropy_base->max_max_u64=state.max_max_u64;
+      entropy_base->max_max_x_idx=(ULONG)(state.max_max_x_idx);
+      entropy_base->max_max_y_idx=(ULONG)(state.max_max_y_idx);
+      entropy_base->min_min_u64=state.min_min_u64;
+      entropy_base->min_min_x_idx=(ULONG)(state.min_min_x_idx);
+      entropy_base->min_min_y_idx=(ULONG)(state.min_min_y_idx);
+      entropy_base->rank_max_threshold_u64=state.rank_max_threshold_u64;
+      entropy_base->rank_min_threshold_u64=state.rank_min_threshold_u64;
+      transform_state_lists_copy(entropy_base, 0, state_u8_list_base, transform_base);
     }
   }
-  *entropy_base_base=entropy_base;
-  *transform_base_base=transform_base;
-  return;
+  *entropy_y_idx_post_base=entropy_y_idx_post;
+  return status;
 }
 
 void
-transform_pop_list_fill(ULONG *freq_list_base, ULONG *pop_list_base, ULONG whole_idx_max, u32 whole_max_max){
+transform_state_lists_copy(entropy_t *entropy_base, u8 export_status, u8 *state_u8_list_base, transform_t *transform_base){
 /*
-Given a valid frequency list, fill a population (frequency-of-frequency) list.
+Copy the lists which follow the header of a checkpoint, in either direction. Don't call here directly; use transform_state_export() or transform_state_import() instead.
 
 In:
 
-  *freq_list_base contains the frequency (occurrence count) each corresponding whole on [0, whole_max_max].
+  entropy_base is transform_state_export():In:entropy_base.
 
-  *pop_list_base is writeable on [0, whole_idx_max+1].
+  export_status is one to copy from *entropy_base and *transform_base to *state_u8_list_base, else zero for the opposite direction.
 
-  whole_idx_max is transform_pop_list_malloc():In:whole_idx_max.
+  state_u8_list_base is transform_state_export():In:state_u8_list_base.
 
-  whole_max_max can be as low as the greatest whole with nonzero frequency at freq_list_base, but in general, will be the same value which was previously passed to transform_malloc().
+  transform_base is transform_state_export():In:transform_base.
 
 Out:
 
-  *pop_list_base contains the populations of all possible frequencies at freq_list_base. Index zero contains the number of zeroes at the latter. The last index, which is (whole_idx_max+1), is zero unless all wholes are identical, in which case it's one. A value of P at index F implies that that frequency F occurs P times at freq_list_base.
+  The lists have been copied in the order described in transform_state_export():Out.
 */
-  ULONG freq;
-  ULONG freq_idx;
-  ULONG freq_max_max;
-  ULONG freq_sum;
+  ULONG freq_list_idx;
+  ULONG freq_list_idx_max;
+  ULONG freq_list_size;
+  void *list_base;
+  ULONG list_size;
+  u8 max_status;
+  ULONG pop_list_size;
+  ULONG rank_count;
+  ULONG state_u8_idx;
 
-  freq_max_max=whole_idx_max+1;
-  transform_ulong_list_zero(freq_max_max, pop_list_base);
-  freq_idx=0;
-  freq_sum=0;
+  freq_list_idx_max=transform_base->freq_list_idx_max;
+  freq_list_size=((ULONG)(entropy_base->whole_max_max)+1)<<transform_base->freq_size_log2;
+  pop_list_size=(entropy_base->window_y_idx_post+1)<<ULONG_SIZE_LOG2;
+  state_u8_idx=TRANSFORM_STATE_HEADER_SIZE;
+  freq_list_idx=0;
   do{
-    freq=freq_list_base[freq_idx];
-    freq_idx++;
-    freq_sum+=freq;
-    pop_list_base[freq]++;
-  }while(freq_sum<=whole_idx_max);
-  pop_list_base[0]+=(ULONG)(whole_max_max)+1-freq_idx;
+    list_base=transform_base->freq_list_base_list_base[freq_list_idx];
+    if(export_status){
+      memcpy(&state_u8_list_base[state_u8_idx], list_base, (size_t)(freq_list_size));
+    }else{
+      memcpy(list_base, &state_u8_list_base[state_u8_idx], (size_t)(freq_list_size));
+    }
+    state_u8_idx+=freq_list_size;
+  }while((freq_list_idx++)!=freq_list_idx_max);
+  if(transform_base->pop_list_base_list_base){
+    freq_list_idx=0;
+    do{
+      list_base=transform_base->pop_list_base_list_base[freq_list_idx];
+      if(export_status){
+        memcpy(&state_u8_list_base[state_u8_idx], list_base, (size_t)(pop_list_size));
+      }else{
+        memcpy(list_base, &state_u8_list_base[state_u8_idx], (size_t)(pop_list_size));
+      }
+      state_u8_idx+=pop_list_size;
+    }while((freq_list_idx++)!=freq_list_idx_max);
+  }
+  if(!entropy_base->precise_status){
+    list_base=transform_base->entropy_delta_fru64_list_base;
+    list_size=(freq_list_idx_max+1)*(ULONG)(sizeof(fru64));
+  }else{
+    list_base=transform_base->entropy_delta_fru128_list_base;
+    list_size=(freq_list_idx_max+1)*(ULONG)(sizeof(fru128));
+  }
+  if(export_status){
+    memcpy(&state_u8_list_base[state_u8_idx], list_base, (size_t)(list_size));
+  }else{
+    memcpy(list_base, &state_u8_list_base[state_u8_idx], (size_t)(list_size));
+  }
+  state_u8_idx+=list_size;
+  if(entropy_base->rank_status){
+    max_status=1;
+    do{
+      rank_count=entropy_base->rank_min_count;
+      list_base=entropy_base->rank_min_fru128_list_base;
+      if(!entropy_base->precise_status){
+        list_base=entropy_base->rank_min_fru64_list_base;
+      }
+      if(max_status){
+        rank_count=entropy_base->rank_max_count;
+        list_base=entropy_base->rank_max_fru128_list_base;
+        if(!entropy_base->precise_status){
+          list_base=entropy_base->rank_max_fru64_list_base;
+        }
+      }
+      list_size=rank_count*(ULONG)(sizeof(fru128));
+      if(!entropy_base->precise_status){
+        list_size=rank_count*(ULONG)(sizeof(fru64));
+      }
+      if(export_status){
+        memcpy(&state_u8_list_base[state_u8_idx], list_base, (size_t)(list_size));
+      }else{
+        memcpy(list_base, &state_u8_list_base[state_u8_idx], (size_t)(list_size));
+      }
+      state_u8_idx+=list_size;
+      list_base=entropy_base->rank_min_xy_list_base;
+      if(max_status){
+        list_base=entropy_base->rank_max_xy_list_base;
+      }
+      list_size=rank_count<<(ULONG_SIZE_LOG2+1);
+      if(export_status){
+        memcpy(&state_u8_list_base[state_u8_idx], list_base, (size_t)(list_size));
+      }else{
+        memcpy(list_base, &state_u8_list_base[state_u8_idx], (size_t)(list_size));
+      }
+      state_u8_idx+=list_size;
+    }while(max_status--);
+  }
   return;
 }
 
-u8
-transform_pop_list_logfreedom_get(fru128 *log_factorial_list_base, fru128 *logfreedom_base, ULONG *pop_list_base, ULONG whole_idx_max, u32 whole_max_max){
+u64
+transform_state_lmd2_get(ULONG state_size, u8 *state_u8_list_base){
 /*
-Calculate the logfreedom of a population list while attempting to maximize accuracy -- actual logfreedom, not a delta relative to a bias.
+Compute the LMD2 hash of a checkpoint. Don't call here directly; use transform_state_export() or transform_state_check() instead.
 
 In:
 
-  *log_factorial_list_base is (transform_base->log_factorial_fru128_list_base).
-
-  *logfreedom_base is undefined.
-
-  *pop_list_base is transform_pop_list_fill():Out:pop_list_base, defined on [0, whole_idx_max+1].
-
-  whole_idx_max is the sum of all items at pop_list_base times their respective indexes, i.e. the sum of population times frequency, less one.
+  state_size is the size of the checkpoint, which is a nonzero multiple of U64_SIZE.
 
-  whole_max_max is the sum of all items at pop_list_base, less one.
+  state_u8_list_base is the base of the checkpoint, aligned to U64_SIZE, in which transform_state_t.lmd2 is zero.
 
 Out:
 
-  Returns one if fracterval underflow or overflow occured (which is usually benign) else zero.
-
-  *logfreedom_base is the logfreedom implied by the inputs.
+  Returns the LMD2 of all (u32)s at state_u8_list_base.
 */
-  ULONG freq;
-  fru128 logfreedom;
-  fru128 logfreedom_delta;
-  ULONG pop;
-  ULONG pop_sum;
-  u8 status;
-  u64 term_u64;
-
-  status=0;
-  logfreedom=log_factorial_list_base[whole_idx_max+1];
-  logfreedom_delta=log_factorial_list_base[whole_max_max+1];
-  FRU128_ADD_FRU128_SELF(logfreedom, logfreedom_delta, status);
-  freq=0;
-  pop_sum=0;
+  u64 lmd2;
+  u32 lmd2_c;
+  u64 lmd2_iterand;
+  u32 lmd2_x;
+  u32 u32_0;
+  ULONG u32_idx;
+  ULONG u32_idx_max;
+  u32 *u32_list_base;
+
+  LMD_SEED_INIT(LMD2_C0, lmd2_c, LMD2_X0, lmd2_x)
+  LMD_ITERAND_INIT(lmd2_c, lmd2_x, lmd2_iterand)
+  LMD_ACCUMULATOR_INIT(lmd2)
+  u32_idx=0;
+  u32_idx_max=(state_size>>U32_SIZE_LOG2)-1;
+  u32_list_base=(u32 *)(state_u8_list_base);
   do{
-    pop=pop_list_base[freq];
-    if(pop){
-      pop_sum+=pop;
-      if(pop!=1){
-        logfreedom_delta=log_factorial_list_base[pop];
-        FRU128_SUBTRACT_FRU128_SELF(logfreedom, logfreedom_delta, status);
-      }
-      if(1<freq){
-        logfreedom_delta=log_factorial_list_base[freq];
-        if(pop!=1){
-          term_u64=pop;
-          FRU128_MULTIPLY_U64_SELF(logfreedom_delta, term_u64, status);
-        }
-        FRU128_SUBTRACT_FRU128_SELF(logfreedom, logfreedom_delta, status);
-      }
-    }
-    freq++;
-  }while(pop_sum<=whole_max_max);
-  *logfreedom_base=logfreedom;
-  return status;
+    u32_0=u32_list_base[u32_idx];
+    LMD_ITERATE_WITH_ZERO_CHECK(LMD2_A, lmd2_c, lmd2_x, lmd2_iterand)
+    LMD_ACCUMULATE(u32_0, lmd2_x, lmd2)
+  }while((u32_idx++)!=u32_idx_max);
+  LMD_FINALIZE(LMD2_A, lmd2_c, lmd2_x, lmd2_iterand, lmd2)
+  return lmd2;
 }
 
-ULONG *
-transform_pop_list_malloc(ULONG whole_idx_max){
+u8
+transform_state_parameters_check(u8 algo_status, u8 discount_status, u8 granularity, u8 optimize_status, u8 precise_status, ULONG rank_idx_max_max, u8 rank_overlap_status, u8 rank_status, u8 rounding_status, u8 *state_u8_list_base, ULONG whole_x_idx_max, ULONG window_x_idx_max, ULONG window_y_idx_max){
 /*
-Allocate a list of populations of frequencies of whole numbers.
+Verify that a checkpoint was produced by a scan with the given parameters. This requires nothing which depends on the size of the array of wholes, so it can be called before transform_malloc() in order to diagnose a mismatch before anything else about the checkpoint is assumed. transform_state_import() repeats the same comparison.
 
 In:
 
-  whole_idx_max is one less than the maximum number of wholes for which the population list might need to be evaluated.
+  algo_status, discount_status, granularity, optimize_status, precise_status, rounding_status, whole_x_idx_max, window_x_idx_max, and window_y_idx_max are as defined in transform_malloc():In.
+
+  rank_idx_max_max and rank_overlap_status are transform_rank_init():In:rank_idx_max_max and transform_rank_init():In:overlap_status if rank_status is one, else ignored.
+
+  rank_status is one if transform_rank_init() will be called before transform_state_import(), else zero.
+
+  state_u8_list_base is the base of the checkpoint, aligned to U64_SIZE, which transform_state_check() has found to be intact.
 
 Out:
 
-  Returns NULL on failure, else the base of (whole_idx_max+1) undefined (ULONG)s.
+  Returns one if any of the above parameters differs from that of the scan which produced the checkpoint, else zero.
 */
-  ULONG list_size;
-  ULONG *pop_list_base;
-  ULONG pop_span;
+  transform_state_t state;
+  u8 status;
 
-  pop_list_base=NULL;
-  pop_span=whole_idx_max+2;
-  if(1U<pop_span){
-    list_size=pop_span<<ULONG_SIZE_LOG2;
-    if((list_size>>ULONG_SIZE_LOG2)==pop_span){
-      pop_list_base=DEBUG_MALLOC_PARANOID(list_size);
-    }
+  memcpy(&state, state_u8_list_base, sizeof(transform_state_t));
+  status=(state.algo_status!=algo_status);
+  status=(u8)(status|(state.discount_status!=discount_status));
+  status=(u8)(status|(state.granularity!=granularity));
+  status=(u8)(status|(state.optimize_status!=optimize_status));
+  status=(u8)(status|(state.precise_status!=precise_status));
+  status=(u8)(status|(state.rank_status!=rank_status));
+  status=(u8)(status|(state.rounding_status!=rounding_status));
+  status=(u8)(status|(state.whole_x_idx_max!=whole_x_idx_max));
+  status=(u8)(status|(state.window_x_idx_max!=window_x_idx_max));
+  status=(u8)(status|(state.window_y_idx_max!=window_y_idx_max));
+  if(rank_status){
+    status=(u8)(status|(state.rank_idx_max_max!=rank_idx_max_max));
+    status=(u8)(status|(state.rank_overlap_status!=rank_overlap_status));
   }
-  return pop_list_base;
+  return status;
 }
 
-void
-transform_ulong_list_zero(ULONG ulong_idx_max, ULONG *ulong_list_base){
+ULONG
+transform_state_size_get(entropy_t *entropy_base, transform_t *transform_base){
 /*
-Zero a list of (ULONG)s.
+Get the size of the checkpoint which transform_state_export() would produce.
 
 In:
 
-  ulong_idx_max is the number of (ULONG)s at ulong_list_base, less one.
+  entropy_base is transform_state_export():In:entropy_base.
 
-  *ulong_list_base is defined on [0, ulong_idx_max].
+  transform_base is transform_state_export():In:transform_base.
 
 Out:
 
-  *ulong_list_base is zero on [0, ulong_idx_max].
+  Returns the size of the checkpoint, in bytes, which is a multiple of U64_SIZE. The lists which it contains have already been allocated, so this can't overflow by more than the header size, which is negligible.
 */
-  ULONG list_size;
+  ULONG column_size;
+  ULONG fru_size;
+  ULONG state_size;
 
-  list_size=(ulong_idx_max+1)<<ULONG_SIZE_LOG2;
-  memset(ulong_list_base, 0, list_size);
-  return;
+  fru_size=(ULONG)(sizeof(fru64));
+  if(entropy_base->precise_status){
+    fru_size=(ULONG)(sizeof(fru128));
+  }
+  column_size=(((ULONG)(entropy_base->whole_max_max)+1)<<transform_base->freq_size_log2)+fru_size;
+  if(transform_base->pop_list_base_list_base){
+    column_size+=(entropy_base->window_y_idx_post+1)<<ULONG_SIZE_LOG2;
+  }
+  state_size=TRANSFORM_STATE_HEADER_SIZE+(transform_base->freq_list_idx_max+1)*column_size;
+  if(entropy_base->rank_status){
+    state_size+=(entropy_base->rank_max_count+entropy_base->rank_min_count)*(fru_size+(ULONG)(2U<<ULONG_SIZE_LOG2));
+  }
+  state_size=(state_size+U64_SIZE-1)&~(ULONG)(U64_SIZE-1);
+  return state_size;
 }
 
-u8
-transform_whole_list_line_entropy_delta_get_fru128(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_y_idx){
+#ifdef TRANSFORM_STATS
+  void
+  transform_stats_add(u8 stats_idx, u64 value){
 /*
-Get the entropy delta (to be subtracted from (entropy_base->window_bias_fru128)) of each window position from left to right in a row of channels after data structures have been initialized by transform_whole_list_line_entropy_get_fru128(). Don't call here directly; use transform_dispatch() instead.
+Add to an instrumentation counter. Don't call here directly; use TRANSFORM_STATS_ADD() or TRANSFORM_STATS_TIME_ADD() instead, which compile to nothing unless TRANSFORM_STATS is defined.
 
 In:
 
-  entropy_base is transform_malloc():Out:*entropy_base_base. (entropy_base->optimize_status) must be one.
-
-  transform_base is transform_malloc():Out:*transform_base_base.
-
-  whole_u8_list_base is the base of (entropy_base->whole_count wholes), each of size (entropy_base->granularity+1) and not exceeding (entropy_base->whole_max_max).
+  stats_idx is TRANSFORM_STATS_IDX_*.
 
-  whole_y_idx is the row index. On [1, (entropy_base->whole_y_idx_max)-(entropy_base->window_y_idx_max)].
+  value is the amount to add.
 
 Out:
 
-  Returns one if fracterval underflow or overflow occured (which is usually benign) else zero.
-
-  (entropy_base->max_max_u128) is the maximum upper limit of the entropy delta fracterval over all window positions in the row.
+  value has been added to the counter at stats_idx. This is atomic, so different threads may safely add to the same counter simultaneously.
+*/
+    __atomic_fetch_add(&transform_stats_list_base[stats_idx], value, __ATOMIC_RELAXED);
+    return;
+  }
 
-  (entropy_base->max_max_x_idx) is the least column index of the window in which said maximum occurred.
+  u64
+  transform_stats_get(char **name_base_base, u8 stats_idx){
+/*
+Read an instrumentation counter, for instance, after a transform has completed.
 
-  (entropy_base->min_min_u128) is the minimum lower limit of the entropy delta fracterval over all window positions in the row.
+In:
 
-  (entropy_base->min_min_x_idx) is the least column index of the window in which said minimum occurred.
+  *name_base_base is undefined.
 
-  (*(entropy_base->fakefloat_list_base)), if not NULL, has been populated with fakefloat entropy values for the row with index whole_y_idx. (If (entropy_base->discount) status is one, then they have first been subtracted from (entropy_base->window_max_max_fru128)). Note that these are actual entropies -- not entropy deltas. The final result has been rounded according to (entropy_base->rounding_status):
+  stats_idx is TRANSFORM_STATS_IDX_*.
 
-    TRANSFORM_ROUNDING_STATUS_NEAREST_EVEN: Each entropy value is the mean of its lower and upper limits (accounting for the understatement of the latter by one ULP) converted to a fakefloat via nearest-or-even rounding.
+Out:
 
-    TRANSFORM_ROUNDING_STATUS_NEGATIVE: Each entropy value is its lower limit converted to a fakefloat via rounding toward negative infinity.
+  Returns the sum of all values added to the counter at stats_idx by all threads since the process started.
 
-    TRANSFORM_ROUNDING_STATUS_POSITIVE: Each entropy value is its upper limit (accounting its understatement by one ULP) converted to a fakefloat via rounding toward positive infinity.
+  *name_base_base is the base of a lowercase name for the counter, suitable as a JSON key.
 */
-  u8 algo_status;
-  u32 digit;
-  u8 discount_status;
-  fru128 entropy;
-  fru128 entropy_copy;
-  fru128 entropy_delta;
-  fru128 entropy_delta_delta;
-  fru128 *entropy_delta_delta_fru128_list_base;
-  fru128 *entropy_delta_list_base;
-  u128 entropy_max_max;
-  fru128 entropy_max_max_max;
-  ULONG entropy_max_max_x_idx;
-  u128 entropy_min_min;
-  ULONG entropy_min_min_x_idx;
-  u32 entropy_u32;
-  ULONG entropy_u32_idx;
-  u32 *entropy_u32_list_base;
-  ULONG entropy_x_idx;
-  ULONG entropy_x_idx_max;
-  ULONG freq;
-  ULONG *freq_list_base;
-  ULONG **freq_list_base_list_base;
-  ULONG freq_old;
-  u8 granularity;
-  fru128 *log_delta_list_base;
-  fru128 *log_list_base;
-  ULONG pop;
-  ULONG pop_freq_old;
-  ULONG *pop_list_base;
-  ULONG **pop_list_base_list_base;
-  u8 rounding_status;
-  u8 status;
-  u64 term_u64;
-  u32 whole;
-  u32 whole_old;
-  u8 whole_size;
-  ULONG whole_u8_idx;
-  ULONG whole_u8_idx_delta;
-  ULONG whole_x_idx;
-  ULONG whole_x_idx_max;
-  ULONG whole_x_idx_post;
-  ULONG window_x_idx_max;
-  ULONG window_y_idx_max;
-  ULONG window_y_idx_post;
-
-  algo_status=transform_base->algo_status;
-  discount_status=entropy_base->discount_status;
-  rounding_status=entropy_base->rounding_status;
-  status=0;
-  entropy=entropy_base->window_bias_fru128;
-  entropy_delta_delta_fru128_list_base=transform_base->entropy_delta_delta_fru128_list_base;
-  entropy_delta_list_base=transform_base->entropy_delta_fru128_list_base;
-  U128_SET_ZERO(entropy_max_max);
-  entropy_max_max_max=entropy_base->window_max_max_fru128;
-  entropy_max_max_x_idx=0;
-  U128_NOT(entropy_min_min, entropy_max_max);
-  entropy_min_min_x_idx=0;
-  entropy_u32_list_base=entropy_base->fakefloat_list_base;
-  entropy_x_idx=0;
-  entropy_x_idx_max=entropy_base->fakefloat_x_idx_max;
-  entropy_u32_idx=(entropy_x_idx_max+1)*whole_y_idx;
-  freq_list_base_list_base=transform_base->freq_list_base_list_base;
-  granularity=entropy_base->granularity;
-  log_delta_list_base=transform_base->log_delta_fru128_list_base;
-  log_list_base=transform_base->log_fru128_list_base;
-  pop_list_base=NULL;
-  pop_list_base_list_base=transform_base->pop_list_base_list_base;
-  whole_size=(u8)(granularity+1);
-  whole_x_idx_max=entropy_base->whole_x_idx_max;
-  whole_x_idx_post=whole_x_idx_max+1;
-  window_x_idx_max=entropy_base->window_x_idx_max;
-  window_y_idx_max=entropy_base->window_y_idx_max;
-  window_y_idx_post=window_y_idx_max+1;
-  whole_u8_idx_delta=whole_size*whole_x_idx_post;
-  whole_u8_idx=whole_u8_idx_delta*(whole_y_idx-1);
-  whole_u8_idx_delta*=window_y_idx_post;
-  whole_x_idx=0;
-  do{
-    if(entropy_x_idx){
-      entropy_delta=entropy_delta_list_base[entropy_x_idx-1];
-      FRU128_ADD_FRU128_SELF(entropy, entropy_delta, status);
-    }
-    entropy_delta=entropy_delta_list_base[whole_x_idx];
-    freq_list_base=freq_list_base_list_base[whole_x_idx];
-    if(algo_status==TRANSFORM_ALGO_STATUS_LOGFREEDOM){
-      pop_list_base=pop_list_base_list_base[whole_x_idx];
-    }
-    whole_old=whole_u8_list_base[whole_u8_idx];
-    whole=whole_u8_list_base[whole_u8_idx+whole_u8_idx_delta];
-    whole_u8_idx++;
-    if(granularity){
-      digit=whole_u8_list_base[whole_u8_idx];
-      whole_old|=digit<<U8_BITS;
-      digit=whole_u8_list_base[whole_u8_idx+whole_u8_idx_delta];
-      whole|=digit<<U8_BITS;
-      whole_u8_idx++;
-      if(U16_BYTE_MAX<granularity){
-        digit=whole_u8_list_base[whole_u8_idx];
-        whole_old|=digit<<U8_BITS;
-        digit=whole_u8_list_base[whole_u8_idx+whole_u8_idx_delta];
-        whole|=digit<<U8_BITS;
-        whole_u8_idx++;
-        if(U24_BYTE_MAX<granularity){
-          digit=whole_u8_list_base[whole_u8_idx];
-          whole_old|=digit<<U8_BITS;
-          digit=whole_u8_list_base[whole_u8_idx+whole_u8_idx_delta];
-          whole|=digit<<U8_BITS;
-          whole_u8_idx++;
-        }
-      }
+    char *name_base;
+
+    name_base="fakefloat_count";
+    if(stats_idx==TRANSFORM_STATS_IDX_KERNEL_NS){
+      name_base="kernel_ns";
+    }else if(stats_idx==TRANSFORM_STATS_IDX_LOGFREEDOM_MAX_NS){
+      name_base="logfreedom_max_ns";
+    }else if(stats_idx==TRANSFORM_STATS_IDX_LOOKUP_NS){
+      name_base="lookup_ns";
+    }else if(stats_idx==TRANSFORM_STATS_IDX_OFFSETS_NS){
+      name_base="offsets_ns";
+    }else if(stats_idx==TRANSFORM_STATS_IDX_OUTPUT_NS){
+      name_base="output_ns";
+    }else if(stats_idx==TRANSFORM_STATS_IDX_SATURATION_COUNT){
+      name_base="saturation_count";
+    }else if(stats_idx==TRANSFORM_STATS_IDX_SCREEN_NS){
+      name_base="screen_ns";
+    }else if(stats_idx==TRANSFORM_STATS_IDX_SCREEN_SKIP_COUNT){
+      name_base="screen_skip_count";
+    }else if(stats_idx==TRANSFORM_STATS_IDX_WHOLE_UNCHANGED_COUNT){
+      name_base="whole_unchanged_count";
+    }else if(stats_idx==TRANSFORM_STATS_IDX_WHOLE_UPDATE_COUNT){
+      name_base="whole_update_count";
     }
-    if(whole!=whole_old){
-      freq=freq_list_base[whole];
-      freq_old=freq_list_base[whole_old];
-      if(algo_status==TRANSFORM_ALGO_STATUS_AGNENTROPY){
-/*
-The negative of the agnentropy difference, dA, is given by:
-
-  -dA=log(freq+1)-log(freq_old)
-*/
-        freq_list_base[whole]=freq+1;
-        if(freq){
-          entropy_delta_delta=log_list_base[freq+1];
-          FRU128_ADD_FRU128_SELF(entropy_delta, entropy_delta_delta, status);
-        }
-        freq_list_base[whole_old]=freq_old-1;
-        if(freq_old!=1){
-          entropy_delta_delta=log_list_base[freq_old];
-          FRU128_SUBTRACT_FRU128_SELF(entropy_delta, entropy_delta_delta, status);
-        }
-      }else if(algo_status==TRANSFORM_ALGO_STATUS_SHANNON){
-/*
-The negative of the Shannon entropy difference, dS, is given by:
+    *name_base_base=name_base;
+    return __atomic_load_n(&transform_stats_list_base[stats_idx], __ATOMIC_RELAXED);
+  }
 
-  -dS=freq*log_delta(freq)+log(freq+1)-(freq_old-1)*log_delta(freq_old-1)-log(freq_old)
-*/
-        freq_list_base[whole]=freq+1;
-        if(freq){
-          if(freq<=TRANSFORM_DELTA_DELTA_FREQ_MAX){
-            entropy_delta_delta=entropy_delta_delta_fru128_list_base[freq];
-          }else{
-            entropy_delta_delta=log_delta_list_base[freq];
-            term_u64=freq;
-            FRU128_MULTIPLY_U64_SELF(entropy_delta_delta, term_u64, status);
-            FRU128_ADD_FRU128_SELF(entropy_delta, entropy_delta_delta, status);
-            entropy_delta_delta=log_list_base[freq+1];
-          }
-          FRU128_ADD_FRU128_SELF(entropy_delta, entropy_delta_delta, status);
-        }
-        freq_list_base[whole_old]=freq_old-1;
-        if(freq_old!=1){
-          if(freq_old<=(TRANSFORM_DELTA_DELTA_FREQ_MAX+1)){
-            entropy_delta_delta=entropy_delta_delta_fru128_list_base[freq_old-1];
-          }else{
-            entropy_delta_delta=log_delta_list_base[freq_old-1];
-            term_u64=freq_old-1;
-            FRU128_MULTIPLY_U64_SELF(entropy_delta_delta, term_u64, status);
-            FRU128_SUBTRACT_FRU128_SELF(entropy_delta, entropy_delta_delta, status);
-            entropy_delta_delta=log_list_base[freq_old];
-          }
-          FRU128_SUBTRACT_FRU128_SELF(entropy_delta, entropy_delta_delta, status);
-        }
-      }else{
+  u64
+  transform_stats_time_get(void){
 /*
-The negative of the logfreedom difference in terms the frequencies in question and their respective populations, dL, is:
+Read the monotonic clock. Don't call here directly; use TRANSFORM_STATS_TIME_GET() instead.
 
-  -dL=+log(freq+1)-log(freq_old)+log(pop(freq_old-1)+1)-log(pop(freq_old))+log(pop(freq+1)+1)-log(pop(freq))
+Out:
 
-where we need to serialize updates to the populations of the old and new masks, hence the processing all freq_old terms before all freq terms.
+  Returns the monotonic time in nanoseconds.
 */
-        freq_list_base[whole]=freq+1;
-        freq_list_base[whole_old]=freq_old-1;
-        if(freq_old!=(freq+1)){
-          entropy_delta_delta=log_list_base[freq+1];
-          FRU128_ADD_FRU128_SELF(entropy_delta, entropy_delta_delta, status);
-          pop=pop_list_base[freq_old-1];
-          pop++;
-          pop_list_base[freq_old-1]=pop;
-          if(pop!=1){
-            entropy_delta_delta=log_list_base[pop];
-            FRU128_ADD_FRU128_SELF(entropy_delta, entropy_delta_delta, status);
-          }
-          pop_freq_old=pop_list_base[freq_old];
-          pop_list_base[freq_old]=pop_freq_old-1;
-          pop=pop_list_base[freq+1];
-          pop++;
-          pop_list_base[freq+1]=pop;
-          if(pop!=1){
-            entropy_delta_delta=log_list_base[pop];
-            FRU128_ADD_FRU128_SELF(entropy_delta, entropy_delta_delta, status);
-          }
-          pop=pop_list_base[freq];
-          pop_list_base[freq]=pop-1;
-          if(pop!=1){
-            entropy_delta_delta=log_list_base[pop];
-            FRU128_SUBTRACT_FRU128_SELF(entropy_delta, entropy_delta_delta, status);
-          }
-          if(pop_freq_old!=1){
-            entropy_delta_delta=log_list_base[pop_freq_old];
-            FRU128_SUBTRACT_FRU128_SELF(entropy_delta, entropy_delta_delta, status);
-          }
-          if(freq_old){
-            entropy_delta_delta=log_list_base[freq_old];
-            FRU128_SUBTRACT_FRU128_SELF(entropy_delta, entropy_delta_delta, status);
-          }
-        }
-      }
-    }
-    entropy_delta_list_base[whole_x_idx]=entropy_delta;
-    FRU128_SUBTRACT_FRU128_SELF(entropy, entropy_delta, status);
-    if(window_x_idx_max<=whole_x_idx){
-      if(U128_IS_LESS(entropy_max_max, entropy.b)){
-        entropy_max_max=entropy.b;
-        entropy_max_max_x_idx=entropy_x_idx;
-      }
-      if(U128_IS_LESS(entropy.a, entropy_min_min)){
-        entropy_min_min=entropy.a;
-        entropy_min_min_x_idx=entropy_x_idx;
-      }
-      if(entropy_u32_list_base){
-        entropy_copy=entropy;
-        if(discount_status){
-          FRU128_SUBTRACT_FRU128(entropy_copy, entropy_max_max_max, entropy, status);
-        }
-        if(rounding_status==TRANSFORM_ROUNDING_STATUS_NEAREST_EVEN){
-          entropy_u32=fracterval_u128_to_fakefloat(entropy_copy, U64_BITS);
-        }else if(rounding_status==TRANSFORM_ROUNDING_STATUS_NEGATIVE){
-          entropy_u32=fractoid_u128_to_fakefloat_floor(entropy_copy.a, U64_BITS);
-        }else{
-          entropy_u32=fractoid_u128_to_fakefloat_ceil(entropy_copy.b, U64_BITS);
-        }
-        entropy_u32_list_base[entropy_u32_idx]=entropy_u32;
-        entropy_u32_idx++;
-      }
-      entropy_x_idx++;
-    }
-  }while((whole_x_idx++)!=whole_x_idx_max);
-  entropy_base->max_max_u128=entropy_max_max;
-  entropy_base->max_max_x_idx=entropy_max_max_x_idx;
-  entropy_base->min_min_u128=entropy_min_min;
-  entropy_base->min_min_x_idx=entropy_min_min_x_idx;
-  return status;
-}
+    struct timespec time;
+    u64 time_ns;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    time_ns=(u64)(time.tv_sec)*1000000000ULL+(u64)(time.tv_nsec);
+    return time_ns;
+  }
+#endif
 
 u8
-transform_whole_list_line_entropy_delta_get_fru64(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_y_idx){
+transform_transpose_init(entropy_t *entropy_base, ULONG tile_idx_max, transform_t *transform_base, u8 *whole_u8_list_base){
 /*
-This is the 64-bit fracterval equivalent of transform_whole_list_line_entropy_delta_get_fru128(). Replace all occurrences of "128" with "64" in its definition.
+Make a column-major copy of the whole array, so that the vertical loops in transform_whole_list_line_entropy_get_fru(64/128)() and transform_whole_list_window_entropy_get_fru(64/128)(), which otherwise stride down the array one full row at a time, read contiguous memory instead. This is mainly of benefit without (transform_base->optimize_status), in which case those loops account for nearly all memory traffic, and on wide arrays, wherein every such stride misses the cache. It doubles the memory required for wholes. The column delta kernels still read the original array, which suits their row-by-row access pattern.
+
+In:
+
+  entropy_base is transform_malloc():Out:*entropy_base_base.
+
+  tile_idx_max is one less than the width and height of the square tiles in which the copy is made. Each tile is read a row at a time and written a column at a time, so it should be small enough that the rows and columns of a tile all fit in cache.
+
+  transform_base is transform_malloc():Out:*transform_base_base. It must not have been created by transform_clone().
+
+  whole_u8_list_base is as defined in transform_dispatch():In. It must contain the entire whole array, not merely part of it as with transform_dispatch_stream().
+
+Out:
+
+  Returns one on allocation failure, else zero.
+
+  (transform_base->whole_transpose_u8_list_base) is NULL on failure, else the base of the copy, wherein the whole at column x and row y is whole number (x*(entropy_base->whole_y_idx_post)+y). All dispatch functions other than transform_dispatch_stream() then use it automatically, as do clones subsequently created by transform_clone(). It will be freed by transform_free_all().
 */
-  u8 algo_status;
-  u32 digit;
-  u8 discount_status;
-  fru64 entropy;
-  fru64 entropy_copy;
-  fru64 entropy_delta;
-  fru64 entropy_delta_delta;
-  fru64 *entropy_delta_delta_fru64_list_base;
-  fru64 *entropy_delta_list_base;
-  u64 entropy_max_max;
-  fru64 entropy_max_max_max;
-  ULONG entropy_max_max_x_idx;
-  u64 entropy_min_min;
-  ULONG entropy_min_min_x_idx;
-  u32 entropy_u32;
-  ULONG entropy_u32_idx;
-  u32 *entropy_u32_list_base;
-  ULONG entropy_x_idx;
-  ULONG entropy_x_idx_max;
-  ULONG freq;
-  ULONG *freq_list_base;
-  ULONG **freq_list_base_list_base;
-  ULONG freq_old;
   u8 granularity;
-  fru64 *log_delta_list_base;
-  fru64 *log_list_base;
-  ULONG pop;
-  ULONG pop_freq_old;
-  ULONG *pop_list_base;
-  ULONG **pop_list_base_list_base;
-  u8 rounding_status;
   u8 status;
-  u64 term_u64;
-  u32 whole;
-  u32 whole_old;
+  ULONG tile_x_idx_max;
+  ULONG tile_x_idx_min;
+  ULONG tile_y_idx_max;
+  ULONG tile_y_idx_min;
+  ULONG transpose_u8_idx;
+  ULONG transpose_u8_idx_delta;
+  u8 *transpose_u8_list_base;
   u8 whole_size;
   ULONG whole_u8_idx;
-  ULONG whole_u8_idx_delta;
   ULONG whole_x_idx;
   ULONG whole_x_idx_max;
   ULONG whole_x_idx_post;
-  ULONG window_x_idx_max;
-  ULONG window_y_idx_max;
-  ULONG window_y_idx_post;
+  ULONG whole_y_idx;
+  ULONG whole_y_idx_max;
 
-  algo_status=transform_base->algo_status;
-  discount_status=entropy_base->discount_status;
-  rounding_status=entropy_base->rounding_status;
-  status=0;
-  entropy=entropy_base->window_bias_fru64;
-  entropy_delta_delta_fru64_list_base=transform_base->entropy_delta_delta_fru64_list_base;
-  entropy_delta_list_base=transform_base->entropy_delta_fru64_list_base;
-  entropy_max_max=0;
-  entropy_max_max_max=entropy_base->window_max_max_fru64;
-  entropy_max_max_x_idx=0;
-  entropy_min_min=~entropy_max_max;
-  entropy_min_min_x_idx=0;
-  entropy_u32_list_base=entropy_base->fakefloat_list_base;
-  entropy_x_idx=0;
-  entropy_x_idx_max=entropy_base->fakefloat_x_idx_max;
-  entropy_u32_idx=(entropy_x_idx_max+1)*whole_y_idx;
-  freq_list_base_list_base=transform_base->freq_list_base_list_base;
   granularity=entropy_base->granularity;
-  log_delta_list_base=transform_base->log_delta_fru64_list_base;
-  log_list_base=transform_base->log_fru64_list_base;
-  pop_list_base=NULL;
-  pop_list_base_list_base=transform_base->pop_list_base_list_base;
   whole_size=(u8)(granularity+1);
-  whole_x_idx_max=entropy_base->whole_x_idx_max;
-  whole_x_idx_post=whole_x_idx_max+1;
-  window_x_idx_max=entropy_base->window_x_idx_max;
-  window_y_idx_max=entropy_base->window_y_idx_max;
-  window_y_idx_post=window_y_idx_max+1;
-  whole_u8_idx_delta=whole_size*whole_x_idx_post;
-  whole_u8_idx=whole_u8_idx_delta*(whole_y_idx-1);
-  whole_u8_idx_delta*=window_y_idx_post;
-  whole_x_idx=0;
-  do{
-    if(entropy_x_idx){
-      entropy_delta=entropy_delta_list_base[entropy_x_idx-1];
-      FRU64_ADD_FRU64_SELF(entropy, entropy_delta, status);
-    }
-    entropy_delta=entropy_delta_list_base[whole_x_idx];
-    freq_list_base=freq_list_base_list_base[whole_x_idx];
-    if(algo_status==TRANSFORM_ALGO_STATUS_LOGFREEDOM){
-      pop_list_base=pop_list_base_list_base[whole_x_idx];
-    }
-    whole_old=whole_u8_list_base[whole_u8_idx];
-    whole=whole_u8_list_base[whole_u8_idx+whole_u8_idx_delta];
-    whole_u8_idx++;
-    if(granularity){
-      digit=whole_u8_list_base[whole_u8_idx];
-      whole_old|=digit<<U8_BITS;
-      digit=whole_u8_list_base[whole_u8_idx+whole_u8_idx_delta];
-      whole|=digit<<U8_BITS;
-      whole_u8_idx++;
-      if(U16_BYTE_MAX<granularity){
-        digit=whole_u8_list_base[whole_u8_idx];
-        whole_old|=digit<<U8_BITS;
-        digit=whole_u8_list_base[whole_u8_idx+whole_u8_idx_delta];
-        whole|=digit<<U8_BITS;
-        whole_u8_idx++;
-        if(U24_BYTE_MAX<granularity){
-          digit=whole_u8_list_base[whole_u8_idx];
-          whole_old|=digit<<U8_BITS;
-          digit=whole_u8_list_base[whole_u8_idx+whole_u8_idx_delta];
-          whole|=digit<<U8_BITS;
-          whole_u8_idx++;
-        }
+  transpose_u8_list_base=DEBUG_MALLOC_PARANOID(entropy_base->whole_count*whole_size);
+  status=!transpose_u8_list_base;
+  if(!status){
+    transpose_u8_idx_delta=whole_size*entropy_base->whole_y_idx_post;
+    whole_x_idx_max=entropy_base->whole_x_idx_max;
+    whole_x_idx_post=whole_x_idx_max+1;
+    whole_y_idx_max=entropy_base->whole_y_idx_max;
+    tile_y_idx_min=0;
+    do{
+      tile_y_idx_max=whole_y_idx_max;
+      if(tile_idx_max<(whole_y_idx_max-tile_y_idx_min)){
+        tile_y_idx_max=tile_y_idx_min+tile_idx_max;
       }
-    }
-    if(whole!=whole_old){
-      freq=freq_list_base[whole];
-      freq_old=freq_list_base[whole_old];
-      if(algo_status==TRANSFORM_ALGO_STATUS_AGNENTROPY){
+      tile_x_idx_min=0;
+      do{
+        tile_x_idx_max=whole_x_idx_max;
+        if(tile_idx_max<(whole_x_idx_max-tile_x_idx_min)){
+          tile_x_idx_max=tile_x_idx_min+tile_idx_max;
+        }
+        whole_y_idx=tile_y_idx_min;
+        do{
+          transpose_u8_idx=whole_size*(whole_y_idx+entropy_base->whole_y_idx_post*tile_x_idx_min);
+          whole_u8_idx=whole_size*(tile_x_idx_min+whole_x_idx_post*whole_y_idx);
+          whole_x_idx=tile_x_idx_min;
+          do{
+            memcpy(&transpose_u8_list_base[transpose_u8_idx], &whole_u8_list_base[whole_u8_idx], (size_t)(whole_size));
+            transpose_u8_idx+=transpose_u8_idx_delta;
+            whole_u8_idx+=whole_size;
+          }while((whole_x_idx++)!=tile_x_idx_max);
+        }while((whole_y_idx++)!=tile_y_idx_max);
+        tile_x_idx_min=tile_x_idx_max+1;
+      }while(tile_x_idx_max!=whole_x_idx_max);
+      tile_y_idx_min=tile_y_idx_max+1;
+    }while(tile_y_idx_max!=whole_y_idx_max);
+  }
+  transform_base->whole_transpose_u8_list_base=transpose_u8_list_base;
+  return status;
+}
+
+void
+transform_ulong_list_zero(ULONG ulong_idx_max, ULONG *ulong_list_base){
 /*
-The negative of the agnentropy difference, dA, is given by:
+Zero a list of (ULONG)s.
 
-  -dA=log(freq+1)-log(freq_old)
+In:
+
+  ulong_idx_max is the number of (ULONG)s at ulong_list_base, less one.
+
+  *ulong_list_base is defined on [0, ulong_idx_max].
+
+Out:
+
+  *ulong_list_base is zero on [0, ulong_idx_max].
 */
-        freq_list_base[whole]=freq+1;
-        if(freq){
-          entropy_delta_delta=log_list_base[freq+1];
-          FRU64_ADD_FRU64_SELF(entropy_delta, entropy_delta_delta, status);
-        }
-        freq_list_base[whole_old]=freq_old-1;
-        if(freq_old!=1){
-          entropy_delta_delta=log_list_base[freq_old];
-          FRU64_SUBTRACT_FRU64_SELF(entropy_delta, entropy_delta_delta, status);
-        }
-      }else if(algo_status==TRANSFORM_ALGO_STATUS_SHANNON){
+  ULONG list_size;
+
+  list_size=(ulong_idx_max+1)<<ULONG_SIZE_LOG2;
+  memset(ulong_list_base, 0, list_size);
+  return;
+}
+
+u8
+transform_whole_list_column_entropy_delta_get_fru128(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx){
 /*
-The negative of the Shannon entropy difference, dS, is given by:
+Update the entropy delta of each column in a given range after data structures have been initialized by transform_whole_list_line_entropy_get_fru128(), in the same manner as transform_whole_list_line_entropy_delta_get_fru128() but without summing them into window entropies. This dispatches to the specialization of this function which transform_malloc() chose according to algo_status, granularity, and precise_status. Columns outside the range are neither read nor written, so different threads may safely process disjoint ranges simultaneously. Don't call here directly; use transform_dispatch_threaded() instead.
 
-  -dS=freq*log_delta(freq)+log(freq+1)-(freq_old-1)*log_delta(freq_old-1)-log(freq_old)
+In:
+
+  entropy_base is transform_malloc():Out:*entropy_base_base. (entropy_base->optimize_status) must be one.
+
+  transform_base is transform_malloc():Out:*transform_base_base.
+
+  whole_u8_list_base is the base of (entropy_base->whole_count wholes), each of size (entropy_base->granularity+1) and not exceeding (entropy_base->whole_max_max).
+
+  whole_x_idx_max is the greatest column index to update. On [whole_x_idx_min, (entropy_base->whole_x_idx_max)].
+
+  whole_x_idx_min is the least column index to update.
+
+  whole_y_idx is the row index. On [1, (entropy_base->whole_y_idx_max)-(entropy_base->window_y_idx_max)].
+
+Out:
+
+  Returns one if fracterval underflow or overflow occured (which is usually benign) else zero.
+
+  (transform_base->entropy_delta_fru128_list_base) has been updated on [whole_x_idx_min, whole_x_idx_max] to reflect the window which starts at row whole_y_idx, as have the corresponding frequency (and for logfreedom, population) lists.
 */
-        freq_list_base[whole]=freq+1;
-        if(freq){
-          if(freq<=TRANSFORM_DELTA_DELTA_FREQ_MAX){
-            entropy_delta_delta=entropy_delta_delta_fru64_list_base[freq];
-          }else{
-            entropy_delta_delta=log_delta_list_base[freq];
-            term_u64=freq;
-            FRU64_MULTIPLY_U64_SELF(entropy_delta_delta, term_u64, status);
-            FRU64_ADD_FRU64_SELF(entropy_delta, entropy_delta_delta, status);
-            entropy_delta_delta=log_list_base[freq+1];
-          }
-          FRU64_ADD_FRU64_SELF(entropy_delta, entropy_delta_delta, status);
-        }
-        freq_list_base[whole_old]=freq_old-1;
-        if(freq_old!=1){
-          if(freq_old<=(TRANSFORM_DELTA_DELTA_FREQ_MAX+1)){
-            entropy_delta_delta=entropy_delta_delta_fru64_list_base[freq_old-1];
-          }else{
-            entropy_delta_delta=log_delta_list_base[freq_old-1];
-            term_u64=freq_old-1;
-            FRU64_MULTIPLY_U64_SELF(entropy_delta_delta, term_u64, status);
-            FRU64_SUBTRACT_FRU64_SELF(entropy_delta, entropy_delta_delta, status);
-            entropy_delta_delta=log_list_base[freq_old];
-          }
-          FRU64_SUBTRACT_FRU64_SELF(entropy_delta, entropy_delta_delta, status);
-        }
-      }else{
+  transform_column_kernel_t column_kernel;
+  TRANSFORM_STATS_DECLARE(stats_time)
+  u8 status;
+
+  TRANSFORM_STATS_TIME_GET(stats_time);
+  column_kernel=(transform_column_kernel_t)(transform_base->column_kernel_base);
+  status=column_kernel(entropy_base, transform_base, whole_u8_list_base, whole_x_idx_max, whole_x_idx_min, whole_y_idx);
+  TRANSFORM_STATS_TIME_ADD(TRANSFORM_STATS_IDX_KERNEL_NS, stats_time);
+  TRANSFORM_STATS_ADD(TRANSFORM_STATS_IDX_SATURATION_COUNT, status);
+  TRANSFORM_STATS_ADD(TRANSFORM_STATS_IDX_WHOLE_UPDATE_COUNT, whole_x_idx_max-whole_x_idx_min+1);
+  return status;
+}
+
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU128(transform_whole_list_column_entropy_delta_get_fru128_agnentropy_u16, TRANSFORM_ALGO_STATUS_AGNENTROPY, U16_BYTE_MAX)
+
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU128(transform_whole_list_column_entropy_delta_get_fru128_agnentropy_u24, TRANSFORM_ALGO_STATUS_AGNENTROPY, U24_BYTE_MAX)
+
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU128(transform_whole_list_column_entropy_delta_get_fru128_agnentropy_u32, TRANSFORM_ALGO_STATUS_AGNENTROPY, U32_BYTE_MAX)
+
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU128(transform_whole_list_column_entropy_delta_get_fru128_agnentropy_u8, TRANSFORM_ALGO_STATUS_AGNENTROPY, U8_BYTE_MAX)
+
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU128(transform_whole_list_column_entropy_delta_get_fru128_logfreedom_u16, TRANSFORM_ALGO_STATUS_LOGFREEDOM, U16_BYTE_MAX)
+
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU128(transform_whole_list_column_entropy_delta_get_fru128_logfreedom_u24, TRANSFORM_ALGO_STATUS_LOGFREEDOM, U24_BYTE_MAX)
+
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU128(transform_whole_list_column_entropy_delta_get_fru128_logfreedom_u32, TRANSFORM_ALGO_STATUS_LOGFREEDOM, U32_BYTE_MAX)
+
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU128(transform_whole_list_column_entropy_delta_get_fru128_logfreedom_u8, TRANSFORM_ALGO_STATUS_LOGFREEDOM, U8_BYTE_MAX)
+
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU128(transform_whole_list_column_entropy_delta_get_fru128_shannon_u16, TRANSFORM_ALGO_STATUS_SHANNON, U16_BYTE_MAX)
+
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU128(transform_whole_list_column_entropy_delta_get_fru128_shannon_u24, TRANSFORM_ALGO_STATUS_SHANNON, U24_BYTE_MAX)
+
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU128(transform_whole_list_column_entropy_delta_get_fru128_shannon_u32, TRANSFORM_ALGO_STATUS_SHANNON, U32_BYTE_MAX)
+
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU128(transform_whole_list_column_entropy_delta_get_fru128_shannon_u8, TRANSFORM_ALGO_STATUS_SHANNON, U8_BYTE_MAX)
+
+u8
+transform_whole_list_column_entropy_delta_get_fru64(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx){
 /*
-The negative of the logfreedom difference in terms the frequencies in question and their respective populations, dL, is:
+This is the 64-bit fracterval equivalent of transform_whole_list_column_entropy_delta_get_fru128(). Replace all occurrences of "128" with "64" in its definition.
+*/
+  transform_column_kernel_t column_kernel;
+  TRANSFORM_STATS_DECLARE(stats_time)
+  u8 status;
 
-  -dL=+log(freq+1)-log(freq_old)+log(pop(freq_old-1)+1)-log(pop(freq_old))+log(pop(freq+1)+1)-log(pop(freq))
+  TRANSFORM_STATS_TIME_GET(stats_time);
+  column_kernel=(transform_column_kernel_t)(transform_base->column_kernel_base);
+  status=column_kernel(entropy_base, transform_base, whole_u8_list_base, whole_x_idx_max, whole_x_idx_min, whole_y_idx);
+  TRANSFORM_STATS_TIME_ADD(TRANSFORM_STATS_IDX_KERNEL_NS, stats_time);
+  TRANSFORM_STATS_ADD(TRANSFORM_STATS_IDX_SATURATION_COUNT, status);
+  TRANSFORM_STATS_ADD(TRANSFORM_STATS_IDX_WHOLE_UPDATE_COUNT, whole_x_idx_max-whole_x_idx_min+1);
+  return status;
+}
 
-where we need to serialize updates to the populations of the old and new masks, hence the processing all freq_old terms before all freq terms.
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU64(transform_whole_list_column_entropy_delta_get_fru64_agnentropy_u16, TRANSFORM_ALGO_STATUS_AGNENTROPY, U16_BYTE_MAX)
+
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU64(transform_whole_list_column_entropy_delta_get_fru64_agnentropy_u24, TRANSFORM_ALGO_STATUS_AGNENTROPY, U24_BYTE_MAX)
+
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU64(transform_whole_list_column_entropy_delta_get_fru64_agnentropy_u32, TRANSFORM_ALGO_STATUS_AGNENTROPY, U32_BYTE_MAX)
+
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU64(transform_whole_list_column_entropy_delta_get_fru64_agnentropy_u8, TRANSFORM_ALGO_STATUS_AGNENTROPY, U8_BYTE_MAX)
+
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU64(transform_whole_list_column_entropy_delta_get_fru64_logfreedom_u16, TRANSFORM_ALGO_STATUS_LOGFREEDOM, U16_BYTE_MAX)
+
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU64(transform_whole_list_column_entropy_delta_get_fru64_logfreedom_u24, TRANSFORM_ALGO_STATUS_LOGFREEDOM, U24_BYTE_MAX)
+
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU64(transform_whole_list_column_entropy_delta_get_fru64_logfreedom_u32, TRANSFORM_ALGO_STATUS_LOGFREEDOM, U32_BYTE_MAX)
+
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU64(transform_whole_list_column_entropy_delta_get_fru64_logfreedom_u8, TRANSFORM_ALGO_STATUS_LOGFREEDOM, U8_BYTE_MAX)
+
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU64(transform_whole_list_column_entropy_delta_get_fru64_shannon_u16, TRANSFORM_ALGO_STATUS_SHANNON, U16_BYTE_MAX)
+
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU64(transform_whole_list_column_entropy_delta_get_fru64_shannon_u24, TRANSFORM_ALGO_STATUS_SHANNON, U24_BYTE_MAX)
+
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU64(transform_whole_list_column_entropy_delta_get_fru64_shannon_u32, TRANSFORM_ALGO_STATUS_SHANNON, U32_BYTE_MAX)
+
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU64(transform_whole_list_column_entropy_delta_get_fru64_shannon_u8, TRANSFORM_ALGO_STATUS_SHANNON, U8_BYTE_MAX)
+
+
+u8
+transform_whole_list_line_entropy_delta_get_fru128(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_y_idx){
+/*
+Get the entropy delta (to be subtracted from (entropy_base->window_bias_fru128)) of each window position from left to right in a row of channels after data structures have been initialized by transform_whole_list_line_entropy_get_fru128(). Don't call here directly; use transform_dispatch() instead.
+
+In:
+
+  entropy_base is transform_malloc():Out:*entropy_base_base. (entropy_base->optimize_status) must be one.
+
+  transform_base is transform_malloc():Out:*transform_base_base.
+
+  whole_u8_list_base is the base of (entropy_base->whole_count wholes), each of size (entropy_base->granularity+1) and not exceeding (entropy_base->whole_max_max).
+
+  whole_y_idx is the row index. On [1, (entropy_base->whole_y_idx_max)-(entropy_base->window_y_idx_max)].
+
+Out:
+
+  Returns one if fracterval underflow or overflow occured (which is usually benign) else zero.
+
+  (entropy_base->max_max_u128) is the maximum upper limit of the entropy delta fracterval over all window positions in the row.
+
+  (entropy_base->max_max_x_idx) is the least column index of the window in which said maximum occurred.
+
+  (entropy_base->min_min_u128) is the minimum lower limit of the entropy delta fracterval over all window positions in the row.
+
+  (entropy_base->min_min_x_idx) is the least column index of the window in which said minimum occurred.
+
+  (*(entropy_base->fakefloat_list_base)), if not NULL, has been populated with fakefloat entropy values for the row with index whole_y_idx. (If (entropy_base->discount) status is one, then they have first been subtracted from (entropy_base->window_max_max_fru128)). Note that these are actual entropies -- not entropy deltas. The final result has been rounded according to (entropy_base->rounding_status):
+
+    TRANSFORM_ROUNDING_STATUS_NEAREST_EVEN: Each entropy value is the mean of its lower and upper limits (accounting for the understatement of the latter by one ULP) converted to a fakefloat via nearest-or-even rounding.
+
+    TRANSFORM_ROUNDING_STATUS_NEGATIVE: Each entropy value is its lower limit converted to a fakefloat via rounding toward negative infinity.
+
+    TRANSFORM_ROUNDING_STATUS_POSITIVE: Each entropy value is its upper limit (accounting its understatement by one ULP) converted to a fakefloat via rounding toward positive infinity.
+*/
+  u8 status;
+  u8 status_delta;
+  transform_thread_t thread;
+
+  status=transform_whole_list_column_entropy_delta_get_fru128(entropy_base, transform_base, whole_u8_list_base, entropy_base->whole_x_idx_max, 0, whole_y_idx);
+  status_delta=transform_entropy_delta_list_line_entropy_get_fru128(entropy_base, entropy_base->fakefloat_x_idx_max, 0, &thread, transform_base, whole_y_idx);
+  status=(u8)(status|status_delta);
+  entropy_base->max_max_u128=thread.max_max_u128;
+  entropy_base->max_max_x_idx=thread.max_max_x_idx;
+  entropy_base->min_min_u128=thread.min_min_u128;
+  entropy_base->min_min_x_idx=thread.min_min_x_idx;
+  return status;
+}
+
+u8
+transform_whole_list_line_entropy_delta_get_fru64(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_y_idx){
+/*
+This is the 64-bit fracterval equivalent of transform_whole_list_line_entropy_delta_get_fru128(). Replace all occurrences of "128" with "64" in its definition.
 */
-        freq_list_base[whole]=freq+1;
-        freq_list_base[whole_old]=freq_old-1;
-        if(freq_old!=(freq+1)){
-          entropy_delta_delta=log_list_base[freq+1];
-          FRU64_ADD_FRU64_SELF(entropy_delta, entropy_delta_delta, status);
-          pop=pop_list_base[freq_old-1];
-          pop++;
-          pop_list_base[freq_old-1]=pop;
-          if(pop!=1){
-            entropy_delta_delta=log_list_base[pop];
-            FRU64_ADD_FRU64_SELF(entropy_delta, entropy_delta_delta, status);
-          }
-          pop_freq_old=pop_list_base[freq_old];
-          pop_list_base[freq_old]=pop_freq_old-1;
-          pop=pop_list_base[freq+1];
-          pop++;
-          pop_list_base[freq+1]=pop;
-          if(pop!=1){
-            entropy_delta_delta=log_list_base[pop];
-            FRU64_ADD_FRU64_SELF(entropy_delta, entropy_delta_delta, status);
-          }
-          pop=pop_list_base[freq];
-          pop_list_base[freq]=pop-1;
-          if(pop!=1){
-            entropy_delta_delta=log_list_base[pop];
-            FRU64_SUBTRACT_FRU64_SELF(entropy_delta, entropy_delta_delta, status);
-          }
-          if(pop_freq_old!=1){
-            entropy_delta_delta=log_list_base[pop_freq_old];
-            FRU64_SUBTRACT_FRU64_SELF(entropy_delta, entropy_delta_delta, status);
-          }
-          if(freq_old){
-            entropy_delta_delta=log_list_base[freq_old];
-            FRU64_SUBTRACT_FRU64_SELF(entropy_delta, entropy_delta_delta, status);
-          }
-        }
-      }
-    }
-    entropy_delta_list_base[whole_x_idx]=entropy_delta;
-    FRU64_SUBTRACT_FRU64_SELF(entropy, entropy_delta, status);
-    if(window_x_idx_max<=whole_x_idx){
-      if(entropy_max_max<entropy.b){
-        entropy_max_max=entropy.b;
-        entropy_max_max_x_idx=entropy_x_idx;
-      }
-      if(entropy.a<entropy_min_min){
-        entropy_min_min=entropy.a;
-        entropy_min_min_x_idx=entropy_x_idx;
-      }
-      if(entropy_u32_list_base){
-        entropy_copy=entropy;
-        if(discount_status){
-          FRU64_SUBTRACT_FRU64(entropy_copy, entropy_max_max_max, entropy, status);
-        }
-        if(rounding_status==TRANSFORM_ROUNDING_STATUS_NEAREST_EVEN){
-          entropy_u32=fracterval_u64_to_fakefloat(entropy_copy, U32_BITS);
-        }else if(rounding_status==TRANSFORM_ROUNDING_STATUS_NEGATIVE){
-          entropy_u32=fractoid_u64_to_fakefloat_floor(entropy_copy.a, U32_BITS);
-        }else{
-          entropy_u32=fractoid_u64_to_fakefloat_ceil(entropy_copy.b, U32_BITS);
-        }
-        entropy_u32_list_base[entropy_u32_idx]=entropy_u32;
-        entropy_u32_idx++;
-      }
-      entropy_x_idx++;
-    }
-  }while((whole_x_idx++)!=whole_x_idx_max);
-  entropy_base->max_max_u64=entropy_max_max;
-  entropy_base->max_max_x_idx=entropy_max_max_x_idx;
-  entropy_base->min_min_u64=entropy_min_min;
-  entropy_base->min_min_x_idx=entropy_min_min_x_idx;
+  u8 status;
+  u8 status_delta;
+  transform_thread_t thread;
+
+  status=transform_whole_list_column_entropy_delta_get_fru64(entropy_base, transform_base, whole_u8_list_base, entropy_base->whole_x_idx_max, 0, whole_y_idx);
+  status_delta=transform_entropy_delta_list_line_entropy_get_fru64(entropy_base, entropy_base->fakefloat_x_idx_max, 0, &thread, transform_base, whole_y_idx);
+  status=(u8)(status|status_delta);
+  entropy_base->max_max_u64=thread.max_max_u64;
+  entropy_base->max_max_x_idx=thread.max_max_x_idx;
+  entropy_base->min_min_u64=thread.min_min_u64;
+  entropy_base->min_min_x_idx=thread.min_min_x_idx;
   return status;
 }
 
@@ -2086,21 +5936,27 @@ This is the functional equivalent of transform_whole_list_line_entropy_delta_get
   ULONG entropy_max_max_x_idx;
   u128 entropy_min_min;
   ULONG entropy_min_min_x_idx;
+  fru128 *entropy_row_list_base;
   u32 entropy_u32;
   ULONG entropy_u32_idx;
   u32 *entropy_u32_list_base;
   ULONG entropy_x_idx;
   ULONG entropy_x_idx_max;
-  ULONG *freq_list_base;
+  ULONG freq;
+  void *freq_list_base;
   ULONG freq_list_idx;
   ULONG freq_list_idx_delta;
-  ULONG **freq_list_base_list_base;
+  void **freq_list_base_list_base;
+  ULONG freq_old;
+  u8 freq_size_log2;
   u8 granularity;
   fru128 *lookup_list_base;
   u8 optimize_status;
   ULONG *pop_list_base;
   ULONG **pop_list_base_list_base;
   u8 rounding_status;
+  TRANSFORM_STATS_DECLARE(stats_time)
+  TRANSFORM_STATS_DECLARE(stats_unchanged_count)
   u8 status;
   u8 status_delta;
   u32 whole;
@@ -2112,11 +5968,15 @@ This is the functional equivalent of transform_whole_list_line_entropy_delta_get
   ULONG whole_u8_idx_delta1;
   ULONG whole_x_idx_max;
   ULONG whole_x_idx_post;
+  ULONG whole_x_u8_idx_delta;
+  ULONG whole_y_u8_idx_delta;
   ULONG window_x_idx_max;
   ULONG window_x_idx_post;
   ULONG window_y_idx;
   ULONG window_y_idx_max;
 
+  TRANSFORM_STATS_TIME_GET(stats_time);
+  TRANSFORM_STATS_SET_ZERO(stats_unchanged_count);
   discount_status=entropy_base->discount_status;
   entropy_base->discount_status=0;
   status=transform_whole_list_window_entropy_get_fru128(entropy_base, transform_base, whole_u8_list_base, 0, whole_y_idx);
@@ -2129,6 +5989,10 @@ This is the functional equivalent of transform_whole_list_line_entropy_delta_get
   entropy_min_min=entropy_base->min_min_u128;
   entropy.a=entropy_min_min;
   entropy_min_min_x_idx=0;
+  entropy_row_list_base=entropy_base->rank_row_fru128_list_base;
+  if(entropy_row_list_base){
+    entropy_row_list_base[0]=entropy;
+  }
   entropy_u32_idx=0;
   entropy_u32_list_base=entropy_base->fakefloat_list_base;
   entropy_x_idx_max=entropy_base->fakefloat_x_idx_max;
@@ -2137,7 +6001,7 @@ This is the functional equivalent of transform_whole_list_line_entropy_delta_get
     if(discount_status){
       FRU128_SUBTRACT_FRU128(entropy_copy, entropy_max_max_max, entropy, status);
     }
-    entropy_u32_idx=(entropy_x_idx_max+1)*whole_y_idx;
+    entropy_u32_idx=(entropy_x_idx_max+1)*(whole_y_idx-entropy_base->fakefloat_y_idx_min);
      if(rounding_status==TRANSFORM_ROUNDING_STATUS_NEAREST_EVEN){
       entropy_u32=fracterval_u128_to_fakefloat(entropy_copy, U64_BITS);
     }else if(rounding_status==TRANSFORM_ROUNDING_STATUS_NEGATIVE){
@@ -2153,6 +6017,7 @@ This is the functional equivalent of transform_whole_list_line_entropy_delta_get
   entropy_x_idx=1;
   freq_list_idx=0;
   freq_list_base_list_base=transform_base->freq_list_base_list_base;
+  freq_size_log2=transform_base->freq_size_log2;
   granularity=entropy_base->granularity;
   lookup_list_base=transform_base->log_factorial_fru128_list_base;
   if(algo_status==TRANSFORM_ALGO_STATUS_SHANNON){
@@ -2166,19 +6031,29 @@ This is the functional equivalent of transform_whole_list_line_entropy_delta_get
   window_x_idx_post=window_x_idx_max+1;
   freq_list_idx_delta=(optimize_status?window_x_idx_post:freq_list_idx);
   whole_max_max=entropy_base->whole_max_max;
-  whole_u8_idx_delta0=whole_size*window_x_idx_post;
   whole_x_idx_max=entropy_base->whole_x_idx_max;
-  whole_u8_idx_delta1=whole_size*whole_x_idx_max;
   whole_x_idx_post=whole_x_idx_max+1;
+  whole_x_u8_idx_delta=whole_size;
+  whole_y_u8_idx_delta=whole_size*whole_x_idx_post;
+  if(transform_base->whole_transpose_u8_list_base){
+/*
+Read the column-major copy from transform_transpose_init() instead, so that the vertical loop below runs through contiguous memory.
+*/
+    whole_u8_list_base=transform_base->whole_transpose_u8_list_base;
+    whole_x_u8_idx_delta=whole_size*entropy_base->whole_y_idx_post;
+    whole_y_u8_idx_delta=whole_size;
+  }
+  whole_u8_idx_delta0=whole_x_u8_idx_delta*window_x_idx_post;
+  whole_u8_idx_delta1=whole_y_u8_idx_delta-whole_size;
   window_y_idx_max=entropy_base->window_y_idx_max;
   while(entropy_x_idx<=entropy_x_idx_max){
     entropy_delta=entropy_delta_list_base[freq_list_idx];
     FRU128_ADD_FRU128_SELF(entropy, entropy_delta, status);
     freq_list_base=freq_list_base_list_base[freq_list_idx+freq_list_idx_delta];
-    if(algo_status==TRANSFORM_ALGO_STATUS_LOGFREEDOM){
+    if(pop_list_base_list_base){
       pop_list_base=pop_list_base_list_base[freq_list_idx+freq_list_idx_delta];
     }
-    whole_u8_idx=whole_size*(entropy_x_idx-1+whole_x_idx_post*whole_y_idx);
+    whole_u8_idx=whole_x_u8_idx_delta*(entropy_x_idx-1)+whole_y_u8_idx_delta*whole_y_idx;
     window_y_idx=0;
     do{
       whole_old=whole_u8_list_base[whole_u8_idx];
@@ -2192,26 +6067,44 @@ This is the functional equivalent of transform_whole_list_line_entropy_delta_get
         whole_u8_idx++;
         if(U16_BYTE_MAX<granularity){
           digit=whole_u8_list_base[whole_u8_idx];
-          whole_old|=digit<<U8_BITS;
+          whole_old|=digit<<U16_BITS;
           digit=whole_u8_list_base[whole_u8_idx+whole_u8_idx_delta0];
-          whole|=digit<<U8_BITS;
+          whole|=digit<<U16_BITS;
           whole_u8_idx++;
           if(U24_BYTE_MAX<granularity){
             digit=whole_u8_list_base[whole_u8_idx];
-            whole_old|=digit<<U8_BITS;
+            whole_old|=digit<<U24_BITS;
             digit=whole_u8_list_base[whole_u8_idx+whole_u8_idx_delta0];
-            whole|=digit<<U8_BITS;
+            whole|=digit<<U24_BITS;
             whole_u8_idx++;
           }
         }
       }
       whole_u8_idx+=whole_u8_idx_delta1;
-      freq_list_base[whole]++;
       if(!optimize_status){
-        freq_list_base[whole_old]--;
+        TRANSFORM_STATS_EQUAL_COUNT(stats_unchanged_count, whole, whole_old);
+/*
+Move both wholes between population buckets as they enter and leave the column, so that the population list remains consistent with the frequency list without having to be refilled.
+*/
+        if(whole!=whole_old){
+          TRANSFORM_FREQ_GET(freq, freq_list_base, freq_size_log2, whole);
+          TRANSFORM_FREQ_SET(freq_list_base, freq_size_log2, whole, freq+1);
+          pop_list_base[freq]--;
+          pop_list_base[freq+1]++;
+          TRANSFORM_FREQ_GET(freq_old, freq_list_base, freq_size_log2, whole_old);
+          TRANSFORM_FREQ_SET(freq_list_base, freq_size_log2, whole_old, freq_old-1);
+          pop_list_base[freq_old]--;
+          pop_list_base[freq_old-1]++;
+        }
+      }else{
+        TRANSFORM_FREQ_INCREMENT(freq_list_base, freq_size_log2, whole);
       }
     }while((window_y_idx++)!=window_y_idx_max);
-    status_delta=transform_freq_list_entropy_get_fru128(algo_status, &entropy_delta, freq_list_base, lookup_list_base, pop_list_base, window_y_idx_max, whole_max_max);
+    if(!optimize_status){
+      status_delta=transform_pop_list_entropy_get_fru128(algo_status, &entropy_delta, lookup_list_base, pop_list_base, window_y_idx_max);
+    }else{
+      status_delta=transform_freq_list_entropy_get_fru128(algo_status, &entropy_delta, freq_list_base, freq_size_log2, lookup_list_base, pop_list_base, window_y_idx_max, whole_max_max);
+    }
     status=(u8)(status|status_delta);
     entropy_delta_list_base[freq_list_idx+freq_list_idx_delta]=entropy_delta;
     FRU128_SUBTRACT_FRU128_SELF(entropy, entropy_delta, status);
@@ -2223,6 +6116,9 @@ This is the functional equivalent of transform_whole_list_line_entropy_delta_get
       entropy_min_min=entropy.a;
       entropy_min_min_x_idx=entropy_x_idx;
     }
+    if(entropy_row_list_base){
+      entropy_row_list_base[entropy_x_idx]=entropy;
+    }
     if(entropy_u32_list_base){
       entropy_copy=entropy;
       if(discount_status){
@@ -2248,6 +6144,11 @@ This is the functional equivalent of transform_whole_list_line_entropy_delta_get
   entropy_base->max_max_x_idx=entropy_max_max_x_idx;
   entropy_base->min_min_u128=entropy_min_min;
   entropy_base->min_min_x_idx=entropy_min_min_x_idx;
+  TRANSFORM_STATS_TIME_ADD(TRANSFORM_STATS_IDX_KERNEL_NS, stats_time);
+  TRANSFORM_STATS_ADD(TRANSFORM_STATS_IDX_FAKEFLOAT_COUNT, (entropy_u32_list_base?(entropy_x_idx_max+1):0));
+  TRANSFORM_STATS_ADD(TRANSFORM_STATS_IDX_SATURATION_COUNT, status);
+  TRANSFORM_STATS_ADD(TRANSFORM_STATS_IDX_WHOLE_UNCHANGED_COUNT, stats_unchanged_count);
+  TRANSFORM_STATS_ADD(TRANSFORM_STATS_IDX_WHOLE_UPDATE_COUNT, (optimize_status?0:entropy_x_idx_max*(window_y_idx_max+1)));
   return status;
 }
 
@@ -2268,21 +6169,27 @@ This is the functional equivalent of transform_whole_list_line_entropy_delta_get
   ULONG entropy_max_max_x_idx;
   u64 entropy_min_min;
   ULONG entropy_min_min_x_idx;
+  fru64 *entropy_row_list_base;
   u32 entropy_u32;
   ULONG entropy_u32_idx;
   u32 *entropy_u32_list_base;
   ULONG entropy_x_idx;
   ULONG entropy_x_idx_max;
-  ULONG *freq_list_base;
-  ULONG **freq_list_base_list_base;
+  ULONG freq;
+  void *freq_list_base;
+  void **freq_list_base_list_base;
   ULONG freq_list_idx;
   ULONG freq_list_idx_delta;
+  ULONG freq_old;
+  u8 freq_size_log2;
   u8 granularity;
   fru64 *lookup_list_base;
   u8 optimize_status;
   ULONG *pop_list_base;
   ULONG **pop_list_base_list_base;
   u8 rounding_status;
+  TRANSFORM_STATS_DECLARE(stats_time)
+  TRANSFORM_STATS_DECLARE(stats_unchanged_count)
   u8 status;
   u8 status_delta;
   u32 whole;
@@ -2294,11 +6201,15 @@ This is the functional equivalent of transform_whole_list_line_entropy_delta_get
   ULONG whole_u8_idx_delta1;
   ULONG whole_x_idx_max;
   ULONG whole_x_idx_post;
+  ULONG whole_x_u8_idx_delta;
+  ULONG whole_y_u8_idx_delta;
   ULONG window_x_idx_max;
   ULONG window_x_idx_post;
   ULONG window_y_idx;
   ULONG window_y_idx_max;
 
+  TRANSFORM_STATS_TIME_GET(stats_time);
+  TRANSFORM_STATS_SET_ZERO(stats_unchanged_count);
   discount_status=entropy_base->discount_status;
   entropy_base->discount_status=0;
   status=transform_whole_list_window_entropy_get_fru64(entropy_base, transform_base, whole_u8_list_base, 0, whole_y_idx);
@@ -2311,6 +6222,10 @@ This is the functional equivalent of transform_whole_list_line_entropy_delta_get
   entropy_min_min=entropy_base->min_min_u64;
   entropy.a=entropy_min_min;
   entropy_min_min_x_idx=0;
+  entropy_row_list_base=entropy_base->rank_row_fru64_list_base;
+  if(entropy_row_list_base){
+    entropy_row_list_base[0]=entropy;
+  }
   entropy_u32_idx=0;
   entropy_u32_list_base=entropy_base->fakefloat_list_base;
   entropy_x_idx_max=entropy_base->fakefloat_x_idx_max;
@@ -2319,7 +6234,7 @@ This is the functional equivalent of transform_whole_list_line_entropy_delta_get
     if(discount_status){
       FRU64_SUBTRACT_FRU64(entropy_copy, entropy_max_max_max, entropy, status);
     }
-    entropy_u32_idx=(entropy_x_idx_max+1)*whole_y_idx;
+    entropy_u32_idx=(entropy_x_idx_max+1)*(whole_y_idx-entropy_base->fakefloat_y_idx_min);
     if(rounding_status==TRANSFORM_ROUNDING_STATUS_NEAREST_EVEN){
       entropy_u32=fracterval_u64_to_fakefloat(entropy, U32_BITS);
     }else if(rounding_status==TRANSFORM_ROUNDING_STATUS_NEGATIVE){
@@ -2335,6 +6250,7 @@ This is the functional equivalent of transform_whole_list_line_entropy_delta_get
   entropy_x_idx=1;
   freq_list_idx=0;
   freq_list_base_list_base=transform_base->freq_list_base_list_base;
+  freq_size_log2=transform_base->freq_size_log2;
   granularity=entropy_base->granularity;
   lookup_list_base=transform_base->log_factorial_fru64_list_base;
   if(algo_status==TRANSFORM_ALGO_STATUS_SHANNON){
@@ -2348,19 +6264,29 @@ This is the functional equivalent of transform_whole_list_line_entropy_delta_get
   window_x_idx_post=window_x_idx_max+1;
   freq_list_idx_delta=(optimize_status?window_x_idx_post:freq_list_idx);
   whole_max_max=entropy_base->whole_max_max;
-  whole_u8_idx_delta0=whole_size*window_x_idx_post;
   whole_x_idx_max=entropy_base->whole_x_idx_max;
-  whole_u8_idx_delta1=whole_size*whole_x_idx_max;
   whole_x_idx_post=whole_x_idx_max+1;
+  whole_x_u8_idx_delta=whole_size;
+  whole_y_u8_idx_delta=whole_size*whole_x_idx_post;
+  if(transform_base->whole_transpose_u8_list_base){
+/*
+Read the column-major copy from transform_transpose_init() instead, so that the vertical loop below runs through contiguous memory.
+*/
+    whole_u8_list_base=transform_base->whole_transpose_u8_list_base;
+    whole_x_u8_idx_delta=whole_size*entropy_base->whole_y_idx_post;
+    whole_y_u8_idx_delta=whole_size;
+  }
+  whole_u8_idx_delta0=whole_x_u8_idx_delta*window_x_idx_post;
+  whole_u8_idx_delta1=whole_y_u8_idx_delta-whole_size;
   window_y_idx_max=entropy_base->window_y_idx_max;
   while(entropy_x_idx<=entropy_x_idx_max){
     entropy_delta=entropy_delta_list_base[freq_list_idx];
     FRU64_ADD_FRU64_SELF(entropy, entropy_delta, status);
     freq_list_base=freq_list_base_list_base[freq_list_idx+freq_list_idx_delta];
-    if(algo_status==TRANSFORM_ALGO_STATUS_LOGFREEDOM){
+    if(pop_list_base_list_base){
       pop_list_base=pop_list_base_list_base[freq_list_idx+freq_list_idx_delta];
     }
-    whole_u8_idx=whole_size*(entropy_x_idx-1+whole_x_idx_post*whole_y_idx);
+    whole_u8_idx=whole_x_u8_idx_delta*(entropy_x_idx-1)+whole_y_u8_idx_delta*whole_y_idx;
     window_y_idx=0;
     do{
       whole_old=whole_u8_list_base[whole_u8_idx];
@@ -2374,26 +6300,44 @@ This is the functional equivalent of transform_whole_list_line_entropy_delta_get
         whole_u8_idx++;
         if(U16_BYTE_MAX<granularity){
           digit=whole_u8_list_base[whole_u8_idx];
-          whole_old|=digit<<U8_BITS;
+          whole_old|=digit<<U16_BITS;
           digit=whole_u8_list_base[whole_u8_idx+whole_u8_idx_delta0];
-          whole|=digit<<U8_BITS;
+          whole|=digit<<U16_BITS;
           whole_u8_idx++;
           if(U24_BYTE_MAX<granularity){
             digit=whole_u8_list_base[whole_u8_idx];
-            whole_old|=digit<<U8_BITS;
+            whole_old|=digit<<U24_BITS;
             digit=whole_u8_list_base[whole_u8_idx+whole_u8_idx_delta0];
-            whole|=digit<<U8_BITS;
+            whole|=digit<<U24_BITS;
             whole_u8_idx++;
           }
         }
       }
       whole_u8_idx+=whole_u8_idx_delta1;
-      freq_list_base[whole]++;
       if(!optimize_status){
-        freq_list_base[whole_old]--;
+        TRANSFORM_STATS_EQUAL_COUNT(stats_unchanged_count, whole, whole_old);
+/*
+Move both wholes between population buckets as they enter and leave the column, so that the population list remains consistent with the frequency list without having to be refilled.
+*/
+        if(whole!=whole_old){
+          TRANSFORM_FREQ_GET(freq, freq_list_base, freq_size_log2, whole);
+          TRANSFORM_FREQ_SET(freq_list_base, freq_size_log2, whole, freq+1);
+          pop_list_base[freq]--;
+          pop_list_base[freq+1]++;
+          TRANSFORM_FREQ_GET(freq_old, freq_list_base, freq_size_log2, whole_old);
+          TRANSFORM_FREQ_SET(freq_list_base, freq_size_log2, whole_old, freq_old-1);
+          pop_list_base[freq_old]--;
+          pop_list_base[freq_old-1]++;
+        }
+      }else{
+        TRANSFORM_FREQ_INCREMENT(freq_list_base, freq_size_log2, whole);
       }
     }while((window_y_idx++)!=window_y_idx_max);
-    status_delta=transform_freq_list_entropy_get_fru64(algo_status, &entropy_delta, freq_list_base, lookup_list_base, pop_list_base, window_y_idx_max, whole_max_max);
+    if(!optimize_status){
+      status_delta=transform_pop_list_entropy_get_fru64(algo_status, &entropy_delta, lookup_list_base, pop_list_base, window_y_idx_max);
+    }else{
+      status_delta=transform_freq_list_entropy_get_fru64(algo_status, &entropy_delta, freq_list_base, freq_size_log2, lookup_list_base, pop_list_base, window_y_idx_max, whole_max_max);
+    }
     status=(u8)(status|status_delta);
     entropy_delta_list_base[freq_list_idx+freq_list_idx_delta]=entropy_delta;
     FRU64_SUBTRACT_FRU64_SELF(entropy, entropy_delta, status);
@@ -2405,6 +6349,9 @@ This is the functional equivalent of transform_whole_list_line_entropy_delta_get
       entropy_min_min=entropy.a;
       entropy_min_min_x_idx=entropy_x_idx;
     }
+    if(entropy_row_list_base){
+      entropy_row_list_base[entropy_x_idx]=entropy;
+    }
     if(entropy_u32_list_base){
       entropy_copy=entropy;
       if(discount_status){
@@ -2430,9 +6377,303 @@ This is the functional equivalent of transform_whole_list_line_entropy_delta_get
   entropy_base->max_max_x_idx=entropy_max_max_x_idx;
   entropy_base->min_min_u64=entropy_min_min;
   entropy_base->min_min_x_idx=entropy_min_min_x_idx;
+  TRANSFORM_STATS_TIME_ADD(TRANSFORM_STATS_IDX_KERNEL_NS, stats_time);
+  TRANSFORM_STATS_ADD(TRANSFORM_STATS_IDX_FAKEFLOAT_COUNT, (entropy_u32_list_base?(entropy_x_idx_max+1):0));
+  TRANSFORM_STATS_ADD(TRANSFORM_STATS_IDX_SATURATION_COUNT, status);
+  TRANSFORM_STATS_ADD(TRANSFORM_STATS_IDX_WHOLE_UNCHANGED_COUNT, stats_unchanged_count);
+  TRANSFORM_STATS_ADD(TRANSFORM_STATS_IDX_WHOLE_UPDATE_COUNT, (optimize_status?0:entropy_x_idx_max*(window_y_idx_max+1)));
   return status;
 }
 
+void
+transform_whole_list_line_entropy_screen(entropy_t *entropy_base, double *entropy_max_base, double *entropy_min_base, double *error_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_y_idx){
+/*
+Estimate the entropy of every window in a row in double precision, along with a bound on the error of the estimates, so that transform_dispatch_row_span() can skip rows which provably contain neither extreme. Rather than reevaluating the entropy delta of each column from its population list, as the fracterval kernels do, maintain the sum of the entropy deltas of all columns in the window by adding the difference in the relevant lookup list terms whenever a single frequency changes, so each whole which enters or leaves the window costs constant time. Don't call here directly; use transform_screen_init() instead.
+
+In:
+
+  entropy_base is transform_malloc():Out:*entropy_base_base.
+
+  *entropy_max_base is undefined.
+
+  *entropy_min_base is undefined.
+
+  *error_base is undefined.
+
+  transform_base is transform_malloc():Out:*transform_base_base, after transform_screen_init(), with (transform_base->optimize_status) zero. Every frequency in every frequency list must be zero.
+
+  whole_u8_list_base is as defined in transform_whole_list_window_entropy_get_fru128():In.
+
+  whole_y_idx is the row index. On [0, (entropy_base->fakefloat_y_idx_max)].
+
+Out:
+
+  *entropy_max_base and *entropy_min_base are the greatest and least estimated entropies, respectively, of all windows in the row.
+
+  *error_base is an upper bound on the absolute difference between the estimated and actual entropy (not discount nats) of every window in the row. It's twice the sum of all error bounds, which more than covers the rounding of the bounds themselves.
+
+  Every frequency in every frequency list is zero again. The population lists in *transform_base are undefined.
+*/
+  u8 algo_status;
+  double bias;
+  double bias_error;
+  ULONG diff_count;
+  u32 digit;
+  double entropy;
+  double entropy_delta;
+  double entropy_delta_sum;
+  double entropy_delta_sum_max;
+  double entropy_max;
+  double entropy_min;
+  ULONG entropy_x_idx;
+  ULONG entropy_x_idx_max;
+  double error;
+  ULONG freq;
+  void *freq_list_base;
+  void **freq_list_base_list_base;
+  ULONG freq_list_idx;
+  u8 freq_size_log2;
+  u8 granularity;
+  double *lookup_list_base;
+  double lookup_error;
+  double lookup_max;
+  u8 logfreedom_status;
+  ULONG pop;
+  ULONG *pop_list_base;
+  ULONG **pop_list_base_list_base;
+  TRANSFORM_STATS_DECLARE(stats_time)
+  u32 whole;
+  u32 whole_max_max;
+  u32 whole_old;
+  u8 whole_size;
+  ULONG whole_u8_idx;
+  ULONG whole_u8_idx_delta0;
+  ULONG whole_u8_idx_delta1;
+  ULONG whole_u8_idx_min;
+  ULONG whole_x_u8_idx_delta;
+  ULONG whole_y_u8_idx_delta;
+  ULONG window_x_idx;
+  ULONG window_x_idx_max;
+  ULONG window_x_idx_post;
+  ULONG window_y_idx;
+  ULONG window_y_idx_max;
+  ULONG window_y_idx_post;
+
+  TRANSFORM_STATS_TIME_GET(stats_time);
+  algo_status=transform_base->algo_status;
+  if(!entropy_base->precise_status){
+    bias=transform_screen_fru64_to_double(&bias_error, entropy_base->window_bias_fru64);
+  }else{
+    bias=transform_screen_fru128_to_double(&bias_error, entropy_base->window_bias_fru128);
+  }
+  freq_list_base_list_base=transform_base->freq_list_base_list_base;
+  freq_size_log2=transform_base->freq_size_log2;
+  granularity=entropy_base->granularity;
+  logfreedom_status=(algo_status==TRANSFORM_ALGO_STATUS_LOGFREEDOM);
+  lookup_list_base=transform_base->screen_double_list_base;
+  lookup_error=transform_base->screen_error;
+  lookup_max=transform_base->screen_term_max;
+  pop_list_base_list_base=transform_base->pop_list_base_list_base;
+  whole_max_max=entropy_base->whole_max_max;
+  whole_size=(u8)(granularity+1);
+  window_x_idx_max=entropy_base->window_x_idx_max;
+  window_x_idx_post=window_x_idx_max+1;
+  window_y_idx_max=entropy_base->window_y_idx_max;
+  window_y_idx_post=window_y_idx_max+1;
+  whole_x_u8_idx_delta=whole_size;
+  whole_y_u8_idx_delta=whole_size*entropy_base->whole_x_idx_post;
+  if(transform_base->whole_transpose_u8_list_base){
+    whole_u8_list_base=transform_base->whole_transpose_u8_list_base;
+    whole_x_u8_idx_delta=whole_size*entropy_base->whole_y_idx_post;
+    whole_y_u8_idx_delta=whole_size;
+  }
+  diff_count=0;
+  entropy_delta_sum=0.0;
+  if(logfreedom_status){
+/*
+Every population list starts out with all (whole_max_max+1) wholes at frequency zero. The entropy delta of such a column is the log factorial of that count.
+*/
+    window_x_idx=0;
+    do{
+      pop_list_base=pop_list_base_list_base[window_x_idx];
+      transform_ulong_list_zero(window_y_idx_post, pop_list_base);
+      pop_list_base[0]=(ULONG)(whole_max_max)+1;
+      entropy_delta_sum+=lookup_list_base[(ULONG)(whole_max_max)+1];
+    }while((window_x_idx++)!=window_x_idx_max);
+    diff_count=window_x_idx_post;
+  }
+  entropy_delta_sum_max=entropy_delta_sum;
+/*
+Add the wholes of the first window one at a time, exactly as they would be added when the window moves right.
+*/
+  whole_u8_idx_delta0=whole_x_u8_idx_delta-whole_size;
+  whole_u8_idx_min=whole_y_u8_idx_delta*whole_y_idx;
+  window_y_idx=0;
+  do{
+    whole_u8_idx=whole_u8_idx_min;
+    for(window_x_idx=0; window_x_idx<=window_x_idx_max; window_x_idx++){
+      freq_list_base=freq_list_base_list_base[window_x_idx];
+      pop_list_base=pop_list_base_list_base[window_x_idx];
+      whole=whole_u8_list_base[whole_u8_idx];
+      whole_u8_idx++;
+      if(granularity){
+        digit=whole_u8_list_base[whole_u8_idx];
+        whole|=digit<<U8_BITS;
+        whole_u8_idx++;
+        if(U16_BYTE_MAX<granularity){
+          digit=whole_u8_list_base[whole_u8_idx];
+          whole|=digit<<U16_BITS;
+          whole_u8_idx++;
+          if(U24_BYTE_MAX<granularity){
+            digit=whole_u8_list_base[whole_u8_idx];
+            whole|=digit<<U24_BITS;
+            whole_u8_idx++;
+          }
+        }
+      }
+      whole_u8_idx+=whole_u8_idx_delta0;
+      TRANSFORM_FREQ_GET(freq, freq_list_base, freq_size_log2, whole);
+      TRANSFORM_FREQ_SET(freq_list_base, freq_size_log2, whole, freq+1);
+      entropy_delta=lookup_list_base[freq+1]-lookup_list_base[freq];
+      diff_count++;
+      if(logfreedom_status){
+        pop=pop_list_base[freq];
+        pop_list_base[freq]=pop-1;
+        entropy_delta+=lookup_list_base[pop-1]-lookup_list_base[pop];
+        pop=pop_list_base[freq+1];
+        pop_list_base[freq+1]=pop+1;
+        entropy_delta+=lookup_list_base[pop+1]-lookup_list_base[pop];
+        diff_count+=2;
+      }
+      entropy_delta_sum+=entropy_delta;
+      entropy_delta_sum_max=MAX(entropy_delta_sum_max, entropy_delta_sum);
+    }
+    whole_u8_idx_min+=whole_y_u8_idx_delta;
+  }while((window_y_idx++)!=window_y_idx_max);
+  entropy=bias-entropy_delta_sum;
+  entropy_max=entropy;
+  entropy_min=entropy;
+/*
+Roll the window across the row as transform_whole_list_line_entropy_get_fru128() does without (transform_base->optimize_status), but instead of reevaluating the outgoing column, adjust the sum by the change in each term.
+*/
+  entropy_x_idx=1;
+  entropy_x_idx_max=entropy_base->fakefloat_x_idx_max;
+  freq_list_idx=0;
+  whole_u8_idx_delta0=whole_x_u8_idx_delta*window_x_idx_post;
+  whole_u8_idx_delta1=whole_y_u8_idx_delta-whole_size;
+  while(entropy_x_idx<=entropy_x_idx_max){
+    freq_list_base=freq_list_base_list_base[freq_list_idx];
+    pop_list_base=pop_list_base_list_base[freq_list_idx];
+    whole_u8_idx=whole_x_u8_idx_delta*(entropy_x_idx-1)+whole_y_u8_idx_delta*whole_y_idx;
+    window_y_idx=0;
+    do{
+      whole_old=whole_u8_list_base[whole_u8_idx];
+      whole=whole_u8_list_base[whole_u8_idx+whole_u8_idx_delta0];
+      whole_u8_idx++;
+      if(granularity){
+        digit=whole_u8_list_base[whole_u8_idx];
+        whole_old|=digit<<U8_BITS;
+        digit=whole_u8_list_base[whole_u8_idx+whole_u8_idx_delta0];
+        whole|=digit<<U8_BITS;
+        whole_u8_idx++;
+        if(U16_BYTE_MAX<granularity){
+          digit=whole_u8_list_base[whole_u8_idx];
+          whole_old|=digit<<U16_BITS;
+          digit=whole_u8_list_base[whole_u8_idx+whole_u8_idx_delta0];
+          whole|=digit<<U16_BITS;
+          whole_u8_idx++;
+          if(U24_BYTE_MAX<granularity){
+            digit=whole_u8_list_base[whole_u8_idx];
+            whole_old|=digit<<U24_BITS;
+            digit=whole_u8_list_base[whole_u8_idx+whole_u8_idx_delta0];
+            whole|=digit<<U24_BITS;
+            whole_u8_idx++;
+          }
+        }
+      }
+      whole_u8_idx+=whole_u8_idx_delta1;
+      if(whole!=whole_old){
+        TRANSFORM_FREQ_GET(freq, freq_list_base, freq_size_log2, whole);
+        TRANSFORM_FREQ_SET(freq_list_base, freq_size_log2, whole, freq+1);
+        entropy_delta=lookup_list_base[freq+1]-lookup_list_base[freq];
+        if(logfreedom_status){
+          pop=pop_list_base[freq];
+          pop_list_base[freq]=pop-1;
+          entropy_delta+=lookup_list_base[pop-1]-lookup_list_base[pop];
+          pop=pop_list_base[freq+1];
+          pop_list_base[freq+1]=pop+1;
+          entropy_delta+=lookup_list_base[pop+1]-lookup_list_base[pop];
+        }
+        TRANSFORM_FREQ_GET(freq, freq_list_base, freq_size_log2, whole_old);
+        TRANSFORM_FREQ_SET(freq_list_base, freq_size_log2, whole_old, freq-1);
+        entropy_delta+=lookup_list_base[freq-1]-lookup_list_base[freq];
+        if(logfreedom_status){
+          pop=pop_list_base[freq];
+          pop_list_base[freq]=pop-1;
+          entropy_delta+=lookup_list_base[pop-1]-lookup_list_base[pop];
+          pop=pop_list_base[freq-1];
+          pop_list_base[freq-1]=pop+1;
+          entropy_delta+=lookup_list_base[pop+1]-lookup_list_base[pop];
+          diff_count+=4;
+        }
+        diff_count+=2;
+        entropy_delta_sum+=entropy_delta;
+        entropy_delta_sum_max=MAX(entropy_delta_sum_max, entropy_delta_sum);
+      }
+    }while((window_y_idx++)!=window_y_idx_max);
+    entropy=bias-entropy_delta_sum;
+    entropy_max=MAX(entropy_max, entropy);
+    entropy_min=MIN(entropy_min, entropy);
+    freq_list_idx++;
+    if(freq_list_idx==window_x_idx_post){
+      freq_list_idx=0;
+    }
+    entropy_x_idx++;
+  }
+/*
+Zero the frequencies of the last window, which is much faster than zeroing entire frequency lists when wholes are wide. Column (entropy_x_idx_max+window_x_idx) was last assigned to frequency list (freq_list_idx+window_x_idx) modulo (window_x_idx_post).
+*/
+  whole_u8_idx_delta0=whole_x_u8_idx_delta-whole_size;
+  whole_u8_idx_min=whole_x_u8_idx_delta*entropy_x_idx_max+whole_y_u8_idx_delta*whole_y_idx;
+  window_y_idx=0;
+  do{
+    whole_u8_idx=whole_u8_idx_min;
+    for(window_x_idx=0; window_x_idx<=window_x_idx_max; window_x_idx++){
+      freq_list_base=freq_list_base_list_base[(freq_list_idx+window_x_idx)%window_x_idx_post];
+      whole=whole_u8_list_base[whole_u8_idx];
+      whole_u8_idx++;
+      if(granularity){
+        digit=whole_u8_list_base[whole_u8_idx];
+        whole|=digit<<U8_BITS;
+        whole_u8_idx++;
+        if(U16_BYTE_MAX<granularity){
+          digit=whole_u8_list_base[whole_u8_idx];
+          whole|=digit<<U16_BITS;
+          whole_u8_idx++;
+          if(U24_BYTE_MAX<granularity){
+            digit=whole_u8_list_base[whole_u8_idx];
+            whole|=digit<<U24_BITS;
+            whole_u8_idx++;
+          }
+        }
+      }
+      whole_u8_idx+=whole_u8_idx_delta0;
+      TRANSFORM_FREQ_SET(freq_list_base, freq_size_log2, whole, 0);
+    }
+    whole_u8_idx_min+=whole_y_u8_idx_delta;
+  }while((window_y_idx++)!=window_y_idx_max);
+/*
+Each difference of lookup list items is off by at most twice their error, plus the rounding of a value no greater than (lookup_max). At most 6 differences are accumulated before being added to the sum, so each of those additions rounds a value no greater than (6*lookup_max), and the addition to the sum rounds a value no greater than (entropy_delta_sum_max+6*lookup_max). Charging all of that to each difference is generous. The final subtraction from the bias rounds once more per window, independently.
+*/
+  error=(double)(diff_count)*(2.0*lookup_error+TRANSFORM_SCREEN_ROUNDING*(entropy_delta_sum_max+16.0*lookup_max));
+  error+=bias_error+TRANSFORM_SCREEN_ROUNDING*(bias+entropy_delta_sum_max);
+  *error_base=2.0*error;
+  *entropy_max_base=entropy_max;
+  *entropy_min_base=entropy_min;
+  TRANSFORM_STATS_TIME_ADD(TRANSFORM_STATS_IDX_SCREEN_NS, stats_time);
+  return;
+}
+
 u8
 transform_whole_list_window_entropy_get_fru128(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_min, ULONG whole_y_idx_min){
 /*
@@ -2444,7 +6685,7 @@ In:
 
   transform_base is transform_malloc():Out:*transform_base_base.
 
-  whole_u8_list_base is the base of (entropy_base->whole_count) wholes, each of size (entropy_base->granularity+1) and not exceeding (entropy_base->whole_max_max).
+  whole_u8_list_base is the base of (entropy_base->whole_count) wholes, each of size (entropy_base->granularity+1) and not exceeding (entropy_base->whole_max_max). It's ignored in favor of (transform_base->whole_transpose_u8_list_base) if transform_transpose_init() was called.
 
   whole_x_idx_min is the the least column index of the window in *whole_u8_list_base.
 
@@ -2461,8 +6702,9 @@ Out:
   fru128 entropy;
   fru128 entropy_delta;
   fru128 *entropy_delta_list_base;
-  ULONG *freq_list_base;
-  ULONG **freq_list_base_list_base;
+  void *freq_list_base;
+  void **freq_list_base_list_base;
+  u8 freq_size_log2;
   u8 granularity;
   fru128 *lookup_list_base;
   ULONG *pop_list_base;
@@ -2474,30 +6716,42 @@ Out:
   u8 whole_size;
   ULONG whole_u8_idx;
   ULONG whole_u8_idx_delta;
+  ULONG whole_u8_idx_min;
   ULONG whole_x_idx_max;
   ULONG whole_x_idx_post;
+  ULONG whole_x_u8_idx_delta;
+  ULONG whole_y_u8_idx_delta;
   ULONG window_x_idx;
   ULONG window_x_idx_max;
   ULONG window_y_idx;
   ULONG window_y_idx_max;
 
   freq_list_base_list_base=transform_base->freq_list_base_list_base;
+  freq_size_log2=transform_base->freq_size_log2;
   whole_max_max=entropy_base->whole_max_max;
   window_x_idx=0;
   window_x_idx_max=entropy_base->window_x_idx_max;
   do{
     freq_list_base=freq_list_base_list_base[window_x_idx];
-    transform_ulong_list_zero(whole_max_max, freq_list_base);
+    transform_freq_list_zero(freq_list_base, freq_size_log2, whole_max_max);
   }while((window_x_idx++)!=window_x_idx_max);
   granularity=entropy_base->granularity;
   whole_size=(u8)(granularity+1);
   whole_x_idx_max=entropy_base->whole_x_idx_max;
   whole_x_idx_post=whole_x_idx_max+1;
-  whole_u8_idx=whole_size*(whole_x_idx_min+whole_x_idx_post*whole_y_idx_min);
-  whole_u8_idx_delta=whole_size*(whole_x_idx_max-window_x_idx_max);
+  whole_x_u8_idx_delta=whole_size;
+  whole_y_u8_idx_delta=whole_size*whole_x_idx_post;
+  if(transform_base->whole_transpose_u8_list_base){
+    whole_u8_list_base=transform_base->whole_transpose_u8_list_base;
+    whole_x_u8_idx_delta=whole_size*entropy_base->whole_y_idx_post;
+    whole_y_u8_idx_delta=whole_size;
+  }
+  whole_u8_idx_delta=whole_x_u8_idx_delta-whole_size;
+  whole_u8_idx_min=whole_x_u8_idx_delta*whole_x_idx_min+whole_y_u8_idx_delta*whole_y_idx_min;
   window_y_idx=0;
   window_y_idx_max=entropy_base->window_y_idx_max;
   do{
+    whole_u8_idx=whole_u8_idx_min;
     for(window_x_idx=0; window_x_idx<=window_x_idx_max; window_x_idx++){
       freq_list_base=freq_list_base_list_base[window_x_idx];
       whole=whole_u8_list_base[whole_u8_idx];
@@ -2517,9 +6771,10 @@ Out:
           }
         }
       }
-      freq_list_base[whole]++;
+      whole_u8_idx+=whole_u8_idx_delta;
+      TRANSFORM_FREQ_INCREMENT(freq_list_base, freq_size_log2, whole);
     }
-    whole_u8_idx+=whole_u8_idx_delta;
+    whole_u8_idx_min+=whole_y_u8_idx_delta;
   }while((window_y_idx++)!=window_y_idx_max);
   algo_status=transform_base->algo_status;
   status=0;
@@ -2534,10 +6789,10 @@ Out:
   window_x_idx=0;
   do{
     freq_list_base=freq_list_base_list_base[window_x_idx];
-    if(algo_status==TRANSFORM_ALGO_STATUS_LOGFREEDOM){
+    if(pop_list_base_list_base){
       pop_list_base=pop_list_base_list_base[window_x_idx];
     }
-    status_delta=transform_freq_list_entropy_get_fru128(algo_status, &entropy_delta, freq_list_base, lookup_list_base, pop_list_base, window_y_idx_max, whole_max_max);
+    status_delta=transform_freq_list_entropy_get_fru128(algo_status, &entropy_delta, freq_list_base, freq_size_log2, lookup_list_base, pop_list_base, window_y_idx_max, whole_max_max);
     status=(u8)(status|status_delta);
     entropy_delta_list_base[window_x_idx]=entropy_delta;
     FRU128_SUBTRACT_FRU128_SELF(entropy, entropy_delta, status);
@@ -2565,8 +6820,9 @@ This is the 64-bit fracterval equivalent of transform_whole_list_window_entropy_
   fru64 entropy;
   fru64 entropy_delta;
   fru64 *entropy_delta_list_base;
-  ULONG *freq_list_base;
-  ULONG **freq_list_base_list_base;
+  void *freq_list_base;
+  void **freq_list_base_list_base;
+  u8 freq_size_log2;
   u8 granularity;
   fru64 *lookup_list_base;
   ULONG *pop_list_base;
@@ -2578,30 +6834,42 @@ This is the 64-bit fracterval equivalent of transform_whole_list_window_entropy_
   u8 whole_size;
   ULONG whole_u8_idx;
   ULONG whole_u8_idx_delta;
+  ULONG whole_u8_idx_min;
   ULONG whole_x_idx_max;
   ULONG whole_x_idx_post;
+  ULONG whole_x_u8_idx_delta;
+  ULONG whole_y_u8_idx_delta;
   ULONG window_x_idx;
   ULONG window_x_idx_max;
   ULONG window_y_idx;
   ULONG window_y_idx_max;
 
   freq_list_base_list_base=transform_base->freq_list_base_list_base;
+  freq_size_log2=transform_base->freq_size_log2;
   whole_max_max=entropy_base->whole_max_max;
   window_x_idx=0;
   window_x_idx_max=entropy_base->window_x_idx_max;
   do{
     freq_list_base=freq_list_base_list_base[window_x_idx];
-    transform_ulong_list_zero(whole_max_max, freq_list_base);
+    transform_freq_list_zero(freq_list_base, freq_size_log2, whole_max_max);
   }while((window_x_idx++)!=window_x_idx_max);
   granularity=entropy_base->granularity;
   whole_size=(u8)(granularity+1);
   whole_x_idx_max=entropy_base->whole_x_idx_max;
   whole_x_idx_post=whole_x_idx_max+1;
-  whole_u8_idx=whole_size*(whole_x_idx_min+whole_x_idx_post*whole_y_idx_min);
-  whole_u8_idx_delta=whole_size*(whole_x_idx_max-window_x_idx_max);
+  whole_x_u8_idx_delta=whole_size;
+  whole_y_u8_idx_delta=whole_size*whole_x_idx_post;
+  if(transform_base->whole_transpose_u8_list_base){
+    whole_u8_list_base=transform_base->whole_transpose_u8_list_base;
+    whole_x_u8_idx_delta=whole_size*entropy_base->whole_y_idx_post;
+    whole_y_u8_idx_delta=whole_size;
+  }
+  whole_u8_idx_delta=whole_x_u8_idx_delta-whole_size;
+  whole_u8_idx_min=whole_x_u8_idx_delta*whole_x_idx_min+whole_y_u8_idx_delta*whole_y_idx_min;
   window_y_idx=0;
   window_y_idx_max=entropy_base->window_y_idx_max;
   do{
+    whole_u8_idx=whole_u8_idx_min;
     for(window_x_idx=0; window_x_idx<=window_x_idx_max; window_x_idx++){
       freq_list_base=freq_list_base_list_base[window_x_idx];
       whole=whole_u8_list_base[whole_u8_idx];
@@ -2621,9 +6889,10 @@ This is the 64-bit fracterval equivalent of transform_whole_list_window_entropy_
           }
         }
       }
-      freq_list_base[whole]++;
+      whole_u8_idx+=whole_u8_idx_delta;
+      TRANSFORM_FREQ_INCREMENT(freq_list_base, freq_size_log2, whole);
     }
-    whole_u8_idx+=whole_u8_idx_delta;
+    whole_u8_idx_min+=whole_y_u8_idx_delta;
   }while((window_y_idx++)!=window_y_idx_max);
   algo_status=transform_base->algo_status;
   status=0;
@@ -2638,10 +6907,10 @@ This is the 64-bit fracterval equivalent of transform_whole_list_window_entropy_
   window_x_idx=0;
   do{
     freq_list_base=freq_list_base_list_base[window_x_idx];
-    if(algo_status==TRANSFORM_ALGO_STATUS_LOGFREEDOM){
+    if(pop_list_base_list_base){
       pop_list_base=pop_list_base_list_base[window_x_idx];
     }
-    status_delta=transform_freq_list_entropy_get_fru64(algo_status, &entropy_delta, freq_list_base, lookup_list_base, pop_list_base, window_y_idx_max, whole_max_max);
+    status_delta=transform_freq_list_entropy_get_fru64(algo_status, &entropy_delta, freq_list_base, freq_size_log2, lookup_list_base, pop_list_base, window_y_idx_max, whole_max_max);
     status=(u8)(status|status_delta);
     entropy_delta_list_base[window_x_idx]=entropy_delta;
     FRU64_SUBTRACT_FRU64_SELF(entropy, entropy_delta, status);
@@ -2684,6 +6953,7 @@ Out:
   fru128 *lookup_fru128_list_base;
   fru64 *lookup_fru64_list_base;
   u8 precise_status;
+  TRANSFORM_STATS_DECLARE(stats_time)
   u8 status;
   u8 status_delta;
   u64 term_u64;
@@ -2696,6 +6966,7 @@ Out:
   ULONG window_x_idx_post;
   ULONG window_y_idx_post;
 
+  TRANSFORM_STATS_TIME_GET(stats_time);
   algo_status=transform_base->algo_status;
   precise_status=entropy_base->precise_status;
   status=0;
@@ -2825,9 +7096,9 @@ Maximum Shannon entropy occurs when all wholes have as close to equal frequency
     window_offset_fru128_1=lookup_fru128_list_base[whole_span_max];
     FRU128_ADD_FRU128_SELF(window_offset_fru128_1, window_offset_fru128_0, status);
 /*
-We don't actually have a generic method for computing maximum logfreedom, although there are good heuristics. (Neither gradient descent nor greedy optimization works all the time.) At slight risk of fracterval overflow, we can approximate it accurately. The iteration_max parameter is a gross overestimate even in the limits of maximal parameters, just to be safe.
+We don't actually have a generic method for computing maximum logfreedom, although there are good heuristics. (Neither gradient descent nor greedy optimization works all the time.) At slight risk of fracterval overflow, we can approximate it accurately, or find it in the memo file from a previous approximation.
 */
-    status_delta=transform_logfreedom_max_approximate(entropy_base, U64_BITS, &window_offset_fru128_0, transform_base);
+    status_delta=transform_logfreedom_max_get(&window_offset_fru128_0, transform_base, entropy_base->window_y_idx_max, entropy_base->whole_max_max);
     status=(u8)(status|status_delta);
     term_u64=window_x_idx_post;
     FRU128_MULTIPLY_U64_SELF(window_offset_fru128_0, term_u64, status);
@@ -2842,5 +7113,6 @@ We don't actually have a generic method for computing maximum logfreedom, althou
       entropy_base->window_max_max_fru128=window_offset_fru128_0;
     }
   }
+  TRANSFORM_STATS_TIME_ADD(TRANSFORM_STATS_IDX_OFFSETS_NS, stats_time);
   return status;
 }
@@ -23,22 +23,138 @@ License version 3 along with the Widebandit Library (filename
 #define TRANSFORM_ALGO_STATUS_SHANNON 0U
 #define TRANSFORM_ALGO_STATUS_AGNENTROPY 1U
 #define TRANSFORM_ALGO_STATUS_LOGFREEDOM 2U
+#define TRANSFORM_BAND_WINDOW_HEIGHT_RATIO 16U
+
+/*
+TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU128() defines a function named _f which is transform_whole_list_column_entropy_delta_get_fru128() with algo_status and granularity hardwired to _a and _g, respectively, by way of transform_column_entropy_delta_get_fru128(). TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU64() is the 64-bit fracterval equivalent.
+*/
+#define TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU128(_f, _a, _g) \
+u8 \
+_f(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx){ \
+  u8 status; \
+  \
+  status=transform_column_entropy_delta_get_fru128(_a, entropy_base, _g, transform_base, whole_u8_list_base, whole_x_idx_max, whole_x_idx_min, whole_y_idx); \
+  return status; \
+}
+
+#define TRANSFORM_COLUMN_ENTROPY_DELTA_GET_FRU64(_f, _a, _g) \
+u8 \
+_f(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx){ \
+  u8 status; \
+  \
+  status=transform_column_entropy_delta_get_fru64(_a, entropy_base, _g, transform_base, whole_u8_list_base, whole_x_idx_max, whole_x_idx_min, whole_y_idx); \
+  return status; \
+}
+
+#define TRANSFORM_COLUMN_KERNEL_IDX(_a, _g, _p) ((((_p)*(TRANSFORM_ALGO_STATUS_MAX+1U))+(_a))*(U32_BYTE_MAX+1U)+(_g))
+#define TRANSFORM_COLUMN_KERNEL_IDX_POST TRANSFORM_COLUMN_KERNEL_IDX(0U, 0U, 2U)
 #define TRANSFORM_DELTA_DELTA_FREQ_MAX (TRANSFORM_DELTA_DELTA_FREQ_POST-1U)
 #define TRANSFORM_DELTA_DELTA_FREQ_POST (1U<<TRANSFORM_DELTA_DELTA_IDX_BITS)
 #define TRANSFORM_DELTA_DELTA_IDX_BITS 4U
 #define TRANSFORM_E_FRACTION 0xB7E151628AED2A6AULL
+
+#define TRANSFORM_FREQ_DECREMENT(_l, _s, _w) \
+  if(!(_s)){ \
+    ((u8 *)(_l))[_w]--; \
+  }else if((_s)==U16_SIZE_LOG2){ \
+    ((u16 *)(_l))[_w]--; \
+  }else{ \
+    ((ULONG *)(_l))[_w]--; \
+  }
+
+#define TRANSFORM_FREQ_GET(_f, _l, _s, _w) \
+  if(!(_s)){ \
+    _f=((u8 *)(_l))[_w]; \
+  }else if((_s)==U16_SIZE_LOG2){ \
+    _f=((u16 *)(_l))[_w]; \
+  }else{ \
+    _f=((ULONG *)(_l))[_w]; \
+  }
+
+#define TRANSFORM_FREQ_INCREMENT(_l, _s, _w) \
+  if(!(_s)){ \
+    ((u8 *)(_l))[_w]++; \
+  }else if((_s)==U16_SIZE_LOG2){ \
+    ((u16 *)(_l))[_w]++; \
+  }else{ \
+    ((ULONG *)(_l))[_w]++; \
+  }
+
+#define TRANSFORM_FREQ_SET(_l, _s, _w, _f) \
+  if(!(_s)){ \
+    ((u8 *)(_l))[_w]=(u8)(_f); \
+  }else if((_s)==U16_SIZE_LOG2){ \
+    ((u16 *)(_l))[_w]=(u16)(_f); \
+  }else{ \
+    ((ULONG *)(_l))[_w]=(ULONG)(_f); \
+  }
+
+/*
+TRANSFORM_INLINE declares a function which the compiler must expand at every call, so that constant arguments can remove branches from its body.
+*/
+#ifdef __GNUC__
+  #define TRANSFORM_INLINE static inline __attribute__((always_inline))
+#else
+  #define TRANSFORM_INLINE static inline
+#endif
 #define TRANSFORM_LOG_CACHE_IDX_MAX U8_MAX
+#define TRANSFORM_LOOKUP_CACHE_SIGNATURE 0x0E7C2B95A4D6183FULL
 #define TRANSFORM_ROUNDING_STATUS_MAX 2U
 #define TRANSFORM_ROUNDING_STATUS_NEAREST_EVEN 0U
 #define TRANSFORM_ROUNDING_STATUS_NEGATIVE 1U
 #define TRANSFORM_ROUNDING_STATUS_POSITIVE 2U
+/*
+TRANSFORM_SCREEN_FRU128_ULP and TRANSFORM_SCREEN_FRU64_ULP are the values of the least significant bits of 64.64 and 32.32 fixed-points, respectively. TRANSFORM_SCREEN_ROUNDING is the maximum relative error of one IEEE754 double-precision operation rounded to nearest, i.e. 2^(-53).
+*/
+#define TRANSFORM_SCREEN_FRU128_ULP (1.0/18446744073709551616.0)
+#define TRANSFORM_SCREEN_FRU64_ULP (1.0/4294967296.0)
+#define TRANSFORM_SCREEN_ROUNDING (1.0/9007199254740992.0)
+#define TRANSFORM_STATE_HEADER_SIZE ((((ULONG)(sizeof(transform_state_t)))+U64_SIZE-1U)&~(ULONG)(U64_SIZE-1U))
+#define TRANSFORM_STATE_SIGNATURE 0x5D3B6A1F0C84E297ULL
+/*
+TRANSFORM_STATS_IDX_* are indexes into the instrumentation counters maintained when Transform is built with "-DTRANSFORM_STATS". Items ending in "NS" are nanoseconds summed over all threads. OFFSETS_NS includes LOGFREEDOM_MAX_NS. KERNEL_NS covers the row kernels, including conversion of their results to fakefloats. OUTPUT_NS covers rank and hit list updates and conversion of the results to discount nats. SATURATION_COUNT is the number of kernel calls, each covering at most one row, which reported fracterval underflow or overflow. SCREEN_NS covers the double-precision estimates made after transform_screen_init(), and SCREEN_SKIP_COUNT is the number of rows which they excluded from fracterval computation. WHOLE_UPDATE_COUNT is the number of (whole_old, whole) pairs consumed by rolling updates, of which WHOLE_UNCHANGED_COUNT were equal and therefore did nothing.
+*/
+#define TRANSFORM_STATS_IDX_FAKEFLOAT_COUNT 0U
+#define TRANSFORM_STATS_IDX_KERNEL_NS 1U
+#define TRANSFORM_STATS_IDX_LOGFREEDOM_MAX_NS 2U
+#define TRANSFORM_STATS_IDX_LOOKUP_NS 3U
+#define TRANSFORM_STATS_IDX_MAX 10U
+#define TRANSFORM_STATS_IDX_OFFSETS_NS 4U
+#define TRANSFORM_STATS_IDX_OUTPUT_NS 5U
+#define TRANSFORM_STATS_IDX_SATURATION_COUNT 6U
+#define TRANSFORM_STATS_IDX_SCREEN_NS 7U
+#define TRANSFORM_STATS_IDX_SCREEN_SKIP_COUNT 8U
+#define TRANSFORM_STATS_IDX_WHOLE_UNCHANGED_COUNT 9U
+#define TRANSFORM_STATS_IDX_WHOLE_UPDATE_COUNT 10U
+/*
+The following macros compile to nothing unless TRANSFORM_STATS is defined, so that instrumentation costs nothing in release builds. TRANSFORM_STATS_DECLARE() supplies its own semicolon so that it can appear among local variable declarations.
+*/
+#ifdef TRANSFORM_STATS
+  #define TRANSFORM_STATS_ADD(_i, _v) transform_stats_add(_i, (u64)(_v))
+  #define TRANSFORM_STATS_DECLARE(_n) u64 _n;
+  #define TRANSFORM_STATS_EQUAL_COUNT(_n, _a, _b) _n+=((_a)==(_b))
+  #define TRANSFORM_STATS_SET_ZERO(_n) _n=0
+  #define TRANSFORM_STATS_TIME_ADD(_i, _n) transform_stats_add(_i, transform_stats_time_get()-(_n))
+  #define TRANSFORM_STATS_TIME_GET(_n) _n=transform_stats_time_get()
+#else
+  #define TRANSFORM_STATS_ADD(_i, _v)
+  #define TRANSFORM_STATS_DECLARE(_n)
+  #define TRANSFORM_STATS_EQUAL_COUNT(_n, _a, _b)
+  #define TRANSFORM_STATS_SET_ZERO(_n)
+  #define TRANSFORM_STATS_TIME_ADD(_i, _n)
+  #define TRANSFORM_STATS_TIME_GET(_n)
+#endif
 
 TYPEDEF_START
+  double screen_error;
+  double screen_term_max;
+  double screen_width;
+  void (*column_kernel_base)(void);
   fru128 *entropy_delta_delta_fru128_list_base;
   fru64 *entropy_delta_delta_fru64_list_base;
   fru128 *entropy_delta_fru128_list_base;
   fru64 *entropy_delta_fru64_list_base;
-  ULONG **freq_list_base_list_base;  
+  void **freq_list_base_list_base;
   fru128 *log_delta_fru128_list_base;
   fru64 *log_delta_fru64_list_base;
   fru128 *log_factorial_fru128_list_base;
@@ -49,27 +165,65 @@ TYPEDEF_START
   ULONG **pop_list_base_list_base;
   ULONG *pop_list_best_base;
   ULONG *pop_list_best_best_base;
+  double *screen_double_list_base;
+  u8 *whole_transpose_u8_list_base;
   ULONG freq_list_idx_max;
   u8 algo_status;
+  u8 clone_status;
+  u8 freq_size_log2;
   u8 optimize_status;
+  u8 screen_status;
 TYPEDEF_END(transform_t)
 
+/*
+transform_hit_t is a record describing one window which crossed a threshold set by transform_hit_init(). All fields are host-endian. x_idx and y_idx are the coordinates of the upper left corner of the window. entropy_min_u32 and entropy_max_u32 are fakefloats which bound its entropy from below and above, respectively, in the same units as those written to the fakefloat list.
+*/
+TYPEDEF_START
+  u64 x_idx;
+  u64 y_idx;
+  u32 entropy_min_u32;
+  u32 entropy_max_u32;
+TYPEDEF_END(transform_hit_t)
+
 TYPEDEF_START
   fru128 window_bias_fru128;
   fru128 window_max_max_fru128;
+  u128 hit_max_threshold_u128;
+  u128 hit_min_threshold_u128;
   u128 max_max_u128;
   u128 min_min_u128;
+  u128 rank_max_threshold_u128;
+  u128 rank_min_threshold_u128;
   fru64 window_bias_fru64;
   fru64 window_max_max_fru64;
+  u64 hit_max_threshold_u64;
+  u64 hit_min_threshold_u64;
   u64 max_max_u64;
   u64 min_min_u64;
+  u64 rank_max_threshold_u64;
+  u64 rank_min_threshold_u64;
   u32 *fakefloat_list_base;
+  transform_hit_t *hit_list_base;
+  fru128 *rank_max_fru128_list_base;
+  fru64 *rank_max_fru64_list_base;
+  ULONG *rank_max_xy_list_base;
+  fru128 *rank_min_fru128_list_base;
+  fru64 *rank_min_fru64_list_base;
+  ULONG *rank_min_xy_list_base;
+  fru128 *rank_row_fru128_list_base;
+  fru64 *rank_row_fru64_list_base;
   ULONG fakefloat_x_idx_max;
   ULONG fakefloat_y_idx_max;
+  ULONG fakefloat_y_idx_min;
+  ULONG hit_count;
+  ULONG hit_idx_max;
   ULONG max_max_x_idx;
   ULONG max_max_y_idx;
   ULONG min_min_x_idx;
   ULONG min_min_y_idx;
+  ULONG rank_idx_max_max;
+  ULONG rank_max_count;
+  ULONG rank_min_count;
   ULONG whole_count;
   ULONG whole_x_idx_max;
   ULONG whole_x_idx_post;
@@ -82,6 +236,109 @@ TYPEDEF_START
   u32 whole_max_max;
   u8 granularity;
   u8 discount_status;
+  u8 hit_fail_status;
+  u8 hit_max_status;
+  u8 hit_min_status;
   u8 precise_status;
+  u8 rank_overlap_status;
+  u8 rank_status;
   u8 rounding_status;
 TYPEDEF_END(entropy_t)
+typedef u8 (*transform_column_kernel_t)(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+
+/*
+transform_logfreedom_memo_t is one record of a memo file written by transform_logfreedom_memo_append(), which consists of any number of them. build_id is TRANSFORM_BUILD_ID, so that records from other builds are ignored. lmd2 is the hash of the record with lmd2 itself set to zero. All fields are host-endian.
+*/
+TYPEDEF_START
+  fru128 logfreedom_max;
+  u64 build_id;
+  u64 lmd2;
+  u64 whole_idx_max;
+  u64 whole_max_max;
+TYPEDEF_END(transform_logfreedom_memo_t)
+
+/*
+transform_lookup_cache_t is the header of a lookup cache file written by transform_lookup_cache_get(). It occupies exactly the space of one fru128, so that the fru128 at index N of the file is the unshifted output of FRU128_LOG_U64() for N, for all nonzero N up to and including log_idx_max. The hash covers only those (fru128)s. All fields are host-endian.
+*/
+TYPEDEF_START
+  u64 fru128_build_id;
+  u64 lmd2;
+  u64 log_idx_max;
+  u64 signature;
+TYPEDEF_END(transform_lookup_cache_t)
+
+/*
+transform_lookup_thread_t is the parameter block of each thread which computes logs in transform_lookup_log_list_fill().
+*/
+TYPEDEF_START
+  fru128 *log_list_base;
+  ULONG log_idx_max;
+  ULONG log_idx_min;
+  u8 status;
+TYPEDEF_END(transform_lookup_thread_t)
+
+/*
+transform_state_t is the header of a checkpoint produced by transform_state_export(). The lists which it describes follow it immediately, in the order documented there. All fields are host-endian, and ULONGs are stored as (u64)s so that the header layout is independent of ULONG_SIZE_LOG2, although the payload is not.
+*/
+TYPEDEF_START
+  u128 max_max_u128;
+  u128 min_min_u128;
+  u128 rank_max_threshold_u128;
+  u128 rank_min_threshold_u128;
+  u64 entropy_y_idx_post;
+  u64 freq_list_idx_max;
+  u64 lmd2;
+  u64 max_max_u64;
+  u64 max_max_x_idx;
+  u64 max_max_y_idx;
+  u64 min_min_u64;
+  u64 min_min_x_idx;
+  u64 min_min_y_idx;
+  u64 rank_idx_max_max;
+  u64 rank_max_count;
+  u64 rank_max_threshold_u64;
+  u64 rank_min_count;
+  u64 rank_min_threshold_u64;
+  u64 signature;
+  u64 size;
+  u64 whole_x_idx_max;
+  u64 window_x_idx_max;
+  u64 window_y_idx_max;
+  u32 whole_max_max;
+  u8 algo_status;
+  u8 discount_status;
+  u8 freq_size_log2;
+  u8 granularity;
+  u8 optimize_status;
+  u8 precise_status;
+  u8 rank_overlap_status;
+  u8 rank_status;
+  u8 rounding_status;
+  u8 ulong_size_log2;
+TYPEDEF_END(transform_state_t)
+
+TYPEDEF_START
+  fru128 entropy_start_fru128;
+  fru128 entropy_sum_fru128;
+  u128 ceiling_u128;
+  u128 delta_max_u128;
+  u128 max_max_u128;
+  u128 min_min_u128;
+  fru64 entropy_start_fru64;
+  fru64 entropy_sum_fru64;
+  u64 ceiling_u64;
+  u64 delta_max_u64;
+  u64 max_max_u64;
+  u64 min_min_u64;
+  thread_barrier_t *barrier_base;
+  entropy_t *entropy_base;
+  void *thread_list_base;
+  transform_t *transform_base;
+  u8 *whole_u8_list_base;
+  ULONG max_max_x_idx;
+  ULONG min_min_x_idx;
+  ULONG thread_idx;
+  ULONG whole_y_idx_max;
+  ULONG whole_y_idx_min;
+  u8 status;
+TYPEDEF_END(transform_thread_t)
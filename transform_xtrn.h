@@ -19,27 +19,110 @@ You should have received a copy of the GNU Limited General Public
 License version 3 along with the Widebandit Library (filename
 "COPYING"). If not, see http://www.gnu.org/licenses/ .
 */
+extern void transform_clone(entropy_t *entropy_base, entropy_t **entropy_clone_base_base, transform_t *transform_base, transform_t **transform_clone_base_base);
+extern u8 transform_clone_reset(entropy_t *entropy_base, transform_t *transform_base, ULONG whole_y_idx_max);
+extern void transform_clone_resize(entropy_t *entropy_base, entropy_t **entropy_clone_base_base, transform_t *transform_base, transform_t **transform_clone_base_base, ULONG window_y_idx_max);
+extern transform_column_kernel_t transform_column_kernel_get(u8 algo_status, u8 granularity, u8 precise_status);
+extern u8 transform_column_lists_malloc(entropy_t *entropy_base, transform_t *transform_base);
 extern u8 transform_delta_delta_list_init(fru128 **entropy_delta_delta_fru128_list_base_base, fru64 **entropy_delta_delta_fru64_list_base_base, u8 precise_status);
 extern u8 transform_dispatch(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base);
+extern void *transform_dispatch_band(void *thread_base);
+extern u8 transform_dispatch_banded(entropy_t *entropy_base, ULONG thread_idx_max, transform_t *transform_base, u8 *whole_u8_list_base);
+extern u8 transform_dispatch_row_span(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_y_idx_max, ULONG whole_y_idx_min);
+extern u8 transform_dispatch_stream(ULONG buffer_y_idx_min, entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_y_idx_max, ULONG whole_y_idx_min);
+extern u8 transform_dispatch_sweep(entropy_t **entropy_base_list_base, ULONG entropy_list_idx_max, transform_t *transform_base, u8 *whole_u8_list_base);
+extern void *transform_dispatch_thread(void *thread_base);
+extern u8 transform_dispatch_threaded(entropy_t *entropy_base, ULONG thread_idx_max, transform_t *transform_base, u8 *whole_u8_list_base);
+extern entropy_t *transform_entropy_clone(entropy_t *entropy_base, transform_t *transform_base, ULONG window_x_idx_max);
+extern u8 transform_entropy_delta_list_line_entropy_get_fru128(entropy_t *entropy_base, ULONG entropy_x_idx_max, ULONG entropy_x_idx_min, transform_thread_t *thread_base, transform_t *transform_base, ULONG whole_y_idx);
+extern u8 transform_entropy_delta_list_line_entropy_get_fru64(entropy_t *entropy_base, ULONG entropy_x_idx_max, ULONG entropy_x_idx_min, transform_thread_t *thread_base, transform_t *transform_base, ULONG whole_y_idx);
+extern u8 transform_entropy_delta_list_stripe_entropy_get_fru128(entropy_t *entropy_base, ULONG entropy_x_idx_max, ULONG entropy_x_idx_min, transform_thread_t *thread_base, transform_t *transform_base, ULONG whole_y_idx);
+extern u8 transform_entropy_delta_list_stripe_entropy_get_fru64(entropy_t *entropy_base, ULONG entropy_x_idx_max, ULONG entropy_x_idx_min, transform_thread_t *thread_base, transform_t *transform_base, ULONG whole_y_idx);
+extern u8 transform_entropy_delta_list_stripe_sum_get_fru128(entropy_t *entropy_base, ULONG entropy_x_idx_max, ULONG entropy_x_idx_min, transform_thread_t *thread_base, transform_t *transform_base);
+extern u8 transform_entropy_delta_list_stripe_sum_get_fru64(entropy_t *entropy_base, ULONG entropy_x_idx_max, ULONG entropy_x_idx_min, transform_thread_t *thread_base, transform_t *transform_base);
 extern u8 transform_entropy_to_discount(entropy_t *entropy_base);
 extern u32 *transform_fakefloat_list_malloc(ULONG *fakefloat_list_size_base, ULONG whole_x_idx_max, ULONG whole_y_idx_max, ULONG window_x_idx_max, ULONG window_y_idx_max);
 extern void *transform_free(void *base);
 extern void transform_free_all(entropy_t **entropy_base_base, transform_t **transform_base_base);
-extern u8 transform_freq_list_entropy_get_fru128(u8 algo_status, fru128 *entropy_fru128_base, ULONG *freq_list_base, fru128 *lookup_list_base, ULONG *pop_list_base, ULONG whole_idx_max, u32 whole_max_max);
-extern u8 transform_freq_list_entropy_get_fru64(u8 algo_status, fru64 *entropy_fru64_base, ULONG *freq_list_base, fru64 *lookup_list_base, ULONG *pop_list_base, ULONG whole_idx_max, u32 whole_max_max);
+extern u8 transform_freq_list_entropy_get_fru128(u8 algo_status, fru128 *entropy_fru128_base, void *freq_list_base, u8 freq_size_log2, fru128 *lookup_list_base, ULONG *pop_list_base, ULONG whole_idx_max, u32 whole_max_max);
+extern u8 transform_freq_list_entropy_get_fru64(u8 algo_status, fru64 *entropy_fru64_base, void *freq_list_base, u8 freq_size_log2, fru64 *lookup_list_base, ULONG *pop_list_base, ULONG whole_idx_max, u32 whole_max_max);
+extern void transform_freq_list_zero(void *freq_list_base, u8 freq_size_log2, u32 whole_max_max);
+extern u8 transform_hit_init(entropy_t *entropy_base, u8 max_status, u128 threshold_u128, u64 threshold_u64);
+extern u8 transform_hit_row_update(entropy_t *entropy_base, ULONG whole_y_idx);
 extern u8 transform_init(u32 build_break_count, u32 build_feature_count);
-extern u8 transform_logfreedom_max_approximate(entropy_t *entropy_base, u32 iteration_max, fru128 *logfreedom_max_base, transform_t *transform_base);
+extern u8 transform_logfreedom_max_approximate(u32 iteration_max, fru128 *logfreedom_max_base, transform_t *transform_base, ULONG whole_idx_max, u32 whole_max_max);
+extern u8 transform_logfreedom_max_get(fru128 *logfreedom_max_base, transform_t *transform_base, ULONG whole_idx_max, u32 whole_max_max);
+extern void transform_logfreedom_memo_append(fru128 logfreedom_max, ULONG whole_idx_max, u32 whole_max_max);
+extern u8 transform_logfreedom_memo_fill(ULONG whole_idx_max_idx_max, ULONG *whole_idx_max_list_base, ULONG whole_max_max_idx_max, ULONG *whole_max_max_list_base);
+extern u8 transform_logfreedom_memo_find(fru128 *logfreedom_max_base, ULONG whole_idx_max, u32 whole_max_max);
+extern void transform_logfreedom_memo_set(char *pathname_base);
+extern void *transform_lookup_cache_free(int descriptor, u64 file_size, fru128 *log_list_base, void *mem_map_base);
+extern fru128 *transform_lookup_cache_get(int *descriptor_base, u64 *file_size_base, ULONG log_idx_max, void **mem_map_base_base);
+extern void transform_lookup_cache_set(char *pathname_base);
 extern void transform_lookup_lists_free(transform_t *transform_base);
 extern u8 transform_lookup_lists_init(entropy_t *entropy_base, transform_t *transform_base);
+extern u8 transform_lookup_log_list_fill(fru128 *log_list_base, ULONG log_idx_max, ULONG log_idx_min, ULONG thread_idx_max);
+extern void *transform_lookup_log_list_fill_thread(void *thread_base);
+extern void transform_lookup_threads_set(ULONG thread_idx_max);
 extern void transform_malloc(u8 algo_status, u8 discount_status, entropy_t **entropy_base_base, u32 *fakefloat_list_base, u8 granularity, u8 optimize_status, u8 precise_status, u8 rounding_status, transform_t **transform_base_base, u32 whole_max_max, ULONG whole_x_idx_max, ULONG whole_y_idx_max, ULONG window_x_idx_max, ULONG window_y_idx_max);
-extern void transform_pop_list_fill(ULONG *freq_list_base, ULONG *pop_list_base, ULONG whole_idx_max, u32 whole_max_max);
+extern u8 transform_pop_list_entropy_get_fru128(u8 algo_status, fru128 *entropy_fru128_base, fru128 *lookup_list_base, ULONG *pop_list_base, ULONG whole_idx_max);
+extern u8 transform_pop_list_entropy_get_fru64(u8 algo_status, fru64 *entropy_fru64_base, fru64 *lookup_list_base, ULONG *pop_list_base, ULONG whole_idx_max);
+extern void transform_pop_list_fill(void *freq_list_base, u8 freq_size_log2, ULONG *pop_list_base, ULONG whole_idx_max, u32 whole_max_max);
 extern u8 transform_pop_list_logfreedom_get(fru128 *log_factorial_list_base, fru128 *logfreedom_base, ULONG *pop_list_base, ULONG whole_idx_max, u32 whole_max_max);
 extern ULONG *transform_pop_list_malloc(ULONG whole_idx_max);
+extern u8 transform_rank_init(entropy_t *entropy_base, u8 overlap_status, ULONG rank_idx_max_max);
+extern void transform_rank_insert_fru128(entropy_t *entropy_base, fru128 entropy, u8 max_status, ULONG entropy_x_idx, ULONG entropy_y_idx);
+extern void transform_rank_insert_fru64(entropy_t *entropy_base, fru64 entropy, u8 max_status, ULONG entropy_x_idx, ULONG entropy_y_idx);
+extern void transform_rank_list_merge(entropy_t *entropy_base, entropy_t *entropy_peer_base);
+extern void transform_rank_row_update(entropy_t *entropy_base, ULONG whole_y_idx);
+extern double transform_screen_fru128_to_double(double *error_base, fru128 value);
+extern double transform_screen_fru64_to_double(double *error_base, fru64 value);
+extern u8 transform_screen_init(entropy_t *entropy_base, transform_t *transform_base);
+extern u8 transform_state_check(ULONG *entropy_y_idx_post_base, ULONG state_size, u8 *state_u8_list_base, u32 *whole_max_max_base);
+extern void transform_state_export(entropy_t *entropy_base, ULONG entropy_y_idx_post, ULONG state_size, u8 *state_u8_list_base, transform_t *transform_base);
+extern u8 transform_state_import(entropy_t *entropy_base, ULONG *entropy_y_idx_post_base, ULONG state_size, u8 *state_u8_list_base, transform_t *transform_base);
+extern void transform_state_lists_copy(entropy_t *entropy_base, u8 export_status, u8 *state_u8_list_base, transform_t *transform_base);
+extern u64 transform_state_lmd2_get(ULONG state_size, u8 *state_u8_list_base);
+extern u8 transform_state_parameters_check(u8 algo_status, u8 discount_status, u8 granularity, u8 optimize_status, u8 precise_status, ULONG rank_idx_max_max, u8 rank_overlap_status, u8 rank_status, u8 rounding_status, u8 *state_u8_list_base, ULONG whole_x_idx_max, ULONG window_x_idx_max, ULONG window_y_idx_max);
+extern ULONG transform_state_size_get(entropy_t *entropy_base, transform_t *transform_base);
+#ifdef TRANSFORM_STATS
+  extern void transform_stats_add(u8 stats_idx, u64 value);
+  extern u64 transform_stats_get(char **name_base_base, u8 stats_idx);
+  extern u64 transform_stats_time_get(void);
+#endif
+extern u8 transform_transpose_init(entropy_t *entropy_base, ULONG tile_idx_max, transform_t *transform_base, u8 *whole_u8_list_base);
 extern void transform_ulong_list_zero(ULONG ulong_idx_max, ULONG *ulong_list_base);
+extern u8 transform_whole_list_column_entropy_delta_get_fru128(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru128_agnentropy_u16(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru128_agnentropy_u24(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru128_agnentropy_u32(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru128_agnentropy_u8(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru128_logfreedom_u16(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru128_logfreedom_u24(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru128_logfreedom_u32(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru128_logfreedom_u8(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru128_shannon_u16(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru128_shannon_u24(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru128_shannon_u32(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru128_shannon_u8(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru64(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru64_agnentropy_u16(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru64_agnentropy_u24(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru64_agnentropy_u32(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru64_agnentropy_u8(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru64_logfreedom_u16(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru64_logfreedom_u24(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru64_logfreedom_u32(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru64_logfreedom_u8(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru64_shannon_u16(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru64_shannon_u24(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru64_shannon_u32(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
+extern u8 transform_whole_list_column_entropy_delta_get_fru64_shannon_u8(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_max, ULONG whole_x_idx_min, ULONG whole_y_idx);
 extern u8 transform_whole_list_line_entropy_delta_get_fru128(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_y_idx);
 extern u8 transform_whole_list_line_entropy_delta_get_fru64(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_y_idx);
 extern u8 transform_whole_list_line_entropy_get_fru128(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_y_idx);
 extern u8 transform_whole_list_line_entropy_get_fru64(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_y_idx);
+extern void transform_whole_list_line_entropy_screen(entropy_t *entropy_base, double *entropy_max_base, double *entropy_min_base, double *error_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_y_idx);
 extern u8 transform_whole_list_window_entropy_get_fru128(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_min, ULONG whole_y_idx_min);
 extern u8 transform_whole_list_window_entropy_get_fru64(entropy_t *entropy_base, transform_t *transform_base, u8 *whole_u8_list_base, ULONG whole_x_idx_min, ULONG whole_y_idx_min);
 extern u8 transform_window_entropy_offsets_get(entropy_t *entropy_base, transform_t *transform_base);